@@ -18,6 +18,12 @@
     #define NOTE_ARDUINO_NO_DEPRECATED_ATTR
 #endif // __GNUC__ || __clang__
 
+// The number of ports, or pairs of transaction pins, for which an interface
+// may be created at once, each serving every Notecard attached to it
+#ifndef NOTE_ARDUINO_MAX_INTERFACES
+    #define NOTE_ARDUINO_MAX_INTERFACES 2
+#endif
+
 // Switches for enabling/disabling features
 #if defined(ARDUINO_ARCH_AVR) || defined(ARDUINO_ARCH_MEGAAVR) || defined(ARDUINO_ARCH_STM32) || defined(ARDUINO_ARCH_NRF52) || (defined(ARDUINO_ARCH_RP2040) && !defined(ARDUINO_ARCH_MBED))
     #define NOTE_ARDUINO_SOFTWARE_SERIAL_SUPPORT
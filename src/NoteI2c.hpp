@@ -43,6 +43,25 @@ public:
     /**************************************************************************/
     virtual bool reset(uint16_t device_address) = 0;
 
+    /**************************************************************************/
+    /*!
+        @brief  Enable or disable block transfers
+
+        When enabled, `receive()` issues each read request with a repeated
+        start, instead of a stop condition followed by a fixed 2ms delay.
+        The response is still copied out of the bus driver's receive buffer
+        one byte at a time, because the Arduino cores offer no common bulk
+        read.
+
+        @param[in] enable
+                `true` to enable block transfers, `false` to use byte-wise
+                transfers.
+        @returns `true` if the implementation supports block transfers,
+                otherwise `false` (the default).
+    */
+    /**************************************************************************/
+    virtual bool setBlockTransfer(bool enable) { (void)enable; return false; }
+
     /**************************************************************************/
     /*!
         @brief  The Serial-over-I2C protocol transmit callback implementation
@@ -95,8 +114,10 @@ public:
     @brief Creates a NoteI2c instance
 
     Helper function to abstract, create and maintain a single instance
-    of the NoteI2c interface implementation, as required by the underlying
-    `note-c` library.
+    of the NoteI2c interface implementation per I2C port, as required by the
+    underlying `note-c` library. Up to `NOTE_ARDUINO_MAX_INTERFACES` ports may
+    be in use at once, beyond which `nullptr` is returned. Passing `nullptr`
+    deletes every instance.
 
     @param[in] i2c_parameters
                Pointer to the parameters required to instantiate
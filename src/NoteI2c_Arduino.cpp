@@ -2,28 +2,48 @@
 
 #include "Notecard.h"
 
+#ifdef NOTE_C_THREAD_CONTEXT
+#include <mutex>
+#endif
+
 #if defined(NOTE_C_LOW_MEM)
 static const char *i2cerr = "{io}{i2c}";
 #endif
 
-// Singleton instance of the NoteI2c_Arduino class
+// Singleton instances of the NoteI2c_Arduino class, one per I2C port
 namespace instance {
-    inline NoteI2c* & note_i2c (void) {
-        static NoteI2c* note_i2c = nullptr;
+    struct NoteI2cPort {
+        const void * port;
+        NoteI2c * note_i2c;
+    };
+    inline NoteI2cPort * note_i2c (void) {
+        static NoteI2cPort note_i2c[NOTE_ARDUINO_MAX_INTERFACES] = {};
         return note_i2c;
     }
+#ifdef NOTE_C_THREAD_CONTEXT
+    inline std::mutex & note_i2c_lock (void) {
+        static std::mutex note_i2c_lock;
+        return note_i2c_lock;
+    }
+#endif
 };
 
 NoteI2c *
 make_note_i2c (
     nullptr_t
 ) {
-    NoteI2c* & note_i2c = instance::note_i2c();
-    if (note_i2c) {
-        delete note_i2c;
-        note_i2c = nullptr;
+#ifdef NOTE_C_THREAD_CONTEXT
+    std::lock_guard<std::mutex> lock(instance::note_i2c_lock());
+#endif
+    instance::NoteI2cPort * const note_i2c = instance::note_i2c();
+    for (size_t i = 0 ; i < NOTE_ARDUINO_MAX_INTERFACES ; ++i) {
+        if (note_i2c[i].note_i2c) {
+            delete note_i2c[i].note_i2c;
+            note_i2c[i].note_i2c = nullptr;
+            note_i2c[i].port = nullptr;
+        }
     }
-    return note_i2c;
+    return nullptr;
 }
 
 template <typename T>
@@ -32,19 +52,36 @@ make_note_i2c (
     T & i2c_parameters_
 )
 {
-    NoteI2c* & note_i2c = instance::note_i2c();
-    if (!note_i2c) {
-        note_i2c = new NoteI2c_Arduino(i2c_parameters_);
+#ifdef NOTE_C_THREAD_CONTEXT
+    std::lock_guard<std::mutex> lock(instance::note_i2c_lock());
+#endif
+    instance::NoteI2cPort * const note_i2c = instance::note_i2c();
+    instance::NoteI2cPort * unused = nullptr;
+    for (size_t i = 0 ; i < NOTE_ARDUINO_MAX_INTERFACES ; ++i) {
+        if (note_i2c[i].note_i2c && note_i2c[i].port == &i2c_parameters_) {
+            return note_i2c[i].note_i2c;
+        } else if (!note_i2c[i].note_i2c && !unused) {
+            unused = &note_i2c[i];
+        }
+    }
+
+    // Each port gets its own instance, up to `NOTE_ARDUINO_MAX_INTERFACES`
+    NoteI2c * result = nullptr;
+    if (unused) {
+        unused->note_i2c = new NoteI2c_Arduino(i2c_parameters_);
+        unused->port = &i2c_parameters_;
+        result = unused->note_i2c;
     }
 
-    return note_i2c;
+    return result;
 }
 
 NoteI2c_Arduino::NoteI2c_Arduino
 (
     TwoWire & i2c_bus_
 ) :
-    _i2cPort(i2c_bus_)
+    _i2cPort(i2c_bus_),
+    _blockTransfer(false)
 {
     _i2cPort.begin();
 }
@@ -77,7 +114,12 @@ NoteI2c_Arduino::receive (
         _i2cPort.beginTransmission(static_cast<uint8_t>(device_address_));
         _i2cPort.write(static_cast<uint8_t>(0));
         _i2cPort.write(static_cast<uint8_t>(requested_byte_count_));
-        transmission_error = _i2cPort.endTransmission();
+        if (_blockTransfer) {
+            // Hold the bus with a repeated start rather than releasing it
+            transmission_error = _i2cPort.endTransmission(false);
+        } else {
+            transmission_error = _i2cPort.endTransmission();
+        }
 
         switch (transmission_error) {
         case 0:
@@ -107,7 +149,9 @@ NoteI2c_Arduino::receive (
         if (!transmission_error) {
             // Delay briefly ensuring that the Notecard can
             // deliver the data in real-time to the I2C ISR
-            NoteDelayMs(2);
+            if (!_blockTransfer) {
+                NoteDelayMs(2);
+            }
 
             const int request_length = requested_byte_count_ + NoteI2c::REQUEST_HEADER_SIZE;
             const int response_length = _i2cPort.requestFrom((int)device_address_, request_length);
@@ -162,6 +206,15 @@ NoteI2c_Arduino::reset (
     return true;
 }
 
+bool
+NoteI2c_Arduino::setBlockTransfer (
+    bool enable_
+)
+{
+    _blockTransfer = enable_;
+    return true;
+}
+
 const char *
 NoteI2c_Arduino::transmit (
     uint16_t device_address_,
@@ -18,10 +18,12 @@ public:
     ~NoteI2c_Arduino(void);
     const char * receive(uint16_t device_address, uint8_t * buffer, uint16_t requested_byte_count, uint32_t * available) override;
     bool reset(uint16_t device_address) override;
+    bool setBlockTransfer(bool enable) override;
     const char * transmit(uint16_t device_address, uint8_t * buffer, uint16_t size) override;
 
 private:
     TwoWire & _i2cPort;
+    bool _blockTransfer;
 };
 
 #endif // NOTE_I2C_ARDUINO_HPP
@@ -0,0 +1,130 @@
+#include "NoteRing.hpp"
+
+#include <string.h>
+
+// The head and tail indices are single bytes, so they are read and written
+// atomically on every supported architecture. The acquire/release ordering
+// ensures a record is copied before it is published by the producer, and
+// read before its slot is released by the consumer.
+#define RING_LOAD(index) __atomic_load_n(&(index), __ATOMIC_ACQUIRE)
+#define RING_STORE(index, value) __atomic_store_n(&(index), (value), __ATOMIC_RELEASE)
+
+NoteRing::NoteRing
+(
+    uint8_t * storage_,
+    size_t recordSize_,
+    uint8_t slots_
+) :
+    _storage(storage_),
+    _recordSize(recordSize_),
+    _slots(slots_),
+    _head(0),
+    _tail(0),
+    _highWatermark(0),
+    _overflows(0)
+{
+}
+
+size_t
+NoteRing::capacity (
+    void
+) const
+{
+    return (_slots ? (_slots - 1) : 0);
+}
+
+void
+NoteRing::consume (
+    size_t records_
+)
+{
+    const size_t waiting = count();
+    if (records_ > waiting) {
+        records_ = waiting;
+    }
+    const uint8_t tail = _tail;
+    RING_STORE(_tail, static_cast<uint8_t>((tail + records_) % _slots));
+}
+
+size_t
+NoteRing::count (
+    void
+) const
+{
+    if (!_slots) {
+        return 0;
+    }
+    const uint8_t head = RING_LOAD(_head);
+    const uint8_t tail = RING_LOAD(_tail);
+    return ((head + _slots - tail) % _slots);
+}
+
+size_t
+NoteRing::highWatermark (
+    void
+) const
+{
+    return RING_LOAD(_highWatermark);
+}
+
+uint32_t
+NoteRing::overflows (
+    void
+) const
+{
+    // The counter may be wider than a single access, so read it until two
+    // consecutive reads agree, in case the producer interrupted the first
+    uint32_t overflows;
+    do {
+        overflows = _overflows;
+    } while (overflows != _overflows);
+    return overflows;
+}
+
+const void *
+NoteRing::peek (
+    size_t index_
+) const
+{
+    if (index_ >= count()) {
+        return nullptr;
+    }
+    const size_t slot = ((_tail + index_) % _slots);
+    return (_storage + (slot * _recordSize));
+}
+
+bool
+NoteRing::push (
+    const void * record_
+)
+{
+    if (!_slots) {
+        return false;
+    }
+
+    const uint8_t head = _head;
+    const uint8_t next = static_cast<uint8_t>((head + 1) % _slots);
+    const uint8_t tail = RING_LOAD(_tail);
+    if (next == tail) {
+        _overflows = (_overflows + 1);
+        return false;
+    }
+
+    ::memcpy(_storage + (head * _recordSize), record_, _recordSize);
+    RING_STORE(_head, next);
+
+    const uint8_t waiting = static_cast<uint8_t>((next + _slots - tail) % _slots);
+    if (waiting > _highWatermark) {
+        RING_STORE(_highWatermark, waiting);
+    }
+
+    return true;
+}
+
+size_t
+NoteRing::recordSize (
+    void
+) const
+{
+    return _recordSize;
+}
@@ -0,0 +1,148 @@
+#ifndef NOTE_RING_HPP
+#define NOTE_RING_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**************************************************************************/
+/*!
+    @brief  A fixed-capacity ring of fixed-size records, which a single
+            producer may fill from interrupt context while a single consumer
+            drains it.
+
+    Pushing a record never allocates memory, takes a lock or waits, so it is
+    safe to call from an interrupt service routine. The producer only ever
+    writes the head index and the consumer only ever writes the tail index,
+    so neither side needs to disable interrupts. A record that does not fit
+    is dropped and counted as an overflow.
+
+    @see NoteRingBuffer to allocate the storage alongside the ring.
+*/
+/**************************************************************************/
+class NoteRing
+{
+public:
+
+    /**************************************************************************/
+    /*!
+        @brief  Construct a ring over caller-provided storage.
+
+        @param[in] storage
+                Storage for the records, which must be at least
+                `recordSize * slots` bytes long and outlive the ring.
+        @param[in] recordSize
+                The size of each record, in bytes.
+        @param[in] slots
+                The number of records the storage can hold. One slot is
+                always left empty, so the capacity is `slots - 1`.
+    */
+    /**************************************************************************/
+    NoteRing(uint8_t * storage, size_t recordSize, uint8_t slots);
+
+    /**************************************************************************/
+    /*!
+        @brief  The number of records the ring can hold.
+    */
+    /**************************************************************************/
+    size_t capacity(void) const;
+
+    /**************************************************************************/
+    /*!
+        @brief  Release records once they have been handled (consumer only).
+
+        @param[in] records
+                The number of records, from the oldest, to release.
+    */
+    /**************************************************************************/
+    void consume(size_t records = 1);
+
+    /**************************************************************************/
+    /*!
+        @brief  The number of records waiting to be consumed.
+    */
+    /**************************************************************************/
+    size_t count(void) const;
+
+    /**************************************************************************/
+    /*!
+        @brief  The largest number of records that have ever been waiting at
+                once.
+    */
+    /**************************************************************************/
+    size_t highWatermark(void) const;
+
+    /**************************************************************************/
+    /*!
+        @brief  The number of records dropped because the ring was full.
+    */
+    /**************************************************************************/
+    uint32_t overflows(void) const;
+
+    /**************************************************************************/
+    /*!
+        @brief  Look at a waiting record without consuming it (consumer only).
+
+        @param[in] index
+                The position of the record, where zero (0) is the oldest.
+
+        @returns A pointer to the record, or `nullptr` if fewer than
+                 `index + 1` records are waiting.
+    */
+    /**************************************************************************/
+    const void * peek(size_t index = 0) const;
+
+    /**************************************************************************/
+    /*!
+        @brief  Add a record to the ring (producer only, interrupt safe).
+
+        @param[in] record
+                The record to copy into the ring, which must be
+                `recordSize()` bytes long.
+
+        @returns `true` if the record was added, or `false` if the ring was
+                 full and the record was dropped.
+    */
+    /**************************************************************************/
+    bool push(const void * record);
+
+    /**************************************************************************/
+    /*!
+        @brief  The size of each record, in bytes.
+    */
+    /**************************************************************************/
+    size_t recordSize(void) const;
+
+private:
+    uint8_t * const _storage;
+    const size_t _recordSize;
+    const uint8_t _slots;
+    uint8_t _head;           // Written by the producer only
+    uint8_t _tail;           // Written by the consumer only
+    uint8_t _highWatermark;  // Written by the producer only
+    volatile uint32_t _overflows;  // Written by the producer only
+};
+
+/**************************************************************************/
+/*!
+    @brief  A `NoteRing` with its own storage.
+
+    @tparam RECORD_SIZE
+            The size of each record, in bytes.
+    @tparam CAPACITY
+            The number of records the ring can hold, at most 254.
+*/
+/**************************************************************************/
+template <size_t RECORD_SIZE, size_t CAPACITY>
+class NoteRingBuffer : public NoteRing
+{
+    static_assert(RECORD_SIZE > 0, "records must not be empty");
+    static_assert(CAPACITY > 0 && CAPACITY < 255, "capacity must be between 1 and 254 records");
+
+public:
+    NoteRingBuffer(void) : NoteRing(_records, RECORD_SIZE, (CAPACITY + 1)) {}
+
+private:
+    uint8_t _records[RECORD_SIZE * (CAPACITY + 1)];
+};
+
+#endif // NOTE_RING_HPP
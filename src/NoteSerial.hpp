@@ -18,6 +18,18 @@ public:
     /**************************************************************************/
     virtual size_t available(void) = 0;
 
+    /**************************************************************************/
+    /*!
+        @brief  Determines if the Notecard is ready to accept more data.
+
+        Consulted before each segment of a request is transmitted when flow
+        control has been enabled with `setFlowControl()`.
+
+        @return `true` if data may be sent (the default), otherwise `false`.
+    */
+    /**************************************************************************/
+    virtual bool clearToSend(void) { return true; }
+
     /**************************************************************************/
     /*!
         @brief  Read a byte from the Notecard Serial port.
@@ -26,6 +38,39 @@ public:
     /**************************************************************************/
     virtual char receive(void) = 0;
 
+    /**************************************************************************/
+    /*!
+        @brief  Read all available bytes from the Notecard Serial port.
+
+        Copies every byte that has already arrived into the buffer, without
+        waiting for more, stopping after the end-of-packet character. The
+        default implementation falls back to `available()` and `receive()`.
+
+        The saving is in note-c, which makes a single call through its hooks
+        for each burst rather than two for each byte. An implementation may
+        still read its port a byte at a time, as the Arduino one does.
+
+        @param    buffer
+                  A buffer to hold the bytes read.
+        @param    size
+                  The size of the buffer in bytes.
+        @param    eop
+                  The end-of-packet character.
+        @return The number of bytes read.
+    */
+    /**************************************************************************/
+    virtual size_t receiveBulk(uint8_t * buffer, size_t size, char eop) {
+        size_t received = 0;
+        while (received < size && available()) {
+            const char ch = receive();
+            buffer[received++] = ch;
+            if (ch == eop) {
+                break;
+            }
+        }
+        return received;
+    }
+
     /**************************************************************************/
     /*!
         @brief  Resets the serial port.
@@ -34,6 +79,24 @@ public:
     /**************************************************************************/
     virtual bool reset(void) = 0;
 
+    /**************************************************************************/
+    /*!
+        @brief  Enable or disable hardware flow control
+
+        When enabled, `clearToSend()` samples the provided CTS pin, allowing
+        requests to be streamed at line rate instead of being paced with a
+        fixed delay between segments.
+
+        @param[in] enable
+                `true` to enable flow control, `false` to disable it.
+        @param[in] cts_pin
+                The host pin wired to the Notecard's CTS signal (active low).
+        @returns `true` if the implementation supports flow control,
+                otherwise `false` (the default).
+    */
+    /**************************************************************************/
+    virtual bool setFlowControl(bool enable, uint8_t cts_pin) { (void)enable; (void)cts_pin; return false; }
+
     /**************************************************************************/
     /*!
         @brief  Writes a buffer to the Notecard Serial port.
@@ -54,8 +117,10 @@ public:
     @brief Creates a NoteSerial instance
 
     Helper function to abstract, create and maintain a single instance
-    of the NoteSerial interface implementation, as required by the underlying
-    `note-c` library.
+    of the NoteSerial interface implementation per serial port, as required by
+    the underlying `note-c` library. Up to `NOTE_ARDUINO_MAX_INTERFACES` ports
+    may be in use at once, beyond which `nullptr` is returned. Passing
+    `nullptr` deletes every instance.
 
     @param[in] serial_parameters
                Pointer to the parameters required to instantiate
@@ -2,6 +2,10 @@
 
 #include "Notecard.h"
 
+#ifdef NOTE_C_THREAD_CONTEXT
+#include <mutex>
+#endif
+
 #ifndef NOTE_MOCK
 #ifdef NOTE_ARDUINO_SOFTWARE_SERIAL_SUPPORT
 #include <SoftwareSerial.h>
@@ -23,24 +27,40 @@ struct ExtractNestedTemplateType<MakeNoteSerial_ArduinoParameters<nested_type>>
     using type = nested_type;
 };
 
-// Singleton instance of the NoteSerial_Arduino class
+// Singleton instances of the NoteSerial_Arduino class, one per serial port
 namespace instance {
-    inline NoteSerial* & note_serial (void) {
-        static NoteSerial* note_serial = nullptr;
+    struct NoteSerialPort {
+        const void * port;
+        NoteSerial * note_serial;
+    };
+    inline NoteSerialPort * note_serial (void) {
+        static NoteSerialPort note_serial[NOTE_ARDUINO_MAX_INTERFACES] = {};
         return note_serial;
     }
+#ifdef NOTE_C_THREAD_CONTEXT
+    inline std::mutex & note_serial_lock (void) {
+        static std::mutex note_serial_lock;
+        return note_serial_lock;
+    }
+#endif
 };
 
 NoteSerial *
 make_note_serial (
     nullptr_t
 ) {
-    NoteSerial* & note_serial = instance::note_serial();
-    if (note_serial) {
-        delete note_serial;
-        note_serial = nullptr;
+#ifdef NOTE_C_THREAD_CONTEXT
+    std::lock_guard<std::mutex> lock(instance::note_serial_lock());
+#endif
+    instance::NoteSerialPort * const note_serial = instance::note_serial();
+    for (size_t i = 0 ; i < NOTE_ARDUINO_MAX_INTERFACES ; ++i) {
+        if (note_serial[i].note_serial) {
+            delete note_serial[i].note_serial;
+            note_serial[i].note_serial = nullptr;
+            note_serial[i].port = nullptr;
+        }
     }
-    return note_serial;
+    return nullptr;
 }
 
 template <typename T>
@@ -48,13 +68,29 @@ NoteSerial *
 make_note_serial (
     T & serial_parameters_
 ) {
-    NoteSerial* & note_serial = instance::note_serial();
-    if (!note_serial) {
+#ifdef NOTE_C_THREAD_CONTEXT
+    std::lock_guard<std::mutex> lock(instance::note_serial_lock());
+#endif
+    instance::NoteSerialPort * const note_serial = instance::note_serial();
+    instance::NoteSerialPort * unused = nullptr;
+    for (size_t i = 0 ; i < NOTE_ARDUINO_MAX_INTERFACES ; ++i) {
+        if (note_serial[i].note_serial && note_serial[i].port == &serial_parameters_.serial) {
+            return note_serial[i].note_serial;
+        } else if (!note_serial[i].note_serial && !unused) {
+            unused = &note_serial[i];
+        }
+    }
+
+    // Each port gets its own instance, up to `NOTE_ARDUINO_MAX_INTERFACES`
+    NoteSerial * result = nullptr;
+    if (unused) {
         using serial_type = typename ExtractNestedTemplateType<T>::type;
-        note_serial = new NoteSerial_Arduino<serial_type>(serial_parameters_.serial, serial_parameters_.baud_rate);
+        unused->note_serial = new NoteSerial_Arduino<serial_type>(serial_parameters_.serial, serial_parameters_.baud_rate);
+        unused->port = &serial_parameters_.serial;
+        result = unused->note_serial;
     }
 
-    return note_serial;
+    return result;
 }
 
 template <typename T>
@@ -64,7 +100,9 @@ NoteSerial_Arduino<T>::NoteSerial_Arduino
     size_t baud_rate_
 ) :
     _notecardSerial(serial_),
-    _notecardSerialSpeed(baud_rate_)
+    _notecardSerialSpeed(baud_rate_),
+    _ctsPin(0),
+    _flowControl(false)
 {
     _notecardSerial.begin(_notecardSerialSpeed);
 
@@ -92,6 +130,16 @@ NoteSerial_Arduino<T>::available (
     return _notecardSerial.available();
 }
 
+template <typename T>
+bool
+NoteSerial_Arduino<T>::clearToSend (
+    void
+)
+{
+    // CTS is asserted (active low) when the Notecard can accept more data
+    return (!_flowControl || (LOW == ::digitalRead(_ctsPin)));
+}
+
 template <typename T>
 char
 NoteSerial_Arduino<T>::receive (
@@ -101,6 +149,31 @@ NoteSerial_Arduino<T>::receive (
     return _notecardSerial.read();
 }
 
+template <typename T>
+size_t
+NoteSerial_Arduino<T>::receiveBulk (
+    uint8_t *buffer_,
+    size_t size_,
+    char eop_
+)
+{
+    // `Stream` offers no bulk read that never waits, so the bytes are still
+    // read one at a time, but the port is only asked once how many are ready
+    size_t ready = _notecardSerial.available();
+    if (ready > size_) {
+        ready = size_;
+    }
+    size_t received = 0;
+    while (received < ready) {
+        const char ch = _notecardSerial.read();
+        buffer_[received++] = ch;
+        if (ch == eop_) {
+            break;
+        }
+    }
+    return received;
+}
+
 template <typename T>
 bool
 NoteSerial_Arduino<T>::reset (
@@ -113,6 +186,22 @@ NoteSerial_Arduino<T>::reset (
     return true;
 }
 
+template <typename T>
+bool
+NoteSerial_Arduino<T>::setFlowControl (
+    bool enable_,
+    uint8_t cts_pin_
+)
+{
+    if (enable_) {
+        _ctsPin = cts_pin_;
+        ::pinMode(_ctsPin, INPUT);
+    }
+    _flowControl = enable_;
+
+    return true;
+}
+
 template <typename T>
 size_t
 NoteSerial_Arduino<T>::transmit (
@@ -29,13 +29,18 @@ public:
     NoteSerial_Arduino(T & serial_, size_t baud_rate_);
     ~NoteSerial_Arduino(void);
     size_t available(void) override;
+    bool clearToSend(void) override;
     char receive(void) override;
+    size_t receiveBulk(uint8_t * buffer, size_t size, char eop) override;
     bool reset(void) override;
+    bool setFlowControl(bool enable, uint8_t cts_pin) override;
     size_t transmit(uint8_t * buffer, size_t size, bool flush) override;
 
 private:
     T & _notecardSerial;
     const int _notecardSerialSpeed;
+    uint8_t _ctsPin;
+    bool _flowControl;
 };
 
 #endif // NOTE_SERIAL_ARDUINO_HPP
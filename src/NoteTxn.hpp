@@ -31,8 +31,10 @@ public:
 /******************************************************************************/
 /*!
     @brief  Helper function to abstract, create and maintain a single instance
-    of the NoteTxn interface implementation, as required by the underlying
-    `note-c` library.
+    of the NoteTxn interface implementation per pair of pins, as required by
+    the underlying `note-c` library. Up to `NOTE_ARDUINO_MAX_INTERFACES` pairs
+    may be in use at once, beyond which `nullptr` is returned. Passing
+    `nullptr`, or the same pin twice, deletes every instance.
     @param[in] txn_parameters
                Pointer to the parameters required to instantiate
                the platform specific transaction implementation.
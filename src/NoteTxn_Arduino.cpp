@@ -2,6 +2,10 @@
 
 #include "Notecard.h"
 
+#ifdef NOTE_C_THREAD_CONTEXT
+#include <mutex>
+#endif
+
 #ifndef NOTE_MOCK
   #include <Arduino.h>
 #else
@@ -9,24 +13,43 @@
   #include "mock/mock-parameters.hpp"
 #endif
 
-// Singleton instance of the NoteTxn_Arduino class
+// Singleton instances of the NoteTxn_Arduino class, one per pair of pins
 namespace instance {
-    inline NoteTxn* & note_txn (void) {
-        static NoteTxn* note_txn = nullptr;
+    struct NoteTxnPins {
+        uint8_t ctx_pin;
+        uint8_t rtx_pin;
+        NoteTxn * note_txn;
+    };
+    inline NoteTxnPins * note_txn (void) {
+        static NoteTxnPins note_txn[NOTE_ARDUINO_MAX_INTERFACES] = {};
         return note_txn;
     }
+#ifdef NOTE_C_THREAD_CONTEXT
+    inline std::mutex & note_txn_lock (void) {
+        static std::mutex note_txn_lock;
+        return note_txn_lock;
+    }
+#endif
+    inline void delete_note_txn (void) {
+        NoteTxnPins * const pins = note_txn();
+        for (size_t i = 0 ; i < NOTE_ARDUINO_MAX_INTERFACES ; ++i) {
+            if (pins[i].note_txn) {
+                delete pins[i].note_txn;
+                pins[i].note_txn = nullptr;
+            }
+        }
+    }
 };
 
 NoteTxn *
 make_note_txn (
     nullptr_t
 ) {
-    NoteTxn* & note_txn = instance::note_txn();
-    if (note_txn) {
-        delete note_txn;
-        note_txn = nullptr;
-    }
-    return note_txn;
+#ifdef NOTE_C_THREAD_CONTEXT
+    std::lock_guard<std::mutex> lock(instance::note_txn_lock());
+#endif
+    instance::delete_note_txn();
+    return nullptr;
 }
 
 template <typename T>
@@ -34,19 +57,35 @@ NoteTxn *
 make_note_txn (
     T & txn_pins_
 ) {
-    NoteTxn* & note_txn = instance::note_txn();
-
+#ifdef NOTE_C_THREAD_CONTEXT
+    std::lock_guard<std::mutex> lock(instance::note_txn_lock());
+#endif
     if (txn_pins_[0] == txn_pins_[1]) {
         // Invalid tuple invokes deletion
-        if (note_txn) {
-            delete note_txn;
-            note_txn = nullptr;
+        instance::delete_note_txn();
+        return nullptr;
+    }
+
+    instance::NoteTxnPins * const note_txn = instance::note_txn();
+    instance::NoteTxnPins * unused = nullptr;
+    for (size_t i = 0 ; i < NOTE_ARDUINO_MAX_INTERFACES ; ++i) {
+        if (note_txn[i].note_txn && note_txn[i].ctx_pin == txn_pins_[0] && note_txn[i].rtx_pin == txn_pins_[1]) {
+            return note_txn[i].note_txn;
+        } else if (!note_txn[i].note_txn && !unused) {
+            unused = &note_txn[i];
         }
-    } else if (!note_txn) {
-        note_txn = new NoteTxn_Arduino(txn_pins_[0], txn_pins_[1]);
     }
 
-    return note_txn;
+    // Each pair of pins gets its own instance, up to `NOTE_ARDUINO_MAX_INTERFACES`
+    NoteTxn * result = nullptr;
+    if (unused) {
+        unused->note_txn = new NoteTxn_Arduino(txn_pins_[0], txn_pins_[1]);
+        unused->ctx_pin = txn_pins_[0];
+        unused->rtx_pin = txn_pins_[1];
+        result = unused->note_txn;
+    }
+
+    return result;
 }
 
 NoteTxn_Arduino::NoteTxn_Arduino
@@ -44,13 +44,20 @@
 
 #include "NoteTime.h"
 
+#ifdef NOTE_C_THREAD_CONTEXT
+#include <atomic>
+#define NOTE_ARDUINO_THREAD_LOCAL thread_local
+#else
+#define NOTE_ARDUINO_THREAD_LOCAL
+#endif
+
 /***************************************************************************
  SINGLETON ABSTRACTION (REQUIRED BY NOTE-C)
  ***************************************************************************/
 
 namespace
 {
-NoteI2c *noteI2c(nullptr);
+NOTE_ARDUINO_THREAD_LOCAL NoteI2c *noteI2c(nullptr);
 
 const char *noteI2cReceive(uint16_t device_address_, uint8_t *buffer_, uint16_t size_, uint32_t *available_)
 {
@@ -98,7 +105,7 @@ size_t noteLogPrint(const char * message_)
     return result;
 }
 
-NoteSerial *noteSerial(nullptr);
+NOTE_ARDUINO_THREAD_LOCAL NoteSerial *noteSerial(nullptr);
 
 bool noteSerialAvailable(void)
 {
@@ -111,6 +118,17 @@ bool noteSerialAvailable(void)
     return result;
 }
 
+bool noteSerialClearToSend(void)
+{
+    bool result;
+    if (noteSerial) {
+        result = noteSerial->clearToSend();
+    } else {
+        result = true;
+    }
+    return result;
+}
+
 char noteSerialReceive(void)
 {
     char result;
@@ -122,6 +140,17 @@ char noteSerialReceive(void)
     return result;
 }
 
+size_t noteSerialReceiveBulk(uint8_t *buffer_, size_t size_, char eop_)
+{
+    size_t result;
+    if (noteSerial) {
+        result = noteSerial->receiveBulk(buffer_, size_, eop_);
+    } else {
+        result = 0;
+    }
+    return result;
+}
+
 bool noteSerialReset(void)
 {
     bool result;
@@ -140,7 +169,15 @@ void noteSerialTransmit(uint8_t *text_, size_t len_, bool flush_)
     }
 }
 
-NoteTxn *noteTxn(nullptr);
+NOTE_ARDUINO_THREAD_LOCAL NoteTxn *noteTxn(nullptr);
+
+NOTE_ARDUINO_THREAD_LOCAL const Notecard *activeNotecard(nullptr);
+
+#ifdef NOTE_C_THREAD_CONTEXT
+std::atomic<size_t> liveNotecards(0);
+#else
+size_t liveNotecards(0);
+#endif
 
 bool noteTransactionStart (uint32_t timeout_ms_) {
     bool result;
@@ -161,6 +198,49 @@ void noteTransactionStop (void) {
 
 }
 
+/**************************************************************************/
+/*!
+    @brief  Make this instance the one communicating with its Notecard.
+
+    The interfaces and `note-c` context of the previously active instance, if
+    any, are saved, and those of this instance are restored. An instance that
+    has never been active begins with no interface configured. This is a
+    no-op when only a single instance is in use. When `note-c` is built with
+    `NOTE_C_THREAD_CONTEXT` defined, the active instance is tracked per
+    thread, so instances driven from different threads run in parallel.
+*/
+/**************************************************************************/
+void Notecard::activate (void) const
+{
+    if (activeNotecard == this) {
+        return;
+    }
+
+    if (activeNotecard) {
+        if (!activeNotecard->_context) {
+            activeNotecard->_context = new NoteContext();
+        }
+        NoteContextSave(activeNotecard->_context);
+        activeNotecard->_contextSaved = (nullptr != activeNotecard->_context);
+        activeNotecard->_noteI2c = noteI2c;
+        activeNotecard->_noteSerial = noteSerial;
+        activeNotecard->_noteTxn = noteTxn;
+
+        NoteContextRestore(_contextSaved ? _context : nullptr);
+        noteI2c = _noteI2c;
+        noteSerial = _noteSerial;
+        noteTxn = _noteTxn;
+    } else if (_contextSaved) {
+        // The instance that replaced this one has since been destroyed
+        NoteContextRestore(_context);
+        noteI2c = _noteI2c;
+        noteSerial = _noteSerial;
+        noteTxn = _noteTxn;
+    }
+    _contextSaved = false;
+    activeNotecard = this;
+}
+
 /**************************************************************************/
 /*!
     @brief  Platform Initialization for the Notecard.
@@ -187,9 +267,52 @@ void Notecard::platformInit (bool assignCallbacks)
  PUBLIC FUNCTIONS
  ***************************************************************************/
 
+Notecard::Notecard (void) :
+    _context(nullptr),
+    _contextSaved(false),
+    _noteI2c(nullptr),
+    _noteSerial(nullptr),
+    _noteTxn(nullptr)
+{
+    ++liveNotecards;
+}
+
 Notecard::~Notecard (void)
 {
-    // Delete Singleton(s)
+    const bool lastNotecard = (0 == --liveNotecards);
+
+    // Leave the interfaces of another active instance untouched
+    if (activeNotecard != this) {
+        if (_contextSaved) {
+            NoteContextFree(_context);
+            _contextSaved = false;
+        }
+        delete _context;
+        _context = nullptr;
+        if (!lastNotecard) {
+            return;
+        }
+    } else if (!lastNotecard) {
+        // Release this instance's state, and leave a fresh one for the next
+        if (!_context) {
+            _context = new NoteContext();
+        }
+        NoteContextSave(_context);
+        NoteContextFree(_context);
+        delete _context;
+        _context = nullptr;
+        NoteContextRestore(nullptr);
+        noteI2c = nullptr;
+        noteSerial = nullptr;
+        noteTxn = nullptr;
+        activeNotecard = nullptr;
+        return;
+    }
+    delete _context;
+    _context = nullptr;
+    activeNotecard = nullptr;
+
+    // Delete Singleton(s), which other instances may share
     noteI2c = make_note_i2c(nullptr);
     noteLog = make_note_log(nullptr);
     noteSerial = make_note_serial(nullptr);
@@ -198,6 +321,7 @@ Notecard::~Notecard (void)
 
 void Notecard::begin(NoteI2c * noteI2c_, uint32_t i2cAddress_, uint32_t i2cMtu_)
 {
+    activate();
     noteI2c = noteI2c_;
     platformInit(noteI2c);
     if (noteI2c) {
@@ -212,11 +336,19 @@ void Notecard::begin(NoteI2c * noteI2c_, uint32_t i2cAddress_, uint32_t i2cMtu_)
 
 void Notecard::begin(NoteSerial * noteSerial_)
 {
+    activate();
     noteSerial = noteSerial_;
     platformInit(noteSerial);
     if (noteSerial) {
         NoteSetFnSerialDefault(noteSerialReset, noteSerialTransmit,
                                noteSerialAvailable, noteSerialReceive);
+
+        // Receive in bulk, unless the serial hooks have been overridden
+        serialReceiveFn receive_fn = nullptr;
+        NoteGetFnSerial(nullptr, nullptr, nullptr, &receive_fn);
+        if (receive_fn == noteSerialReceive) {
+            NoteSetFnSerialReceiveBulk(noteSerialReceiveBulk);
+        }
     } else {
         NoteSetFnSerial(nullptr, nullptr, nullptr, nullptr); // Force clear
     }
@@ -224,6 +356,7 @@ void Notecard::begin(NoteSerial * noteSerial_)
 
 bool Notecard::debugSyncStatus(int pollFrequencyMs, int maxLevel)
 {
+    activate();
     return NoteDebugSyncStatus(pollFrequencyMs, maxLevel);
 }
 
@@ -234,12 +367,16 @@ void Notecard::deleteResponse(J *rsp) const
 
 void Notecard::end(void)
 {
+    activate();
     // Clear I2C Interface
     i2cTransmitFn i2c_is_set = nullptr;
     NoteGetFnI2C(nullptr, nullptr, nullptr, &i2c_is_set, nullptr);
     if (i2c_is_set) {
-        // Delete Singletons
-        noteI2c = make_note_i2c(nullptr);
+        // Delete Singletons, unless other instances may share them
+        if (1 == liveNotecards) {
+            make_note_i2c(nullptr);
+        }
+        noteI2c = nullptr;
         NoteSetFnI2C(0, 0, nullptr, nullptr, nullptr);
     }
 
@@ -247,13 +384,18 @@ void Notecard::end(void)
     serialTransmitFn serial_is_set = nullptr;
     NoteGetFnSerial(nullptr, &serial_is_set, nullptr, nullptr);
     if (serial_is_set) {
-        // Delete Singletons
-        noteSerial = make_note_serial(nullptr);
+        // Delete Singletons, unless other instances may share them
+        if (1 == liveNotecards) {
+            make_note_serial(nullptr);
+        }
+        noteSerial = nullptr;
         NoteSetFnSerial(nullptr, nullptr, nullptr, nullptr);
     }
 
-    // Clear Platform Callbacks
-    platformInit(false);
+    // Clear Platform Callbacks, unless other instances rely on them
+    if (1 == liveNotecards) {
+        platformInit(false);
+    }
 }
 
 NOTE_ARDUINO_DEPRECATED void Notecard::logDebug(const char *message) const
@@ -278,26 +420,122 @@ NOTE_ARDUINO_DEPRECATED void Notecard::logDebugf(const char *format, ...) const
     NoteDebug(message);
 }
 
+J *Notecard::finishAsync(NoteTransactionAsync *txn) const
+{
+    activate();
+    return NoteTransactionAsyncEnd(txn);
+}
+
+#ifdef NOTE_C_METRICS
+void Notecard::getMetrics(NoteMetrics *metrics_, bool reset_) const
+{
+    activate();
+    NoteGetMetrics(metrics_);
+    if (reset_) {
+        NoteResetMetrics();
+    }
+}
+#endif
+
 J *Notecard::newCommand(const char *request) const
 {
+    activate();
     return NoteNewCommand(request);
 }
 
 J *Notecard::newRequest(const char *request) const
 {
+    activate();
     return NoteNewRequest(request);
 }
 
+bool Notecard::pollAsync(NoteTransactionAsync *txn) const
+{
+    activate();
+    return NoteTransactionAsyncPoll(txn);
+}
+
+size_t Notecard::pumpNotes(NoteRing &ring_, const char *file_, noteRecordFn recordFn_, void *context_, size_t maxRecords_) const
+{
+    activate();
+    size_t records = ring_.count();
+    if (records > maxRecords_) {
+        records = maxRecords_;
+    }
+    if (!records || !recordFn_) {
+        return 0;
+    }
+
+    // Describe each waiting record as a Note, without releasing it
+    J *reqs = JCreateArray();
+    if (!reqs) {
+        return 0;
+    }
+    size_t batched = 0;
+    for (; batched < records ; ++batched) {
+        J *req = NoteNewRequest("note.add");
+        J *body = JCreateObject();
+        if (!req || !body) {
+            JDelete(req);
+            JDelete(body);
+            break;
+        }
+        recordFn_(body, ring_.peek(batched), context_);
+        if (file_) {
+            JAddStringToObject(req, "file", file_);
+        }
+        JAddItemToObject(req, "body", body);
+        JAddItemToArray(reqs, req);
+    }
+    if (!batched) {
+        JDelete(reqs);
+        return 0;
+    }
+
+    // Release the records that were added, in order, up to the first failure,
+    // after which nothing was sent
+    J *rsps = NoteTransactionBatchUntilError(reqs);
+    JDelete(reqs);
+    size_t sent = 0;
+    for (; rsps && sent < batched ; ++sent) {
+        J *rsp = JGetArrayItem(rsps, static_cast<int>(sent));
+        if (!rsp || NoteResponseError(rsp)) {
+            break;
+        }
+    }
+    JDelete(rsps);
+    ring_.consume(sent);
+
+    return sent;
+}
+
 J *Notecard::requestAndResponse(J *req) const
 {
+    activate();
     return NoteRequestResponse(req);
 }
 
+J *Notecard::requestAndResponseBatch(J *reqs) const
+{
+    activate();
+    J *rsps = NoteTransactionBatch(reqs);
+    JDelete(reqs);
+    return rsps;
+}
+
 J *Notecard::requestAndResponseWithRetry(J *req, uint32_t timeoutSeconds) const
 {
+    activate();
     return NoteRequestResponseWithRetry(req, timeoutSeconds);
 }
 
+void Notecard::requestAsync(NoteTransactionAsync *txn, J *req) const
+{
+    activate();
+    NoteTransactionAsyncBegin(txn, req);
+    JDelete(req);
+}
+
 bool Notecard::responseError(J *rsp) const
 {
     return NoteResponseError(rsp);
@@ -305,16 +543,19 @@ bool Notecard::responseError(J *rsp) const
 
 bool Notecard::sendRequest(J *req) const
 {
+    activate();
     return NoteRequest(req);
 }
 
 bool Notecard::sendRequestWithRetry(J *req, uint32_t timeoutSeconds) const
 {
+    activate();
     return NoteRequestWithRetry(req, timeoutSeconds);
 }
 
 void Notecard::setDebugOutputStream(NoteLog * noteLog_)
 {
+    activate();
     noteLog = noteLog_;
     if (noteLog) {
         NoteSetFnDebugOutput(noteLogPrint);
@@ -325,23 +566,58 @@ void Notecard::setDebugOutputStream(NoteLog * noteLog_)
 }
 
 void Notecard::setFn(mallocFn mallocHook, freeFn freeHook, delayMsFn delayMsHook, getMsFn getMsHook) {
+    activate();
     NoteSetFn(mallocHook, freeHook, delayMsHook, getMsHook);
 }
 
 void Notecard::setFnI2cMutex(mutexFn lockI2cFn_, mutexFn unlockI2cFn_) {
+    activate();
     NoteSetFnI2CMutex(lockI2cFn_, unlockI2cFn_);
 }
 
 void Notecard::setFnNoteMutex(mutexFn lockNoteFn_, mutexFn unlockNoteFn_) {
+    activate();
     NoteSetFnNoteMutex(lockNoteFn_, unlockNoteFn_);
 }
 
+void Notecard::setFnResponseWait(responseWaitFn waitFn_) {
+    activate();
+    NoteSetFnResponseWait(waitFn_);
+}
+
+bool Notecard::setI2cBlockTransfer(bool enable_) {
+    activate();
+    bool result = false;
+    if (noteI2c) {
+        result = noteI2c->setBlockTransfer(enable_);
+    }
+    return result;
+}
+
+void Notecard::setI2cBusSharing(bool enable_) {
+    activate();
+    NoteSetI2CBusSharing(enable_);
+}
+
+bool Notecard::setSerialFlowControl(bool enable_, uint8_t ctsPin_) {
+    activate();
+    bool result = false;
+    if (noteSerial) {
+        result = noteSerial->setFlowControl(enable_, ctsPin_);
+    }
+    NoteSetFnSerialFlowControl((enable_ && result) ? noteSerialClearToSend : nullptr);
+    return result;
+}
+
 void Notecard::setTransactionPins(NoteTxn * noteTxn_) {
+    activate();
     noteTxn = noteTxn_;  // Set global interface
     if (noteTxn_) {
         NoteSetFnTransaction(noteTransactionStart, noteTransactionStop);
     } else {
-        make_note_txn(nullptr);  // Clear singleton
+        if (1 == liveNotecards) {
+            make_note_txn(nullptr);  // Clear singleton
+        }
         NoteSetFnTransaction(nullptr, nullptr);
     }
 }
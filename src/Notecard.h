@@ -31,6 +31,7 @@
 #include "NoteDefines.h"
 #include "NoteI2c.hpp"
 #include "NoteLog.hpp"
+#include "NoteRing.hpp"
 #include "NoteSerial.hpp"
 #include "NoteTxn.hpp"
 
@@ -50,16 +51,51 @@
 #include "mock/mock-parameters.hpp"
 #endif
 
+/**************************************************************************/
+/*!
+    @brief  The type for a function that describes a record, drained from a
+            `NoteRing`, as the body of a Note.
+
+    @param [in] body
+            An empty `J` JSON object, to be populated with the fields of the
+            Note.
+    @param [in] record
+            The record, which is `NoteRing::recordSize()` bytes long.
+    @param [in] context
+            The context passed to `Notecard::pumpNotes()`.
+*/
+/**************************************************************************/
+typedef void (*noteRecordFn)(J *body, const void *record, void *context);
+
 /**************************************************************************/
 /*!
     @brief  Class that stores state and functions for interacting with the
     Blues Notecard.
+
+    Several instances may be used to drive several Notecards. Each instance
+    keeps its own interface and `note-c` context, which are swapped in
+    whenever that instance communicates with its Notecard. Room to save the
+    context is only allocated once another instance is swapped in, so a
+    single instance carries no more than a pointer to it. The `begin()`
+    overloads that accept an Arduino bus create one interface per port, which
+    is shared by every Notecard attached to it (see
+    `NOTE_ARDUINO_MAX_INTERFACES`).
+
+    By default, instances share the `note-c` lock, so their transactions are
+    serialized, and must not be switched from different threads without a
+    Notecard mutex in place (see `setFnNoteMutex()`). When `note-c` is built
+    with `NOTE_C_THREAD_CONTEXT` defined, as on a Linux host, each thread
+    drives its own instance in parallel with the others. Notecards sharing a
+    bus then require an I2C mutex (see `setFnI2cMutex()`).
 */
 /**************************************************************************/
 class Notecard
 {
 public:
+    Notecard(void);
     ~Notecard(void);
+    Notecard(const Notecard &) = delete;
+    Notecard & operator=(const Notecard &) = delete;
 #ifdef ARDUINO
     /**************************************************************************/
     /*!
@@ -251,11 +287,52 @@ public:
         @brief  Deinitialize the Notecard object
 
         This function clears the Notecard object's communication
-        interfaces, and frees all associated memory.
+        interfaces, and frees all associated memory. While other instances
+        exist, the interfaces they may share, and the platform callbacks, are
+        left in place until the last of them ends.
     */
     /**************************************************************************/
     void end(void);
 
+    /**************************************************************************/
+    /*!
+        @brief  Finishes a non-blocking request and returns the JSON response.
+
+        If the transaction has not yet completed, it is abandoned and an
+        error response is returned.
+
+        @param [in] txn
+                The transaction state passed to `requestAsync()`.
+
+        @return `J` JSON object with the response from the Notecard.
+
+        @see requestAsync
+    */
+    /**************************************************************************/
+    J *finishAsync(NoteTransactionAsync *txn) const;
+
+#ifdef NOTE_C_METRICS
+    /**************************************************************************/
+    /*!
+        @brief  Read the counters and per-phase latency histograms of the
+                transactions with the Notecard.
+
+        Available when the library is built with `NOTE_C_METRICS` defined.
+        Without it, no metrics are collected and this function does not
+        exist. The metrics cover the transactions of every `Notecard`
+        instance.
+
+        @param [out] metrics
+                The metrics collected since they were last reset.
+        @param [in] reset
+                `true` to reset the metrics once they have been read.
+
+        @see NoteMetrics
+    */
+    /**************************************************************************/
+    void getMetrics(NoteMetrics *metrics, bool reset = false) const;
+#endif
+
     /**************************************************************************/
     /*!
         @deprecated NoteDebug, which this function wraps, should be treated
@@ -318,6 +395,55 @@ public:
     /**************************************************************************/
     J *newRequest(const char *request) const;
 
+    /**************************************************************************/
+    /*!
+        @brief  Advances a non-blocking request by a single step.
+
+        Waiting for the Notecard to process the request never blocks, so
+        this function may be called on every pass through `loop()` alongside
+        other work. The steps that transmit the request and receive the
+        response do block until the transfer is complete, which takes longer
+        for large requests and responses (see `NoteTransactionAsyncPoll()`).
+
+        @param [in] txn
+                The transaction state passed to `requestAsync()`.
+
+        @return `true` once the response is ready to be collected with
+                `finishAsync()`, otherwise `false`.
+
+        @see requestAsync
+    */
+    /**************************************************************************/
+    bool pollAsync(NoteTransactionAsync *txn) const;
+
+    /**************************************************************************/
+    /*!
+        @brief  Drains records, filled from interrupt context, into Notes.
+
+        Intended to be called on every pass through `loop()`. Each waiting
+        record, up to `maxRecords`, is described by `recordFn` and becomes a
+        `note.add` request, and the requests are sent together as a batch.
+        The batch stops at the first request that fails, and only the records
+        sent before it are released from the ring, so the failed record and
+        those after it are sent again on the next call, without duplicates.
+
+        @param [in] ring
+                The ring the records are pushed into.
+        @param [in] file
+                The Notefile to add the Notes to, or `nullptr` for the
+                Notecard's default.
+        @param [in] recordFn
+                A function that describes a record as the body of a Note.
+        @param [in] context
+                A context passed to `recordFn`.
+        @param [in] maxRecords
+                The most records to send in a single batch.
+
+        @return The number of records sent and released from the ring.
+    */
+    /**************************************************************************/
+    size_t pumpNotes(NoteRing &ring, const char *file, noteRecordFn recordFn, void *context = nullptr, size_t maxRecords = 8) const;
+
     /**************************************************************************/
     /*!
         @brief  Sends a request to the Notecard and returns the JSON response.
@@ -336,6 +462,25 @@ public:
     /**************************************************************************/
     J *requestAndResponse(J *req) const;
 
+    /**************************************************************************/
+    /*!
+        @brief  Sends a list of requests to the Notecard and returns their
+                JSON responses.
+
+        The requests are sent in order within a single transaction window, so
+        a burst of requests wakes the Notecard only once.
+
+        @param [in] reqs
+                A `J` JSON array of request objects.
+
+        @return `J` JSON array with one response per request, in order.
+
+        @note The request array and the requests it holds are deleted by this
+              function; do not use them after calling this function.
+    */
+    /**************************************************************************/
+    J *requestAndResponseBatch(J *reqs) const;
+
     /**************************************************************************/
     /*!
         @brief  Sends a request to the Notecard and returns the JSON response;
@@ -354,6 +499,31 @@ public:
     /**************************************************************************/
     J *requestAndResponseWithRetry(J *req, uint32_t timeoutSeconds) const;
 
+    /**************************************************************************/
+    /*!
+        @brief  Begins sending a request to the Notecard without waiting for
+                the response.
+
+        The transaction is driven by calling `pollAsync()` until it returns
+        `true`, after which the response is collected with `finishAsync()`.
+        Retries, CRC checks and heartbeats are handled exactly as they are by
+        `requestAndResponse()`.
+
+        @param [out] txn
+                The transaction state, which must remain valid until
+                `finishAsync()` is called.
+        @param [in] req
+                A `J` JSON request object.
+
+        @note The request object is deleted by this function; do not use it
+              after calling this function.
+
+        @note The Notecard remains locked until `finishAsync()` is called, so
+              no other request may be made in the meantime.
+    */
+    /**************************************************************************/
+    void requestAsync(NoteTransactionAsync *txn, J *req) const;
+
     /**************************************************************************/
     /*!
         @brief  Checks a response object for the presence of an error string.
@@ -470,6 +640,91 @@ public:
     /**************************************************************************/
     void setFnNoteMutex(mutexFn lockNoteFn, mutexFn unlockNoteFn);
 
+    /**************************************************************************/
+    /*!
+        @brief  Set the function the host MCU uses to sleep while awaiting a
+                response from the Notecard.
+
+        By default, the Notecard is polled for a response (every 50ms over
+        I2C, or every 10ms over Serial). Supplying this function allows the
+        host to sleep until the response is signaled instead, which reduces
+        both latency and bus traffic.
+
+        @param [in] waitFn
+                A user-defined callback that blocks until the response is
+                signaled (e.g. by an interrupt attached to the ATTN pin or to
+                the UART RX line) or the provided timeout elapses, returning
+                `true` if the signal was observed. Passing `nullptr` restores
+                polling.
+
+        @note The callback need not be precise. The Notecard is always
+              queried before data is read, so a spurious wake-up only costs
+              a single poll.
+    */
+    /**************************************************************************/
+    void setFnResponseWait(responseWaitFn waitFn);
+
+    /**************************************************************************/
+    /*!
+        @brief  Enable or disable block transfers on the I2C interface.
+
+        When enabled, each read request is issued with a repeated start,
+        instead of a stop condition followed by a fixed 2ms delay. Off by
+        default, to keep the proven timing.
+
+        @param [in] enable
+                `true` to enable block transfers, `false` to disable them.
+
+        @returns `true` if the I2C interface supports block transfers,
+                 otherwise `false`.
+
+        @note Must be called after `begin()` with an I2C interface.
+    */
+    /**************************************************************************/
+    bool setI2cBlockTransfer(bool enable);
+
+    /**************************************************************************/
+    /*!
+        @brief  Share the I2C bus with other devices during Notecard
+                transactions.
+
+        By default, the lock provided to `setFnI2cMutex()` is held for the
+        whole of a Notecard transaction, including the time the Notecard
+        spends processing the request. When bus sharing is enabled, the lock
+        is only held around each physical I2C transfer, so other devices on
+        the same bus can be serviced while the Notecard is busy.
+
+        @param [in] enable
+                `true` to hold the I2C lock only around each transfer,
+                `false` (the default) to hold it for the whole transaction.
+    */
+    /**************************************************************************/
+    void setI2cBusSharing(bool enable);
+
+    /**************************************************************************/
+    /*!
+        @brief  Enable or disable hardware flow control on the Serial link.
+
+        By default, requests are sent to the Notecard in 250 byte segments,
+        with a 250ms pause between each, so as not to overrun its receive
+        buffer. With flow control enabled, requests are sent in 16 byte
+        chunks, each as soon as the Notecard asserts CTS, so large requests
+        stream at close to line rate.
+
+        @param [in] enable
+                `true` to enable flow control, `false` to restore the fixed
+                delay between segments.
+        @param [in] ctsPin
+                The host pin wired to the Notecard's CTS signal.
+
+        @returns `true` if the Serial interface supports flow control,
+                 otherwise `false`.
+
+        @note Must be called after `begin()` with a Serial interface.
+    */
+    /**************************************************************************/
+    bool setSerialFlowControl(bool enable, uint8_t ctsPin);
+
     /**************************************************************************/
     /*!
         @brief  Set the transaction pins.
@@ -489,7 +744,14 @@ public:
     void setTransactionPins(NoteTxn * noteTxn);
 
 private:
+    void activate (void) const;
     void platformInit (bool assignCallbacks);
+
+    mutable NoteContext * _context;
+    mutable bool _contextSaved;
+    mutable NoteI2c * _noteI2c;
+    mutable NoteSerial * _noteSerial;
+    mutable NoteTxn * _noteTxn;
 };
 
 #endif
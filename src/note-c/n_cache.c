@@ -0,0 +1,559 @@
+// Copyright 2026 Blues Inc.  All rights reserved.
+// Use of this source code is governed by licenses granted by the
+// copyright holder including that found in the LICENSE file.
+
+// A cache of the responses to idempotent queries, such as `card.version` or
+// `hub.get`, with which `NoteRequestResponse` answers a repeated request,
+// without a transaction with the Notecard, for as long as the time to live of
+// its API allows. The responses that a write may have made stale are dropped
+// as soon as the write is sent.
+
+#include "n_lib.h"
+
+#include <string.h>
+
+// The number of APIs whose responses may be cached, and the longest name
+#define CACHE_RULES_MAX 8
+#define CACHE_API_MAX   24
+
+// An API whose responses are cached, and for how long
+typedef struct {
+    char api[CACHE_API_MAX];
+    uint32_t ttlMs;
+} NoteCacheRule;
+
+// A cached response, held after its key (the sorted request) in one allocation
+typedef struct {
+    char *text;         // The key, its null-terminator, then the response
+    size_t size;        // Bytes allocated for `text`, or 0 if unused
+    uint32_t storedMs;  // Time at which the response was received
+    uint32_t usedMs;    // Time at which the response was last returned
+    uint8_t rule;       // The rule of the API of the request
+} NoteCacheEntry;
+
+// The APIs cached by default, which only report on the Notecard
+NOTE_C_STATIC NoteCacheRule cacheRules[CACHE_RULES_MAX] = {
+    {"card.version", 3600000},
+    {"card.wireless", 10000},
+    {"env.get", 30000},
+    {"hub.get", 60000},
+};
+
+// The cache of the Notecard being driven, which is disabled until entries are
+// allocated
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL NoteCacheEntry *cacheEntries = NULL;
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL uint8_t cacheCapacity = 0;
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL size_t cacheMaxBytes = 0;
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL NoteResponseCacheStats cacheStats;
+
+// Advanced whenever responses are invalidated, so that a response received
+// before a write, but stored after it, is not cached
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL uint32_t cacheGeneration = 0;
+
+/**************************************************************************/
+/*!
+  @brief  Find the rule of an API.
+  @param   api The name of the API.
+  @returns the index of the rule, or -1 if the API is not cached.
+*/
+/**************************************************************************/
+NOTE_C_STATIC int _cacheRule(const char *api)
+{
+    for (int i = 0 ; i < CACHE_RULES_MAX ; i++) {
+        if (cacheRules[i].api[0] != '\0' && strcmp(cacheRules[i].api, api) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**************************************************************************/
+/*!
+  @brief  Determine whether a request only reads from the Notecard.
+
+  A request without arguments only reads, as do the arguments of a `.get`
+  API, which select what is read. Any other argument (e.g. the `mode` of
+  `card.wireless`) may change what the API subsequently reports.
+
+  @param   req The request.
+  @param   api The name of the API of the request.
+  @returns `true` if the request only reads, `false` otherwise.
+*/
+/**************************************************************************/
+NOTE_C_STATIC bool _cacheIsRead(J *req, const char *api)
+{
+    const size_t apiLen = strlen(api);
+    if (apiLen > 4 && strcmp(&api[apiLen - 4], ".get") == 0) {
+        return true;
+    }
+    J *field = NULL;
+    JObjectForEach(field, req) {
+        if (strcmp(field->string, c_req) != 0 && strcmp(field->string, "id") != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**************************************************************************/
+/*!
+  @brief  Determine whether a serialized request only reads from the
+  Notecard, as `_cacheIsRead` does for a `J` request.
+
+  The text only holds the request's API and "id" if it is exactly as long as
+  those fields, printed unformatted. Any other argument, or formatting, is
+  taken to be a write, so that at worst the cache is dropped needlessly.
+
+  @param   json The serialized request.
+  @param   jsonLen The length of the serialized request.
+  @param   api The name of the API of the request.
+  @param   fields The request's API and "id", located in the text.
+  @param   count The number of fields.
+  @returns `true` if the request only reads, `false` otherwise.
+*/
+/**************************************************************************/
+NOTE_C_STATIC bool _cacheIsReadText(const char *json, size_t jsonLen, const char *api, const JField *fields, size_t count)
+{
+    const size_t apiLen = strlen(api);
+    if (apiLen > 4 && strcmp(&api[apiLen - 4], ".get") == 0) {
+        return true;
+    }
+    while (jsonLen > 0 && json[jsonLen - 1] <= ' ') {
+        jsonLen--;
+    }
+    size_t expectedLen = sizeof("{}") - 1;
+    size_t found = 0;
+    for (size_t i = 0 ; i < count ; i++) {
+        if (fields[i].type != JInvalid) {
+            expectedLen += (strlen(fields[i].name) + sizeof("\"\":") - 1 + fields[i].length);
+            found++;
+        }
+    }
+    if (found > 1) {
+        expectedLen += (found - 1);
+    }
+    return (jsonLen == expectedLen);
+}
+
+/**************************************************************************/
+/*!
+  @brief  Print the key of the response to a request, which is the request
+  with its fields in order of their names, so that requests that differ only
+  in the order of their fields share a response.
+  @param   req The request.
+  @returns the key, which must be freed with `JFree`, or NULL if there is
+  insufficient memory.
+*/
+/**************************************************************************/
+NOTE_C_STATIC char *_cacheKey(J *req)
+{
+    J *sorted = JDuplicate(req, true);
+    if (sorted == NULL) {
+        return NULL;
+    }
+
+    // Move the first of the unsorted fields, by name, to the end, until
+    // every field has been moved
+    for (int unsorted = JGetObjectItems(sorted) ; unsorted > 0 ; unsorted--) {
+        J *first = sorted->child;
+        J *field = first;
+        for (int i = 1 ; i < unsorted ; i++) {
+            field = field->next;
+            if (strcmp(field->string, first->string) < 0) {
+                first = field;
+            }
+        }
+        JAddItemToArray(sorted, JDetachItemViaPointer(sorted, first));
+    }
+
+    char *key = JPrintUnformatted(sorted);
+    JDelete(sorted);
+    return key;
+}
+
+/**************************************************************************/
+/*!
+  @brief  Drop a cached response.
+  @param   entry The entry of the response.
+*/
+/**************************************************************************/
+NOTE_C_STATIC void _cacheDrop(NoteCacheEntry *entry)
+{
+    _Free(entry->text);
+    cacheStats.bytes -= (uint32_t)entry->size;
+    cacheStats.entries--;
+    entry->text = NULL;
+    entry->size = 0;
+}
+
+/**************************************************************************/
+/*!
+  @brief  Drop the cached responses of an API, or of every API.
+  @param   rule The rule of the API, or -1 for every API.
+*/
+/**************************************************************************/
+NOTE_C_STATIC void _cacheInvalidate(int rule)
+{
+    cacheGeneration++;
+    for (uint8_t i = 0 ; i < cacheCapacity ; i++) {
+        if (cacheEntries[i].size && (rule < 0 || cacheEntries[i].rule == rule)) {
+            _cacheDrop(&cacheEntries[i]);
+            cacheStats.invalidations++;
+        }
+    }
+}
+
+/**************************************************************************/
+/*!
+  @brief  Find the cached response to a request.
+  @param   key The key of the request (see `_cacheKey`).
+  @returns the entry of the response, or NULL if there is none.
+*/
+/**************************************************************************/
+NOTE_C_STATIC NoteCacheEntry *_cacheFind(const char *key)
+{
+    for (uint8_t i = 0 ; i < cacheCapacity ; i++) {
+        if (cacheEntries[i].size && strcmp(cacheEntries[i].text, key) == 0) {
+            return &cacheEntries[i];
+        }
+    }
+    return NULL;
+}
+
+/**************************************************************************/
+/*!
+  @brief  Cache a response, evicting the least recently used responses until
+  it fits.
+  @param   key The key of the request (see `_cacheKey`).
+  @param   rsp The response, printed unformatted.
+  @param   rule The rule of the API of the request.
+*/
+/**************************************************************************/
+NOTE_C_STATIC void _cacheStore(const char *key, const char *rsp, int rule)
+{
+    const size_t keyLen = strlen(key);
+    const size_t rspLen = strlen(rsp);
+    const size_t size = (keyLen + 1 + rspLen + 1);
+    if (size > cacheMaxBytes) {
+        return;
+    }
+
+    // Replace the response if another task cached it in the meantime
+    NoteCacheEntry *entry = _cacheFind(key);
+    if (entry != NULL) {
+        _cacheDrop(entry);
+    }
+
+    // Evict until there is both a free entry and room for the response
+    const uint32_t nowMs = _GetMs();
+    for (;;) {
+        NoteCacheEntry *oldest = NULL;
+        entry = NULL;
+        for (uint8_t i = 0 ; i < cacheCapacity ; i++) {
+            if (!cacheEntries[i].size) {
+                entry = &cacheEntries[i];
+            } else if (oldest == NULL || (nowMs - cacheEntries[i].usedMs) > (nowMs - oldest->usedMs)) {
+                oldest = &cacheEntries[i];
+            }
+        }
+        if (entry != NULL && (cacheStats.bytes + size) <= cacheMaxBytes) {
+            break;
+        }
+        _cacheDrop(oldest);
+        cacheStats.evictions++;
+    }
+
+    entry->text = (char *)_Malloc(size);
+    if (entry->text == NULL) {
+        return;
+    }
+    memcpy(entry->text, key, keyLen + 1);
+    memcpy(&entry->text[keyLen + 1], rsp, rspLen + 1);
+    entry->size = size;
+    entry->storedMs = nowMs;
+    entry->usedMs = nowMs;
+    entry->rule = (uint8_t)rule;
+    cacheStats.bytes += (uint32_t)size;
+    cacheStats.entries++;
+}
+
+/**************************************************************************/
+/*!
+  @brief  Perform a transaction with the Notecard, unless the response to an
+  identical request is cached and still fresh.
+
+  Only requests that read (see `_cacheIsRead`) from a cached API, and that
+  don't carry an "id", are answered from, or added to, the cache.
+
+  @param   req The `J` cJSON request object, which is not freed.
+  @returns a `J` cJSON object with the response, as with `NoteTransaction`.
+*/
+/**************************************************************************/
+J *_noteCacheTransaction(J *req)
+{
+    // Nothing is cached unless the cache has been enabled
+    if (cacheEntries == NULL) {
+        return NoteTransaction(req);
+    }
+
+    // Print the key of the request's response, if it may be cached
+    char *key = NULL;
+    int rule = -1;
+    uint32_t generation = 0;
+    _LockNote();
+    if (cacheEntries != NULL) {
+        const char *api = JGetString(req, c_req);
+        rule = _cacheRule(api);
+        if (rule >= 0 && !JIsPresent(req, "id") && _cacheIsRead(req, api)) {
+            key = _cacheKey(req);
+            generation = cacheGeneration;
+        }
+    }
+
+    // Answer from the cache while the response is fresh
+    J *rsp = NULL;
+    if (key != NULL) {
+        NoteCacheEntry *entry = _cacheFind(key);
+        const uint32_t nowMs = _GetMs();
+        if (entry != NULL && (nowMs - entry->storedMs) >= cacheRules[rule].ttlMs) {
+            _cacheDrop(entry);
+            entry = NULL;
+        }
+        if (entry != NULL) {
+            rsp = JParse(&entry->text[strlen(entry->text) + 1]);
+        }
+        if (rsp != NULL) {
+            entry->usedMs = nowMs;
+            cacheStats.hits++;
+        } else {
+            cacheStats.misses++;
+        }
+    }
+    _UnlockNote();
+    if (rsp != NULL) {
+        JFree(key);
+        return rsp;
+    }
+
+    // Otherwise, perform the transaction and cache a successful response,
+    // unless a write was sent by another task since the lock was released
+    rsp = NoteTransaction(req);
+    if (key != NULL && rsp != NULL && JIsNullString(rsp, c_err)) {
+        char *text = JPrintUnformatted(rsp);
+        if (text != NULL) {
+            _LockNote();
+            if (cacheEntries != NULL && cacheRules[rule].api[0] != '\0' && generation == cacheGeneration) {
+                _cacheStore(key, text, rule);
+            }
+            _UnlockNote();
+            JFree(text);
+        }
+    }
+    JFree(key);
+
+    return rsp;
+}
+
+/**************************************************************************/
+/*!
+  @brief  Drop the cached responses that a request may make stale, before it
+  is sent.
+
+  A restart or restore of the Notecard drops every response, a `.set` or
+  `.default` drops those of the matching `.get`, and a request to a cached API
+  that doesn't only read drops those of the API. The request is examined as
+  it is sent, so that requests built as `J` objects, templates, and
+  serialized requests are all accounted for. The caller must hold the
+  Notecard lock.
+
+  @param   json The serialized request.
+  @param   jsonLen The length of the serialized request.
+*/
+/**************************************************************************/
+void _noteCacheWrite(const char *json, size_t jsonLen)
+{
+    // Nothing is cached unless the cache has been enabled
+    if (cacheEntries == NULL) {
+        return;
+    }
+
+    // Locate the API of the request, and its "id", which only reads
+    JField fields[3] = {
+        { c_req, NULL, 0, JInvalid },
+        { c_cmd, NULL, 0, JInvalid },
+        { "id", NULL, 0, JInvalid },
+    };
+    if (JScanWithLength(json, jsonLen, fields, 3) < 0) {
+        return;
+    }
+    char api[CACHE_API_MAX];
+    const JField *apiField = ((fields[0].type != JInvalid) ? &fields[0] : &fields[1]);
+    if (!JFieldString(apiField, api, sizeof(api)) || strlen(api) != (apiField->length - 2)) {
+        return;
+    }
+
+    int rule = -1;
+    bool stale = false;
+    const char *dot = strrchr(api, '.');
+    if (strcmp(api, "card.restart") == 0 || strcmp(api, "card.restore") == 0) {
+        stale = true;
+    } else if ((rule = _cacheRule(api)) >= 0) {
+        stale = !_cacheIsReadText(json, jsonLen, api, fields, 3);
+    } else if (dot != NULL && (strcmp(dot, ".set") == 0 || strcmp(dot, ".default") == 0)) {
+        char getApi[CACHE_API_MAX];
+        const size_t nsLen = (size_t)(dot - api);
+        if (nsLen + sizeof(".get") <= sizeof(getApi)) {
+            memcpy(getApi, api, nsLen);
+            memcpy(&getApi[nsLen], ".get", sizeof(".get"));
+            rule = _cacheRule(getApi);
+            stale = (rule >= 0);
+        }
+    }
+    if (stale) {
+        _cacheInvalidate(rule);
+    }
+}
+
+bool NoteSetResponseCache(uint8_t entries, size_t maxBytes)
+{
+    NoteCacheEntry *table = NULL;
+    if (entries) {
+        table = (NoteCacheEntry *)_Malloc(entries * sizeof(NoteCacheEntry));
+        if (table == NULL) {
+            return false;
+        }
+        memset(table, 0, entries * sizeof(NoteCacheEntry));
+    }
+
+    _LockNote();
+    if (cacheEntries != NULL) {
+        _cacheInvalidate(-1);
+        _Free(cacheEntries);
+    }
+    cacheEntries = table;
+    cacheCapacity = entries;
+    cacheMaxBytes = maxBytes;
+    memset(&cacheStats, 0, sizeof(cacheStats));
+    _UnlockNote();
+
+    return true;
+}
+
+bool NoteSetResponseCacheTTL(const char *api, uint32_t ttlSecs)
+{
+    if (api == NULL || strlen(api) >= CACHE_API_MAX) {
+        return false;
+    }
+
+    bool success = true;
+    _LockNote();
+    int rule = _cacheRule(api);
+    if (rule >= 0 && cacheEntries != NULL) {
+        _cacheInvalidate(rule);
+    }
+    if (ttlSecs == 0) {
+        if (rule >= 0) {
+            cacheRules[rule].api[0] = '\0';
+        }
+    } else {
+        for (int i = 0 ; rule < 0 && i < CACHE_RULES_MAX ; i++) {
+            if (cacheRules[i].api[0] == '\0') {
+                strlcpy(cacheRules[i].api, api, CACHE_API_MAX);
+                rule = i;
+            }
+        }
+        if (rule >= 0) {
+            cacheRules[rule].ttlMs = (ttlSecs * 1000);
+        } else {
+            success = false;
+        }
+    }
+    _UnlockNote();
+
+    return success;
+}
+
+void NoteResponseCacheInvalidate(const char *api)
+{
+    _LockNote();
+    if (cacheEntries != NULL) {
+        if (api == NULL) {
+            _cacheInvalidate(-1);
+        } else {
+            const int rule = _cacheRule(api);
+            if (rule >= 0) {
+                _cacheInvalidate(rule);
+            }
+        }
+    }
+    _UnlockNote();
+}
+
+void NoteGetResponseCacheStats(NoteResponseCacheStats *stats)
+{
+    if (stats == NULL) {
+        return;
+    }
+    _LockNote();
+    memcpy(stats, &cacheStats, sizeof(*stats));
+    _UnlockNote();
+}
+
+/*!
+ @internal
+
+ @brief Save the response cache into a context, which takes it over.
+
+ @param ctx The context to save the cache into.
+ */
+void _noteCacheContextSave(NoteContext *ctx)
+{
+    ctx->cacheEntries = cacheEntries;
+    ctx->cacheCapacity = cacheCapacity;
+    ctx->cacheMaxBytes = cacheMaxBytes;
+    memcpy(&ctx->cacheStats, &cacheStats, sizeof(ctx->cacheStats));
+}
+
+/*!
+ @internal
+
+ @brief Restore the response cache from a context.
+
+ @param ctx The context to restore the cache from, or NULL for a disabled
+        cache.
+ */
+void _noteCacheContextRestore(const NoteContext *ctx)
+{
+    if (ctx == NULL) {
+        cacheEntries = NULL;
+        cacheCapacity = 0;
+        cacheMaxBytes = 0;
+        memset(&cacheStats, 0, sizeof(cacheStats));
+        return;
+    }
+
+    cacheEntries = (NoteCacheEntry *)ctx->cacheEntries;
+    cacheCapacity = ctx->cacheCapacity;
+    cacheMaxBytes = ctx->cacheMaxBytes;
+    memcpy(&cacheStats, &ctx->cacheStats, sizeof(cacheStats));
+}
+
+/*!
+ @internal
+
+ @brief Free the response cache held by a context.
+
+ @param ctx The context holding the cache.
+ */
+void _noteCacheContextFree(NoteContext *ctx)
+{
+    NoteCacheEntry *entries = (NoteCacheEntry *)ctx->cacheEntries;
+    for (uint8_t i = 0 ; entries != NULL && i < ctx->cacheCapacity ; i++) {
+        _Free(entries[i].text);
+    }
+    _Free(entries);
+    ctx->cacheEntries = NULL;
+    ctx->cacheCapacity = 0;
+    ctx->cacheMaxBytes = 0;
+    memset(&ctx->cacheStats, 0, sizeof(ctx->cacheStats));
+}
@@ -83,7 +83,7 @@ typedef struct {
     const unsigned char *json;
     size_t position;
 } error;
-static error global_error = { NULL, 0 };
+static NOTE_C_THREAD_LOCAL error global_error = { NULL, 0 };
 
 // Forwards
 NOTE_C_STATIC J *_jNew_Item(void);
@@ -900,6 +900,19 @@ NOTE_C_STATIC parse_buffer *_skip_utf8_bom(parse_buffer * const buffer)
 
 /* Parse an object - create a new root, and populate. */
 N_CJSON_PUBLIC(J *) JParseWithOpts(const char *value, const char **return_parse_end, Jbool require_null_terminated)
+{
+    size_t buffer_length;
+
+    if (value == NULL) {
+        return JParseWithLengthOpts(NULL, 0, return_parse_end, require_null_terminated);
+    }
+
+    buffer_length = strlen((const char*)value) + 1;   // Trailing '\0'
+    return JParseWithLengthOpts(value, buffer_length, return_parse_end, require_null_terminated);
+}
+
+/* Parse an object of known length - create a new root, and populate. */
+N_CJSON_PUBLIC(J *) JParseWithLengthOpts(const char *value, size_t buffer_length, const char **return_parse_end, Jbool require_null_terminated)
 {
     parse_buffer buffer = { 0, 0, 0, 0 };
     J *item = NULL;
@@ -908,12 +921,12 @@ N_CJSON_PUBLIC(J *) JParseWithOpts(const char *value, const char **return_parse_
     global_error.json = NULL;
     global_error.position = 0;
 
-    if (value == NULL) {
+    if (value == NULL || buffer_length == 0) {
         goto fail;
     }
 
     buffer.content = (const unsigned char*)value;
-    buffer.length = strlen((const char*)value) + 1;   // Trailing '\0'
+    buffer.length = buffer_length;
     buffer.offset = 0;
 
     item = _jNew_Item();
@@ -978,6 +991,20 @@ N_CJSON_PUBLIC(J *) JParse(const char *value)
     return JParseWithOpts(value, 0, 0);
 }
 
+/*!
+ @brief Parse JSON of a known length, which need not be null-terminated, and
+        return a `J` object representing it.
+
+ @param value The JSON.
+ @param buffer_length The length of the JSON.
+
+ @returns A `J` object or NULL on error (e.g. the JSON was invalid).
+ */
+N_CJSON_PUBLIC(J *) JParseWithLength(const char *value, size_t buffer_length)
+{
+    return JParseWithLengthOpts(value, buffer_length, 0, 0);
+}
+
 #define cjson_min(a, b) ((a < b) ? a : b)
 
 NOTE_C_STATIC unsigned char *_print(const J * const item, Jbool format, Jbool omitempty)
@@ -1094,6 +1121,160 @@ N_CJSON_PUBLIC(char *) JPrintBuffered(const J *item, int prebuffer, Jbool fmt)
     return (char*)p.buffer;
 }
 
+/*!
+ @brief Get the unformatted string representation of a `J` object, leaving
+        room after it for the caller to append to the string in place.
+
+ The string is rendered directly into the buffer that is returned, rather than
+ being copied into an exactly-sized allocation, so only one buffer is ever
+ held. The buffer MUST be freed by the caller with `JFree`.
+
+ @param item The JSON object to get the unformatted string representation of.
+ @param reserve The number of bytes to leave free after the terminator.
+ @param length Set to the length of the string, if not NULL.
+
+ @returns The string or NULL on error.
+ */
+char *_jPrintUnformattedReserve(const J *item, size_t reserve, size_t *length)
+{
+    static const size_t default_buffer_size = 128;
+    printbuffer p = { 0, 0, 0, 0, 0, 0, 0 };
+
+    if (item == NULL) {
+        return NULL;
+    }
+
+    p.buffer = (unsigned char*)_Malloc(default_buffer_size);
+    if (!p.buffer) {
+        return NULL;
+    }
+    p.length = default_buffer_size;
+
+    if (!_print_value(item, &p)) {
+        if (p.buffer != NULL) {
+            _Free(p.buffer);
+        }
+        return NULL;
+    }
+    _update_offset(&p);
+
+    // Grow the buffer only if the reserve does not fit in what is left of it
+    if (_ensure(&p, reserve) == NULL) {
+        if (p.buffer != NULL) {
+            _Free(p.buffer);
+        }
+        return NULL;
+    }
+    p.buffer[p.offset] = '\0';
+
+    if (length != NULL) {
+        *length = p.offset;
+    }
+    return (char*)p.buffer;
+}
+
+/*!
+ @brief Create a null item, as `JParse` would for the literal `null`.
+
+ @returns The item, or NULL if there is insufficient memory.
+ */
+J *_jCreateNull(void)
+{
+    J *item = _jNew_Item();
+    if (item != NULL) {
+        item->type = JNULL;
+    }
+    return item;
+}
+
+/*!
+ @brief Create a number item from its JSON text, exactly as `JParse` would.
+
+ @param text The text of the number, which need not be null-terminated.
+ @param length The length of the text.
+
+ @returns The item, or NULL if the text is not entirely a number or there is
+          insufficient memory.
+ */
+J *_jCreateNumberText(const char *text, size_t length)
+{
+    parse_buffer buffer = { 0, 0, 0, 0 };
+    buffer.content = (const unsigned char*)text;
+    buffer.length = length;
+
+    J *item = _jNew_Item();
+    if (item == NULL) {
+        return NULL;
+    }
+    if (!_parse_number(item, &buffer) || buffer.offset != length) {
+        JDelete(item);
+        return NULL;
+    }
+    return item;
+}
+
+/*!
+ @brief Convert the JSON text of a number, exactly as `JParse` would, without
+        allocating an item.
+
+ @param text The text, which begins with the number and need not be
+        null-terminated.
+ @param length The length of the text.
+ @param number (out) The value of the number, if not NULL.
+ @param integer (out) The integer value of the number, if not NULL.
+
+ @returns The length of the number's text, or zero (0) if the text does not
+          begin with a number.
+ */
+size_t _jParseNumberText(const char *text, size_t length, JNUMBER *number, JINTEGER *integer)
+{
+    parse_buffer buffer = { 0, 0, 0, 0 };
+    buffer.content = (const unsigned char*)text;
+    buffer.length = length;
+
+    J item;
+    memset(&item, 0, sizeof(item));
+    if (!_parse_number(&item, &buffer)) {
+        return 0;
+    }
+    if (number != NULL) {
+        *number = item.valuenumber;
+    }
+    if (integer != NULL) {
+        *integer = item.valueint;
+    }
+    return buffer.offset;
+}
+
+/*!
+ @brief Print an item, exactly as `JPrintUnformatted` would, into a buffer
+        without allocating.
+
+ @param item The item.
+ @param buf (out) The buffer, in which the text is null-terminated.
+ @param buflen The length of the buffer.
+
+ @returns The length of the text, or zero (0) if it does not fit.
+ */
+size_t _jPrintValueText(const J *item, char *buf, size_t buflen)
+{
+    printbuffer p = { 0, 0, 0, 0, 0, 0, 0 };
+
+    if (item == NULL || buf == NULL || buflen == 0) {
+        return 0;
+    }
+
+    p.buffer = (unsigned char*)buf;
+    p.length = buflen;
+    p.noalloc = true;
+    if (!_print_value(item, &p)) {
+        buf[0] = '\0';
+        return 0;
+    }
+    _update_offset(&p);
+    return p.offset;
+}
+
 NOTE_C_STATIC Jbool _printPreallocated(J *item, char *buf, const int len, const Jbool fmt, const Jbool omit)
 {
     printbuffer p = { 0, 0, 0, 0, 0, 0, 0 };
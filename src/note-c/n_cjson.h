@@ -188,6 +188,9 @@ N_CJSON_PUBLIC(J *) JParse(const char *value);
 /* ParseWithOpts allows you to require (and check) that the JSON is null terminated, and to retrieve the pointer to the final byte parsed. */
 /* If you supply a ptr in return_parse_end and parsing fails, then return_parse_end will contain a pointer to the error so will match JGetErrorPtr(). */
 N_CJSON_PUBLIC(J *) JParseWithOpts(const char *value, const char **return_parse_end, Jbool require_null_terminated);
+/* ParseWithLength parses no more than buffer_length bytes of the JSON, which need not be null terminated, so that the caller needn't scan it for its length. */
+N_CJSON_PUBLIC(J *) JParseWithLength(const char *value, size_t buffer_length);
+N_CJSON_PUBLIC(J *) JParseWithLengthOpts(const char *value, size_t buffer_length, const char **return_parse_end, Jbool require_null_terminated);
 
 /* Render a J entity to text for transfer/storage. */
 N_CJSON_PUBLIC(char *) JPrint(const J *item);
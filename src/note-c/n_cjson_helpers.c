@@ -14,6 +14,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include <ctype.h>
 #include "n_lib.h"
 
 bool JIsPresent(J *json, const char *field)
@@ -212,6 +213,446 @@ bool JContainsString(J *json, const char *field, const char *substr)
     return (strstr(item->valuestring, substr) != NULL);
 }
 
+// State of a scan for fields in the text of a JSON object
+typedef struct {
+    const char *json;
+    size_t length;
+    size_t offset;
+    JField *fields;
+    size_t count;
+    int found;
+} jscan;
+
+NOTE_C_STATIC bool _jScanValue(jscan *scan, uint32_t match, uint32_t within, size_t depth);
+
+// Skip whitespace, as JParse does
+NOTE_C_STATIC void _jScanSkip(jscan *scan)
+{
+    while (scan->offset < scan->length && (unsigned char)scan->json[scan->offset] <= 32) {
+        scan->offset++;
+    }
+}
+
+// Get the value of the hex digits of a \u escape, which is zero (0) if they
+// are invalid, as JParse has it
+NOTE_C_STATIC unsigned long _jScanHex4(const char *text)
+{
+    unsigned long value = 0;
+    for (int i = 0; i < 4; i++) {
+        const char ch = text[i];
+        value <<= 4;
+        if (ch >= '0' && ch <= '9') {
+            value |= (unsigned long)(ch - '0');
+        } else if (ch >= 'a' && ch <= 'f') {
+            value |= (unsigned long)(ch - 'a' + 10);
+        } else if (ch >= 'A' && ch <= 'F') {
+            value |= (unsigned long)(ch - 'A' + 10);
+        } else {
+            return 0;
+        }
+    }
+    return value;
+}
+
+// Check the string beginning at the quote at *offset and advance past it,
+// accepting exactly what JParse accepts. When a buffer is supplied, the
+// decoded string is placed in it, truncated to fit.
+NOTE_C_STATIC bool _jScanString(const char *text, size_t length, size_t *offset, char *buf, size_t buflen)
+{
+    // Find the closing quote, skipping the character after each backslash
+    size_t end = *offset + 1;
+    while (end < length && text[end] != '"') {
+        if (text[end] == '\\') {
+            end++;
+        }
+        end++;
+    }
+    if (end >= length) {
+        return false;
+    }
+
+    size_t in = *offset + 1;
+    size_t out = 0;
+    bool truncated = false;
+    while (in < end) {
+        uint8_t utf8[4];
+        size_t utf8Len = 1;
+        utf8[0] = (uint8_t)text[in++];
+        if (utf8[0] == '\\') {
+            const char escape = text[in++];
+            switch (escape) {
+            case 'b':
+                utf8[0] = '\b';
+                break;
+            case 'f':
+                utf8[0] = '\f';
+                break;
+            case 'n':
+                utf8[0] = '\n';
+                break;
+            case 'r':
+                utf8[0] = '\r';
+                break;
+            case 't':
+                utf8[0] = '\t';
+                break;
+            case '"':
+            case '\\':
+            case '/':
+                utf8[0] = (uint8_t)escape;
+                break;
+            case 'u': {
+                if ((end - in) < 4) {
+                    return false;
+                }
+                unsigned long codepoint = _jScanHex4(&text[in]);
+                in += 4;
+                if (codepoint >= 0xDC00 && codepoint <= 0xDFFF) {
+                    return false;
+                }
+                // A high surrogate must be followed by the escape of a low one
+                if (codepoint >= 0xD800 && codepoint <= 0xDBFF) {
+                    if ((end - in) < 6 || text[in] != '\\' || text[in+1] != 'u') {
+                        return false;
+                    }
+                    const unsigned long low = _jScanHex4(&text[in+2]);
+                    if (low < 0xDC00 || low > 0xDFFF) {
+                        return false;
+                    }
+                    in += 6;
+                    codepoint = 0x10000 + (((codepoint & 0x3FF) << 10) | (low & 0x3FF));
+                }
+                if (codepoint < 0x80) {
+                    utf8[0] = (uint8_t)codepoint;
+                } else if (codepoint < 0x800) {
+                    utf8[0] = (uint8_t)(0xC0 | (codepoint >> 6));
+                    utf8[1] = (uint8_t)(0x80 | (codepoint & 0x3F));
+                    utf8Len = 2;
+                } else if (codepoint < 0x10000) {
+                    utf8[0] = (uint8_t)(0xE0 | (codepoint >> 12));
+                    utf8[1] = (uint8_t)(0x80 | ((codepoint >> 6) & 0x3F));
+                    utf8[2] = (uint8_t)(0x80 | (codepoint & 0x3F));
+                    utf8Len = 3;
+                } else {
+                    utf8[0] = (uint8_t)(0xF0 | (codepoint >> 18));
+                    utf8[1] = (uint8_t)(0x80 | ((codepoint >> 12) & 0x3F));
+                    utf8[2] = (uint8_t)(0x80 | ((codepoint >> 6) & 0x3F));
+                    utf8[3] = (uint8_t)(0x80 | (codepoint & 0x3F));
+                    utf8Len = 4;
+                }
+                break;
+            }
+            default:
+                return false;
+            }
+        }
+        if (buf != NULL && !truncated) {
+            truncated = ((out + utf8Len) >= buflen);
+            if (!truncated) {
+                memcpy(&buf[out], utf8, utf8Len);
+                out += utf8Len;
+            }
+        }
+    }
+    if (buf != NULL && buflen > 0) {
+        buf[out] = '\0';
+    }
+    *offset = end + 1;
+    return true;
+}
+
+// Determine whether a name matches the part of a field's path at a depth,
+// where *last is set if that part is the final one of the path
+NOTE_C_STATIC bool _jScanNameMatches(const char *path, size_t depth, const char *name, size_t nameLen, bool *last)
+{
+    for (; depth > 0; depth--) {
+        path = strchr(path, '.');
+        if (path == NULL) {
+            return false;
+        }
+        path++;
+    }
+    const char *end = strchr(path, '.');
+    const size_t partLen = (end == NULL ? strlen(path) : (size_t)(end - path));
+    if (partLen != nameLen) {
+        return false;
+    }
+    for (size_t i = 0; i < nameLen; i++) {
+        if (tolower((unsigned char)path[i]) != tolower((unsigned char)name[i])) {
+            return false;
+        }
+    }
+    *last = (end == NULL);
+    return true;
+}
+
+// Scan the members of an object, where `within` holds the fields whose paths
+// lead into it
+NOTE_C_STATIC bool _jScanObject(jscan *scan, uint32_t within, size_t depth)
+{
+    if (depth >= N_CJSON_NESTING_LIMIT) {
+        return false;
+    }
+    scan->offset++;
+    _jScanSkip(scan);
+    if (scan->offset < scan->length && scan->json[scan->offset] == '}') {
+        scan->offset++;
+        return true;
+    }
+    for (;;) {
+        _jScanSkip(scan);
+        if (scan->offset >= scan->length || scan->json[scan->offset] != '"') {
+            return false;
+        }
+        const char *name = &scan->json[scan->offset+1];
+        if (!_jScanString(scan->json, scan->length, &scan->offset, NULL, 0)) {
+            return false;
+        }
+        const size_t nameLen = (size_t)(&scan->json[scan->offset-1] - name);
+        _jScanSkip(scan);
+        if (scan->offset >= scan->length || scan->json[scan->offset] != ':') {
+            return false;
+        }
+        scan->offset++;
+
+        // Sort the fields whose paths lead here into those that name this
+        // member and those that lead further into it
+        uint32_t match = 0;
+        uint32_t further = 0;
+        for (size_t i = 0; within != 0 && i < scan->count; i++) {
+            bool last;
+            if ((within & (1UL << i)) && _jScanNameMatches(scan->fields[i].name, depth, name, nameLen, &last)) {
+                if (last) {
+                    match |= (1UL << i);
+                } else {
+                    further |= (1UL << i);
+                }
+            }
+        }
+        if (!_jScanValue(scan, match, further, depth + 1)) {
+            return false;
+        }
+
+        _jScanSkip(scan);
+        if (scan->offset >= scan->length) {
+            return false;
+        }
+        const char ch = scan->json[scan->offset++];
+        if (ch == '}') {
+            return true;
+        }
+        if (ch != ',') {
+            return false;
+        }
+    }
+}
+
+// Scan the elements of an array, within which no field is located
+NOTE_C_STATIC bool _jScanArray(jscan *scan, size_t depth)
+{
+    if (depth >= N_CJSON_NESTING_LIMIT) {
+        return false;
+    }
+    scan->offset++;
+    _jScanSkip(scan);
+    if (scan->offset < scan->length && scan->json[scan->offset] == ']') {
+        scan->offset++;
+        return true;
+    }
+    for (;;) {
+        if (!_jScanValue(scan, 0, 0, depth + 1)) {
+            return false;
+        }
+        _jScanSkip(scan);
+        if (scan->offset >= scan->length) {
+            return false;
+        }
+        const char ch = scan->json[scan->offset++];
+        if (ch == ']') {
+            return true;
+        }
+        if (ch != ',') {
+            return false;
+        }
+    }
+}
+
+// Scan a value, locating it as each field in `match`, and the fields in
+// `within` inside it
+NOTE_C_STATIC bool _jScanValue(jscan *scan, uint32_t match, uint32_t within, size_t depth)
+{
+    _jScanSkip(scan);
+    if (scan->offset >= scan->length) {
+        return false;
+    }
+
+    const size_t start = scan->offset;
+    const char *text = &scan->json[start];
+    const size_t remaining = (scan->length - start);
+    int type = JInvalid;
+    if (*text == '{') {
+        type = JObject;
+        if (!_jScanObject(scan, within, depth)) {
+            return false;
+        }
+    } else if (*text == '[') {
+        type = JArray;
+        if (!_jScanArray(scan, depth)) {
+            return false;
+        }
+    } else if (*text == '"') {
+        type = JString;
+        if (!_jScanString(scan->json, scan->length, &scan->offset, NULL, 0)) {
+            return false;
+        }
+    } else if (*text == '-' || (*text >= '0' && *text <= '9')) {
+        type = JNumber;
+        const size_t numberLen = _jParseNumberText(text, remaining, NULL, NULL);
+        if (numberLen == 0) {
+            return false;
+        }
+        scan->offset += numberLen;
+    } else if (remaining >= 4 && strncmp(text, "null", 4) == 0) {
+        type = JNULL;
+        scan->offset += 4;
+    } else if (remaining >= 4 && strncmp(text, "true", 4) == 0) {
+        type = JTrue;
+        scan->offset += 4;
+    } else if (remaining >= 5 && strncmp(text, "false", 5) == 0) {
+        type = JFalse;
+        scan->offset += 5;
+    } else {
+        return false;
+    }
+
+    for (size_t i = 0; match != 0 && i < scan->count; i++) {
+        if ((match & (1UL << i)) && scan->fields[i].type == JInvalid) {
+            scan->fields[i].value = text;
+            scan->fields[i].length = (scan->offset - start);
+            scan->fields[i].type = type;
+            scan->found++;
+        }
+    }
+    return true;
+}
+
+int JScan(const char *json, JField *fields, size_t count)
+{
+    return JScanWithLength(json, ((json != NULL) ? strlen(json) : 0), fields, count);
+}
+
+int JScanWithLength(const char *json, size_t length, JField *fields, size_t count)
+{
+    if (fields == NULL) {
+        count = 0;
+    }
+    if (count > JSCAN_FIELDS_MAX) {
+        count = JSCAN_FIELDS_MAX;
+    }
+    for (size_t i = 0; i < count; i++) {
+        fields[i].value = NULL;
+        fields[i].length = 0;
+        fields[i].type = JInvalid;
+    }
+    if (json == NULL) {
+        return -1;
+    }
+
+    jscan scan = { 0 };
+    scan.json = json;
+    scan.length = length;
+    scan.fields = fields;
+    scan.count = count;
+
+    // Only the members of an object are located
+    uint32_t within = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (fields[i].name != NULL) {
+            within |= (1UL << i);
+        }
+    }
+    _jScanSkip(&scan);
+    if (scan.offset >= scan.length || json[scan.offset] != '{') {
+        within = 0;
+    }
+
+    if (!_jScanValue(&scan, 0, within, 0)) {
+        for (size_t i = 0; i < count; i++) {
+            fields[i].value = NULL;
+            fields[i].length = 0;
+            fields[i].type = JInvalid;
+        }
+        return -1;
+    }
+    return scan.found;
+}
+
+JNUMBER JFieldNumber(const JField *field)
+{
+    JNUMBER number = 0.0;
+    if (field != NULL && field->type == JNumber) {
+        _jParseNumberText(field->value, field->length, &number, NULL);
+    }
+    return number;
+}
+
+JINTEGER JFieldInt(const JField *field)
+{
+    JINTEGER integer = 0;
+    if (field != NULL && field->type == JNumber) {
+        _jParseNumberText(field->value, field->length, NULL, &integer);
+    }
+    return integer;
+}
+
+bool JFieldBool(const JField *field)
+{
+    return (field != NULL && field->type == JTrue);
+}
+
+bool JFieldString(const JField *field, char *buf, size_t buflen)
+{
+    if (buf == NULL || buflen == 0) {
+        return false;
+    }
+    buf[0] = '\0';
+    if (field == NULL || field->type != JString) {
+        return false;
+    }
+    size_t offset = 0;
+    return _jScanString(field->value, field->length, &offset, buf, buflen);
+}
+
+bool JFieldIsNullString(const JField *field)
+{
+    if (field == NULL) {
+        return false;
+    }
+    if (field->type == JInvalid) {
+        return true;
+    }
+    return (field->type == JString && field->length == 2);
+}
+
+bool JFieldContains(const JField *field, const char *substr)
+{
+    if (field == NULL || field->type != JString || substr == NULL) {
+        return false;
+    }
+    const size_t substrLen = strlen(substr);
+    if (substrLen == 0 || substrLen > (field->length - 2)) {
+        return false;
+    }
+    const char *text = (field->value + 1);
+    const size_t last = (field->length - 2 - substrLen);
+    for (size_t i = 0; i <= last; i++) {
+        if (memcmp(&text[i], substr, substrLen) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
 bool JAddBinaryToObject(J *json, const char *fieldName, const void *binaryData, uint32_t binaryDataLen)
 {
     if (json == NULL) {
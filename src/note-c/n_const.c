@@ -26,6 +26,7 @@ const char *c_mem = "mem";
 const char *c_newline = "\r\n";
 const char *c_null = "null";
 const char *c_nullstring = "";
+const char *c_overflow = "{overflow}";
 const char *c_req = "req";
 const char *c_status = "status";
 const char *c_true = "true";
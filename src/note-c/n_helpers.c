@@ -30,42 +30,42 @@
 // of wrapper, just implemented here as a convenience to all developers.
 
 // Time-related suppression timer and cache
-static uint32_t timeBaseSetAtMs = 0;
-static JTIME timeBaseSec = 0;
-static bool timeBaseSetManually = false;
-static uint32_t suppressionTimerSecs = 10;
-static uint32_t refreshTimerSecs = 86400;
-static uint32_t timeTimer = 0;
-static uint32_t timeRefreshTimer = 0;
-static bool zoneStillUnavailable = true;
-static bool zoneForceRefresh = false;
-static char curZone[10] = {0};
-static char curArea[64] = {0};
-static char curCountry[8] = "";
-static int curZoneOffsetMins = 0;
+static NOTE_C_THREAD_LOCAL uint32_t timeBaseSetAtMs = 0;
+static NOTE_C_THREAD_LOCAL JTIME timeBaseSec = 0;
+static NOTE_C_THREAD_LOCAL bool timeBaseSetManually = false;
+static NOTE_C_THREAD_LOCAL uint32_t suppressionTimerSecs = 10;
+static NOTE_C_THREAD_LOCAL uint32_t refreshTimerSecs = 86400;
+static NOTE_C_THREAD_LOCAL uint32_t timeTimer = 0;
+static NOTE_C_THREAD_LOCAL uint32_t timeRefreshTimer = 0;
+static NOTE_C_THREAD_LOCAL bool zoneStillUnavailable = true;
+static NOTE_C_THREAD_LOCAL bool zoneForceRefresh = false;
+static NOTE_C_THREAD_LOCAL char curZone[NOTE_C_CACHED_ZONE_SIZE] = {0};
+static NOTE_C_THREAD_LOCAL char curArea[NOTE_C_CACHED_AREA_SIZE] = {0};
+static NOTE_C_THREAD_LOCAL char curCountry[NOTE_C_CACHED_COUNTRY_SIZE] = "";
+static NOTE_C_THREAD_LOCAL int curZoneOffsetMins = 0;
 
 // Location-related suppression timer and cache
-static uint32_t locationTimer = 0;
-static char locationLastErr[64] = {0};
-static bool locationValid = false;
+static NOTE_C_THREAD_LOCAL uint32_t locationTimer = 0;
+static NOTE_C_THREAD_LOCAL char locationLastErr[NOTE_C_CACHED_ERR_SIZE] = {0};
+static NOTE_C_THREAD_LOCAL bool locationValid = false;
 
 // Connection-related suppression timer and cache
-static uint32_t connectivityTimer = 0;
-static bool cardConnected = false;
+static NOTE_C_THREAD_LOCAL uint32_t connectivityTimer = 0;
+static NOTE_C_THREAD_LOCAL bool cardConnected = false;
 
 // Status suppression timer
-static uint32_t statusTimer = 0;
+static NOTE_C_THREAD_LOCAL uint32_t statusTimer = 0;
 
 // DEPRECATED. Turbo communications mode, for special use cases and well-tested
 // hardware.
-bool cardTurboIO = false;
+NOTE_C_THREAD_LOCAL bool cardTurboIO = false;
 
 // Service config-related suppression timer and cache
-static uint32_t serviceConfigTimer = 0;
-static char scDevice[128] = {0};
-static char scSN[128] = {0};
-static char scProduct[128] = {0};
-static char scService[128] = {0};
+static NOTE_C_THREAD_LOCAL uint32_t serviceConfigTimer = 0;
+static NOTE_C_THREAD_LOCAL char scDevice[NOTE_C_CACHED_CONFIG_SIZE] = {0};
+static NOTE_C_THREAD_LOCAL char scSN[NOTE_C_CACHED_CONFIG_SIZE] = {0};
+static NOTE_C_THREAD_LOCAL char scProduct[NOTE_C_CACHED_CONFIG_SIZE] = {0};
+static NOTE_C_THREAD_LOCAL char scService[NOTE_C_CACHED_CONFIG_SIZE] = {0};
 
 // For date conversions
 #define daysByMonth(y) ((y)&03||(y)==0?normalYearDaysByMonth:leapYearDaysByMonth)
@@ -1310,16 +1310,14 @@ bool NoteGetEnv(const char *variable, const char *defaultVal, char *buf, uint32_
     J *req = NoteNewRequest("env.get");
     if (req != NULL) {
         JAddStringToObject(req, "name", variable);
-        J *rsp = NoteRequestResponse(req);
+        JField fields[2] = {{ c_err, NULL, 0, JInvalid }, { "text", NULL, 0, JInvalid }};
+        char *rsp = _noteRequestResponseFields(req, fields, 2);
         if (rsp != NULL) {
-            if (!NoteResponseError(rsp)) {
-                success = true;
-                char *val = JGetString(rsp, "text");
-                if (val[0] != '\0') {
-                    strlcpy(buf, val, buflen);
-                }
+            success = true;
+            if (!JFieldIsNullString(&fields[1])) {
+                JFieldString(&fields[1], buf, buflen);
             }
-            NoteDeleteResponse(rsp);
+            JFree(rsp);
         }
     }
     return success;
@@ -1346,12 +1344,11 @@ bool NoteIsConnected(void)
 bool NoteIsConnectedST(void)
 {
     if (_timerExpiredSecs(&connectivityTimer, suppressionTimerSecs)) {
-        J *rsp = NoteRequestResponse(NoteNewRequest("hub.status"));
+        JField fields[2] = {{ c_err, NULL, 0, JInvalid }, { "connected", NULL, 0, JInvalid }};
+        char *rsp = _noteRequestResponseFields(NoteNewRequest("hub.status"), fields, 2);
         if (rsp != NULL) {
-            if (!NoteResponseError(rsp)) {
-                cardConnected = JGetBool(rsp, "connected");
-            }
-            NoteDeleteResponse(rsp);
+            cardConnected = JFieldBool(&fields[1]);
+            JFree(rsp);
         }
     }
     return cardConnected;
@@ -2176,13 +2173,12 @@ bool NoteGetVoltage(JNUMBER *voltage)
 {
     bool success = false;
     *voltage = 0.0;
-    J *rsp = NoteRequestResponse(NoteNewRequest("card.voltage"));
+    JField fields[2] = {{ c_err, NULL, 0, JInvalid }, { "value", NULL, 0, JInvalid }};
+    char *rsp = _noteRequestResponseFields(NoteNewRequest("card.voltage"), fields, 2);
     if (rsp != NULL) {
-        if (!NoteResponseError(rsp)) {
-            *voltage = JGetNumber(rsp, "value");
-            success = true;
-        }
-        NoteDeleteResponse(rsp);
+        *voltage = JFieldNumber(&fields[1]);
+        success = true;
+        JFree(rsp);
     }
     return success;
 }
@@ -2198,13 +2194,12 @@ bool NoteGetTemperature(JNUMBER *temp)
 {
     bool success = false;
     *temp = 0.0;
-    J *rsp = NoteRequestResponse(NoteNewRequest("card.temp"));
+    JField fields[2] = {{ c_err, NULL, 0, JInvalid }, { "value", NULL, 0, JInvalid }};
+    char *rsp = _noteRequestResponseFields(NoteNewRequest("card.temp"), fields, 2);
     if (rsp != NULL) {
-        if (!NoteResponseError(rsp)) {
-            *temp = JGetNumber(rsp, "value");
-            success = true;
-        }
-        NoteDeleteResponse(rsp);
+        *temp = JFieldNumber(&fields[1]);
+        success = true;
+        JFree(rsp);
     }
     return success;
 }
@@ -2598,3 +2593,104 @@ void NoteTurboIO(bool enable)
 
     NOTE_C_LOG_WARN("NoteTurboIO is deprecated and has no effect.");
 }
+
+/*!
+ @internal
+
+ @brief Save the state cached by the helpers into a context.
+
+ @param ctx The context to save the state into.
+ */
+void _noteHelpersContextSave(NoteContext *ctx)
+{
+    ctx->turboIO = cardTurboIO;
+    ctx->timeBaseSetAtMs = timeBaseSetAtMs;
+    ctx->timeBaseSec = timeBaseSec;
+    ctx->timeBaseSetManually = timeBaseSetManually;
+    ctx->timeSuppressionSecs = suppressionTimerSecs;
+    ctx->timeRefreshSecs = refreshTimerSecs;
+    ctx->timeTimer = timeTimer;
+    ctx->timeRefreshTimer = timeRefreshTimer;
+    ctx->zoneStillUnavailable = zoneStillUnavailable;
+    ctx->zoneForceRefresh = zoneForceRefresh;
+    memcpy(ctx->zone, curZone, sizeof(ctx->zone));
+    memcpy(ctx->area, curArea, sizeof(ctx->area));
+    memcpy(ctx->country, curCountry, sizeof(ctx->country));
+    ctx->zoneOffsetMins = curZoneOffsetMins;
+    ctx->locationTimer = locationTimer;
+    memcpy(ctx->locationLastErr, locationLastErr, sizeof(ctx->locationLastErr));
+    ctx->locationValid = locationValid;
+    ctx->connectivityTimer = connectivityTimer;
+    ctx->cardConnected = cardConnected;
+    ctx->statusTimer = statusTimer;
+    ctx->serviceConfigTimer = serviceConfigTimer;
+    memcpy(ctx->scDevice, scDevice, sizeof(ctx->scDevice));
+    memcpy(ctx->scSN, scSN, sizeof(ctx->scSN));
+    memcpy(ctx->scProduct, scProduct, sizeof(ctx->scProduct));
+    memcpy(ctx->scService, scService, sizeof(ctx->scService));
+}
+
+/*!
+ @internal
+
+ @brief Restore the state cached by the helpers from a context.
+
+ @param ctx The context to restore the state from, or NULL for an empty cache.
+ */
+void _noteHelpersContextRestore(const NoteContext *ctx)
+{
+    if (ctx == NULL) {
+        cardTurboIO = false;
+        timeBaseSetAtMs = 0;
+        timeBaseSec = 0;
+        timeBaseSetManually = false;
+        suppressionTimerSecs = 10;
+        refreshTimerSecs = 86400;
+        timeTimer = 0;
+        timeRefreshTimer = 0;
+        zoneStillUnavailable = true;
+        zoneForceRefresh = false;
+        curZone[0] = '\0';
+        curArea[0] = '\0';
+        curCountry[0] = '\0';
+        curZoneOffsetMins = 0;
+        locationTimer = 0;
+        locationLastErr[0] = '\0';
+        locationValid = false;
+        connectivityTimer = 0;
+        cardConnected = false;
+        statusTimer = 0;
+        serviceConfigTimer = 0;
+        scDevice[0] = '\0';
+        scSN[0] = '\0';
+        scProduct[0] = '\0';
+        scService[0] = '\0';
+        return;
+    }
+
+    cardTurboIO = ctx->turboIO;
+    timeBaseSetAtMs = ctx->timeBaseSetAtMs;
+    timeBaseSec = ctx->timeBaseSec;
+    timeBaseSetManually = ctx->timeBaseSetManually;
+    suppressionTimerSecs = ctx->timeSuppressionSecs;
+    refreshTimerSecs = ctx->timeRefreshSecs;
+    timeTimer = ctx->timeTimer;
+    timeRefreshTimer = ctx->timeRefreshTimer;
+    zoneStillUnavailable = ctx->zoneStillUnavailable;
+    zoneForceRefresh = ctx->zoneForceRefresh;
+    memcpy(curZone, ctx->zone, sizeof(curZone));
+    memcpy(curArea, ctx->area, sizeof(curArea));
+    memcpy(curCountry, ctx->country, sizeof(curCountry));
+    curZoneOffsetMins = ctx->zoneOffsetMins;
+    locationTimer = ctx->locationTimer;
+    memcpy(locationLastErr, ctx->locationLastErr, sizeof(locationLastErr));
+    locationValid = ctx->locationValid;
+    connectivityTimer = ctx->connectivityTimer;
+    cardConnected = ctx->cardConnected;
+    statusTimer = ctx->statusTimer;
+    serviceConfigTimer = ctx->serviceConfigTimer;
+    memcpy(scDevice, ctx->scDevice, sizeof(scDevice));
+    memcpy(scSN, ctx->scSN, sizeof(scSN));
+    memcpy(scProduct, ctx->scProduct, sizeof(scProduct));
+    memcpy(scService, ctx->scService, sizeof(scService));
+}
@@ -60,25 +60,43 @@ mutexFn hookUnlockI2C = NULL;
   @brief  Hook for the calling platform's Notecard lock function.
 */
 /**************************************************************************/
-mutexFn hookLockNote = NULL;
+NOTE_C_THREAD_LOCAL mutexFn hookLockNote = NULL;
 //**************************************************************************/
 /*!
   @brief  Hook for the calling platform's Notecard lock function.
 */
 /**************************************************************************/
-mutexFn hookUnlockNote = NULL;
+NOTE_C_THREAD_LOCAL mutexFn hookUnlockNote = NULL;
 //**************************************************************************/
 /*!
   @brief  Hook for the calling platform's transaction initiation function.
 */
 /**************************************************************************/
-NOTE_C_STATIC txnStartFn hookTransactionStart = NULL;
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL txnStartFn hookTransactionStart = NULL;
 //**************************************************************************/
 /*!
   @brief  Hook for the calling platform's transaction completion function.
 */
 /**************************************************************************/
-NOTE_C_STATIC txnStopFn hookTransactionStop = NULL;
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL txnStopFn hookTransactionStop = NULL;
+//**************************************************************************/
+/*!
+  @brief  Hook for the calling platform's response notification function.
+*/
+/**************************************************************************/
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL responseWaitFn hookResponseWait = NULL;
+//**************************************************************************/
+/*!
+  @brief  Hook for the calling platform's CRC32 function.
+*/
+/**************************************************************************/
+NOTE_C_STATIC crc32Fn hookCRC32 = NULL;
+//**************************************************************************/
+/*!
+  @brief  Hook for the calling platform's memory reallocation function.
+*/
+/**************************************************************************/
+NOTE_C_STATIC reallocFn hookRealloc = NULL;
 //**************************************************************************/
 /*!
   @brief  Hook for the calling platform's memory allocation function.
@@ -112,62 +130,76 @@ NOTE_C_STATIC getMsFn hookGetMs = NULL;
   - NOTE_C_INTERFACE_I2C
 */
 /**************************************************************************/
-NOTE_C_STATIC volatile int hookActiveInterface = NOTE_C_INTERFACE_NONE;
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL volatile int hookActiveInterface = NOTE_C_INTERFACE_NONE;
 
 //**************************************************************************/
 /*!
   @brief  Hook for the calling platform's Serial reset function.
 */
 /**************************************************************************/
-NOTE_C_STATIC serialResetFn hookSerialReset = NULL;
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL serialResetFn hookSerialReset = NULL;
 //**************************************************************************/
 /*!
   @brief  Hook for the calling platform's Serial transmit function.
 */
 /**************************************************************************/
-NOTE_C_STATIC serialTransmitFn hookSerialTransmit = NULL;
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL serialTransmitFn hookSerialTransmit = NULL;
 //**************************************************************************/
 /*!
   @brief  Hook for the calling platform's Serial data available function.
 */
 /**************************************************************************/
-NOTE_C_STATIC serialAvailableFn hookSerialAvailable = NULL;
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL serialAvailableFn hookSerialAvailable = NULL;
 //**************************************************************************/
 /*!
   @brief  Hook for the calling platform's Serial receive function.
 */
 /**************************************************************************/
-NOTE_C_STATIC serialReceiveFn hookSerialReceive = NULL;
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL serialReceiveFn hookSerialReceive = NULL;
+//**************************************************************************/
+/*!
+  @brief  Hook for the calling platform's optional Serial bulk receive
+  function.
+*/
+/**************************************************************************/
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL serialReceiveBulkFn hookSerialReceiveBulk = NULL;
+//**************************************************************************/
+/*!
+  @brief  Hook for the calling platform's optional Serial flow control
+  function.
+*/
+/**************************************************************************/
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL serialClearToSendFn hookSerialClearToSend = NULL;
 //**************************************************************************/
 /*!
   @brief  Hook for the calling platform's I2C address.
 */
 /**************************************************************************/
-NOTE_C_STATIC uint32_t i2cAddress = 0;
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL uint32_t i2cAddress = 0;
 //**************************************************************************/
 /*!
   @brief  Hook for the calling platform's I2C maximum segment size, in bytes.
 */
 /**************************************************************************/
-NOTE_C_STATIC uint32_t i2cMax = 0;
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL uint32_t i2cMax = 0;
 //**************************************************************************/
 /*!
   @brief  Hook for the calling platform's I2C reset function.
 */
 /**************************************************************************/
-NOTE_C_STATIC i2cResetFn hookI2CReset = NULL;
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL i2cResetFn hookI2CReset = NULL;
 //**************************************************************************/
 /*!
   @brief  Hook for the calling platform's transmit function.
 */
 /**************************************************************************/
-NOTE_C_STATIC i2cTransmitFn hookI2CTransmit = NULL;
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL i2cTransmitFn hookI2CTransmit = NULL;
 //**************************************************************************/
 /*!
   @brief  Hook for the calling platform's I2C receive function.
 */
 /**************************************************************************/
-NOTE_C_STATIC i2cReceiveFn hookI2CReceive = NULL;
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL i2cReceiveFn hookI2CReceive = NULL;
 #ifdef NOTE_C_HEARTBEAT_CALLBACK
 //**************************************************************************/
 /*!
@@ -188,13 +220,17 @@ NOTE_C_STATIC int noteLogLevel = NOTE_C_LOG_LEVEL;
 
 // Internal hooks
 typedef bool (*nNoteResetFn) (void);
-typedef const char * (*nTransactionFn) (const char *, size_t, char **, uint32_t);
+typedef const char * (*nTransactionFn) (const char *, size_t, char **, size_t *, uint32_t);
 typedef const char * (*nReceiveFn) (uint8_t *, uint32_t *, bool, uint32_t, uint32_t *);
 typedef const char * (*nTransmitFn) (const uint8_t *, uint32_t, bool);
-NOTE_C_STATIC nNoteResetFn notecardReset = NULL;
-NOTE_C_STATIC nTransactionFn notecardTransaction = NULL;
-NOTE_C_STATIC nReceiveFn notecardChunkedReceive = NULL;
-NOTE_C_STATIC nTransmitFn notecardChunkedTransmit = NULL;
+typedef const char * (*nResponseQueryFn) (uint32_t *);
+typedef const char * (*nResponseReceiveFn) (uint32_t, char **, size_t *);
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL nNoteResetFn notecardReset = NULL;
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL nTransactionFn notecardTransaction = NULL;
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL nReceiveFn notecardChunkedReceive = NULL;
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL nTransmitFn notecardChunkedTransmit = NULL;
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL nResponseQueryFn notecardResponseQuery = NULL;
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL nResponseReceiveFn notecardResponseReceive = NULL;
 
 //**************************************************************************/
 /*!
@@ -221,12 +257,16 @@ NOTE_C_STATIC void _noteSetActiveInterface(int interface)
         notecardTransaction = _serialNoteTransaction;
         notecardChunkedReceive = _serialChunkedReceive;
         notecardChunkedTransmit = _serialChunkedTransmit;
+        notecardResponseQuery = _serialNoteResponseQuery;
+        notecardResponseReceive = _serialNoteResponseReceive;
         break;
     case NOTE_C_INTERFACE_I2C:
         notecardReset = _i2cNoteReset;
         notecardTransaction = _i2cNoteTransaction;
         notecardChunkedReceive = _i2cNoteChunkedReceive;
         notecardChunkedTransmit = _i2cNoteChunkedTransmit;
+        notecardResponseQuery = _i2cNoteResponseQuery;
+        notecardResponseReceive = _i2cNoteResponseReceive;
         break;
     default:
         hookActiveInterface = NOTE_C_INTERFACE_NONE; // unrecognized interfaces are disabled
@@ -234,6 +274,8 @@ NOTE_C_STATIC void _noteSetActiveInterface(int interface)
         notecardTransaction = NULL;
         notecardChunkedReceive = NULL;
         notecardChunkedTransmit = NULL;
+        notecardResponseQuery = NULL;
+        notecardResponseReceive = NULL;
         break;
     }
 }
@@ -318,6 +360,27 @@ void NoteSetFnTransaction(txnStartFn startFn, txnStopFn stopFn)
     _UnlockNote();
 }
 
+void NoteSetFnResponseWait(responseWaitFn waitFn)
+{
+    _LockNote();
+    hookResponseWait = waitFn;
+    _UnlockNote();
+}
+
+void NoteSetFnCRC32(crc32Fn crcFn)
+{
+    _LockNote();
+    hookCRC32 = crcFn;
+    _UnlockNote();
+}
+
+void NoteSetFnRealloc(reallocFn reallocHook)
+{
+    _LockNote();
+    hookRealloc = reallocHook;
+    _UnlockNote();
+}
+
 void NoteSetFnMutex(mutexFn lockI2Cfn, mutexFn unlockI2Cfn, mutexFn lockNotefn, mutexFn unlockNotefn)
 {
     hookLockI2C = lockI2Cfn;
@@ -347,6 +410,8 @@ void NoteSetFnSerial(serialResetFn resetFn, serialTransmitFn transmitFn,
     hookSerialTransmit = transmitFn;
     hookSerialAvailable = availFn;
     hookSerialReceive = receiveFn;
+    hookSerialReceiveBulk = NULL;
+    hookSerialClearToSend = NULL;
 
     _noteSetActiveInterface(NOTE_C_INTERFACE_SERIAL);
 
@@ -378,6 +443,20 @@ void NoteSetFnSerialDefault(serialResetFn resetFn, serialTransmitFn transmitFn,
     _UnlockNote();
 }
 
+void NoteSetFnSerialReceiveBulk(serialReceiveBulkFn receiveBulkFn)
+{
+    _LockNote();
+    hookSerialReceiveBulk = receiveBulkFn;
+    _UnlockNote();
+}
+
+void NoteSetFnSerialFlowControl(serialClearToSendFn clearToSendFn)
+{
+    _LockNote();
+    hookSerialClearToSend = clearToSendFn;
+    _UnlockNote();
+}
+
 void NoteSetFnI2C(uint32_t notecardAddr, uint32_t maxTransmitSize,
                   i2cResetFn resetFn, i2cTransmitFn transmitFn,
                   i2cReceiveFn receiveFn)
@@ -439,6 +518,89 @@ void NoteSetFnDisabled(void)
 
 }
 
+void NoteContextSave(NoteContext *ctx)
+{
+    if (ctx == NULL) {
+        return;
+    }
+
+    _LockNote();
+    ctx->interface = hookActiveInterface;
+    ctx->serialReset = hookSerialReset;
+    ctx->serialTransmit = hookSerialTransmit;
+    ctx->serialAvailable = hookSerialAvailable;
+    ctx->serialReceive = hookSerialReceive;
+    ctx->serialReceiveBulk = hookSerialReceiveBulk;
+    ctx->serialClearToSend = hookSerialClearToSend;
+    ctx->i2cAddress = i2cAddress;
+    ctx->i2cMax = i2cMax;
+    ctx->i2cReset = hookI2CReset;
+    ctx->i2cTransmit = hookI2CTransmit;
+    ctx->i2cReceive = hookI2CReceive;
+    ctx->transactionStart = hookTransactionStart;
+    ctx->transactionStop = hookTransactionStop;
+    ctx->responseWait = hookResponseWait;
+    _noteRequestContextSave(ctx);
+    _noteI2cContextSave(ctx);
+    _noteSerialContextSave(ctx);
+    _noteCacheContextSave(ctx);
+    _noteHelpersContextSave(ctx);
+    _UnlockNote();
+}
+
+void NoteContextRestore(const NoteContext *ctx)
+{
+    _LockNote();
+    if (ctx == NULL) {
+        hookSerialReset = NULL;
+        hookSerialTransmit = NULL;
+        hookSerialAvailable = NULL;
+        hookSerialReceive = NULL;
+        hookSerialReceiveBulk = NULL;
+        hookSerialClearToSend = NULL;
+        i2cAddress = 0;
+        i2cMax = 0;
+        hookI2CReset = NULL;
+        hookI2CTransmit = NULL;
+        hookI2CReceive = NULL;
+        hookTransactionStart = NULL;
+        hookTransactionStop = NULL;
+        hookResponseWait = NULL;
+        _noteSetActiveInterface(NOTE_C_INTERFACE_NONE);
+    } else {
+        hookSerialReset = ctx->serialReset;
+        hookSerialTransmit = ctx->serialTransmit;
+        hookSerialAvailable = ctx->serialAvailable;
+        hookSerialReceive = ctx->serialReceive;
+        hookSerialReceiveBulk = ctx->serialReceiveBulk;
+        hookSerialClearToSend = ctx->serialClearToSend;
+        i2cAddress = ctx->i2cAddress;
+        i2cMax = ctx->i2cMax;
+        hookI2CReset = ctx->i2cReset;
+        hookI2CTransmit = ctx->i2cTransmit;
+        hookI2CReceive = ctx->i2cReceive;
+        hookTransactionStart = ctx->transactionStart;
+        hookTransactionStop = ctx->transactionStop;
+        hookResponseWait = ctx->responseWait;
+        _noteSetActiveInterface(ctx->interface);
+    }
+    _noteRequestContextRestore(ctx);
+    _noteI2cContextRestore(ctx);
+    _noteSerialContextRestore(ctx);
+    _noteCacheContextRestore(ctx);
+    _noteHelpersContextRestore(ctx);
+    _UnlockNote();
+}
+
+void NoteContextFree(NoteContext *ctx)
+{
+    if (ctx == NULL) {
+        return;
+    }
+
+    _noteCacheContextFree(ctx);
+}
+
 // Runtime hook wrappers
 
 void NoteSetLogLevel(int level)
@@ -698,6 +860,79 @@ void _noteTransactionStop(void)
     }
 }
 
+//**************************************************************************/
+/*!
+  @brief  Wait for the Notecard to signal that a response is ready using the
+          platform-specific hook.
+
+  @param   timeoutMs The maximum amount of time, in milliseconds, to wait.
+            Passing zero (0) waits for up to `CARD_RESPONSE_WAIT_MAX_MS`.
+
+  @returns `true` if the hook performed the wait, or `false` if no hook is
+           set and the caller should fall back to its polling delay.
+*/
+/**************************************************************************/
+bool _noteResponseWait(uint32_t timeoutMs)
+{
+    if (hookResponseWait != NULL) {
+        // Bound the wait, so that a missed notification degrades to slow
+        // polling rather than a stalled transaction.
+        if (timeoutMs == 0 || timeoutMs > CARD_RESPONSE_WAIT_MAX_MS) {
+            timeoutMs = CARD_RESPONSE_WAIT_MAX_MS;
+        }
+        hookResponseWait(timeoutMs);
+        return true;
+    }
+    return false;
+}
+
+//**************************************************************************/
+/*!
+  @brief  Compute a CRC32 using the platform-specific hook.
+
+  @param   data The buffer.
+  @param   length The length of the buffer.
+  @param   crc Set to the CRC32 of the buffer, if the hook was called.
+
+  @returns `true` if the hook computed the CRC32, or `false` if no hook is set
+           and the caller should fall back to its software implementation.
+*/
+/**************************************************************************/
+bool _noteCRC32(const void *data, size_t length, uint32_t *crc)
+{
+    if (hookCRC32 != NULL) {
+        *crc = hookCRC32(data, length);
+        return true;
+    }
+    return false;
+}
+
+//**************************************************************************/
+/*!
+  @brief  Resize a block of memory using the platform-specific hook, or, if
+  no hook is set, by moving it to a new block.
+
+  @param   ptr The block, or NULL.
+  @param   size The new size of the block.
+  @param   used The bytes of the block to keep, should it be moved.
+
+  @returns the resized block, or NULL if there is insufficient memory, in
+           which case `ptr` remains valid.
+*/
+/**************************************************************************/
+void *_noteRealloc(void *ptr, size_t size, size_t used)
+{
+    if (hookRealloc != NULL) {
+        return hookRealloc(ptr, size);
+    }
+    void *p = _Malloc(size);
+    if (p != NULL && ptr != NULL) {
+        memcpy(p, ptr, used);
+        _Free(ptr);
+    }
+    return p;
+}
+
 void NoteGetFnDebugOutput(debugOutputFn *fn)
 {
     if (fn != NULL) {
@@ -734,6 +969,33 @@ void NoteGetFnTransaction(txnStartFn *startFn, txnStopFn *stopFn)
     _UnlockNote();
 }
 
+void NoteGetFnResponseWait(responseWaitFn *waitFn)
+{
+    _LockNote();
+    if (waitFn != NULL) {
+        *waitFn = hookResponseWait;
+    }
+    _UnlockNote();
+}
+
+void NoteGetFnCRC32(crc32Fn *crcFn)
+{
+    _LockNote();
+    if (crcFn != NULL) {
+        *crcFn = hookCRC32;
+    }
+    _UnlockNote();
+}
+
+void NoteGetFnRealloc(reallocFn *reallocHook)
+{
+    _LockNote();
+    if (reallocHook != NULL) {
+        *reallocHook = hookRealloc;
+    }
+    _UnlockNote();
+}
+
 void NoteGetFnMutex(mutexFn *lockI2Cfn, mutexFn *unlockI2Cfn, mutexFn *lockNotefn,
                     mutexFn *unlockNotefn)
 {
@@ -809,6 +1071,24 @@ void NoteGetFnSerial(serialResetFn *resetFn, serialTransmitFn *transmitFn,
     _UnlockNote();
 }
 
+void NoteGetFnSerialReceiveBulk(serialReceiveBulkFn *receiveBulkFn)
+{
+    _LockNote();
+    if (receiveBulkFn != NULL) {
+        *receiveBulkFn = hookSerialReceiveBulk;
+    }
+    _UnlockNote();
+}
+
+void NoteGetFnSerialFlowControl(serialClearToSendFn *clearToSendFn)
+{
+    _LockNote();
+    if (clearToSendFn != NULL) {
+        *clearToSendFn = hookSerialClearToSend;
+    }
+    _UnlockNote();
+}
+
 void NoteGetFnI2C(uint32_t *notecardAddr, uint32_t *maxTransmitSize,
                   i2cResetFn *resetFn, i2cTransmitFn *transmitFn,
                   i2cReceiveFn *receiveFn)
@@ -907,6 +1187,46 @@ char _noteSerialReceive(void)
     return '\0';
 }
 
+//**************************************************************************/
+/*!
+  @brief  Obtain all available characters, up to and including the
+  end-of-packet character, from the Serial bus using the optional
+  platform-specific bulk receive hook.
+  @param   buffer A buffer to receive characters into.
+  @param   size The size of the buffer in bytes.
+  @param   eop The end-of-packet character.
+  @param   received (out) The number of characters received.
+  @returns `true` if the bulk receive hook is available, `false` if the caller
+  must fall back to receiving a single character at a time.
+*/
+/**************************************************************************/
+bool _noteSerialReceiveBulk(uint8_t *buffer, size_t size, char eop, size_t *received)
+{
+    if (hookActiveInterface == NOTE_C_INTERFACE_SERIAL && hookSerialReceiveBulk != NULL) {
+        *received = hookSerialReceiveBulk(buffer, size, eop);
+        return true;
+    }
+    return false;
+}
+
+//**************************************************************************/
+/*!
+  @brief  Determine whether the Notecard may be sent more data over the Serial
+  bus using the optional platform-specific flow control hook.
+  @param   clear (out) `true` if data may be sent, `false` otherwise.
+  @returns `true` if the flow control hook is available, `false` if the caller
+  must fall back to fixed delays.
+*/
+/**************************************************************************/
+bool _noteSerialClearToSend(bool *clear)
+{
+    if (hookActiveInterface == NOTE_C_INTERFACE_SERIAL && hookSerialClearToSend != NULL) {
+        *clear = hookSerialClearToSend();
+        return true;
+    }
+    return false;
+}
+
 //**************************************************************************/
 /*!
   @brief  Reset the I2C bus using the platform-specific hook.
@@ -1032,6 +1352,8 @@ bool _noteHardReset(void)
   @param   response [out] A c-string buffer that will contain the newline ('\n')
             terminated JSON response from the Notercard. If NULL, no response
             will be captured.
+  @param   responseLen [out] The length of the response, excluding its
+            null-terminator, if not NULL.
   @param   timeoutMs The maximum amount of time, in milliseconds, to wait
             for data to arrive. Passing zero (0) disables the timeout.
 
@@ -1039,12 +1361,12 @@ bool _noteHardReset(void)
   or the hook has not been set.
 */
 /**************************************************************************/
-const char *_noteJSONTransaction(const char *request, size_t reqLen, char **response, uint32_t timeoutMs)
+const char *_noteJSONTransaction(const char *request, size_t reqLen, char **response, size_t *responseLen, uint32_t timeoutMs)
 {
     if (notecardTransaction == NULL || hookActiveInterface == NOTE_C_INTERFACE_NONE) {
         return "a valid interface must be selected";
     }
-    return notecardTransaction(request, reqLen, response, timeoutMs);
+    return notecardTransaction(request, reqLen, response, responseLen, timeoutMs);
 }
 
 /**************************************************************************/
@@ -1091,3 +1413,39 @@ const char *_noteChunkedTransmit(const uint8_t *buffer, uint32_t size, bool dela
     }
     return notecardChunkedTransmit(buffer, size, delay);
 }
+
+/**************************************************************************/
+/*!
+  @brief  Query, without blocking, whether the Notecard has a response
+  waiting to be received using the currently-set platform hook.
+  @param   available (out) Non-zero when a response is waiting. With I2C,
+            this is the number of bytes the Notecard is waiting to send.
+  @returns  A c-string with an error, or `NULL` if no error ocurred.
+*/
+/**************************************************************************/
+const char *_noteResponseQuery(uint32_t *available)
+{
+    if (notecardResponseQuery == NULL || hookActiveInterface == NOTE_C_INTERFACE_NONE) {
+        return "a valid interface must be selected";
+    }
+    return notecardResponseQuery(available);
+}
+
+/**************************************************************************/
+/*!
+  @brief  Receive a response, previously reported by `_noteResponseQuery`,
+  using the currently-set platform hook.
+  @param   available The value reported by `_noteResponseQuery`.
+  @param   response (out) The newline-terminated response, allocated by this
+            function and freed by the caller.
+  @param   responseLen (out) The length of the response, if not NULL.
+  @returns  A c-string with an error, or `NULL` if no error ocurred.
+*/
+/**************************************************************************/
+const char *_noteResponseReceive(uint32_t available, char **response, size_t *responseLen)
+{
+    if (notecardResponseReceive == NULL || hookActiveInterface == NOTE_C_INTERFACE_NONE) {
+        return "a valid interface must be selected";
+    }
+    return notecardResponseReceive(available, response, responseLen);
+}
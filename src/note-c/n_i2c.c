@@ -17,7 +17,24 @@
 
 // Forwards
 NOTE_C_STATIC void _delayIO(void);
+NOTE_C_STATIC void _i2cYield(uint32_t delayMs);
+NOTE_C_STATIC void _i2cYieldUntilResponse(uint32_t timeoutMs);
+NOTE_C_STATIC uint32_t _i2cPacedMs(uint32_t delayMs);
 NOTE_C_STATIC const char * _i2cNoteQueryLength(uint32_t * available, uint32_t timeoutMs);
+NOTE_C_STATIC const char *_i2cReceiveResponse(uint32_t available, char **response, size_t *responseLen);
+NOTE_C_STATIC const char *_i2cStreamResponse(NoteJStream *stream, uint32_t available);
+
+// Adaptive pacing state. The level defaults to the maximum, which reproduces
+// the legacy fixed delays, until adaptive pacing is explicitly enabled.
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL bool i2cPacingAdaptive = false;
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL uint8_t i2cPacingLevel = NOTE_I2C_PACING_LEVEL_MAX;
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL uint8_t i2cPacingFloor = 0;
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL uint8_t i2cPacingStreak = 0;
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL uint16_t i2cPacingSettled = 0;
+
+// Bus sharing state. When disabled, the I2C lock is held for the duration of
+// each transaction, as it always has been.
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL bool i2cBusSharing = false;
 
 /**************************************************************************/
 /*!
@@ -30,10 +47,224 @@ NOTE_C_STATIC const char * _i2cNoteQueryLength(uint32_t * available, uint32_t ti
 NOTE_C_STATIC void _delayIO(void)
 {
     if (!cardTurboIO) {
-        _DelayMs(6);
+        const uint32_t delayMs = _i2cPacedMs(CARD_REQUEST_I2C_IO_DELAY_MS);
+        if (delayMs) {
+            _i2cYield(delayMs);
+        }
+    }
+}
+
+/**************************************************************************/
+/*!
+  @brief  Wait between physical I2C transfers.
+
+  When bus sharing is enabled, the I2C lock held by the caller is released
+  for the duration of the wait, so that other devices on the bus may be
+  serviced, even when there is no delay to wait out.
+
+  @param   delayMs The delay, in milliseconds, or zero (0) to only yield the
+            bus.
+*/
+/**************************************************************************/
+NOTE_C_STATIC void _i2cYield(uint32_t delayMs)
+{
+    const bool sharing = i2cBusSharing;
+    if (sharing) {
+        _UnlockI2C();
+    }
+    if (delayMs) {
+        _DelayMs(delayMs);
+    }
+    if (sharing) {
+        _LockI2C();
+    }
+}
+
+/**************************************************************************/
+/*!
+  @brief  Wait for the Notecard to signal a response, otherwise for a single
+  polling interval.
+
+  When bus sharing is enabled, the I2C lock held by the caller is released
+  while waiting.
+
+  @param   timeoutMs The longest, in milliseconds, to wait for the signal.
+*/
+/**************************************************************************/
+NOTE_C_STATIC void _i2cYieldUntilResponse(uint32_t timeoutMs)
+{
+    const bool sharing = i2cBusSharing;
+    if (sharing) {
+        _UnlockI2C();
+    }
+    if (!_ResponseWait(timeoutMs)) {
+        _DelayMs(CARD_REQUEST_I2C_POLL_MS);
+    }
+    if (sharing) {
+        _LockI2C();
     }
 }
 
+/**************************************************************************/
+/*!
+  @brief  Scale one of the legacy I2C delays by the current pacing level.
+
+  @param   delayMs The delay, in milliseconds, used at the maximum level.
+
+  @returns The delay, in milliseconds, to use at the current level, rounded up
+           so that any level above zero produces a non-zero delay.
+*/
+/**************************************************************************/
+NOTE_C_STATIC uint32_t _i2cPacedMs(uint32_t delayMs)
+{
+    return (((delayMs * i2cPacingLevel) + (NOTE_I2C_PACING_LEVEL_MAX - 1)) / NOTE_I2C_PACING_LEVEL_MAX);
+}
+
+/**************************************************************************/
+/*!
+  @brief  Report the outcome of an I2C exchange to the adaptive pacing engine.
+
+  @details  A failure (NACK, transfer timeout or CRC retry) marks the current
+             level as unsafe, raises the floor above it and backs off
+             exponentially. A run of `CARD_I2C_PACING_SUCCESS_STREAK` clean
+             transactions steps the level back down by one, but never below
+             the floor, so the engine converges on the fastest level that has
+             not recently failed. After `CARD_I2C_PACING_FLOOR_DECAY_STREAK`
+             clean transactions in a row the floor itself is lowered by one,
+             so that a single transient failure does not pin the pacing
+             forever. This has no effect unless adaptive pacing is enabled and
+             the I2C interface is active.
+
+  @param   success `true` if the exchange completed cleanly.
+*/
+/**************************************************************************/
+void _i2cPacingFeedback(bool success)
+{
+    if (!i2cPacingAdaptive || NoteGetActiveInterface() != NOTE_C_INTERFACE_I2C) {
+        return;
+    }
+
+    if (success) {
+        if (i2cPacingFloor && ++i2cPacingSettled >= CARD_I2C_PACING_FLOOR_DECAY_STREAK) {
+            --i2cPacingFloor;
+            i2cPacingSettled = 0;
+            NOTE_C_LOG_DEBUG("i2c pacing floor decreased");
+        }
+        if (i2cPacingLevel > i2cPacingFloor && ++i2cPacingStreak >= CARD_I2C_PACING_SUCCESS_STREAK) {
+            --i2cPacingLevel;
+            i2cPacingStreak = 0;
+            NOTE_C_LOG_DEBUG("i2c pacing level decreased");
+        }
+        return;
+    }
+
+    i2cPacingStreak = 0;
+    i2cPacingSettled = 0;
+    if (i2cPacingLevel >= i2cPacingFloor && i2cPacingLevel < NOTE_I2C_PACING_LEVEL_MAX) {
+        i2cPacingFloor = (i2cPacingLevel + 1);
+    }
+    uint16_t level = (i2cPacingLevel ? (i2cPacingLevel * 2) : 1);
+    if (level < i2cPacingFloor) {
+        level = i2cPacingFloor;
+    }
+    i2cPacingLevel = (level > NOTE_I2C_PACING_LEVEL_MAX ? NOTE_I2C_PACING_LEVEL_MAX : (uint8_t)level);
+    NOTE_C_LOG_DEBUG("i2c pacing level increased");
+}
+
+void NoteSetI2CPacingAdaptive(bool enable, const NoteI2CPacing *profile)
+{
+    _LockI2C();
+    i2cPacingAdaptive = enable;
+    i2cPacingStreak = 0;
+    i2cPacingSettled = 0;
+    if (!enable) {
+        i2cPacingLevel = NOTE_I2C_PACING_LEVEL_MAX;
+        i2cPacingFloor = 0;
+    } else if (profile == NULL) {
+        i2cPacingLevel = 0;
+        i2cPacingFloor = 0;
+    } else {
+        i2cPacingFloor = (profile->floor > NOTE_I2C_PACING_LEVEL_MAX ? NOTE_I2C_PACING_LEVEL_MAX : profile->floor);
+        i2cPacingLevel = (profile->level > NOTE_I2C_PACING_LEVEL_MAX ? NOTE_I2C_PACING_LEVEL_MAX : profile->level);
+        if (i2cPacingLevel < i2cPacingFloor) {
+            i2cPacingLevel = i2cPacingFloor;
+        }
+    }
+    _UnlockI2C();
+}
+
+void NoteSetI2CBusSharing(bool enable)
+{
+    _LockI2C();
+    i2cBusSharing = enable;
+    _UnlockI2C();
+}
+
+bool NoteGetI2CBusSharing(void)
+{
+    return i2cBusSharing;
+}
+
+/*!
+ @internal
+
+ @brief Save the I2C pacing and bus sharing state into a context.
+
+ @param ctx The context to save the state into.
+ */
+void _noteI2cContextSave(NoteContext *ctx)
+{
+    ctx->i2cPacingAdaptive = i2cPacingAdaptive;
+    ctx->i2cPacingLevel = i2cPacingLevel;
+    ctx->i2cPacingFloor = i2cPacingFloor;
+    ctx->i2cPacingStreak = i2cPacingStreak;
+    ctx->i2cPacingSettled = i2cPacingSettled;
+    ctx->i2cBusSharing = i2cBusSharing;
+}
+
+/*!
+ @internal
+
+ @brief Restore the I2C pacing and bus sharing state from a context.
+
+ @param ctx The context to restore the state from, or NULL for the legacy
+        fixed pacing without bus sharing.
+ */
+void _noteI2cContextRestore(const NoteContext *ctx)
+{
+    if (ctx == NULL) {
+        i2cPacingAdaptive = false;
+        i2cPacingLevel = NOTE_I2C_PACING_LEVEL_MAX;
+        i2cPacingFloor = 0;
+        i2cPacingStreak = 0;
+        i2cPacingSettled = 0;
+        i2cBusSharing = false;
+        return;
+    }
+
+    i2cPacingAdaptive = ctx->i2cPacingAdaptive;
+    i2cPacingLevel = ctx->i2cPacingLevel;
+    i2cPacingFloor = ctx->i2cPacingFloor;
+    i2cPacingStreak = ctx->i2cPacingStreak;
+    i2cPacingSettled = ctx->i2cPacingSettled;
+    i2cBusSharing = ctx->i2cBusSharing;
+}
+
+bool NoteGetI2CPacing(NoteI2CPacing *profile)
+{
+    _LockI2C();
+    const bool adaptive = i2cPacingAdaptive;
+    if (profile != NULL) {
+        profile->level = i2cPacingLevel;
+        profile->floor = i2cPacingFloor;
+        profile->ioDelayMs = (uint16_t)_i2cPacedMs(CARD_REQUEST_I2C_IO_DELAY_MS);
+        profile->chunkDelayMs = (uint16_t)_i2cPacedMs(CARD_REQUEST_I2C_CHUNK_DELAY_MS);
+        profile->segmentDelayMs = (uint16_t)_i2cPacedMs(CARD_REQUEST_I2C_SEGMENT_DELAY_MS);
+    }
+    _UnlockI2C();
+    return adaptive;
+}
+
 /**************************************************************************/
 /*!
   @brief  Query the Notecard for the length of cached data.
@@ -50,20 +281,27 @@ NOTE_C_STATIC const char * _i2cNoteQueryLength(uint32_t * available,
 {
     uint8_t dummy_buffer = 0;
 
-    for (const uint32_t startMs = _GetMs() ; !(*available) ; _DelayMs(50)) {
+    for (const uint32_t startMs = _GetMs() ; !(*available) ;) {
         // Send a dummy I2C transaction to prime the Notecard
         const char *err = _I2CReceive(_I2CAddress(), &dummy_buffer, 0, available);
         if (err) {
+            _i2cPacingFeedback(false);
             NOTE_C_LOG_ERROR(err);
             return err;
         }
 
-        // If we've timed out, return an error
+        // If we've timed out, return an error. The Notecard is simply still
+        // busy, which says nothing about the bus, so pacing is left alone.
         if (timeoutMs && _GetMs() - startMs >= timeoutMs) {
             const char *err = ERRSTR("timeout: no response from Notecard {io}", c_iotimeout);
             NOTE_C_LOG_ERROR(err);
             return err;
         }
+
+        // Sleep until the Notecard signals a response, otherwise poll
+        if (!(*available)) {
+            _i2cYieldUntilResponse(timeoutMs ? (timeoutMs - (_GetMs() - startMs)) : 0);
+        }
     }
     return NULL;
 }
@@ -78,13 +316,15 @@ NOTE_C_STATIC const char * _i2cNoteQueryLength(uint32_t * available,
   @param   response [out] A pointer to a c-string buffer that will contain the
             newline ('\n') terminated JSON response from the Notercard. If NULL,
             no response will be captured.
+  @param   responseLen [out] The length of the response, excluding its
+            null-terminator, if not NULL.
   @param   timeoutMs The maximum amount of time, in milliseconds, to wait
             for data to arrive. Passing zero (0) disables the timeout.
 
   @returns a c-string with an error, or `NULL` if no error occurred.
 */
 /**************************************************************************/
-const char *_i2cNoteTransaction(const char *request, size_t reqLen, char **response, uint32_t timeoutMs)
+const char *_i2cNoteTransaction(const char *request, size_t reqLen, char **response, size_t *responseLen, uint32_t timeoutMs)
 {
     const char *err = NULL;
 
@@ -93,12 +333,15 @@ const char *_i2cNoteTransaction(const char *request, size_t reqLen, char **respo
 
     // Do not attempt to send a zero-length request
     if (reqLen > 0) {
+        NOTE_C_METRICS_START(transmitMs);
         err = _i2cChunkedTransmit((const uint8_t *)request, reqLen, true);
         if (err) {
             NOTE_C_LOG_ERROR(err);
             _UnlockI2C();
             return err;
         }
+        cardRequestTransmitted = true;
+        NOTE_C_METRICS_PHASE(NOTE_METRICS_PHASE_TRANSMIT, transmitMs);
     }
 
     // If no reply expected, we're done
@@ -108,11 +351,10 @@ const char *_i2cNoteTransaction(const char *request, size_t reqLen, char **respo
     }
 
     // Wait for something to become available
+    NOTE_C_METRICS_START(firstByteMs);
     _delayIO();
 
-    // Allocate a buffer for input, noting that we always put the +1 in the
-    // alloc so we can be assured that it can be null-terminated. This must be
-    // the case because json parsing requires a null-terminated string.
+    // Query the Notecard for the length of the response
     uint32_t available = 0;
     err = _i2cNoteQueryLength(&available, timeoutMs);
     if (err) {
@@ -120,60 +362,88 @@ const char *_i2cNoteTransaction(const char *request, size_t reqLen, char **respo
         _UnlockI2C();
         return err;
     }
-    size_t jsonbufAllocLen = (ALLOC_CHUNK * ((available / ALLOC_CHUNK) + ((available % ALLOC_CHUNK) > 0)));
+    NOTE_C_METRICS_PHASE(NOTE_METRICS_PHASE_FIRST_BYTE, firstByteMs);
+    _i2cYield(0);
+    NOTE_C_METRICS_START(receiveMs);
+    err = _i2cReceiveResponse(available, response, responseLen);
+    NOTE_C_METRICS_PHASE(NOTE_METRICS_PHASE_RECEIVE, receiveMs);
+
+    // Done with the bus
+    _UnlockI2C();
+
+    return err;
+}
+
+/**************************************************************************/
+/*!
+  @brief  Receive a complete JSON response from the Notecard over I2C.
+
+  @param   available The number of bytes the Notecard has reported as
+            available to receive.
+  @param   response [out] A pointer to a c-string buffer that will contain the
+            newline ('\n') terminated JSON response from the Notecard.
+  @param   responseLen [out] The length of the response, excluding its
+            null-terminator, if not NULL.
+
+  @returns a c-string with an error, or `NULL` if no error occurred.
+
+  @note  The caller is responsible for holding the I2C lock.
+*/
+/**************************************************************************/
+NOTE_C_STATIC const char *_i2cReceiveResponse(uint32_t available, char **response, size_t *responseLen)
+{
+    const char *err = NULL;
+
+    // Feed a streamed response to its parser, rather than buffering it
+    if (cardResponseStream != NULL) {
+        *response = NULL;
+        return _i2cStreamResponse(cardResponseStream, available);
+    }
+
+    // Get a buffer for input, sized from the bytes the Notecard reports as
+    // available, noting that there is always room for a null-terminator. This
+    // must be the case because json parsing requires a null-terminated string.
+    size_t jsonbufSize = available;
     uint8_t *jsonbuf = NULL;
-    uint32_t jsonbufLen = 0;
-    if (jsonbufAllocLen) {
-        jsonbuf = (uint8_t *)_Malloc(jsonbufAllocLen + 1);
+    size_t jsonbufLen = 0;
+    if (jsonbufSize) {
+        jsonbuf = _rxBufferAlloc(&jsonbufSize);
         if (jsonbuf == NULL) {
             err = ERRSTR("transaction: jsonbuf malloc failed", c_mem);
             NOTE_C_LOG_ERROR(err);
-            _UnlockI2C();
             return err;
         }
 
         // Receive the Notecard response
         do {
-            uint32_t jsonbufAvailLen = (jsonbufAllocLen - jsonbufLen);
+            uint32_t jsonbufAvailLen = (uint32_t)(jsonbufSize - jsonbufLen);
 
             // Append into the json buffer
             err = _i2cChunkedReceive((uint8_t *)(jsonbuf + jsonbufLen), &jsonbufAvailLen, true, (CARD_INTRA_TRANSACTION_TIMEOUT_SEC * 1000), &available);
             if (err) {
-                _Free(jsonbuf);
+                _rxBufferFree(jsonbuf);
                 NOTE_C_LOG_ERROR(ERRSTR(err, c_iobad));
-                _UnlockI2C();
                 return err;
             }
             jsonbufLen += jsonbufAvailLen;
             jsonbuf[jsonbufLen] = '\0';
 
             if (available) {
-                // When more bytes are available than we have buffer to accommodate
-                // (i.e. overflow), then we allocate blocks of size `ALLOC_CHUNK` to
-                // reduce heap fragmentation.
-                // NOTE: We always put the +1 in the allocation so we can be assured
-                // that it can be null-terminated, because the json parser requires
-                // a null-terminated string.
-                jsonbufAllocLen += (ALLOC_CHUNK * ((available / ALLOC_CHUNK) + ((available % ALLOC_CHUNK) > 0)));
-                uint8_t *jsonbufNew = (uint8_t *)_Malloc(jsonbufAllocLen + 1);
-                if (jsonbufNew == NULL) {
-                    err = ERRSTR("transaction: jsonbuf grow malloc failed", c_mem);
+                // When more bytes are available than we have buffer to
+                // accommodate (i.e. overflow), grow the buffer geometrically,
+                // so that a large response arriving in many chunks is only
+                // copied a few times.
+                err = _rxBufferGrow(&jsonbuf, jsonbufLen, &jsonbufSize, (jsonbufLen + available));
+                if (err) {
                     NOTE_C_LOG_ERROR(err);
-                    _Free(jsonbuf);
-                    _UnlockI2C();
+                    _rxBufferFree(jsonbuf);
                     return err;
                 }
-                memcpy(jsonbufNew, jsonbuf, jsonbufLen);
-                _Free(jsonbuf);
-                jsonbuf = jsonbufNew;
-                NOTE_C_LOG_DEBUG("additional receive buffer chunk allocated");
+                NOTE_C_LOG_DEBUG("receive buffer grown");
             }
         } while (available);
     }
 
-    // Done with the bus
-    _UnlockI2C();
-
     // Null-terminate it, using the +1 space that we'd allocated in the buffer
     if (jsonbuf) {
         jsonbuf[jsonbufLen] = '\0';
@@ -181,9 +451,97 @@ const char *_i2cNoteTransaction(const char *request, size_t reqLen, char **respo
 
     // Return it
     *response = (char *)jsonbuf;
+    if (responseLen != NULL) {
+        *responseLen = jsonbufLen;
+    }
+    return NULL;
+}
+
+/**************************************************************************/
+/*!
+  @brief  Receive a complete JSON response from the Notecard over I2C, feeding
+  each chunk to a parser as it arrives.
+
+  @param   stream The parser to feed.
+  @param   available The number of bytes the Notecard has reported as
+            available to receive.
+
+  @returns a c-string with an error, or `NULL` if no error occurred.
+
+  @note  The caller is responsible for holding the I2C lock.
+*/
+/**************************************************************************/
+NOTE_C_STATIC const char *_i2cStreamResponse(NoteJStream *stream, uint32_t available)
+{
+    // The buffer holds at least a full I2C transfer, which is as much as
+    // `_i2cChunkedReceive` reads at once
+    uint32_t bufferLen = 0;
+    uint8_t *buffer = _jStreamBuffer(stream, &bufferLen);
+
+    while (available) {
+        uint32_t received = bufferLen;
+        const char *err = _i2cChunkedReceive(buffer, &received, true, (CARD_INTRA_TRANSACTION_TIMEOUT_SEC * 1000), &available);
+        if (err) {
+            NOTE_C_LOG_ERROR(ERRSTR(err, c_iobad));
+            return err;
+        }
+        _jStreamFeed(stream, buffer, received);
+    }
+
     return NULL;
 }
 
+/**************************************************************************/
+/*!
+  @brief  Query, without blocking, whether the Notecard has a response ready
+          to be received over I2C.
+
+  @param   available [out] The number of bytes the Notecard is waiting to
+            send, or zero (0) if the response is not yet ready.
+
+  @returns a c-string with an error, or `NULL` if no error occurred.
+*/
+/**************************************************************************/
+const char *_i2cNoteResponseQuery(uint32_t *available)
+{
+    uint8_t dummy_buffer = 0;
+    *available = 0;
+
+    _LockI2C();
+    const char *err = _I2CReceive(_I2CAddress(), &dummy_buffer, 0, available);
+    _UnlockI2C();
+
+    if (err) {
+        _i2cPacingFeedback(false);
+        NOTE_C_LOG_ERROR(err);
+    }
+    return err;
+}
+
+/**************************************************************************/
+/*!
+  @brief  Receive a response, already reported as available by
+          `_i2cNoteResponseQuery`, from the Notecard over I2C.
+
+  @param   available The number of bytes reported by `_i2cNoteResponseQuery`.
+  @param   response [out] A pointer to a c-string buffer that will contain the
+            newline ('\n') terminated JSON response from the Notecard.
+  @param   responseLen [out] The length of the response, excluding its
+            null-terminator, if not NULL.
+
+  @returns a c-string with an error, or `NULL` if no error occurred.
+*/
+/**************************************************************************/
+const char *_i2cNoteResponseReceive(uint32_t available, char **response, size_t *responseLen)
+{
+    _LockI2C();
+    NOTE_C_METRICS_START(receiveMs);
+    const char *err = _i2cReceiveResponse(available, response, responseLen);
+    NOTE_C_METRICS_PHASE(NOTE_METRICS_PHASE_RECEIVE, receiveMs);
+    _UnlockI2C();
+    return err;
+}
+
 //**************************************************************************/
 /*!
   @brief  Initialize or re-initialize the I2C subsystem, returning false if
@@ -199,9 +557,10 @@ bool _i2cNoteReset(void)
     // Claim the I2C bus
     _LockI2C();
     NOTE_C_LOG_DEBUG("resetting I2C interface...");
+    NOTE_C_METRICS_COUNT(resets, 1);
 
     // Reset the I2C subsystem and exit if failure
-    _DelayMs(CARD_REQUEST_I2C_SEGMENT_DELAY_MS);
+    _i2cYield(CARD_REQUEST_I2C_SEGMENT_DELAY_MS);
     notecardReady = _I2CReset(_I2CAddress());
     if (!notecardReady) {
         NOTE_C_LOG_ERROR(ERRSTR("error encountered during I2C reset hook execution", c_err));
@@ -226,13 +585,13 @@ bool _i2cNoteReset(void)
         if (transmitErr) {
             NOTE_C_LOG_ERROR(transmitErr);
             NOTE_C_LOG_ERROR(ERRSTR("error encountered during I2C transmit hook execution", c_err));
-            _DelayMs(CARD_REQUEST_I2C_NACK_WAIT_MS);
+            _i2cYield(CARD_REQUEST_I2C_NACK_WAIT_MS);
             notecardReady = false;
             continue;
         }
 
         // Wait for the Notecard to respond with a carriage return and newline
-        _DelayMs(CARD_REQUEST_I2C_SEGMENT_DELAY_MS);
+        _i2cYield(CARD_REQUEST_I2C_SEGMENT_DELAY_MS);
 
         // Determine if I2C data is available
         // set initial state of variable to perform query
@@ -256,7 +615,7 @@ bool _i2cNoteReset(void)
                 // Introduce delay to relieve system stress.
                 NOTE_C_LOG_ERROR(err);
                 NOTE_C_LOG_ERROR(ERRSTR("error encountered during I2C receive hook execution", c_err));
-                _DelayMs(CARD_REQUEST_I2C_SEGMENT_DELAY_MS);
+                _i2cYield(CARD_REQUEST_I2C_SEGMENT_DELAY_MS);
                 notecardReady = false;
                 continue;
             }
@@ -282,7 +641,7 @@ bool _i2cNoteReset(void)
             // buffer size as a uint16_t).
             chunkLen = (available > 0xFFFF) ? 0xFFFF : available;
 
-            _DelayMs(CARD_REQUEST_I2C_CHUNK_DELAY_MS);
+            _i2cYield(CARD_REQUEST_I2C_CHUNK_DELAY_MS);
         }
 
         // If characters were received and they were ONLY `\r` or `\n`,
@@ -381,6 +740,7 @@ const char *_i2cChunkedReceive(uint8_t *buffer, uint32_t *size, bool delay, uint
         // available to receive from the Notecard.
         const char *err = _I2CReceive(_I2CAddress(), (buffer + received), requested, available);
         if (err) {
+            _i2cPacingFeedback(false);
             *size = received;
             NOTE_C_LOG_ERROR(err);
             return err;
@@ -388,6 +748,7 @@ const char *_i2cChunkedReceive(uint8_t *buffer, uint32_t *size, bool delay, uint
 
         // Add requested bytes to received total
         received += requested;
+        NOTE_C_METRICS_COUNT(bytesIn, requested);
 
         // Once we've received any character, we will no longer wait patiently
         if (requested != 0) {
@@ -415,6 +776,7 @@ const char *_i2cChunkedReceive(uint8_t *buffer, uint32_t *size, bool delay, uint
 
         // If there's something available on the Notecard for us to receive, do it
         if (*available > 0) {
+            _i2cYield(0);
             continue;
         }
 
@@ -429,12 +791,13 @@ const char *_i2cChunkedReceive(uint8_t *buffer, uint32_t *size, bool delay, uint
             if (received) {
                 NOTE_C_LOG_ERROR(ERRSTR("received only partial reply before timeout", c_iobad));
             }
+            _i2cPacingFeedback(false);
             return ERRSTR("timeout: transaction incomplete {io}", c_iotimeout);
         }
 
         // Delay, simply waiting for the Note to process the request
         if (delay) {
-            _DelayMs(50);
+            _i2cYieldUntilResponse(timeoutMs ? (timeoutMs - (_GetMs() - startMs)) : 0);
         }
     }
 
@@ -491,21 +854,26 @@ const char *_i2cChunkedTransmit(const uint8_t *buffer, uint32_t size, bool delay
         }
         estr = _I2CTransmit(_I2CAddress(), chunk, chunkLen);
         if (estr != NULL) {
+            _i2cPacingFeedback(false);
             _I2CReset(_I2CAddress());
             NOTE_C_LOG_ERROR(estr);
             return estr;
         }
+        NOTE_C_METRICS_COUNT(bytesOut, chunkLen);
         chunk += chunkLen;
         size -= chunkLen;
         sentInSegment += chunkLen;
         if (sentInSegment > CARD_REQUEST_I2C_SEGMENT_MAX_LEN) {
             sentInSegment = 0;
             if (delay) {
-                _DelayMs(CARD_REQUEST_I2C_SEGMENT_DELAY_MS);
+                const uint32_t segmentDelayMs = _i2cPacedMs(CARD_REQUEST_I2C_SEGMENT_DELAY_MS);
+                if (segmentDelayMs) {
+                    _i2cYield(segmentDelayMs);
+                }
             }
         }
         if (delay) {
-            _DelayMs(CARD_REQUEST_I2C_CHUNK_DELAY_MS);
+            _i2cYield(_i2cPacedMs(CARD_REQUEST_I2C_CHUNK_DELAY_MS));
         }
     }
 
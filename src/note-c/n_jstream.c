@@ -0,0 +1,730 @@
+// Copyright 2026 Blues Inc.  All rights reserved.
+// Use of this source code is governed by licenses granted by the
+// copyright holder including that found in the LICENSE file.
+
+// A resumable JSON parser, which builds a `J` document from a response as each
+// chunk of it is received from the Notecard, rather than from the complete
+// response once it has been buffered. The CRC that protects the response is
+// computed over the same chunks as they pass through.
+
+#include "n_lib.h"
+
+#include <string.h>
+
+// Parser states
+#define JSTREAM_VALUE           0   // Expecting a value
+#define JSTREAM_ARRAY_FIRST     1   // Expecting a value or the end of an empty array
+#define JSTREAM_OBJECT_FIRST    2   // Expecting a key or the end of an empty object
+#define JSTREAM_KEY             3   // Expecting a key
+#define JSTREAM_COLON           4   // Expecting the colon that follows a key
+#define JSTREAM_STRING          5   // Within a string
+#define JSTREAM_ESCAPE          6   // Following a backslash within a string
+#define JSTREAM_UNICODE         7   // Within the hex digits of a \u escape
+#define JSTREAM_SURROGATE       8   // Expecting the \u escape of a low surrogate
+#define JSTREAM_NUMBER          9   // Within a number
+#define JSTREAM_LITERAL         10  // Within true, false or null
+#define JSTREAM_AFTER_VALUE     11  // Expecting a comma or the end of a container
+#define JSTREAM_DONE            12  // The document is complete
+#define JSTREAM_FAILED          13  // The document is invalid, or memory ran out
+
+// Longest number accepted, which matches the limit of `JParse`
+#define JSTREAM_NUMBER_MAX      64
+
+#ifndef NOTE_C_LOW_MEM
+// The CRC field and the closing brace that follows it
+#define JSTREAM_TAIL_LEN        (CRC_FIELD_LENGTH + 1)
+#endif
+
+struct NoteJStream {
+    J *root;                        // The document, once its first value has begun
+    J *container;                   // The innermost open array or object
+    char *key;                      // The key of the object member being parsed
+    char *text;                     // Scratch buffer for the string being parsed
+    size_t textLen;
+    size_t textAlloc;
+    size_t received;                // Bytes fed, including any after the document
+    const char *literal;            // The literal being matched
+    uint32_t unicode;               // The value of the \u escape being parsed
+    uint32_t highSurrogate;         // A high surrogate awaiting its low surrogate
+    uint16_t depth;
+    uint8_t state;
+    uint8_t count;                  // Characters of the number, literal or escape
+    bool inKey;                     // The string being parsed is an object key
+    char number[JSTREAM_NUMBER_MAX];
+#ifndef NOTE_C_LOW_MEM
+    uint32_t crc;                   // CRC32 of the document, less its tail
+    size_t documentLen;
+    uint8_t tail[JSTREAM_TAIL_LEN]; // The most recent bytes of the document
+    uint8_t tailLen;
+#endif
+    uint8_t buffer[NOTE_I2C_MTU_MAX];
+};
+
+NOTE_C_STATIC bool _jStreamAppend(NoteJStream *stream, const uint8_t *bytes, size_t length);
+NOTE_C_STATIC void _jStreamAbandon(NoteJStream *stream);
+NOTE_C_STATIC void _jStreamAttach(NoteJStream *stream, J *item);
+NOTE_C_STATIC void _jStreamBeginValue(NoteJStream *stream, uint8_t ch);
+NOTE_C_STATIC void _jStreamClose(NoteJStream *stream, bool object);
+NOTE_C_STATIC bool _jStreamConsume(NoteJStream *stream, uint8_t ch);
+NOTE_C_STATIC void _jStreamEndString(NoteJStream *stream);
+NOTE_C_STATIC void _jStreamEndUnicode(NoteJStream *stream);
+NOTE_C_STATIC void _jStreamFail(NoteJStream *stream);
+#ifndef NOTE_C_LOW_MEM
+NOTE_C_STATIC void _jStreamTrack(NoteJStream *stream, const uint8_t *data, size_t length);
+#endif
+
+/*!
+ @brief Allocate a streaming parser, ready for its first document.
+
+ @returns The parser, which must be freed with `_jStreamDelete`, or NULL if
+          there is insufficient memory.
+ */
+NoteJStream *_jStreamCreate(void)
+{
+    NoteJStream *stream = (NoteJStream *)_Malloc(sizeof(NoteJStream));
+    if (stream != NULL) {
+        memset(stream, 0, sizeof(NoteJStream));
+    }
+    return stream;
+}
+
+/*!
+ @brief Free a streaming parser, along with any document it holds.
+
+ @param stream The parser, or NULL.
+ */
+void _jStreamDelete(NoteJStream *stream)
+{
+    if (stream == NULL) {
+        return;
+    }
+    _jStreamAbandon(stream);
+    if (stream->text != NULL) {
+        _Free(stream->text);
+    }
+    _Free(stream);
+}
+
+/*!
+ @brief Discard any document held by a streaming parser, so that it is ready
+        for the next one.
+
+ @param stream The parser.
+ */
+void _jStreamReset(NoteJStream *stream)
+{
+    _jStreamAbandon(stream);
+    stream->textLen = 0;
+    stream->received = 0;
+    stream->highSurrogate = 0;
+    stream->depth = 0;
+    stream->state = JSTREAM_VALUE;
+#ifndef NOTE_C_LOW_MEM
+    stream->crc = 0;
+    stream->documentLen = 0;
+    stream->tailLen = 0;
+#endif
+}
+
+/*!
+ @brief Get the buffer into which a transport may receive each chunk before
+        feeding it to the parser.
+
+ @param stream The parser.
+ @param size Set to the size of the buffer, which is at least the largest
+        I2C transfer.
+
+ @returns The buffer.
+ */
+uint8_t *_jStreamBuffer(NoteJStream *stream, uint32_t *size)
+{
+    *size = sizeof(stream->buffer);
+    return stream->buffer;
+}
+
+/*!
+ @brief Feed the next chunk of a document to a streaming parser.
+
+ Anything that follows the end of the document, such as the newline that
+ terminates a response, is ignored, as is everything once the document has
+ been found to be invalid, so the whole response may always be fed.
+
+ @param stream The parser.
+ @param data The chunk.
+ @param length The length of the chunk.
+ */
+void _jStreamFeed(NoteJStream *stream, const uint8_t *data, size_t length)
+{
+    stream->received += length;
+
+    size_t consumed = 0;
+    while (consumed < length && stream->state < JSTREAM_DONE) {
+
+        // Copy a run of plain characters within a string all at once
+        if (stream->state == JSTREAM_STRING) {
+            size_t run = consumed;
+            while (run < length && data[run] != '"' && data[run] != '\\') {
+                run++;
+            }
+            if (run > consumed) {
+                if (!_jStreamAppend(stream, &data[consumed], (run - consumed))) {
+                    _jStreamFail(stream);
+                }
+                consumed = run;
+                continue;
+            }
+        }
+
+        // A character that ends a number is consumed again in the next state
+        if (_jStreamConsume(stream, data[consumed])) {
+            consumed++;
+        }
+    }
+
+#ifndef NOTE_C_LOW_MEM
+    _jStreamTrack(stream, data, consumed);
+#endif
+}
+
+/*!
+ @brief Get the number of bytes fed to a streaming parser since it was reset.
+
+ @param stream The parser.
+
+ @returns The number of bytes.
+ */
+size_t _jStreamReceived(const NoteJStream *stream)
+{
+    return stream->received;
+}
+
+/*!
+ @brief Take the document from a streaming parser.
+
+ @param stream The parser.
+
+ @returns The document, which the caller must free with `JDelete`, or NULL if
+          it is incomplete or invalid.
+ */
+J *_jStreamFinish(NoteJStream *stream)
+{
+    if (stream->state != JSTREAM_DONE) {
+        _jStreamAbandon(stream);
+        return NULL;
+    }
+    J *root = stream->root;
+    stream->root = NULL;
+    return root;
+}
+
+#ifndef NOTE_C_LOW_MEM
+/*!
+ @brief Get the CRC field that ends a document, along with the CRC32 of the
+        document it protects.
+
+ The CRC covers the document as it would be without its CRC field, which is
+ always the last member of the object, exactly as checked by `_crcError`.
+
+ @param stream The parser, which must have been fed a complete document.
+ @param seqno Set to the sequence number from the CRC field.
+ @param crc Set to the CRC32 from the CRC field.
+ @param expectedCrc Set to the CRC32 of the document.
+
+ @returns `true` if the document ends with a CRC field, `false` otherwise.
+ */
+bool _jStreamCrc(NoteJStream *stream, uint16_t *seqno, uint32_t *crc, uint32_t *expectedCrc)
+{
+    if (stream->state != JSTREAM_DONE || stream->documentLen < (CRC_FIELD_LENGTH + 2)) {
+        return false;
+    }
+    if (stream->tail[JSTREAM_TAIL_LEN - 1] != '}') {
+        return false;
+    }
+    if (memcmp(&stream->tail[CRC_FIELD_NAME_OFFSET], CRC_FIELD_NAME_TEST, (sizeof(CRC_FIELD_NAME_TEST) - 1)) != 0) {
+        return false;
+    }
+
+    char *p = (char *)&stream->tail[CRC_FIELD_NAME_OFFSET + (sizeof(CRC_FIELD_NAME_TEST) - 1)];
+    *seqno = (uint16_t) _n_atoh(p, 4);
+    *crc = (uint32_t) _n_atoh(p+5, 8);
+    *expectedCrc = _crc32Update(stream->crc, "}", 1);
+    return true;
+}
+
+/*!
+ @brief Add the bytes of the document to its CRC32, holding back the most
+        recent bytes, which may yet turn out to be its CRC field.
+
+ @param stream The parser.
+ @param data The bytes of the document.
+ @param length The number of bytes.
+ */
+NOTE_C_STATIC void _jStreamTrack(NoteJStream *stream, const uint8_t *data, size_t length)
+{
+    stream->documentLen += length;
+
+    if (length >= JSTREAM_TAIL_LEN) {
+        stream->crc = _crc32Update(stream->crc, stream->tail, stream->tailLen);
+        stream->crc = _crc32Update(stream->crc, data, (length - JSTREAM_TAIL_LEN));
+        memcpy(stream->tail, &data[length - JSTREAM_TAIL_LEN], JSTREAM_TAIL_LEN);
+        stream->tailLen = JSTREAM_TAIL_LEN;
+        return;
+    }
+
+    const size_t held = (stream->tailLen + length);
+    if (held > JSTREAM_TAIL_LEN) {
+        const size_t evicted = (held - JSTREAM_TAIL_LEN);
+        stream->crc = _crc32Update(stream->crc, stream->tail, evicted);
+        memmove(stream->tail, &stream->tail[evicted], (stream->tailLen - evicted));
+        stream->tailLen -= evicted;
+    }
+    memcpy(&stream->tail[stream->tailLen], data, length);
+    stream->tailLen += length;
+}
+#endif // !NOTE_C_LOW_MEM
+
+/*!
+ @brief Advance the parser by a single character.
+
+ @param stream The parser.
+ @param ch The character.
+
+ @returns `true` if the character was consumed, or `false` if it ended a
+          number and must be consumed again.
+ */
+NOTE_C_STATIC bool _jStreamConsume(NoteJStream *stream, uint8_t ch)
+{
+    switch (stream->state) {
+    case JSTREAM_VALUE:
+    case JSTREAM_ARRAY_FIRST:
+        if (ch <= ' ') {
+            break;
+        }
+        if (ch == ']' && stream->state == JSTREAM_ARRAY_FIRST) {
+            _jStreamClose(stream, false);
+            break;
+        }
+        _jStreamBeginValue(stream, ch);
+        break;
+    case JSTREAM_OBJECT_FIRST:
+    case JSTREAM_KEY:
+        if (ch <= ' ') {
+            break;
+        }
+        if (ch == '}' && stream->state == JSTREAM_OBJECT_FIRST) {
+            _jStreamClose(stream, true);
+        } else if (ch == '"') {
+            stream->inKey = true;
+            stream->textLen = 0;
+            stream->state = JSTREAM_STRING;
+        } else {
+            _jStreamFail(stream);
+        }
+        break;
+    case JSTREAM_COLON:
+        if (ch <= ' ') {
+            break;
+        }
+        if (ch == ':') {
+            stream->state = JSTREAM_VALUE;
+        } else {
+            _jStreamFail(stream);
+        }
+        break;
+    case JSTREAM_AFTER_VALUE:
+        if (ch <= ' ') {
+            break;
+        }
+        if (ch == ',') {
+            stream->state = (JIsObject(stream->container) ? JSTREAM_KEY : JSTREAM_VALUE);
+        } else if (ch == ']' || ch == '}') {
+            _jStreamClose(stream, (ch == '}'));
+        } else {
+            _jStreamFail(stream);
+        }
+        break;
+    case JSTREAM_STRING:
+        if (ch == '"') {
+            _jStreamEndString(stream);
+        } else if (ch == '\\') {
+            stream->state = JSTREAM_ESCAPE;
+        } else if (!_jStreamAppend(stream, &ch, 1)) {
+            _jStreamFail(stream);
+        }
+        break;
+    case JSTREAM_ESCAPE:
+        switch (ch) {
+        case 'b':
+            ch = '\b';
+            break;
+        case 'f':
+            ch = '\f';
+            break;
+        case 'n':
+            ch = '\n';
+            break;
+        case 'r':
+            ch = '\r';
+            break;
+        case 't':
+            ch = '\t';
+            break;
+        case '"':
+        case '\\':
+        case '/':
+            break;
+        case 'u':
+            stream->unicode = 0;
+            stream->count = 0;
+            stream->state = JSTREAM_UNICODE;
+            return true;
+        default:
+            _jStreamFail(stream);
+            return true;
+        }
+        if (_jStreamAppend(stream, &ch, 1)) {
+            stream->state = JSTREAM_STRING;
+        } else {
+            _jStreamFail(stream);
+        }
+        break;
+    case JSTREAM_UNICODE:
+        if (ch >= '0' && ch <= '9') {
+            stream->unicode = ((stream->unicode << 4) | (uint32_t)(ch - '0'));
+        } else if (ch >= 'a' && ch <= 'f') {
+            stream->unicode = ((stream->unicode << 4) | (uint32_t)(10 + (ch - 'a')));
+        } else if (ch >= 'A' && ch <= 'F') {
+            stream->unicode = ((stream->unicode << 4) | (uint32_t)(10 + (ch - 'A')));
+        } else {
+            _jStreamFail(stream);
+            break;
+        }
+        if (++stream->count == 4) {
+            _jStreamEndUnicode(stream);
+        }
+        break;
+    case JSTREAM_SURROGATE:
+        // The backslash and 'u' that introduce the low surrogate
+        if (ch != (stream->count ? 'u' : '\\')) {
+            _jStreamFail(stream);
+        } else if (++stream->count == 2) {
+            stream->unicode = 0;
+            stream->count = 0;
+            stream->state = JSTREAM_UNICODE;
+        }
+        break;
+    case JSTREAM_NUMBER:
+        if ((ch >= '0' && ch <= '9') || ch == '+' || ch == '-' || ch == 'e' || ch == 'E' || ch == '.') {
+            if (stream->count >= (JSTREAM_NUMBER_MAX - 1)) {
+                _jStreamFail(stream);
+            } else {
+                stream->number[stream->count++] = (char)ch;
+            }
+            break;
+        }
+        _jStreamAttach(stream, _jCreateNumberText(stream->number, stream->count));
+        return false;
+    case JSTREAM_LITERAL:
+        if (ch != (uint8_t)stream->literal[stream->count]) {
+            _jStreamFail(stream);
+        } else if (stream->literal[++stream->count] == '\0') {
+            if (stream->literal == c_true) {
+                _jStreamAttach(stream, JCreateTrue());
+            } else if (stream->literal == c_false) {
+                _jStreamAttach(stream, JCreateFalse());
+            } else {
+                _jStreamAttach(stream, _jCreateNull());
+            }
+        }
+        break;
+    default:
+        break;
+    }
+
+    return true;
+}
+
+/*!
+ @brief Begin the value introduced by the passed in character.
+
+ @param stream The parser.
+ @param ch The first character of the value.
+ */
+NOTE_C_STATIC void _jStreamBeginValue(NoteJStream *stream, uint8_t ch)
+{
+    switch (ch) {
+    case '{':
+        _jStreamAttach(stream, JCreateObject());
+        break;
+    case '[':
+        _jStreamAttach(stream, JCreateArray());
+        break;
+    case '"':
+        stream->inKey = false;
+        stream->textLen = 0;
+        stream->state = JSTREAM_STRING;
+        break;
+    case 't':
+    case 'f':
+    case 'n':
+        stream->literal = ((ch == 't') ? c_true : ((ch == 'f') ? c_false : c_null));
+        stream->count = 1;
+        stream->state = JSTREAM_LITERAL;
+        break;
+    default:
+        if (ch == '-' || (ch >= '0' && ch <= '9')) {
+            stream->number[0] = (char)ch;
+            stream->count = 1;
+            stream->state = JSTREAM_NUMBER;
+        } else {
+            _jStreamFail(stream);
+        }
+        break;
+    }
+}
+
+/*!
+ @brief Add a completed value to the document, and descend into it if it is
+        an array or an object.
+
+ While a container is open, its first child's `prev` points to its last
+ child, so that each value is appended without walking the list, and its
+ otherwise unused `valuestring` points to its parent, so that no stack is
+ needed. Both are restored as the container is closed.
+
+ @param stream The parser.
+ @param item The value, or NULL if it could not be allocated.
+ */
+NOTE_C_STATIC void _jStreamAttach(NoteJStream *stream, J *item)
+{
+    if (item == NULL) {
+        _jStreamFail(stream);
+        return;
+    }
+
+    J *container = stream->container;
+    if (container == NULL) {
+        stream->root = item;
+    } else {
+        if (container->child == NULL) {
+            container->child = item;
+        } else {
+            J *last = container->child->prev;
+            last->next = item;
+            item->prev = last;
+        }
+        container->child->prev = item;
+        if (JIsObject(container)) {
+            item->string = stream->key;
+            stream->key = NULL;
+        }
+    }
+
+    if (JIsObject(item) || JIsArray(item)) {
+        if (stream->depth >= N_CJSON_NESTING_LIMIT) {
+            _jStreamFail(stream);
+            return;
+        }
+        stream->depth++;
+        item->valuestring = (char *)(void *)container;
+        stream->container = item;
+        stream->state = (JIsObject(item) ? JSTREAM_OBJECT_FIRST : JSTREAM_ARRAY_FIRST);
+    } else {
+        stream->state = ((container != NULL) ? JSTREAM_AFTER_VALUE : JSTREAM_DONE);
+    }
+}
+
+/*!
+ @brief Close the innermost container.
+
+ @param stream The parser.
+ @param object `true` if the closing character ends an object, `false` if it
+        ends an array.
+ */
+NOTE_C_STATIC void _jStreamClose(NoteJStream *stream, bool object)
+{
+    J *container = stream->container;
+    if (object ? !JIsObject(container) : !JIsArray(container)) {
+        _jStreamFail(stream);
+        return;
+    }
+
+    if (container->child != NULL) {
+        container->child->prev = NULL;
+    }
+    J *parent = (J *)(void *)container->valuestring;
+    container->valuestring = NULL;
+    stream->container = parent;
+    stream->depth--;
+    stream->state = ((parent != NULL) ? JSTREAM_AFTER_VALUE : JSTREAM_DONE);
+}
+
+/*!
+ @brief Complete the string being parsed, as either a key or a value.
+
+ A string that outgrew the first chunk of the scratch buffer takes the buffer
+ over, while a shorter one is copied out of it, so that no string wastes more
+ than a chunk.
+
+ @param stream The parser.
+ */
+NOTE_C_STATIC void _jStreamEndString(NoteJStream *stream)
+{
+    char *string;
+    if (stream->textAlloc > ALLOC_CHUNK) {
+        string = stream->text;
+        stream->text = NULL;
+        stream->textAlloc = 0;
+    } else {
+        string = (char *)_Malloc(stream->textLen + 1);
+        if (string == NULL) {
+            _jStreamFail(stream);
+            return;
+        }
+        if (stream->textLen) {
+            memcpy(string, stream->text, stream->textLen);
+        }
+    }
+    string[stream->textLen] = '\0';
+
+    if (stream->inKey) {
+        stream->key = string;
+        stream->state = JSTREAM_COLON;
+        return;
+    }
+
+    J *item = JCreateStringValue(string);
+    if (item == NULL) {
+        _Free(string);
+    }
+    _jStreamAttach(stream, item);
+}
+
+/*!
+ @brief Complete a \u escape, combining a surrogate pair into a single code
+        point, and append it to the string as UTF-8.
+
+ @param stream The parser.
+ */
+NOTE_C_STATIC void _jStreamEndUnicode(NoteJStream *stream)
+{
+    uint32_t codepoint = stream->unicode;
+    if (stream->highSurrogate) {
+        if (codepoint < 0xDC00 || codepoint > 0xDFFF) {
+            _jStreamFail(stream);
+            return;
+        }
+        codepoint = (0x10000 + (((stream->highSurrogate & 0x3FF) << 10) | (codepoint & 0x3FF)));
+        stream->highSurrogate = 0;
+    } else if (codepoint >= 0xDC00 && codepoint <= 0xDFFF) {
+        _jStreamFail(stream);
+        return;
+    } else if (codepoint >= 0xD800 && codepoint <= 0xDBFF) {
+        stream->highSurrogate = codepoint;
+        stream->count = 0;
+        stream->state = JSTREAM_SURROGATE;
+        return;
+    }
+
+    uint8_t utf8[4];
+    size_t utf8Len;
+    if (codepoint < 0x80) {
+        utf8[0] = (uint8_t)codepoint;
+        utf8Len = 1;
+    } else if (codepoint < 0x800) {
+        utf8[0] = (uint8_t)(0xC0 | (codepoint >> 6));
+        utf8[1] = (uint8_t)(0x80 | (codepoint & 0x3F));
+        utf8Len = 2;
+    } else if (codepoint < 0x10000) {
+        utf8[0] = (uint8_t)(0xE0 | (codepoint >> 12));
+        utf8[1] = (uint8_t)(0x80 | ((codepoint >> 6) & 0x3F));
+        utf8[2] = (uint8_t)(0x80 | (codepoint & 0x3F));
+        utf8Len = 3;
+    } else {
+        utf8[0] = (uint8_t)(0xF0 | (codepoint >> 18));
+        utf8[1] = (uint8_t)(0x80 | ((codepoint >> 12) & 0x3F));
+        utf8[2] = (uint8_t)(0x80 | ((codepoint >> 6) & 0x3F));
+        utf8[3] = (uint8_t)(0x80 | (codepoint & 0x3F));
+        utf8Len = 4;
+    }
+
+    if (_jStreamAppend(stream, utf8, utf8Len)) {
+        stream->state = JSTREAM_STRING;
+    } else {
+        _jStreamFail(stream);
+    }
+}
+
+/*!
+ @brief Append to the string being parsed, growing the scratch buffer in
+        blocks of `ALLOC_CHUNK` to reduce heap fragmentation.
+
+ @param stream The parser.
+ @param bytes The bytes to append.
+ @param length The number of bytes.
+
+ @returns `true` if the bytes were appended, or `false` if there is
+          insufficient memory.
+ */
+NOTE_C_STATIC bool _jStreamAppend(NoteJStream *stream, const uint8_t *bytes, size_t length)
+{
+    // Always leave room for the terminator
+    const size_t needed = (stream->textLen + length + 1);
+    if (needed > stream->textAlloc) {
+        const size_t textAlloc = (ALLOC_CHUNK * ((needed / ALLOC_CHUNK) + ((needed % ALLOC_CHUNK) > 0)));
+        char *text = (char *)_Malloc(textAlloc);
+        if (text == NULL) {
+            return false;
+        }
+        if (stream->text != NULL) {
+            memcpy(text, stream->text, stream->textLen);
+            _Free(stream->text);
+        }
+        stream->text = text;
+        stream->textAlloc = textAlloc;
+    }
+    memcpy(&stream->text[stream->textLen], bytes, length);
+    stream->textLen += length;
+    return true;
+}
+
+/*!
+ @brief Free the partial document, if any, held by the parser.
+
+ @param stream The parser.
+ */
+NOTE_C_STATIC void _jStreamAbandon(NoteJStream *stream)
+{
+    // Restore the links borrowed by the open containers, so that the partial
+    // document may be deleted like any other
+    for (J *container = stream->container; container != NULL; ) {
+        J *parent = (J *)(void *)container->valuestring;
+        container->valuestring = NULL;
+        if (container->child != NULL) {
+            container->child->prev = NULL;
+        }
+        container = parent;
+    }
+    stream->container = NULL;
+
+    if (stream->root != NULL) {
+        JDelete(stream->root);
+        stream->root = NULL;
+    }
+    if (stream->key != NULL) {
+        _Free(stream->key);
+        stream->key = NULL;
+    }
+}
+
+/*!
+ @brief Give up on an invalid document, or one for which there is
+        insufficient memory.
+
+ @param stream The parser.
+ */
+NOTE_C_STATIC void _jStreamFail(NoteJStream *stream)
+{
+    _jStreamAbandon(stream);
+    stream->state = JSTREAM_FAILED;
+}
@@ -35,6 +35,19 @@ extern "C" {
 #define NOTE_C_STATIC static
 #endif
 
+//**************************************************************************/
+/*!
+  @brief  `NOTE_C_THREAD_CONTEXT` keeps the state of the Notecard being
+  driven (see `NoteContext`) per thread, so that each thread may drive its
+  own Notecard in parallel.
+*/
+/**************************************************************************/
+#ifdef NOTE_C_THREAD_CONTEXT
+#define NOTE_C_THREAD_LOCAL _Thread_local
+#else
+#define NOTE_C_THREAD_LOCAL
+#endif
+
 /**************************************************************************/
 /*!
     @brief  How long to wait for the card for any given transaction.
@@ -73,6 +86,55 @@ extern uint32_t cardTransactionTimeoutOverrideSecs;
 /**************************************************************************/
 #define CARD_REQUEST_I2C_NACK_WAIT_MS 1000
 /**************************************************************************/
+/*!
+    @brief  The delay, in miliseconds, before each I/O when using I2C.
+*/
+/**************************************************************************/
+#define CARD_REQUEST_I2C_IO_DELAY_MS 6
+/**************************************************************************/
+/*!
+    @brief  The number of consecutive clean transactions required before
+            adaptive I2C pacing steps down to the next faster level.
+*/
+/**************************************************************************/
+#define CARD_I2C_PACING_SUCCESS_STREAK 8
+/**************************************************************************/
+/*!
+    @brief  The number of consecutive clean transactions required before
+            adaptive I2C pacing lowers its floor, to retry a faster level.
+*/
+/**************************************************************************/
+#define CARD_I2C_PACING_FLOOR_DECAY_STREAK 64
+/**************************************************************************/
+/*!
+    @brief  The interval, in miliseconds, between I2C queries while awaiting
+            a response from the Notecard.
+*/
+/**************************************************************************/
+#define CARD_REQUEST_I2C_POLL_MS 50
+/**************************************************************************/
+/*!
+    @brief  The interval, in miliseconds, between Serial checks while
+            awaiting a response from the Notecard.
+*/
+/**************************************************************************/
+#define CARD_REQUEST_SERIAL_POLL_MS 10
+/**************************************************************************/
+/*!
+    @brief  The longest, in miliseconds, to wait on the response notification
+            hook before querying the Notecard anyway, in case a notification
+            was missed.
+*/
+/**************************************************************************/
+#define CARD_RESPONSE_WAIT_MAX_MS 1000
+/**************************************************************************/
+/*!
+    @brief  The interval, in miliseconds, between queries for a response
+            while an asynchronous transaction is being polled.
+*/
+/**************************************************************************/
+#define CARD_REQUEST_ASYNC_POLL_MS 10
+/**************************************************************************/
 /*!
     @brief  The max length, in bytes, of each request segment when using Serial.
 */
@@ -85,6 +147,20 @@ extern uint32_t cardTransactionTimeoutOverrideSecs;
 /**************************************************************************/
 #define CARD_REQUEST_SERIAL_SEGMENT_DELAY_MS 250
 /**************************************************************************/
+/*!
+    @brief  The longest, in miliseconds, to wait for the Notecard to become
+            clear to send when Serial flow control is in use.
+*/
+/**************************************************************************/
+#define CARD_REQUEST_SERIAL_FLOW_TIMEOUT_MS 1000
+/**************************************************************************/
+/*!
+    @brief  The number of bytes sent between each check of the Notecard's
+            clear to send signal, when Serial flow control is in use.
+*/
+/**************************************************************************/
+#define CARD_REQUEST_SERIAL_FLOW_CHUNK_LEN 16
+/**************************************************************************/
 /*!
     @brief  The time, in miliseconds, to drain incoming messages.
 */
@@ -92,10 +168,11 @@ extern uint32_t cardTransactionTimeoutOverrideSecs;
 #define CARD_RESET_DRAIN_MS 500
 /**************************************************************************/
 /*!
-    @brief  The number of times we will retry a request before giving up.
+    @brief  The time, in miliseconds, the link must remain quiet after a clean
+            echo before a fast Serial resync ends the drain early.
 */
 /**************************************************************************/
-#define CARD_REQUEST_RETRIES_ALLOWED 5
+#define CARD_RESET_FAST_QUIET_MS 10
 /**************************************************************************/
 /*!
     @brief  The number of times we will retry getting in sync before giving up.
@@ -121,34 +198,81 @@ extern uint32_t cardTransactionTimeoutOverrideSecs;
 void _noteResumeTransactionDebug(void);
 void _noteSuspendTransactionDebug(void);
 J *_noteTransactionShouldLock(J *req, bool lockNotecard);
-const char *_i2cNoteTransaction(const char *request, size_t reqLen, char **response, uint32_t timeoutMs);
+char *_noteRequestResponseFields(J *req, JField *fields, size_t count);
+char *_noteTransactionText(char *json, size_t jsonLen, uint32_t id, uint32_t timeoutMs, bool cmd, size_t *textLen);
+uint8_t *_rxBufferAlloc(size_t *size);
+const char *_rxBufferGrow(uint8_t **buffer, size_t used, size_t *size, size_t needed);
+void _rxBufferFree(void *buffer);
+void *_rxBufferDetach(void *buffer);
+void _rxBufferProvide(uint8_t *buffer, size_t size);
+J *_noteCacheTransaction(J *req);
+void _noteCacheWrite(const char *json, size_t jsonLen);
+uint32_t _noteTransaction_calculateTimeoutMs(J *req, bool isReq);
+const char *_i2cNoteTransaction(const char *request, size_t reqLen, char **response, size_t *responseLen, uint32_t timeoutMs);
+const char *_i2cNoteResponseQuery(uint32_t *available);
+const char *_i2cNoteResponseReceive(uint32_t available, char **response, size_t *responseLen);
 bool _i2cNoteReset(void);
-const char *_serialNoteTransaction(const char *request, size_t reqLen, char **response, uint32_t timeoutMs);
+const char *_serialNoteTransaction(const char *request, size_t reqLen, char **response, size_t *responseLen, uint32_t timeoutMs);
+const char *_serialNoteResponseQuery(uint32_t *available);
+const char *_serialNoteResponseReceive(uint32_t available, char **response, size_t *responseLen);
 bool _serialNoteReset(void);
 const char *_i2cChunkedReceive(uint8_t *buffer, uint32_t *size, bool delay, uint32_t timeoutMs, uint32_t *available);
 const char *_i2cChunkedTransmit(const uint8_t *buffer, uint32_t size, bool delay);
 const char *_i2cNoteChunkedReceive(uint8_t *buffer, uint32_t *size, bool delay, uint32_t timeoutMs, uint32_t *available);
 const char *_i2cNoteChunkedTransmit(const uint8_t *buffer, uint32_t size, bool delay);
+void _i2cPacingFeedback(bool success);
 const char *_serialChunkedReceive(uint8_t *buffer, uint32_t *size, bool delay, uint32_t timeoutMs, uint32_t *available);
 const char *_serialChunkedTransmit(const uint8_t *buffer, uint32_t size, bool delay);
+void _noteRequestContextSave(NoteContext *ctx);
+void _noteRequestContextRestore(const NoteContext *ctx);
+void _noteI2cContextSave(NoteContext *ctx);
+void _noteI2cContextRestore(const NoteContext *ctx);
+void _noteSerialContextSave(NoteContext *ctx);
+void _noteSerialContextRestore(const NoteContext *ctx);
+void _noteCacheContextSave(NoteContext *ctx);
+void _noteCacheContextRestore(const NoteContext *ctx);
+void _noteCacheContextFree(NoteContext *ctx);
+void _noteHelpersContextSave(NoteContext *ctx);
+void _noteHelpersContextRestore(const NoteContext *ctx);
+
+// Metrics, which compile away unless NOTE_C_METRICS is defined. A phase is
+// timed from the point at which NOTE_C_METRICS_START declares its start time.
+#ifdef NOTE_C_METRICS
+extern NOTE_C_THREAD_LOCAL NoteMetrics noteMetrics;
+void _noteMetricsPhase(uint8_t phase, uint32_t startMs);
+#define NOTE_C_METRICS_START(startMs) const uint32_t startMs = _GetMs()
+#define NOTE_C_METRICS_PHASE(phase, startMs) _noteMetricsPhase((phase), (startMs))
+#define NOTE_C_METRICS_COUNT(counter, n) (noteMetrics.counter += (uint32_t)(n))
+#else
+#define NOTE_C_METRICS_START(startMs)
+#define NOTE_C_METRICS_PHASE(phase, startMs)
+#define NOTE_C_METRICS_COUNT(counter, n)
+#endif
 
 // Hooks
 void _noteLockNote(void);
 void _noteUnlockNote(void);
 bool _noteTransactionStart(uint32_t timeoutMs);
 void _noteTransactionStop(void);
+bool _noteResponseWait(uint32_t timeoutMs);
+bool _noteCRC32(const void *data, size_t length, uint32_t *crc);
+void *_noteRealloc(void *ptr, size_t size, size_t used);
 const char *_noteActiveInterface(void);
 bool _noteSerialReset(void);
 void _noteSerialTransmit(const uint8_t *, size_t, bool);
 bool _noteSerialAvailable(void);
 char _noteSerialReceive(void);
+bool _noteSerialReceiveBulk(uint8_t *buffer, size_t size, char eop, size_t *received);
+bool _noteSerialClearToSend(bool *clear);
 bool _noteI2CReset(uint16_t DevAddress);
 const char *_noteI2CTransmit(uint16_t DevAddress, const uint8_t* pBuffer, uint16_t Size);
 const char *_noteI2CReceive(uint16_t DevAddress, uint8_t* pBuffer, uint16_t Size, uint32_t *avail);
 bool _noteHardReset(void);
-const char *_noteJSONTransaction(const char *request, size_t reqLen, char **response, uint32_t timeoutMs);
+const char *_noteJSONTransaction(const char *request, size_t reqLen, char **response, size_t *responseLen, uint32_t timeoutMs);
 const char *_noteChunkedReceive(uint8_t *buffer, uint32_t *size, bool delay, uint32_t timeoutMs, uint32_t *available);
 const char *_noteChunkedTransmit(const uint8_t *buffer, uint32_t size, bool delay);
+const char *_noteResponseQuery(uint32_t *available);
+const char *_noteResponseReceive(uint32_t available, char **response, size_t *responseLen);
 bool _noteIsDebugOutputActive(void);
 #ifdef NOTE_C_HEARTBEAT_CALLBACK
 bool _noteHeartbeat(const char *heartbeatJson);
@@ -158,6 +282,38 @@ bool _noteHeartbeat(const char *heartbeatJson);
 void _n_htoa32(uint32_t n, char *p);
 void _n_htoa16(uint16_t n, unsigned char *p);
 uint64_t _n_atoh(char *p, int maxLen);
+char *_jPrintUnformattedReserve(const J *item, size_t reserve, size_t *length);
+J *_jCreateNull(void);
+J *_jCreateNumberText(const char *text, size_t length);
+size_t _jParseNumberText(const char *text, size_t length, JNUMBER *number, JINTEGER *integer);
+size_t _jPrintValueText(const J *item, char *buf, size_t buflen);
+
+// CRC32
+#define CRC_FIELD_LENGTH        22  // ,"crc":"SSSS:CCCCCCCC"
+#define CRC_FIELD_NAME_OFFSET   1
+#define CRC_FIELD_NAME_TEST     "\"crc\":\""
+uint32_t _crc32(const void *data, size_t length);
+uint32_t _crc32Update(uint32_t crc, const void *data, size_t length);
+uint32_t _crc32Nibble(const void *data, size_t length);
+#if defined(NOTE_C_CRC32_SLICE_BY_4) || defined(NOTE_C_CRC32_SLICE_BY_8)
+uint32_t _crc32SliceBy4(const void *data, size_t length);
+#endif
+#if defined(NOTE_C_CRC32_SLICE_BY_8)
+uint32_t _crc32SliceBy8(const void *data, size_t length);
+#endif
+
+// Streaming response parser
+typedef struct NoteJStream NoteJStream;
+extern NOTE_C_THREAD_LOCAL NoteJStream *cardResponseStream;
+extern NOTE_C_THREAD_LOCAL bool cardRequestTransmitted;
+NoteJStream *_jStreamCreate(void);
+void _jStreamDelete(NoteJStream *stream);
+void _jStreamReset(NoteJStream *stream);
+uint8_t *_jStreamBuffer(NoteJStream *stream, uint32_t *size);
+void _jStreamFeed(NoteJStream *stream, const uint8_t *data, size_t length);
+size_t _jStreamReceived(const NoteJStream *stream);
+J *_jStreamFinish(NoteJStream *stream);
+bool _jStreamCrc(NoteJStream *stream, uint16_t *seqno, uint32_t *crc, uint32_t *expectedCrc);
 
 // COBS Helpers
 uint32_t _cobsDecode(uint8_t *ptr, uint32_t length, uint8_t eop, uint8_t *dst);
@@ -167,7 +323,7 @@ uint32_t _cobsEncodedMaxLength(uint32_t length);
 uint32_t _cobsGuaranteedFit(uint32_t bufLen);
 
 // Turbo I/O mode
-extern bool cardTurboIO;
+extern NOTE_C_THREAD_LOCAL bool cardTurboIO;
 
 // Constants, a global optimization to save static string memory
 extern const char *c_bad;
@@ -209,6 +365,9 @@ extern const char *c_null;
 extern const char *c_nullstring;
 #define c_nullstring_len 0
 
+extern const char *c_overflow;
+#define c_overflow_len 10
+
 extern const char *c_req;
 #define c_req_len 3
 
@@ -227,10 +386,13 @@ extern const char *c_unsupported;
 #define _UnlockNote _noteUnlockNote
 #define _TransactionStart _noteTransactionStart
 #define _TransactionStop _noteTransactionStop
+#define _ResponseWait _noteResponseWait
 #define _SerialReset _noteSerialReset
 #define _SerialTransmit _noteSerialTransmit
 #define _SerialAvailable _noteSerialAvailable
 #define _SerialReceive _noteSerialReceive
+#define _SerialReceiveBulk _noteSerialReceiveBulk
+#define _SerialClearToSend _noteSerialClearToSend
 #define _I2CReset _noteI2CReset
 #define _I2CTransmit _noteI2CTransmit
 #define _I2CReceive _noteI2CReceive
@@ -238,6 +400,8 @@ extern const char *c_unsupported;
 #define _Transaction _noteJSONTransaction
 #define _ChunkedReceive _noteChunkedReceive
 #define _ChunkedTransmit _noteChunkedTransmit
+#define _ResponseQuery _noteResponseQuery
+#define _ResponseReceive _noteResponseReceive
 #define _Malloc NoteMalloc
 #define _Free NoteFree
 #define _GetMs NoteGetMs
@@ -0,0 +1,164 @@
+// Copyright 2026 Blues Inc.  All rights reserved.
+// Use of this source code is governed by licenses granted by the
+// copyright holder including that found in the LICENSE file.
+
+// A bounded queue of requests, filled by any number of producer tasks and
+// drained by a single worker task that owns the transport to the Notecard.
+
+#include "n_lib.h"
+
+/**************************************************************************/
+/*!
+  @brief  Take the lock protecting a request queue, if one was provided.
+  @param   queue The request queue.
+*/
+/**************************************************************************/
+NOTE_C_STATIC void _queueLock(const NoteRequestQueue *queue)
+{
+    if (queue->lockFn != NULL) {
+        queue->lockFn();
+    }
+}
+
+/**************************************************************************/
+/*!
+  @brief  Release the lock protecting a request queue, if one was provided.
+  @param   queue The request queue.
+*/
+/**************************************************************************/
+NOTE_C_STATIC void _queueUnlock(const NoteRequestQueue *queue)
+{
+    if (queue->unlockFn != NULL) {
+        queue->unlockFn();
+    }
+}
+
+bool NoteRequestQueueInit(NoteRequestQueue *queue, NoteRequestQueueEntry *entries,
+                          size_t capacity, mutexFn lockFn, mutexFn unlockFn)
+{
+    if (queue == NULL || entries == NULL || capacity == 0) {
+        return false;
+    }
+
+    queue->entries = entries;
+    queue->capacity = capacity;
+    queue->head = 0;
+    queue->count = 0;
+    queue->lockFn = lockFn;
+    queue->unlockFn = unlockFn;
+
+    return true;
+}
+
+bool NoteRequestQueuePush(NoteRequestQueue *queue, J *req,
+                          noteRequestCompleteFn completeFn, void *context)
+{
+    if (queue == NULL || req == NULL) {
+        return false;
+    }
+
+    _queueLock(queue);
+    const bool full = (queue->count >= queue->capacity);
+    if (!full) {
+        NoteRequestQueueEntry *entry = &queue->entries[(queue->head + queue->count) % queue->capacity];
+        entry->req = req;
+        entry->completeFn = completeFn;
+        entry->context = context;
+        queue->count++;
+    }
+    _queueUnlock(queue);
+
+    return !full;
+}
+
+size_t NoteRequestQueueProcess(NoteRequestQueue *queue, size_t maxRequests)
+{
+    size_t processed = 0;
+
+    if (queue == NULL) {
+        return 0;
+    }
+
+    while (maxRequests == 0 || processed < maxRequests) {
+
+        // Take the oldest request, holding the queue lock only long enough to
+        // unlink it, so producers are never blocked by the transaction itself
+        NoteRequestQueueEntry entry;
+        _queueLock(queue);
+        const bool empty = (queue->count == 0);
+        if (!empty) {
+            entry = queue->entries[queue->head];
+            queue->head = ((queue->head + 1) % queue->capacity);
+            queue->count--;
+        }
+        _queueUnlock(queue);
+        if (empty) {
+            break;
+        }
+
+        // Perform the transaction, which frees the request
+        J *rsp = NoteRequestResponse(entry.req);
+        if (entry.completeFn != NULL) {
+            entry.completeFn(rsp, entry.context);
+        } else {
+            JDelete(rsp);
+        }
+        processed++;
+    }
+
+    return processed;
+}
+
+size_t NoteRequestQueueCount(NoteRequestQueue *queue)
+{
+    if (queue == NULL) {
+        return 0;
+    }
+
+    _queueLock(queue);
+    const size_t count = queue->count;
+    _queueUnlock(queue);
+
+    return count;
+}
+
+size_t NoteRequestQueueClear(NoteRequestQueue *queue)
+{
+    size_t cleared = 0;
+
+    if (queue == NULL) {
+        return 0;
+    }
+
+    // Take how many requests are waiting up front, so that producers pushing
+    // during the callbacks can't keep the clear running indefinitely
+    _queueLock(queue);
+    size_t remaining = queue->count;
+    _queueUnlock(queue);
+
+    while (remaining-- > 0) {
+
+        // Unlink the oldest request under the lock, as the worker would
+        NoteRequestQueueEntry entry;
+        _queueLock(queue);
+        const bool empty = (queue->count == 0);
+        if (!empty) {
+            entry = queue->entries[queue->head];
+            queue->head = ((queue->head + 1) % queue->capacity);
+            queue->count--;
+        }
+        _queueUnlock(queue);
+        if (empty) {
+            break;
+        }
+
+        // Drop the request, telling its producer that it was never sent
+        JDelete(entry.req);
+        if (entry.completeFn != NULL) {
+            entry.completeFn(NULL, entry.context);
+        }
+        cleared++;
+    }
+
+    return cleared;
+}
@@ -14,31 +14,54 @@
 
 #include <string.h>
 
-static const int RETRY_DELAY_MS = 500;
-
 // A value that optionally overrides CARD_INTER_TRANSACTION_TIMEOUT_SEC
 uint32_t cardTransactionTimeoutOverrideSecs = 0;
 
 // For flow tracing
-static int suppressShowTransactions = 0;
+static NOTE_C_THREAD_LOCAL int suppressShowTransactions = 0;
 
 // Flag that gets set whenever an error occurs that should force a reset
-NOTE_C_STATIC bool resetRequired = true;
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL bool resetRequired = true;
+
+// Whether the Notecard lock is held or released during retry backoff
+NOTE_C_STATIC uint8_t retryLockPolicy = NOTE_RETRY_LOCK_HOLD;
+
+// How requests are retried, unless sent with a policy of their own
+NOTE_C_STATIC NoteRetryPolicy retryPolicy = NOTE_RETRY_POLICY_DEFAULT;
+
+// State of the generator that spreads out retry backoffs
+static NOTE_C_THREAD_LOCAL uint32_t retryJitterState = 0;
+
+// Whether responses are parsed as they are received
+NOTE_C_STATIC bool responseStreaming = false;
+
+// The parser that the I2C and Serial transports feed while a response is
+// being received, or NULL to have them buffer it
+NOTE_C_THREAD_LOCAL NoteJStream *cardResponseStream = NULL;
+
+// Set by the I2C and Serial transports once the whole of a request has been
+// transmitted to the Notecard
+NOTE_C_THREAD_LOCAL bool cardRequestTransmitted = false;
+
+#ifdef NOTE_C_METRICS
+// Transaction metrics, updated by the transports as well as the transaction
+NOTE_C_THREAD_LOCAL NoteMetrics noteMetrics;
+#endif
 
 // CRC data
 #ifndef NOTE_C_LOW_MEM
-static uint16_t seqNo = 0;
-#define CRC_FIELD_LENGTH        22  // ,"crc":"SSSS:CCCCCCCC"
-#define CRC_FIELD_NAME_OFFSET   1
-#define CRC_FIELD_NAME_TEST     "\"crc\":\""
+static NOTE_C_THREAD_LOCAL uint16_t seqNo = 0;
 #define ERR_FIELD_NAME_TEST     "\"err\":\""
-NOTE_C_STATIC int32_t _crc32(const void* data, size_t length);
-NOTE_C_STATIC char * _crcAdd(char *json, uint16_t seqno);
-NOTE_C_STATIC bool _crcError(char *json, uint16_t shouldBeSeqno);
+NOTE_C_STATIC bool _crcAdd(char *json, size_t jsonLen, uint16_t seqno);
+NOTE_C_STATIC bool _crcError(char *json, size_t *jsonLen, uint16_t shouldBeSeqno);
+NOTE_C_STATIC bool _crcStreamError(NoteJStream *stream, J *rsp, uint16_t shouldBeSeqno);
 
-NOTE_C_STATIC bool notecardFirmwareSupportsCrc = false;
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL bool notecardFirmwareSupportsCrc = false;
 #endif // !NOTE_C_LOW_MEM
 
+NOTE_C_STATIC uint32_t _noteRetryBackoffMs(const NoteRetryPolicy *policy, uint8_t retries);
+NOTE_C_STATIC J *_noteTransactionWithPolicy(J *req, const NoteRetryPolicy *policy, uint32_t startMs, uint32_t deadlineMs);
+
 /*!
  @internal
 
@@ -74,6 +97,51 @@ NOTE_C_STATIC J * _errDoc(uint32_t id, const char *errmsg)
     return rspdoc;
 }
 
+/*!
+ @internal
+
+ @brief Save the request sequencing state into a context.
+
+ @param ctx The context to save the state into.
+ */
+void _noteRequestContextSave(NoteContext *ctx)
+{
+    ctx->resetRequired = resetRequired;
+#ifndef NOTE_C_LOW_MEM
+    ctx->seqNo = seqNo;
+    ctx->crcSupported = notecardFirmwareSupportsCrc;
+#else
+    ctx->seqNo = 0;
+    ctx->crcSupported = false;
+#endif
+}
+
+/*!
+ @internal
+
+ @brief Restore the request sequencing state from a context.
+
+ @param ctx The context to restore the state from, or NULL for the state of a
+        Notecard that has not yet been reset.
+ */
+void _noteRequestContextRestore(const NoteContext *ctx)
+{
+    if (ctx == NULL) {
+        resetRequired = true;
+#ifndef NOTE_C_LOW_MEM
+        seqNo = 0;
+        notecardFirmwareSupportsCrc = false;
+#endif
+        return;
+    }
+
+    resetRequired = ctx->resetRequired;
+#ifndef NOTE_C_LOW_MEM
+    seqNo = ctx->seqNo;
+    notecardFirmwareSupportsCrc = ctx->crcSupported;
+#endif
+}
+
 /*!
  @brief Resume showing transaction details.
  */
@@ -114,7 +182,7 @@ void _noteSuspendTransactionDebug(void)
 
  @returns The timeout in milliseconds.
  */
-NOTE_C_STATIC uint32_t _noteTransaction_calculateTimeoutMs(J *req, bool isReq)
+uint32_t _noteTransaction_calculateTimeoutMs(J *req, bool isReq)
 {
     uint32_t result = ((CARD_INTER_TRANSACTION_TIMEOUT_SEC - 1) * 1000);
 
@@ -147,6 +215,30 @@ NOTE_C_STATIC uint32_t _noteTransaction_calculateTimeoutMs(J *req, bool isReq)
     return result;
 }
 
+/*!
+ @brief Calculate the transaction timeout, exactly as
+        `_noteTransaction_calculateTimeoutMs` does, from the fields of a
+        request that has been scanned rather than parsed.
+
+ @param api The "req" or "cmd" field of the request.
+ @param milliseconds The "milliseconds" field of the request.
+ @param seconds The "seconds" field of the request.
+
+ @returns The timeout in milliseconds.
+ */
+NOTE_C_STATIC uint32_t _noteTransactionScannedTimeoutMs(const JField *api, const JField *milliseconds, const JField *seconds)
+{
+    uint32_t result = ((CARD_INTER_TRANSACTION_TIMEOUT_SEC - 1) * 1000);
+    if (JFieldContains(api, "note.add") || JFieldContains(api, "web.")) {
+        if (milliseconds->type != JInvalid) {
+            result = (uint32_t)JFieldInt(milliseconds);
+        } else if (seconds->type != JInvalid) {
+            result = (uint32_t)(JFieldInt(seconds) * 1000);
+        }
+    }
+    return (result + 1000);
+}
+
 /*!
  @brief Suppress showing transaction details.
  */
@@ -224,8 +316,40 @@ J *NoteRequestResponse(J *req)
     if (req == NULL) {
         return NULL;
     }
-    // Execute the transaction
-    J *rsp = NoteTransaction(req);
+    // Execute the transaction, unless the response is cached
+    J *rsp = _noteCacheTransaction(req);
+    // Free the request and exit
+    JDelete(req);
+    return rsp;
+}
+
+bool NoteRequestWithPolicy(J *req, const NoteRetryPolicy *policy)
+{
+    J *rsp = NoteRequestResponseWithPolicy(req, policy);
+    // If there is no response return false
+    if (rsp == NULL) {
+        return false;
+    }
+
+    // Check for a transaction error, and exit
+    bool success = JIsNullString(rsp, c_err);
+    JDelete(rsp);
+
+    return success;
+}
+
+J *NoteRequestResponseWithPolicy(J *req, const NoteRetryPolicy *policy)
+{
+    // Exit if null request. This allows safe execution of the form
+    // NoteRequestResponse(NoteNewRequest("xxx"))
+    if (req == NULL) {
+        return NULL;
+    }
+
+    // The deadline runs from now, and spans every attempt
+    const uint32_t deadlineMs = ((policy != NULL) ? policy->deadlineMs : retryPolicy.deadlineMs);
+    J *rsp = _noteTransactionWithPolicy(req, policy, _GetMs(), deadlineMs);
+
     // Free the request and exit
     JDelete(req);
     return rsp;
@@ -245,9 +369,16 @@ J *NoteRequestResponseWithRetry(J *req, uint32_t timeoutSeconds)
     uint32_t startMs = _GetMs();
     uint32_t timeoutMs = timeoutSeconds * 1000;
 
+    // The time limit is also the deadline of the retries within each
+    // transaction, unless the retry policy sets an earlier one
+    uint32_t deadlineMs = retryPolicy.deadlineMs;
+    if (timeoutMs && (!deadlineMs || timeoutMs < deadlineMs)) {
+        deadlineMs = timeoutMs;
+    }
+
     while(true) {
         // Execute the transaction
-        rsp = NoteTransaction(req);
+        rsp = _noteTransactionWithPolicy(req, NULL, startMs, deadlineMs);
 
         // Loop if there is no response, or if there is an io error
         if ((rsp == NULL) || (JContainsString(rsp, c_err, c_ioerr) && !JContainsString(rsp, c_err, c_unsupported))) {
@@ -263,10 +394,14 @@ J *NoteRequestResponseWithRetry(J *req, uint32_t timeoutSeconds)
             break;
         }
 
-        // Exit loop on timeout
-        if (_GetMs() - startMs >= timeoutMs) {
+        // Exit loop on timeout, or when the deadline leaves no time to back
+        // off and try again
+        const uint32_t elapsedMs = (_GetMs() - startMs);
+        const uint32_t backoffMs = _noteRetryBackoffMs(&retryPolicy, 0);
+        if (elapsedMs >= timeoutMs || (deadlineMs && (elapsedMs + backoffMs) >= deadlineMs)) {
             break;
         }
+        _DelayMs(backoffMs);
     }
 
     // Free the request
@@ -346,8 +481,12 @@ char * NoteRequestResponseJSON(const char *reqJSON)
             JDelete(jsonObj);
         }
 
+        // Drop the cached responses that the request may make stale
+        _noteCacheWrite(reqJSON, reqLen);
+
         if (!isCmd) {
-            const char *errstr = _Transaction(reqJSON, reqLen, &rspJSON, transactionTimeoutMs);
+            const char *errstr = _Transaction(reqJSON, reqLen, &rspJSON, NULL, transactionTimeoutMs);
+            rspJSON = (char *)_rxBufferDetach(rspJSON);  // The caller frees it
             if (errstr != NULL) {
                 NOTE_C_LOG_ERROR(errstr);
 
@@ -384,7 +523,7 @@ char * NoteRequestResponseJSON(const char *reqJSON)
         } else {
             // If it's a command, the Notecard will not respond, so we pass
             // NULL for the response parameter.
-            const char *errstr = _Transaction(reqJSON, reqLen, NULL, transactionTimeoutMs);
+            const char *errstr = _Transaction(reqJSON, reqLen, NULL, NULL, transactionTimeoutMs);
             reqJSON = (endPtr + 1);  // Move to the next command in the pipeline
             if (errstr != NULL) {
                 NOTE_C_LOG_ERROR(errstr);
@@ -413,305 +552,787 @@ J *NoteTransaction(J *req)
     return _noteTransactionShouldLock(req, true);
 }
 
+// Steps of a transaction
+#define TXN_STATE_IDLE      0   // Not begun, or already finished
+#define TXN_STATE_SEND      1   // Transmit the request
+#define TXN_STATE_AWAIT     2   // Query for a response
+#define TXN_STATE_RECEIVE   3   // Receive the response
+#define TXN_STATE_PROCESS   4   // Check and parse the response
+#define TXN_STATE_BACKOFF   5   // Wait before retrying
+#define TXN_STATE_COMPLETE  6   // Exchange complete, epilogue pending
+#define TXN_STATE_DONE      7   // Failed before the exchange, result in `rsp`
+
 /**************************************************************************/
 /*!
-  @brief Same as `NoteTransaction`, but takes an additional parameter that
-  indicates if the Notecard should be locked.
-  @param   req
-  The `J` cJSON request object.
-  @param   lockNotecard
-  Set to `true` if the Notecard should be locked and `false` otherwise.
-  @returns a `J` cJSON object with the response, or NULL if there is
-  insufficient memory.
+  @brief Resume a transaction once its retry backoff has elapsed, retaking
+  the Notecard lock if it was released for the backoff.
+  @param   txn
+  The transaction state.
 */
 /**************************************************************************/
-J *_noteTransactionShouldLock(J *req, bool lockNotecard)
+NOTE_C_STATIC void _noteTransactionResume(NoteTransactionAsync *txn)
 {
-    // Validate in case of memory failure of the requestor
-    if (req == NULL) {
-        NOTE_C_LOG_ERROR(ERRSTR("NULL request", c_bad));
-        return NULL;
+    if (txn->yielded) {
+        _LockNote();
+        _rxBufferProvide((uint8_t *)txn->rxBuffer, txn->rxBufferSize);
+        txn->yielded = false;
     }
+    txn->retries++;
+    txn->state = TXN_STATE_SEND;
+}
 
-    // Serialize the JSON request
-    char *json = JPrintUnformatted(req); // `json` allocated, must be freed
-    if (json == NULL) {
-        NOTE_C_LOG_ERROR(ERRSTR("failed to serialize JSON request", c_mem));
-        return NULL;
+/**************************************************************************/
+/*!
+  @brief Determine how long a transaction backs off before its next attempt.
+  @param   policy
+  The retry policy of the transaction.
+  @param   retries
+  The retries the transaction has consumed so far.
+  @returns the backoff, in milliseconds, with its jitter applied.
+*/
+/**************************************************************************/
+NOTE_C_STATIC uint32_t _noteRetryBackoffMs(const NoteRetryPolicy *policy, uint8_t retries)
+{
+    // Grow the backoff after each retry, up to the longest allowed
+    const uint32_t factor = (policy->backoffFactor ? policy->backoffFactor : 1);
+    uint32_t backoffMs = policy->baseDelayMs;
+    for (uint8_t i = 0 ; i < retries && factor > 1 ; i++) {
+        if (policy->maxDelayMs && backoffMs >= policy->maxDelayMs) {
+            break;
+        }
+        backoffMs = ((backoffMs > (UINT32_MAX / factor)) ? UINT32_MAX : (backoffMs * factor));
+    }
+    if (policy->maxDelayMs && backoffMs > policy->maxDelayMs) {
+        backoffMs = policy->maxDelayMs;
     }
 
-    // Determine the request or command type
-    const char * const reqApi = JGetString(req, "req");
-    const bool reqFound = reqApi[0];  // test for non-empty string
-    const char * const cmdApi = JGetString(req, "cmd");
-    const bool cmdFound = cmdApi[0];  // test for non-empty string
+    // Cut a random share from the backoff, from a xorshift generator seeded
+    // from the clock on first use
+    if (policy->jitterPercent && backoffMs) {
+        if (retryJitterState == 0) {
+            retryJitterState = (_GetMs() ^ 0x9E3779B9);
+            retryJitterState |= 1;
+        }
+        retryJitterState ^= (retryJitterState << 13);
+        retryJitterState ^= (retryJitterState >> 17);
+        retryJitterState ^= (retryJitterState << 5);
+        const uint32_t percent = ((policy->jitterPercent > 100) ? 100 : policy->jitterPercent);
+        const uint32_t jitterMs = (uint32_t)(((uint64_t)backoffMs * percent) / 100);
+        backoffMs -= (uint32_t)(retryJitterState % ((uint64_t)jitterMs + 1));
+    }
 
-    // If neither `"req"` nor `"cmd"` are found, then we have an error
-    // condition. If both are present, then we have undefined behavior.
-    if (!reqFound && !cmdFound) {
-        _Free(json);
-        NOTE_C_LOG_ERROR(ERRSTR("neither req nor cmd found in API invocation (invalid JSON)", c_bad));
-        return NULL;
-    } else if (reqFound && cmdFound) {
-        _Free(json);
-        NOTE_C_LOG_ERROR(ERRSTR("both req and cmd present in API invocation (undefined behavior)", c_bad));
-        return NULL;
+    return backoffMs;
+}
+
+/**************************************************************************/
+/*!
+  @brief Schedule the next attempt of a transaction after a retryable error,
+  or complete it once its retry policy allows no further attempt.
+  @param   txn
+  The transaction state.
+*/
+/**************************************************************************/
+NOTE_C_STATIC void _noteTransactionRetry(NoteTransactionAsync *txn)
+{
+    // Give up once every attempt has been made, or rather than back off when
+    // there would be no time left for another attempt
+    txn->backoffMs = _noteRetryBackoffMs(txn->policy, txn->retries);
+    const bool exhausted = (((uint32_t)txn->retries + 1) >= txn->policy->attempts);
+    if (exhausted || (txn->deadlineMs && ((_GetMs() - txn->startMs) + txn->backoffMs) >= txn->deadlineMs)) {
+        txn->state = TXN_STATE_COMPLETE;
+        return;
     }
 
-    // Extract the ID of the request so that errors can be returned with the same ID
-    const uint32_t id = JGetInt(req, "id");
+    NOTE_C_METRICS_COUNT(retries, 1);
 
-    // Ensure the Notecard is ready
-    if (!_TransactionStart(CARD_INTER_TRANSACTION_TIMEOUT_SEC * 1000)) {
-        _Free(json);
-        const char *errStr = ERRSTR("Notecard not ready (CTX/RTX) {io}", c_ioerr);
-        if (cmdFound) {
-            NOTE_C_LOG_ERROR(errStr);
-            return NULL;
-        }
-        return _errDoc(id, errStr);
+    // Let other tasks transact with the Notecard during the backoff, unless
+    // the failed attempt reached the Notecard, which only recognizes the
+    // retry as a duplicate if no other request comes in between
+    txn->yielded = (txn->lock && retryLockPolicy == NOTE_RETRY_LOCK_YIELD && !txn->delivered);
+
+    // The caller's buffer is withdrawn while the lock is released, so that
+    // no other task's response is received into it
+    if (txn->yielded) {
+        _rxBufferProvide(NULL, 0);
+        _UnlockNote();
     }
 
-    // Inject the user agent object only when we're doing a `hub.set` and
-    // specifying the product UID together. The goal is to only piggyback
-    // user agent data when the host is initializing the Notecard, as opposed
-    // to every time the host does a `hub.set` to change mode.
-#ifndef NOTE_DISABLE_USER_AGENT
-    if (!JIsPresent(req, "body") && JContainsString(req, (reqFound ? "req" : "cmd"), "hub.set") && JIsPresent(req, "product")) {
-        J *body = NoteUserAgent();
-        if (body != NULL) {
-            JAddItemToObject(req, "body", body);
-            NOTE_C_LOG_DEBUG("Added user-agent to request");
+    if (txn->blocking) {
+        _DelayMs(txn->backoffMs);
+        _noteTransactionResume(txn);
+    } else {
+        txn->stepMs = _GetMs();
+        txn->state = TXN_STATE_BACKOFF;
+    }
+}
+
+/**************************************************************************/
+/*!
+  @brief Classify the result of an exchange with the Notecard.
+  @param   txn
+  The transaction state, with `errStr` holding the result of the exchange.
+*/
+/**************************************************************************/
+NOTE_C_STATIC void _noteTransactionExchanged(NoteTransactionAsync *txn)
+{
+    // Handle transaction errors
+    if (txn->errStr != NULL) {
+        _rxBufferFree(txn->rspJsonStr);
+        txn->rspJsonStr = NULL;
+        // If there's an I/O error on the transaction, retry
+        if (NoteErrorContains(txn->errStr, c_ioerr)) {
+            NOTE_C_LOG_WARN(ERRSTR("retrying... transaction failure", c_iobad));
+            resetRequired = !_Reset();
+            _noteTransactionRetry(txn);  // I/O error, retry
         } else {
-            NOTE_C_LOG_ERROR(ERRSTR("Failed to add user-agent to request", c_mem));
+            NOTE_C_LOG_DEBUG(ERRSTR("transaction failure", c_bad));
+            txn->state = TXN_STATE_COMPLETE;  // Fatal error, do not retry
         }
+    } else if (txn->cmd) {
+        NOTE_C_LOG_DEBUG("Command successfully sent to Notecard");
+        txn->state = TXN_STATE_COMPLETE;  // No response expected and no further ability to retry.
+    } else if (txn->blocking) {
+        txn->state = TXN_STATE_PROCESS;
+    } else {
+        txn->stepMs = txn->queryMs = _GetMs();
+        txn->state = TXN_STATE_AWAIT;
     }
-#endif
+}
 
-    // Calculate the transaction timeout based on the parameters in the request.
-    const uint32_t transactionTimeoutMs = _noteTransaction_calculateTimeoutMs(req, reqFound);
+/**************************************************************************/
+/*!
+  @brief Direct the response about to be received to the response parser,
+  when responses are parsed as they are received.
+  @param   txn
+  The transaction state.
+*/
+/**************************************************************************/
+NOTE_C_STATIC void _noteTransactionStream(NoteTransactionAsync *txn)
+{
+    // Parse the response as it is received, when enabled and if the parser
+    // can be allocated, and otherwise buffer it
+    if (txn->stream == NULL && responseStreaming && !txn->text) {
+        txn->stream = _jStreamCreate();
+    }
+    if (txn->stream != NULL) {
+        _jStreamReset(txn->stream);
+        cardResponseStream = txn->stream;
+    }
+}
 
-#ifndef NOTE_C_LOW_MEM
-    /*
-    * Add a CRC value, so the request may be retried if it is received
-    * in a corrupted state.
-    *
-    * NOTE: This can only performed on requests, because commands do not have a
-    *       'response channel'. As such, we have no ability to understand if a
-    *       command failed and should be retried. A sequence number is included
-    *       as part of the CRC data, so that two identical but separate requests
-    *       are not mistaken as the same request being retried.
-    *
-    *   req   cmd  response
-    *  found found expected
-    *  ----- ----- --------
-    *    0     0    ERROR
-    *    0     1      0
-    *    1     0      1
-    *    1     1    1 (UB)
-    */
-    bool crcAddedToRequest = false;
-    if (reqFound) {
-        char *newJson = _crcAdd(json, seqNo);
-        if (newJson != NULL) {
-            _Free(json);
-            json = newJson;
-            crcAddedToRequest = true;
+/**************************************************************************/
+/*!
+  @brief Transmit the request, or, in blocking mode, perform the entire
+  exchange with the Notecard.
+  @param   txn
+  The transaction state.
+*/
+/**************************************************************************/
+NOTE_C_STATIC void _noteTransactionSend(NoteTransactionAsync *txn)
+{
+    // free on retry
+    if (txn->rsp != NULL) {
+        JDelete(txn->rsp);
+    }
+
+    // reset variables
+    txn->errStr = NULL;
+    txn->rspJsonStr = NULL;
+    txn->rspJsonLen = 0;
+    txn->rsp = NULL;
+
+    // Allow the response no more than the time left before the deadline
+    uint32_t timeoutMs = txn->timeoutMs;
+    if (txn->deadlineMs) {
+        const uint32_t elapsedMs = (_GetMs() - txn->startMs);
+        if (elapsedMs >= txn->deadlineMs) {
+            txn->errStr = ERRSTR("transaction deadline exceeded {io}", c_iotimeout);
+            txn->state = TXN_STATE_COMPLETE;
+            return;
+        }
+        if (!timeoutMs || (txn->deadlineMs - elapsedMs) < timeoutMs) {
+            timeoutMs = (txn->deadlineMs - elapsedMs);
         }
     }
-#endif // !NOTE_C_LOW_MEM
 
-    // Take the lock on the Notecard.  This is required to ensure that we don't
-    // have multiple threads trying to access the Notecard at the same time.
-    if (lockNotecard) {
-        _LockNote();
+    // Heartbeat responses have no request, so simply resume waiting
+    if (txn->heartbeat && !txn->blocking) {
+        txn->stepMs = txn->queryMs = _GetMs();
+        txn->state = TXN_STATE_AWAIT;
+        return;
     }
 
-    // If a reset of the I/O interface is required for any reason, do it now.
-    if (resetRequired) {
-        NOTE_C_LOG_DEBUG("Resetting Notecard I/O Interface...");
-        if ((resetRequired = !_Reset())) {
-            if (lockNotecard) {
-                _UnlockNote();
-            }
-            _Free(json);
-            _TransactionStop();
-            const char *errStr = ERRSTR("failed to reset Notecard interface {io}", c_iobad);
-            if (cmdFound) {
-                NOTE_C_LOG_ERROR(errStr);
-                return NULL;
-            }
-            return _errDoc(id, errStr);
-        }
+    // Trace request unless suppressed
+    if (!txn->heartbeat && suppressShowTransactions == 0) {
+        NOTE_C_LOG_INFO(txn->json);
     }
 
-    // If we're performing retries, this is where we come back to
-    // after a failed transaction.
-    const char *errStr = NULL;
-    char *rspJsonStr = NULL;
-    J *rsp = NULL;
-    bool isHeartbeat = false;
-    for (uint8_t lastRequestRetries = 0; lastRequestRetries <= CARD_REQUEST_RETRIES_ALLOWED; ++lastRequestRetries) {
-        // free on retry
-        if (rsp != NULL) {
-            JDelete(rsp);
-        }
+    // In-place replacement of NULL-terminator with a newline character.
+    // The Notecard expects a newline-terminated string to understand the
+    // end of the request.
+    const size_t jsonLen = txn->jsonLen;
+    txn->json[jsonLen] = '\n';
 
-        // reset variables
-        errStr = NULL;
-        rspJsonStr = NULL;
-        rsp = NULL;
+    size_t jsonTxLen;
+    if (txn->heartbeat) {
+        // Heartbeat responses have no request
+        jsonTxLen = 0;
+    } else {
+        jsonTxLen = (jsonLen + 1);
+    }
 
-        // Trace request unless suppressed
-        if (!isHeartbeat && suppressShowTransactions == 0) {
-            NOTE_C_LOG_INFO(json);
-        }
+    // Perform the transaction. When not blocking, only the request is
+    // transmitted here and the response is collected by subsequent steps.
+    cardRequestTransmitted = false;
+    if (txn->cmd || !txn->blocking) {
+        txn->errStr = _Transaction(txn->json, jsonTxLen, NULL, NULL, timeoutMs);
+    } else {
+        _noteTransactionStream(txn);
+        txn->errStr = _Transaction(txn->json, jsonTxLen, &txn->rspJsonStr, &txn->rspJsonLen, timeoutMs);
+        cardResponseStream = NULL;
+    }
 
-        // In-place replacement of NULL-terminator with a newline character.
-        // The Notecard expects a newline-terminated string to understand the
-        // end of the request.
-        const size_t jsonLen = strlen(json);
-        json[jsonLen] = '\n';
+    txn->delivered = cardRequestTransmitted;
 
-        size_t jsonTxLen;
-        if (isHeartbeat) {
-            // Heartbeat responses have no request
-            jsonTxLen = 0;
-        } else {
-            jsonTxLen = (jsonLen + 1);
-        }
+    // Restore NULL-terminator
+    txn->json[jsonLen] = '\0';
 
-        // Perform the transaction
-        if (cmdFound) {
-            errStr = _Transaction(json, jsonTxLen, NULL, transactionTimeoutMs);
-            // break;  // No response expected for commands and no ability to retry.
-        } else {
-            errStr = _Transaction(json, jsonTxLen, &rspJsonStr, transactionTimeoutMs);
-        }
-
-        // Restore NULL-terminator
-        json[jsonLen] = '\0';
-
-        ////////////////////////
-        // Request retry logic
-        ////////////////////////
-
-        // Handle transaction errors
-        if (errStr != NULL) {
-            _Free(rspJsonStr);
-            // If there's an I/O error on the transaction, retry
-            if (NoteErrorContains(errStr, c_ioerr)) {
-                NOTE_C_LOG_WARN(ERRSTR("retrying... transaction failure", c_iobad));
-                resetRequired = !_Reset();
-                _DelayMs(RETRY_DELAY_MS);
-                continue;  // I/O error, retry
-            } else {
-                NOTE_C_LOG_DEBUG(ERRSTR("transaction failure", c_bad));
-                break;  // Fatal error, do not retry
-            }
-        } else if (cmdFound) {
-            NOTE_C_LOG_DEBUG("Command successfully sent to Notecard");
-            break;  // No response expected and no further ability to retry.
-        }
+    _noteTransactionExchanged(txn);
+}
 
-        // Inspect the Notecard Response
-        if (rspJsonStr == NULL) {
-            // If the response is NULL, then we have a timeout or other error
-            errStr = ERRSTR("response expected, but response is NULL {io}", c_ioerr);
-            NOTE_C_LOG_WARN(ERRSTR("retrying... no response", c_iobad));
-            _DelayMs(RETRY_DELAY_MS);
-            continue;  // I/O error, retry
+/**************************************************************************/
+/*!
+  @brief Query the Notecard, at most every `CARD_REQUEST_ASYNC_POLL_MS`, for
+  the response to a transmitted request.
+  @param   txn
+  The transaction state.
+*/
+/**************************************************************************/
+NOTE_C_STATIC void _noteTransactionAwait(NoteTransactionAsync *txn)
+{
+    const uint32_t nowMs = _GetMs();
+    if ((nowMs - txn->queryMs) < CARD_REQUEST_ASYNC_POLL_MS) {
+        return;
+    }
+    txn->queryMs = nowMs;
+
+    txn->available = 0;
+    txn->errStr = _ResponseQuery(&txn->available);
+    if (txn->errStr == NULL) {
+        if (txn->available) {
+            NOTE_C_METRICS_PHASE(NOTE_METRICS_PHASE_FIRST_BYTE, txn->stepMs);
+            txn->state = TXN_STATE_RECEIVE;
+            return;
         }
+        const bool timedOut = (txn->timeoutMs && (nowMs - txn->stepMs) >= txn->timeoutMs);
+        if (!timedOut && (!txn->deadlineMs || (nowMs - txn->startMs) < txn->deadlineMs)) {
+            return;
+        }
+        NOTE_C_LOG_DEBUG(ERRSTR("reply to request didn't arrive from module in time", c_iotimeout));
+        txn->errStr = ERRSTR("transaction timeout {io}", c_iotimeout);
+    }
+    _noteTransactionExchanged(txn);
+}
+
+/**************************************************************************/
+/*!
+  @brief Check and parse the response received from the Notecard, applying
+  the CRC, heartbeat and retry rules.
+  @param   txn
+  The transaction state.
+*/
+/**************************************************************************/
+NOTE_C_STATIC void _noteTransactionProcess(NoteTransactionAsync *txn)
+{
+    // A streamed response has been parsed as it was received
+    const bool streamed = (txn->rspJsonStr == NULL && txn->stream != NULL && _jStreamReceived(txn->stream));
+
+    // Inspect the Notecard Response
+    if (txn->rspJsonStr == NULL && !streamed) {
+        // If the response is NULL, then we have a timeout or other error
+        txn->errStr = ERRSTR("response expected, but response is NULL {io}", c_ioerr);
+        NOTE_C_LOG_WARN(ERRSTR("retrying... no response", c_iobad));
+        _noteTransactionRetry(txn);  // I/O error, retry
+        return;
+    }
+
+    // Take the streamed response from its parser
+    if (streamed) {
+        txn->rsp = _jStreamFinish(txn->stream);
+    }
 
 #ifndef NOTE_C_LOW_MEM
-        // If we sent a CRC in the request, examine the response JSON to see if
-        // it has a CRC error.  Note that the CRC is stripped from the
-        // rspJsonStr as a side-effect of this method.
-        if (crcAddedToRequest && _crcError(rspJsonStr, seqNo)) {
-            _Free(rspJsonStr);
-            errStr = ERRSTR("CRC error {io}", c_iobad);
+    // If we sent a CRC in the request, examine the response JSON to see if
+    // it has a CRC error.  Note that the CRC is stripped from the
+    // response as a side-effect of these methods.
+    if (txn->crc) {
+        NOTE_C_METRICS_START(crcMs);
+        const bool crcError = (streamed ? _crcStreamError(txn->stream, txn->rsp, txn->seqNo) : _crcError(txn->rspJsonStr, &txn->rspJsonLen, txn->seqNo));
+        NOTE_C_METRICS_PHASE(NOTE_METRICS_PHASE_CRC, crcMs);
+        if (crcError) {
+            NOTE_C_METRICS_COUNT(crcErrors, 1);
+            JDelete(txn->rsp);
+            txn->rsp = NULL;
+            _rxBufferFree(txn->rspJsonStr);
+            txn->rspJsonStr = NULL;
+            txn->errStr = ERRSTR("CRC error {io}", c_iobad);
+            _i2cPacingFeedback(false);
             NOTE_C_LOG_WARN(ERRSTR("retrying... CRC error", c_iobad));
-            _DelayMs(RETRY_DELAY_MS);
-            continue;
+            _noteTransactionRetry(txn);
+            return;
         }
+    }
 #endif // !NOTE_C_LOW_MEM
 
-        // Error types
-        bool isBadBin = false;
-        bool isIoError = false;
-        isHeartbeat = false;
-
-        // Error detection / classification
-        rsp = JParse(rspJsonStr);
-        if (rsp != NULL) {
-            isBadBin = JContainsString(rsp, c_err, c_badbinerr);
-            isIoError = JContainsString(rsp, c_err, c_ioerr) && !JContainsString(rsp, c_err, c_unsupported);
-            isHeartbeat = JContainsString(rsp, c_err, c_heartbeat);
-        } else {
-            // Failed to parse response as JSON
-            isIoError = true;
+    // Error types
+    bool isBadBin = false;
+    bool isIoError = false;
+    txn->heartbeat = false;
+    char textStatus[64] = "";
+
+    // Error detection / classification
+    NOTE_C_METRICS_START(parseMs);
+    bool valid;
+    if (txn->text) {
+        // The error of a response kept as text is located in the same pass
+        // as the caller's fields, if any, and a heartbeat's status only when
+        // there is one
+        JField err = { c_err, NULL, 0, JInvalid };
+        JField *fields = ((txn->fields != NULL) ? txn->fields : &err);
+        const size_t fieldCount = ((txn->fields != NULL) ? txn->fieldCount : 1);
+        valid = (JScanWithLength(txn->rspJsonStr, txn->rspJsonLen, fields, fieldCount) >= 0);
+        isBadBin = JFieldContains(&fields[0], c_badbinerr);
+        isIoError = JFieldContains(&fields[0], c_ioerr) && !JFieldContains(&fields[0], c_unsupported);
+        txn->heartbeat = JFieldContains(&fields[0], c_heartbeat);
+        if (txn->heartbeat) {
+            JField status = { c_status, NULL, 0, JInvalid };
+            JScanWithLength(txn->rspJsonStr, txn->rspJsonLen, &status, 1);
+            JFieldString(&status, textStatus, sizeof(textStatus));
+        }
+    } else {
+        if (!streamed) {
+            txn->rsp = JParseWithLength(txn->rspJsonStr, txn->rspJsonLen);
+        }
+        valid = (txn->rsp != NULL);
+        if (valid) {
+            isBadBin = JContainsString(txn->rsp, c_err, c_badbinerr);
+            isIoError = JContainsString(txn->rsp, c_err, c_ioerr) && !JContainsString(txn->rsp, c_err, c_unsupported);
+            txn->heartbeat = JContainsString(txn->rsp, c_err, c_heartbeat);
+        }
+    }
+    NOTE_C_METRICS_PHASE(NOTE_METRICS_PHASE_PARSE, parseMs);
+    if (!valid) {
+        // Failed to parse response as JSON
+        isIoError = true;
 #ifndef NOTE_C_LOW_MEM
-            _DebugWithLevel(NOTE_C_LOG_LEVEL_ERROR, "[ERROR] ");
-            _DebugWithLevel(NOTE_C_LOG_LEVEL_ERROR, "invalid JSON {io}: ");
-            _DebugWithLevel(NOTE_C_LOG_LEVEL_ERROR, rspJsonStr);
+        _DebugWithLevel(NOTE_C_LOG_LEVEL_ERROR, "[ERROR] ");
+        _DebugWithLevel(NOTE_C_LOG_LEVEL_ERROR, "invalid JSON {io}: ");
+        _DebugWithLevel(NOTE_C_LOG_LEVEL_ERROR, (streamed ? c_newline : txn->rspJsonStr));
 #else
-            NOTE_C_LOG_ERROR(c_ioerr);
+        NOTE_C_LOG_ERROR(c_ioerr);
 #endif // !NOTE_C_LOW_MEM
-        }
+    }
 
-        // Error handling
-        if (isHeartbeat) {
-            // Heartbeat responses are not traditional errors, log and resume waiting
-            _Free(rspJsonStr);
-            const char * const status = JGetString(rsp, c_status);
-            NOTE_C_LOG_DEBUG(ERRSTR(status, c_heartbeat));
+    // Error handling
+    if (txn->heartbeat) {
+        // Heartbeat responses are not traditional errors, log and resume waiting
+        NOTE_C_METRICS_COUNT(heartbeats, 1);
+        _rxBufferFree(txn->rspJsonStr);
+        txn->rspJsonStr = NULL;
+        const char * const status = (txn->text ? textStatus : JGetString(txn->rsp, c_status));
+        NOTE_C_LOG_DEBUG(ERRSTR(status, c_heartbeat));
 #ifdef NOTE_C_HEARTBEAT_CALLBACK
-            if (_noteHeartbeat(status)) {
-                errStr = ERRSTR("host abandoned transaction {heartbeat}", c_heartbeat);
-                NoteResetRequired();
-                break;
-            }
+        if (_noteHeartbeat(status)) {
+            txn->errStr = ERRSTR("host abandoned transaction {heartbeat}", c_heartbeat);
+            NoteResetRequired();
+            txn->state = TXN_STATE_COMPLETE;
+            return;
+        }
 #else
-            (void)status; // avoid unused variable warning when NOTE_C_LOW_MEM defined
+        (void)status; // avoid unused variable warning when NOTE_C_LOW_MEM defined
 #endif
-            --lastRequestRetries; // Heartbeats do not count against retry limit
-            continue;
-        } else if (isIoError || isBadBin) {
-            if (rsp != NULL) {
-                NOTE_C_LOG_ERROR(JGetString(rsp, c_err));
+        txn->state = TXN_STATE_SEND;  // Heartbeats do not count against retry limit
+        return;
+    } else if (isIoError || isBadBin) {
+        if (txn->rsp != NULL) {
+            NOTE_C_LOG_ERROR(JGetString(txn->rsp, c_err));
+        } else if (txn->text) {
+            NOTE_C_LOG_ERROR(txn->rspJsonStr);
+        }
+        if (isBadBin) {
+            NOTE_C_LOG_DEBUG("{bad-bin} errors not eligible for retry");
+            txn->state = TXN_STATE_COMPLETE;
+            return;
+        } else {
+            _rxBufferFree(txn->rspJsonStr);
+            txn->rspJsonStr = NULL;
+            txn->errStr = ERRSTR("corrupt response {io}", c_ioerr);
+            _i2cPacingFeedback(false);
+            NOTE_C_LOG_WARN(ERRSTR("retrying... corrupt response", c_iobad));
+            _noteTransactionRetry(txn);
+            return;
+        }
+    }
+
+    // Transaction completed
+    _i2cPacingFeedback(true);
+    txn->state = TXN_STATE_COMPLETE;
+}
+
+/**************************************************************************/
+/*!
+  @brief Set how a transaction is retried.
+  @param   txn
+  The transaction state.
+  @param   policy
+  The retry policy, or NULL for the one set with `NoteSetRetryPolicy`. It
+  must remain valid until the transaction ends.
+  @param   startMs
+  The time from which the deadline runs.
+  @param   deadlineMs
+  The time allowed over all attempts, or 0 for no limit.
+*/
+/**************************************************************************/
+NOTE_C_STATIC void _noteTransactionPolicy(NoteTransactionAsync *txn, const NoteRetryPolicy *policy, uint32_t startMs, uint32_t deadlineMs)
+{
+    txn->policy = ((policy != NULL) ? policy : &retryPolicy);
+    txn->startMs = startMs;
+    txn->deadlineMs = deadlineMs;
+}
+
+/**************************************************************************/
+/*!
+  @brief Fail a transaction before anything is exchanged with the Notecard.
+  @param   txn
+  The transaction state.
+  @param   id
+  The "id" of the request, with which the error is returned.
+  @param   errStr
+  The error.
+  @param   cmd
+  Set to `true` if the request is a command, to which there is no response.
+*/
+/**************************************************************************/
+NOTE_C_STATIC void _noteTransactionFail(NoteTransactionAsync *txn, uint32_t id, const char *errStr, bool cmd)
+{
+    if (txn->raw) {
+        txn->errStr = errStr;
+    }
+    if (cmd) {
+        NOTE_C_LOG_ERROR(errStr);
+    } else if (!txn->raw) {
+        txn->rsp = _errDoc(id, errStr);
+    }
+}
+
+/**************************************************************************/
+/*!
+  @brief Prepare a transaction with the Notecard for a request that has
+  already been serialized: wait for the Notecard to be ready, add a CRC, take
+  the lock and reset the interface if required.
+  @param   txn
+  The transaction state, initialized but for the serialized request.
+  @param   json
+  The serialized request, with room after it for a CRC. It is freed when the
+  transaction ends, unless `txn->borrowed` is set.
+  @param   jsonLen
+  The length of the serialized request.
+  @param   id
+  The "id" of the request, with which errors are returned.
+  @param   timeoutMs
+  Time allowed for each response.
+  @param   cmd
+  Set to `true` if the request is a command, to which there is no response.
+  @param   lockNotecard
+  Set to `true` if the Notecard should be locked and `false` otherwise.
+  @param   startTransaction
+  Set to `true` to open (and later close) the CTX/RTX window, or `false` if
+  the caller already holds it open.
+*/
+/**************************************************************************/
+NOTE_C_STATIC void _noteTransactionPrepare(NoteTransactionAsync *txn, char *json, size_t jsonLen, uint32_t id, uint32_t timeoutMs, bool cmd, bool lockNotecard, bool startTransaction)
+{
+    // Ensure the Notecard is ready
+    NOTE_C_METRICS_START(windowMs);
+    if (startTransaction && !_TransactionStart(CARD_INTER_TRANSACTION_TIMEOUT_SEC * 1000)) {
+        if (!txn->borrowed) {
+            _Free(json);
+        }
+        _noteTransactionFail(txn, id, ERRSTR("Notecard not ready (CTX/RTX) {io}", c_ioerr), cmd);
+        return;
+    }
+    if (startTransaction) {
+        NOTE_C_METRICS_PHASE(NOTE_METRICS_PHASE_START, windowMs);
+    }
+
+    // Take the lock on the Notecard.  This is required to ensure that we don't
+    // have multiple threads trying to access the Notecard at the same time.
+    if (lockNotecard) {
+        _LockNote();
+    }
+
+    // Drop the cached responses that the request may make stale
+    _noteCacheWrite(json, jsonLen);
+
+#ifndef NOTE_C_LOW_MEM
+    // Reserve a sequence number for the request. Every attempt of the request
+    // carries the same number, even when other transactions are interleaved
+    // between attempts, while no two requests ever share one.
+    txn->seqNo = seqNo++;
+
+    /*
+    * Add a CRC value, so the request may be retried if it is received
+    * in a corrupted state.
+    *
+    * NOTE: This can only performed on requests, because commands do not have a
+    *       'response channel'. As such, we have no ability to understand if a
+    *       command failed and should be retried. A sequence number is included
+    *       as part of the CRC data, so that two identical but separate requests
+    *       are not mistaken as the same request being retried.
+    *
+    *   req   cmd  response
+    *  found found expected
+    *  ----- ----- --------
+    *    0     0    ERROR
+    *    0     1      0
+    *    1     0      1
+    *    1     1    1 (UB)
+    */
+    txn->crc = (!cmd && _crcAdd(json, jsonLen, txn->seqNo));
+    if (txn->crc) {
+        jsonLen += CRC_FIELD_LENGTH;
+    }
+#endif // !NOTE_C_LOW_MEM
+
+    // If a reset of the I/O interface is required for any reason, do it now.
+    if (resetRequired) {
+        NOTE_C_LOG_DEBUG("Resetting Notecard I/O Interface...");
+        if ((resetRequired = !_Reset())) {
+            if (lockNotecard) {
+                _UnlockNote();
             }
-            if (isBadBin) {
-                NOTE_C_LOG_DEBUG("{bad-bin} errors not eligible for retry");
-                break;
-            } else {
-                _Free(rspJsonStr);
-                errStr = ERRSTR("corrupt response {io}", c_ioerr);
-                NOTE_C_LOG_WARN(ERRSTR("retrying... corrupt response", c_iobad));
-                _DelayMs(RETRY_DELAY_MS);
-                continue;
+            if (!txn->borrowed) {
+                _Free(json);
+            }
+            if (startTransaction) {
+                _TransactionStop();
             }
+            _noteTransactionFail(txn, id, ERRSTR("failed to reset Notecard interface {io}", c_iobad), cmd);
+            return;
+        }
+    }
+
+    // Ready to exchange the request with the Notecard
+    NOTE_C_METRICS_COUNT(transactions, 1);
+    txn->json = json;
+    txn->jsonLen = jsonLen;
+    txn->id = id;
+    txn->timeoutMs = timeoutMs;
+    txn->cmd = cmd;
+    txn->lock = lockNotecard;
+    txn->window = startTransaction;
+    txn->state = TXN_STATE_SEND;
+}
+
+/**************************************************************************/
+/*!
+  @brief Prepare a transaction with the Notecard: serialize and validate the
+  request, wait for the Notecard to be ready, add a CRC, take the lock and
+  reset the interface if required.
+  @param   txn
+  The transaction state to initialize.
+  @param   req
+  The `J` cJSON request object.
+  @param   lockNotecard
+  Set to `true` if the Notecard should be locked and `false` otherwise.
+  @param   blocking
+  Set to `true` to perform each exchange with the Notecard in a single step.
+  @param   startTransaction
+  Set to `true` to open (and later close) the CTX/RTX window, or `false` if
+  the caller already holds it open.
+*/
+/**************************************************************************/
+NOTE_C_STATIC void _noteTransactionBegin(NoteTransactionAsync *txn, J *req, bool lockNotecard, bool blocking, bool startTransaction)
+{
+    memset(txn, 0, sizeof(*txn));
+    txn->state = TXN_STATE_DONE;
+    txn->blocking = blocking;
+    _noteTransactionPolicy(txn, NULL, _GetMs(), retryPolicy.deadlineMs);
+
+    // Validate in case of memory failure of the requestor
+    if (req == NULL) {
+        NOTE_C_LOG_ERROR(ERRSTR("NULL request", c_bad));
+        return;
+    }
+
+    // Serialize the JSON request, leaving room to append the CRC in place
+#ifdef NOTE_C_LOW_MEM
+    const size_t jsonReserve = 0;
+#else
+    const size_t jsonReserve = CRC_FIELD_LENGTH;
+#endif
+    size_t jsonLen = 0;
+    NOTE_C_METRICS_START(serializeMs);
+    char *json = _jPrintUnformattedReserve(req, jsonReserve, &jsonLen); // `json` allocated, must be freed
+    NOTE_C_METRICS_PHASE(NOTE_METRICS_PHASE_SERIALIZE, serializeMs);
+    if (json == NULL) {
+        NOTE_C_LOG_ERROR(ERRSTR("failed to serialize JSON request", c_mem));
+        return;
+    }
+
+    // Determine the request or command type
+    const char * const reqApi = JGetString(req, "req");
+    const bool reqFound = reqApi[0];  // test for non-empty string
+    const char * const cmdApi = JGetString(req, "cmd");
+    const bool cmdFound = cmdApi[0];  // test for non-empty string
+
+    // If neither `"req"` nor `"cmd"` are found, then we have an error
+    // condition. If both are present, then we have undefined behavior.
+    if (!reqFound && !cmdFound) {
+        _Free(json);
+        NOTE_C_LOG_ERROR(ERRSTR("neither req nor cmd found in API invocation (invalid JSON)", c_bad));
+        return;
+    } else if (reqFound && cmdFound) {
+        _Free(json);
+        NOTE_C_LOG_ERROR(ERRSTR("both req and cmd present in API invocation (undefined behavior)", c_bad));
+        return;
+    }
+
+    // Extract the ID of the request so that errors can be returned with the same ID
+    const uint32_t id = JGetInt(req, "id");
+
+    // Inject the user agent object only when we're doing a `hub.set` and
+    // specifying the product UID together. The goal is to only piggyback
+    // user agent data when the host is initializing the Notecard, as opposed
+    // to every time the host does a `hub.set` to change mode.
+#ifndef NOTE_DISABLE_USER_AGENT
+    if (!JIsPresent(req, "body") && JContainsString(req, (reqFound ? "req" : "cmd"), "hub.set") && JIsPresent(req, "product")) {
+        J *body = NoteUserAgent();
+        if (body != NULL) {
+            JAddItemToObject(req, "body", body);
+            NOTE_C_LOG_DEBUG("Added user-agent to request");
+        } else {
+            NOTE_C_LOG_ERROR(ERRSTR("Failed to add user-agent to request", c_mem));
         }
+    }
+#endif
+
+    // Calculate the transaction timeout based on the parameters in the request.
+    const uint32_t transactionTimeoutMs = _noteTransaction_calculateTimeoutMs(req, reqFound);
+
+    _noteTransactionPrepare(txn, json, jsonLen, id, transactionTimeoutMs, cmdFound, lockNotecard, startTransaction);
+}
 
-        // Transaction completed
+/**************************************************************************/
+/*!
+  @brief Perform the next step of a transaction with the Notecard.
+  @param   txn
+  The transaction state.
+  @returns `true` once the transaction is complete, `false` otherwise.
+*/
+/**************************************************************************/
+NOTE_C_STATIC bool _noteTransactionStep(NoteTransactionAsync *txn)
+{
+    switch (txn->state) {
+    case TXN_STATE_SEND:
+        _noteTransactionSend(txn);
+        break;
+    case TXN_STATE_AWAIT:
+        _noteTransactionAwait(txn);
+        break;
+    case TXN_STATE_RECEIVE:
+        _noteTransactionStream(txn);
+        txn->errStr = _ResponseReceive(txn->available, &txn->rspJsonStr, &txn->rspJsonLen);
+        cardResponseStream = NULL;
+        if (txn->errStr == NULL) {
+            txn->state = TXN_STATE_PROCESS;
+        } else {
+            _noteTransactionExchanged(txn);
+        }
+        break;
+    case TXN_STATE_PROCESS:
+        _noteTransactionProcess(txn);
+        break;
+    case TXN_STATE_BACKOFF:
+        if ((_GetMs() - txn->stepMs) >= txn->backoffMs) {
+            _noteTransactionResume(txn);
+        }
         break;
-    } // end of retry loop
+    default:
+        break;
+    }
 
-    // Free the original serialized JSON request
-    _Free(json);
+    return (txn->state == TXN_STATE_COMPLETE || txn->state == TXN_STATE_DONE || txn->state == TXN_STATE_IDLE);
+}
 
-#ifndef NOTE_C_LOW_MEM
-    // Request processing complete, regardless of success or error.
-    // Now, advance the request sequence number.
-    seqNo++;
-#endif // !NOTE_C_LOW_MEM
+/**************************************************************************/
+/*!
+  @brief Run a blocking transaction with the Notecard to completion.
+  @param   txn
+  The transaction state, in which each step runs to completion.
+*/
+/**************************************************************************/
+NOTE_C_STATIC void _noteTransactionRun(NoteTransactionAsync *txn)
+{
+    while (!_noteTransactionStep(txn)) {
+        // Each blocking step runs to completion
+    }
+}
+
+/**************************************************************************/
+/*!
+  @brief Finish a transaction with the Notecard, abandoning it if it has not
+  yet completed, and release the resources it holds.
+  @param   txn
+  The transaction state.
+  @returns a `J` cJSON object with the response, or NULL if there is
+  insufficient memory.
+*/
+/**************************************************************************/
+NOTE_C_STATIC J *_noteTransactionEnd(NoteTransactionAsync *txn)
+{
+    J *rsp = txn->rsp;
+    const uint8_t state = txn->state;
+    txn->rsp = NULL;
+    txn->state = TXN_STATE_IDLE;
+
+    // Nothing was exchanged with the Notecard, so nothing is held
+    if (state == TXN_STATE_IDLE || state == TXN_STATE_DONE) {
+        return rsp;
+    }
+
+    // Retake the lock if the transaction is abandoned during its backoff
+    if (txn->yielded) {
+        _LockNote();
+        txn->yielded = false;
+    }
+
+    // Abandon an incomplete transaction
+    const char *errStr = txn->errStr;
+    if (state != TXN_STATE_COMPLETE) {
+        _rxBufferFree(txn->rspJsonStr);
+        txn->rspJsonStr = NULL;
+        errStr = ERRSTR("transaction abandoned {io}", c_ioerr);
+    }
+
+    // Free the original serialized JSON request, unless it belongs to the
+    // caller, and the response parser
+    if (!txn->borrowed) {
+        _Free(txn->json);
+    }
+    txn->json = NULL;
+    _jStreamDelete(txn->stream);
+    txn->stream = NULL;
 
     // Return an empty object (with no err field) when no response is expected
-    if (cmdFound) {
-        if (lockNotecard) {
+    if (txn->cmd) {
+        if (txn->lock) {
             _UnlockNote();
         }
-        _TransactionStop();
-        return JCreateObject();
+        if (txn->window) {
+            _TransactionStop();
+        }
+        return (txn->raw ? NULL : JCreateObject());
     }
 
     // Handle error condition
@@ -721,33 +1342,434 @@ J *_noteTransactionShouldLock(J *req, bool lockNotecard)
             rsp = NULL;
         }
         NoteResetRequired(); // queue up a reset
-        J *errRsp = _errDoc(id, errStr);
-        if (lockNotecard) {
+        txn->errStr = errStr;
+        J *errRsp = (txn->raw ? NULL : _errDoc(txn->id, errStr));
+        if (txn->lock) {
             _UnlockNote();
         }
-        _TransactionStop();
+        if (txn->window) {
+            _TransactionStop();
+        }
         return errRsp;
     }
 
-    // Log and discard the response JSON
-    if (suppressShowTransactions == 0) {
-        NOTE_C_LOG_INFO(rspJsonStr);
+    // Log and discard the response JSON, which is not held when streamed,
+    // unless the caller is to collect it as text
+    if (suppressShowTransactions == 0 && txn->rspJsonStr != NULL) {
+        NOTE_C_LOG_INFO(txn->rspJsonStr);
+    }
+    if (!txn->text) {
+        _rxBufferFree(txn->rspJsonStr);
+        txn->rspJsonStr = NULL;
     }
-    _Free(rspJsonStr);
 
     // Release the Notecard lock
-    if (lockNotecard) {
+    if (txn->lock) {
         _UnlockNote();
     }
 
     // Inform the Notecard that the transaction is complete.
     // This allows the Notecard (ESP) to drop into low power mode.
-    _TransactionStop();
+    if (txn->window) {
+        _TransactionStop();
+    }
 
     // Done
     return rsp;
 }
 
+/**************************************************************************/
+/*!
+  @brief Same as `NoteTransaction`, but takes an additional parameter that
+  indicates if the Notecard should be locked.
+  @param   req
+  The `J` cJSON request object.
+  @param   lockNotecard
+  Set to `true` if the Notecard should be locked and `false` otherwise.
+  @returns a `J` cJSON object with the response, or NULL if there is
+  insufficient memory.
+*/
+/**************************************************************************/
+J *_noteTransactionShouldLock(J *req, bool lockNotecard)
+{
+    NoteTransactionAsync txn;
+    _noteTransactionBegin(&txn, req, lockNotecard, true, true);
+    _noteTransactionRun(&txn);
+    return _noteTransactionEnd(&txn);
+}
+
+/**************************************************************************/
+/*!
+  @brief Same as `NoteTransaction`, but retries the request as the given
+  policy allows, within a deadline that may have begun before the call.
+  @param   req
+  The `J` cJSON request object.
+  @param   policy
+  The retry policy, or NULL for the one set with `NoteSetRetryPolicy`.
+  @param   startMs
+  The time from which the deadline runs.
+  @param   deadlineMs
+  The time allowed over all attempts, or 0 for no limit.
+  @returns a `J` cJSON object with the response, or NULL if there is
+  insufficient memory.
+*/
+/**************************************************************************/
+NOTE_C_STATIC J *_noteTransactionWithPolicy(J *req, const NoteRetryPolicy *policy, uint32_t startMs, uint32_t deadlineMs)
+{
+    NoteTransactionAsync txn;
+    _noteTransactionBegin(&txn, req, true, true, true);
+    _noteTransactionPolicy(&txn, policy, startMs, deadlineMs);
+    _noteTransactionRun(&txn);
+    return _noteTransactionEnd(&txn);
+}
+
+/**************************************************************************/
+/*!
+  @brief Run a prepared blocking transaction to completion, keeping the
+  response as text.
+  @param   txn
+  The transaction state.
+  @param   textLen [out]
+  The length of the response text.
+  @returns the response text, without its CRC, which must be freed with
+  `JFree`, or NULL if there is insufficient memory. Errors that arise before
+  a response is received are returned as the text of an error object.
+*/
+/**************************************************************************/
+NOTE_C_STATIC char *_noteTransactionRunText(NoteTransactionAsync *txn, size_t *textLen)
+{
+    txn->text = true;
+    _noteTransactionRun(txn);
+    J *rsp = _noteTransactionEnd(txn);
+    char *text = (char *)_rxBufferDetach(txn->rspJsonStr);
+    *textLen = txn->rspJsonLen;
+    txn->rspJsonStr = NULL;
+    if (text == NULL && rsp != NULL) {
+        text = _jPrintUnformattedReserve(rsp, 0, textLen);
+    }
+    JDelete(rsp);
+    return text;
+}
+
+/**************************************************************************/
+/*!
+  @brief Same as `NoteRequestResponse`, but locates fields of the response
+  with `JScan` rather than parsing it, in the same pass that checks the
+  response for an error.
+  @param   req
+  The `J` cJSON request object, which is always freed.
+  @param   fields
+  The fields to locate, the first of which must be "err".
+  @param   count
+  The number of fields, including "err".
+  @returns the response text, which holds the values of the fields and must
+  be freed with `JFree`, or NULL if the request failed or the response has an
+  "err" field, even an empty one.
+*/
+/**************************************************************************/
+char *_noteRequestResponseFields(J *req, JField *fields, size_t count)
+{
+    if (req == NULL) {
+        return NULL;
+    }
+
+    NoteTransactionAsync txn;
+    _noteTransactionBegin(&txn, req, true, true, true);
+    txn.text = true;
+    txn.fields = fields;
+    txn.fieldCount = count;
+    _noteTransactionRun(&txn);
+    JDelete(_noteTransactionEnd(&txn));
+    JDelete(req);
+
+    // Only a response that was received has had its fields located, and
+    // errors that arise before then are not kept
+    char *text = (char *)_rxBufferDetach(txn.rspJsonStr);
+    txn.rspJsonStr = NULL;
+    if (text != NULL && fields[0].type != JInvalid) {
+        JFree(text);
+        text = NULL;
+    }
+    return text;
+}
+
+/**************************************************************************/
+/*!
+  @brief Perform a transaction with a request that the caller has already
+  serialized, keeping the response as text.
+  @param   json
+  The serialized request, with room after it for a CRC (and its
+  null-terminator). It remains the caller's, and a CRC may be left appended.
+  @param   jsonLen
+  The length of the serialized request.
+  @param   id
+  The "id" of the request, with which errors are returned.
+  @param   timeoutMs
+  Time allowed for each response.
+  @param   cmd
+  Set to `true` if the request is a command, to which there is no response.
+  @param   textLen [out]
+  The length of the response text.
+  @returns the response text, without its CRC, which must be freed with
+  `JFree`, or NULL if there is insufficient memory. Errors that arise before
+  a response is received are returned as the text of an error object.
+*/
+/**************************************************************************/
+char *_noteTransactionText(char *json, size_t jsonLen, uint32_t id, uint32_t timeoutMs, bool cmd, size_t *textLen)
+{
+    NoteTransactionAsync txn;
+    memset(&txn, 0, sizeof(txn));
+    txn.state = TXN_STATE_DONE;
+    txn.blocking = true;
+    txn.borrowed = true;
+    _noteTransactionPolicy(&txn, NULL, _GetMs(), retryPolicy.deadlineMs);
+    _noteTransactionPrepare(&txn, json, jsonLen, id, timeoutMs, cmd, true, true);
+    return _noteTransactionRunText(&txn, textLen);
+}
+
+const char *NoteRequestResponseJSONBuffer(char *request, size_t requestLen, size_t requestSize, char *response, size_t responseSize, size_t *responseLen)
+{
+    if (responseLen != NULL) {
+        *responseLen = 0;
+    }
+    if (request == NULL || response == NULL || responseSize < 2) {
+        return ERRSTR("request and response buffers are required {bad}", c_bad);
+    }
+
+    // The request is sent with a CRC and a newline appended in place
+    while (requestLen > 0 && request[requestLen - 1] <= ' ') {
+        requestLen--;
+    }
+    if (requestSize < (requestLen + NOTE_JSON_REQUEST_RESERVE)) {
+        return ERRSTR("request buffer has no room for its CRC {overflow}", c_overflow);
+    }
+    request[requestLen] = '\0';
+
+    // Locate the fields that determine how the request is sent, without
+    // parsing it
+    JField fields[5] = {
+        { c_req, NULL, 0, JInvalid },
+        { c_cmd, NULL, 0, JInvalid },
+        { "id", NULL, 0, JInvalid },
+        { "milliseconds", NULL, 0, JInvalid },
+        { "seconds", NULL, 0, JInvalid },
+    };
+    if (JScanWithLength(request, requestLen, fields, 5) < 0) {
+        return ERRSTR("request is not valid JSON {bad}", c_bad);
+    }
+    const bool reqFound = !JFieldIsNullString(&fields[0]);
+    const bool cmdFound = !JFieldIsNullString(&fields[1]);
+    if (reqFound == cmdFound) {
+        return ERRSTR("request must have either req or cmd {bad}", c_bad);
+    }
+    const uint32_t id = (uint32_t)JFieldInt(&fields[2]);
+    const uint32_t timeoutMs = _noteTransactionScannedTimeoutMs(&fields[reqFound ? 0 : 1], &fields[3], &fields[4]);
+
+    // Receive the response into the caller's buffer while the Notecard is
+    // locked for the transaction, keeping it as text
+    NoteTransactionAsync txn;
+    memset(&txn, 0, sizeof(txn));
+    txn.state = TXN_STATE_DONE;
+    txn.blocking = true;
+    txn.borrowed = true;
+    txn.raw = true;
+    txn.text = true;
+    _noteTransactionPolicy(&txn, NULL, _GetMs(), retryPolicy.deadlineMs);
+    _noteTransactionPrepare(&txn, request, requestLen, id, timeoutMs, cmdFound, true, true);
+    if (txn.state == TXN_STATE_SEND) {
+        txn.rxBuffer = response;
+        txn.rxBufferSize = (responseSize - 1);
+        _rxBufferProvide((uint8_t *)txn.rxBuffer, txn.rxBufferSize);
+        _noteTransactionRun(&txn);
+        _rxBufferProvide(NULL, 0);
+    }
+    _noteTransactionEnd(&txn);
+
+    // Restore the request, from which the CRC replaced the closing brace
+    if (txn.crc) {
+        request[requestLen - 1] = '}';
+        request[requestLen] = '\0';
+    }
+    if (txn.errStr != NULL || cmdFound) {
+        return txn.errStr;
+    }
+
+    // The response is in the caller's buffer, without its CRC or newline
+    size_t len = ((txn.rspJsonStr == response) ? txn.rspJsonLen : 0);
+    while (len > 0 && response[len - 1] <= ' ') {
+        len--;
+    }
+    response[len] = '\0';
+    if (responseLen != NULL) {
+        *responseLen = len;
+    }
+    return NULL;
+}
+
+/**************************************************************************/
+/*!
+  @brief Send each request in a list to the Notecard, in order, within a single
+  CTX/RTX window and a single hold of the Notecard lock.
+  @param   reqs
+  A `J` array of request (or command) objects. The array is not freed.
+  @param   stopOnError
+  Whether the requests that follow a failed request are left unsent.
+  @returns a `J` array holding one response per request sent, in order, or
+  NULL if `reqs` is not an array or there is insufficient memory. A command
+  yields an empty object, exactly as with `NoteTransaction`, and an entry
+  that `NoteTransaction` would have returned as NULL is replaced by an error
+  object.
+*/
+/**************************************************************************/
+NOTE_C_STATIC J *_noteTransactionBatch(J *reqs, bool stopOnError)
+{
+    if (reqs == NULL || !JIsArray(reqs)) {
+        NOTE_C_LOG_ERROR(ERRSTR("batch requires an array of requests", c_bad));
+        return NULL;
+    }
+
+    J *rsps = JCreateArray();
+    if (rsps == NULL) {
+        NOTE_C_LOG_ERROR(ERRSTR("failed to allocate batch response", c_mem));
+        return NULL;
+    }
+
+    // Wake the Notecard once for the entire batch
+    const bool ready = _TransactionStart(CARD_INTER_TRANSACTION_TIMEOUT_SEC * 1000);
+
+    _LockNote();
+    bool stopped = false;
+    J *req = NULL;
+    JArrayForEach(req, reqs) {
+        J *rsp;
+        if (ready) {
+            NoteTransactionAsync txn;
+            _noteTransactionBegin(&txn, req, false, true, false);
+            _noteTransactionRun(&txn);
+            rsp = _noteTransactionEnd(&txn);
+            if (rsp == NULL) {
+                rsp = _errDoc(JGetInt(req, "id"), ERRSTR("request could not be sent {bad}", c_bad));
+            }
+        } else {
+            rsp = _errDoc(JGetInt(req, "id"), ERRSTR("Notecard not ready (CTX/RTX) {io}", c_ioerr));
+        }
+        if (rsp == NULL) {
+            NOTE_C_LOG_ERROR(ERRSTR("failed to allocate batch response", c_mem));
+            break;
+        }
+        JAddItemToArray(rsps, rsp);
+        if (stopOnError && NoteResponseError(rsp)) {
+            stopped = true;
+            break;
+        }
+    }
+    _UnlockNote();
+
+    if (ready) {
+        _TransactionStop();
+    }
+
+    // Report insufficient memory for the batch as a whole
+    if (!stopped && JGetArraySize(rsps) != JGetArraySize(reqs)) {
+        JDelete(rsps);
+        rsps = NULL;
+    }
+
+    return rsps;
+}
+
+J *NoteTransactionBatch(J *reqs)
+{
+    return _noteTransactionBatch(reqs, false);
+}
+
+J *NoteTransactionBatchUntilError(J *reqs)
+{
+    return _noteTransactionBatch(reqs, true);
+}
+
+void NoteTransactionAsyncBegin(NoteTransactionAsync *txn, J *req)
+{
+    _noteTransactionBegin(txn, req, true, false, true);
+}
+
+bool NoteTransactionAsyncPoll(NoteTransactionAsync *txn)
+{
+    return _noteTransactionStep(txn);
+}
+
+J *NoteTransactionAsyncEnd(NoteTransactionAsync *txn)
+{
+    return _noteTransactionEnd(txn);
+}
+
+void NoteSetRetryLockPolicy(uint8_t policy)
+{
+    _LockNote();
+    retryLockPolicy = policy;
+    _UnlockNote();
+}
+
+void NoteSetRetryPolicy(const NoteRetryPolicy *policy)
+{
+    static const NoteRetryPolicy defaultPolicy = NOTE_RETRY_POLICY_DEFAULT;
+    _LockNote();
+    retryPolicy = ((policy != NULL) ? *policy : defaultPolicy);
+    _UnlockNote();
+}
+
+void NoteSetResponseStreaming(bool enable)
+{
+    _LockNote();
+    responseStreaming = enable;
+    _UnlockNote();
+}
+
+#ifdef NOTE_C_METRICS
+/**************************************************************************/
+/*!
+  @brief Add the duration of a phase of a transaction to its histogram.
+  @param   phase
+  The phase, one of `NOTE_METRICS_PHASE_*`.
+  @param   startMs
+  The time at which the phase started.
+*/
+/**************************************************************************/
+void _noteMetricsPhase(uint8_t phase, uint32_t startMs)
+{
+    const uint32_t elapsedMs = (_GetMs() - startMs);
+    NoteMetricsHistogram *histogram = &noteMetrics.phases[phase];
+
+    uint8_t bucket = 0;
+    while (bucket < (NOTE_METRICS_BUCKETS - 1) && (elapsedMs >> bucket) != 0) {
+        bucket++;
+    }
+    histogram->buckets[bucket]++;
+    histogram->count++;
+    histogram->totalMs += elapsedMs;
+    if (elapsedMs > histogram->maxMs) {
+        histogram->maxMs = elapsedMs;
+    }
+}
+
+void NoteGetMetrics(NoteMetrics *metrics)
+{
+    if (metrics == NULL) {
+        return;
+    }
+    _LockNote();
+    memcpy(metrics, &noteMetrics, sizeof(noteMetrics));
+    _UnlockNote();
+}
+
+void NoteResetMetrics(void)
+{
+    _LockNote();
+    memset(&noteMetrics, 0, sizeof(noteMetrics));
+    _UnlockNote();
+}
+#endif // NOTE_C_METRICS
+
 /*!
  @brief Mark that a reset will be required before doing further I/O on a given
         port.
@@ -832,96 +1854,83 @@ uint64_t _n_atoh(char *p, int maxLen)
     return (n);
 }
 
-static uint32_t lut[16] = {
-    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4,
-    0x4DB26158, 0x5005713C, 0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
-    0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
-};
-
-/*!
- @brief Compute the CRC32 of the passed in buffer.
-
- Small lookup-table half-byte CRC32 algorithm. See
- https://create.stephan-brumme.com/crc32/#half-byte
-
- @param data The buffer.
- @param length The length of the buffer.
-
- @returns The CRC32 of the buffer.
- */
-NOTE_C_STATIC int32_t _crc32(const void* data, size_t length)
-{
-    uint32_t previousCrc32 = 0;
-    uint32_t crc = ~previousCrc32;
-    unsigned char* current = (unsigned char*) data;
-
-    while (length--) {
-        crc = lut[(crc ^  *current      ) & 0x0F] ^ (crc >> 4);
-        crc = lut[(crc ^ (*current >> 4)) & 0x0F] ^ (crc >> 4);
-        current++;
-    }
-
-    return ~crc;
-}
-
 /*!
- @brief Append a "crc" field to the passed in JSON buffer.
+ @brief Append a "crc" field to the passed in JSON buffer, in place.
 
  The "crc" field has a value of the form "SSSS:CCCCCCCC", where SSSS is the
  passed in sequence number and CCCCCCCC is the CRC32.
 
  @param json The JSON buffer to both add the CRC32 to and to compute the
-        CRC32 over.
+        CRC32 over. The buffer must have room for `CRC_FIELD_LENGTH` more
+        bytes after the terminator.
+ @param jsonLen The length of the JSON in the buffer.
  @param seqno A 16-bit sequence number to include as a part of the CRC.
 
- @returns A dynamically-allocated version of the passed in buffer with the CRC
-          field added or NULL on error.
+ @returns `true` if the CRC field was added or `false` on error, in which case
+          the buffer is left unmodified.
  */
-NOTE_C_STATIC char *_crcAdd(char *json, uint16_t seqno)
+NOTE_C_STATIC bool _crcAdd(char *json, size_t jsonLen, uint16_t seqno)
 {
 
-    // Allocate a block the size of the input json plus the size of
-    // the field to be added.  Note that the input JSON ends in '"}' and
-    // this will be replaced with a combination of 4 hex digits of the
-    // seqno plus 8 hex digits of the CRC32, and the '}' will be
-    // transformed into ',"crc":"SSSS:CCCCCCCC"}' where SSSS is the
-    // seqno and CCCCCCCC is the CRC32.  Note that the comma is
-    // replaced with a space if the input json doesn't contain
-    // any fields, so that we always return compliant JSON.
-
-    size_t jsonLen = strlen(json);
+    // The input JSON ends in '}', which will be transformed into
+    // ',"crc":"SSSS:CCCCCCCC"}' where SSSS is the seqno and CCCCCCCC is
+    // the CRC32.  Note that the comma is replaced with a space if the
+    // input json doesn't contain any fields, so that we always produce
+    // compliant JSON.
 
     // Minimum JSON is "{}" and must end with a closing "}".
     if (jsonLen < 2 || json[jsonLen-1] != '}') {
-        return NULL;
-    }
-    char *newJson = (char *) _Malloc(jsonLen+CRC_FIELD_LENGTH+1);
-    if (newJson == NULL) {
-        return NULL;
+        return false;
     }
 
+    // The CRC covers the JSON as it was passed in, so take it before the
+    // closing brace is overwritten
+    const uint32_t crc = _crc32(json, jsonLen);
     bool isEmptyObject = (memchr(json, ':', jsonLen) == NULL);
     size_t newJsonLen = jsonLen-1;
 
-    memcpy(newJson, json, newJsonLen);
-    newJson[newJsonLen++] = (isEmptyObject ? ' ' : ',');    // Replace }
-    newJson[newJsonLen++] = '"';                            // +1
-    newJson[newJsonLen++] = 'c';                            // +2
-    newJson[newJsonLen++] = 'r';                            // +3
-    newJson[newJsonLen++] = 'c';                            // +4
-    newJson[newJsonLen++] = '"';                            // +5
-    newJson[newJsonLen++] = ':';                            // +6
-    newJson[newJsonLen++] = '"';                            // +7
-    _n_htoa16(seqno, (uint8_t *) &newJson[newJsonLen]);
+    json[newJsonLen++] = (isEmptyObject ? ' ' : ',');       // Replace }
+    json[newJsonLen++] = '"';                               // +1
+    json[newJsonLen++] = 'c';                               // +2
+    json[newJsonLen++] = 'r';                               // +3
+    json[newJsonLen++] = 'c';                               // +4
+    json[newJsonLen++] = '"';                               // +5
+    json[newJsonLen++] = ':';                               // +6
+    json[newJsonLen++] = '"';                               // +7
+    _n_htoa16(seqno, (uint8_t *) &json[newJsonLen]);
     newJsonLen += 4;                                        // +11
-    newJson[newJsonLen++] = ':';                            // +12
-    _n_htoa32(_crc32(json, jsonLen), &newJson[newJsonLen]);
+    json[newJsonLen++] = ':';                               // +12
+    _n_htoa32(crc, &json[newJsonLen]);
     newJsonLen += 8;                                        // +20
-    newJson[newJsonLen++] = '"';                            // +21
-    newJson[newJsonLen++] = '}';                            // +22 == CRC_FIELD_LENGTH
-    newJson[newJsonLen] = '\0';                             // null-terminated as it came in
+    json[newJsonLen++] = '"';                               // +21
+    json[newJsonLen++] = '}';                               // +22 == CRC_FIELD_LENGTH
+    json[newJsonLen] = '\0';                                // null-terminated as it came in
 
-    return newJson;
+    return true;
+}
+
+/*!
+ @brief Determine whether JSON of a known length has an "err" field.
+
+ @param json The JSON, which need not be null-terminated.
+ @param jsonLen The length of the JSON.
+
+ @returns `true` if the JSON contains `ERR_FIELD_NAME_TEST`.
+ */
+NOTE_C_STATIC bool _crcErrFieldPresent(const char *json, size_t jsonLen)
+{
+    const size_t fieldLen = (sizeof(ERR_FIELD_NAME_TEST) - 1);
+    const char *end = (json + jsonLen);
+    for (const char *p = json; (size_t)(end - p) >= fieldLen; p++) {
+        p = (const char *)memchr(p, ERR_FIELD_NAME_TEST[0], ((size_t)(end - p) - fieldLen) + 1);
+        if (p == NULL) {
+            return false;
+        }
+        if (memcmp(p, ERR_FIELD_NAME_TEST, fieldLen) == 0) {
+            return true;
+        }
+    }
+    return false;
 }
 
 /*!
@@ -933,51 +1942,59 @@ NOTE_C_STATIC char *_crcAdd(char *json, uint16_t seqno)
  function has been given a buffer with a CRC field before. In this case, the
  lack of a CRC field is an error.
 
- @param json The JSON buffer for which the CRC should be checked. Note that the
-        CRC is stripped from the input JSON regardless of whether or not there
-        was an error.
+ @param json The JSON buffer for which the CRC should be checked.
+ @param jsonLen [in/out] The length of the JSON, which is reduced should the
+        CRC be stripped.
  @param shouldBeSeqno The expected sequence number.
 
  @returns `true` if there's an error and `false` otherwise.
 
- @note The CRC is stripped from the input JSON regardless of whether or not
-        there was an error.
+ @note The CRC is stripped from the input JSON unless the JSON is an error
+       response that fails the check.
  */
-NOTE_C_STATIC bool _crcError(char *json, uint16_t shouldBeSeqno)
+NOTE_C_STATIC bool _crcError(char *json, size_t *jsonLen, uint16_t shouldBeSeqno)
 {
     // Trim whitespace from tail (specifically "\r\n") for CRC calculation
-    size_t jsonLen = strlen(json);
-    while (jsonLen > 0 && json[jsonLen - 1] <= ' ') {
-        jsonLen--;
+    size_t len = *jsonLen;
+    while (len > 0 && json[len - 1] <= ' ') {
+        len--;
     }
 
     // Valid JSON must begin with an opening "{" and end with a closing "}"
-    if (jsonLen < 2 || json[0] != '{' || json[jsonLen - 1] != '}') {
+    if (len < 2 || json[0] != '{' || json[len - 1] != '}') {
         // Invalid JSON
         return false;
     }
 
-    // Ignore CRC checks when error ("err") is present in JSON.
-    // This condition must be tested early-on, because Notecard errors should
-    // not be treated as CRC errors (CRC errors are automatically retried).
-    // There is little value in attempting to retry a transaction that prompts
-    // an error condition in the Notecard.
-    if (strstr(json, ERR_FIELD_NAME_TEST)) {
-        // Error ("err") present in JSON
-        return false;
+    // Calculate CRC offset by subtracting CRC_FIELD_LENGTH (the length of the
+    // CRC field name and value) from the end of the JSON. The minimum JSON
+    // length is "{}" (2 bytes) + CRC_FIELD_LENGTH.
+    size_t crcOffset = ((len - 1) - CRC_FIELD_LENGTH);
+    const bool crcPresent = (len >= (CRC_FIELD_LENGTH + 2) && memcmp(&json[crcOffset + CRC_FIELD_NAME_OFFSET], CRC_FIELD_NAME_TEST, (sizeof(CRC_FIELD_NAME_TEST) - 1)) == 0);
+
+    // Check the CRC over the JSON that precedes it, closed with a "}", before
+    // anything is modified
+    bool crcMismatch = false;
+    if (crcPresent) {
+        char *p = &json[crcOffset + CRC_FIELD_NAME_OFFSET + (sizeof(CRC_FIELD_NAME_TEST) - 1)];
+        const uint16_t actualSeqno = (uint16_t) _n_atoh(p, 4);
+        const uint32_t actualCrc32 = (uint32_t) _n_atoh(p+5, 8);
+        const uint32_t shouldBeCrc32 = _crc32Update(_crc32(json, crcOffset), "}", 1);
+        crcMismatch = (shouldBeSeqno != actualSeqno || shouldBeCrc32 != actualCrc32);
     }
 
-    // Minimum JSON length is "{}" (2 bytes) + CRC_FIELD_LENGTH
-    if (jsonLen < (CRC_FIELD_LENGTH + 2)) {
-        // JSON too short to contain a CRC parameter
-        // Return error if we've seen a CRC before, otherwise no CRC value is expected.
-        return notecardFirmwareSupportsCrc;
+    // Ignore CRC checks when error ("err") is present in JSON, because
+    // Notecard errors should not be treated as CRC errors (CRC errors are
+    // automatically retried). There is little value in attempting to retry a
+    // transaction that prompts an error condition in the Notecard. The JSON is
+    // only searched when the CRC doesn't vouch for it, so that a good response
+    // is scanned once here.
+    if ((!crcPresent || crcMismatch) && _crcErrFieldPresent(json, len)) {
+        // Error ("err") present in JSON
+        return false;
     }
 
-    // Calculate CRC offset by subtracting CRC_FIELD_LENGTH (the length of the
-    // CRC field name and value) from the end of the JSON.
-    size_t crcOffset = ((jsonLen - 1) - CRC_FIELD_LENGTH);
-    if (memcmp(&json[crcOffset + CRC_FIELD_NAME_OFFSET], CRC_FIELD_NAME_TEST, (sizeof(CRC_FIELD_NAME_TEST) - 1)) != 0) {
+    if (!crcPresent) {
         // CRC value not present in JSON
         // Return error if we've seen a CRC before, otherwise no CRC value is expected.
         return notecardFirmwareSupportsCrc;
@@ -987,13 +2004,49 @@ NOTE_C_STATIC bool _crcError(char *json, uint16_t shouldBeSeqno)
     // so we should continue to expect it from now on.
     notecardFirmwareSupportsCrc = true;
 
-    // Extract the CRC field and the sequence number
-    char *p = &json[crcOffset + CRC_FIELD_NAME_OFFSET + (sizeof(CRC_FIELD_NAME_TEST) - 1)];
-    uint16_t actualSeqno = (uint16_t) _n_atoh(p, 4);
-    uint32_t actualCrc32 = (uint32_t) _n_atoh(p+5, 8);
+    // Strip the CRC field
     json[crcOffset++] = '}';
     json[crcOffset] = '\0';
-    uint32_t shouldBeCrc32 = _crc32(json, crcOffset);
+    *jsonLen = crcOffset;
+
+    return crcMismatch;
+}
+
+/*!
+ @brief Check a streamed response for CRC and sequence number errors.
+
+ Applies the same rules as `_crcError`, to a response that was parsed as it
+ was received, using the CRC computed by the parser along the way. As the
+ response text is not held, an error response is recognized by a top-level
+ "err" field.
+
+ @param stream The parser that received the response.
+ @param rsp The parsed response, or NULL if it was invalid. Note that the CRC
+        is stripped from the response regardless of whether or not there was
+        an error.
+ @param shouldBeSeqno The expected sequence number.
+
+ @returns `true` if there's an error and `false` otherwise.
+ */
+NOTE_C_STATIC bool _crcStreamError(NoteJStream *stream, J *rsp, uint16_t shouldBeSeqno)
+{
+    // Invalid JSON and Notecard errors are not treated as CRC errors
+    if (!JIsObject(rsp) || JIsPresent(rsp, c_err)) {
+        return false;
+    }
+
+    uint16_t actualSeqno = 0;
+    uint32_t actualCrc32 = 0;
+    uint32_t shouldBeCrc32 = 0;
+    if (!_jStreamCrc(stream, &actualSeqno, &actualCrc32, &shouldBeCrc32)) {
+        // Return error if we've seen a CRC before, otherwise no CRC value is expected.
+        return notecardFirmwareSupportsCrc;
+    }
+
+    // Once we get here, we've seen a CRC from the Notecard,
+    // so we should continue to expect it from now on.
+    notecardFirmwareSupportsCrc = true;
+    JDeleteItemFromObject(rsp, "crc");
 
     return (shouldBeSeqno != actualSeqno || shouldBeCrc32 != actualCrc32);
 }
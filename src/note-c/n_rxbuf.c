@@ -0,0 +1,204 @@
+// Copyright 2026 Blues Inc.  All rights reserved.
+// Use of this source code is governed by licenses granted by the
+// copyright holder including that found in the LICENSE file.
+
+// The buffer into which the I2C and Serial transports receive each response
+// from the Notecard. It is sized from the count of bytes the Notecard first
+// reports as available, and grows geometrically (in place, if the platform has
+// a realloc hook). When pooling is enabled, a buffer of the pool's full size is
+// allocated once and kept in place from one transaction to the next, so that
+// most responses are received without any allocation, and the buffer never
+// leaves a hole behind by moving. A buffer provided by the caller may be used
+// instead, in which case nothing is allocated and a response that doesn't fit
+// is an overflow error.
+
+#include "n_lib.h"
+
+// The pooled buffer, its size (excluding the null-terminator), whether it
+// holds a response, and the size of the pool, which are kept per thread when
+// `NOTE_C_THREAD_CONTEXT` is defined
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL uint8_t *rxPool = NULL;
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL size_t rxPoolSize = 0;
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL bool rxPoolLent = false;
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL size_t rxPoolRetain = 0;
+
+// The buffer provided by the caller, and its size (excluding the
+// null-terminator), which is used in place of any other while set
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL uint8_t *rxProvided = NULL;
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL size_t rxProvidedSize = 0;
+
+/**************************************************************************/
+/*!
+  @brief  Get a buffer into which to receive a response.
+
+  The buffer provided by the caller is used, whatever its size, if one is
+  set. The pooled buffer is lent when pooling is enabled, it isn't already
+  lent and it is large enough, once it has been allocated at the pool's full
+  size if it hasn't been already. Otherwise, a buffer of exactly the size
+  requested is allocated.
+
+  @param   size [in/out] The bytes required, then the bytes available, which
+            never include the extra byte that is always allocated for the
+            null-terminator.
+
+  @returns the buffer, which must be released with `_rxBufferFree`, or NULL
+           if there is insufficient memory.
+*/
+/**************************************************************************/
+uint8_t *_rxBufferAlloc(size_t *size)
+{
+    if (rxProvided != NULL) {
+        *size = rxProvidedSize;
+        return rxProvided;
+    }
+    if (!rxPoolRetain || rxPoolLent || *size > rxPoolRetain) {
+        return (uint8_t *)_Malloc(*size + 1);
+    }
+
+    // The pooled buffer is only ever allocated at its full size, so that it
+    // never has to move
+    if (rxPool == NULL) {
+        rxPool = (uint8_t *)_Malloc(rxPoolRetain + 1);
+        if (rxPool == NULL) {
+            return (uint8_t *)_Malloc(*size + 1);
+        }
+        rxPoolSize = rxPoolRetain;
+    }
+    rxPoolLent = true;
+    *size = rxPoolSize;
+    return rxPool;
+}
+
+/**************************************************************************/
+/*!
+  @brief  Enlarge a receive buffer that cannot hold the rest of a response.
+
+  The buffer at least doubles, so that a response is copied a bounded number
+  of times however many chunks it arrives in. The pooled buffer stays where
+  it is, and is returned to the pool once the response has been copied out of
+  it. The buffer provided by the caller cannot grow.
+
+  @param   buffer [in/out] The buffer.
+  @param   used The bytes of the buffer holding the response so far.
+  @param   size [in/out] The bytes available in the buffer.
+  @param   needed The bytes that the buffer must be able to hold.
+
+  @returns a c-string with an error, in which case `buffer` remains valid, or
+           `NULL` if no error occurred.
+*/
+/**************************************************************************/
+const char *_rxBufferGrow(uint8_t **buffer, size_t used, size_t *size, size_t needed)
+{
+    if (*buffer == rxProvided) {
+        return ERRSTR("transaction: response larger than buffer {overflow}", c_overflow);
+    }
+    size_t grownSize = (*size * 2);
+    if (grownSize < needed) {
+        grownSize = needed;
+    }
+    uint8_t *grown;
+    if (*buffer == rxPool) {
+        grown = (uint8_t *)_Malloc(grownSize + 1);
+        if (grown != NULL) {
+            memcpy(grown, *buffer, used);
+            rxPoolLent = false;
+        }
+    } else {
+        grown = (uint8_t *)_noteRealloc(*buffer, grownSize + 1, used);
+    }
+    if (grown == NULL) {
+        return ERRSTR("transaction: jsonbuf grow malloc failed", c_mem);
+    }
+    *size = grownSize;
+    *buffer = grown;
+    return NULL;
+}
+
+/**************************************************************************/
+/*!
+  @brief  Release a receive buffer, returning it to the pool if it is the
+  pooled buffer and the pool hasn't been resized since it was lent.
+  @param   buffer The buffer, or NULL.
+*/
+/**************************************************************************/
+void _rxBufferFree(void *buffer)
+{
+    if (buffer != NULL && buffer == rxProvided) {
+        return;
+    }
+    if (buffer != NULL && buffer == rxPool) {
+        rxPoolLent = false;
+        if (rxPoolSize == rxPoolRetain) {
+            return;
+        }
+        rxPool = NULL;
+        rxPoolSize = 0;
+    }
+    _Free(buffer);
+}
+
+/**************************************************************************/
+/*!
+  @brief  Take ownership of a receive buffer, which is then freed with
+  `_Free` (or `JFree`), for a response that is handed to the caller.
+
+  The response is copied out of the pooled buffer, so that the pooled buffer
+  stays where it is, unless there is insufficient memory for the copy, in
+  which case the pooled buffer itself is handed over.
+
+  @param   buffer The buffer, holding a null-terminated response, or NULL.
+  @returns the buffer, or the copy of the response.
+*/
+/**************************************************************************/
+void *_rxBufferDetach(void *buffer)
+{
+    if (buffer != NULL && buffer == rxPool) {
+        const size_t len = strlen((const char *)buffer);
+        char *copy = (char *)_Malloc(len + 1);
+        if (copy != NULL) {
+            memcpy(copy, buffer, len + 1);
+            _rxBufferFree(buffer);
+            return copy;
+        }
+        rxPool = NULL;
+        rxPoolSize = 0;
+        rxPoolLent = false;
+    }
+    return buffer;
+}
+
+/**************************************************************************/
+/*!
+  @brief  Receive responses into a buffer provided by the caller, rather than
+  one that is allocated, until the buffer is withdrawn.
+
+  @param   buffer The buffer, or NULL to withdraw it.
+  @param   size The bytes available in the buffer, which never include the
+            extra byte for the null-terminator.
+
+  @note  The caller is responsible for holding the Notecard lock.
+*/
+/**************************************************************************/
+void _rxBufferProvide(uint8_t *buffer, size_t size)
+{
+    rxProvided = buffer;
+    rxProvidedSize = ((buffer != NULL) ? size : 0);
+}
+
+void NoteSetReceiveBufferPool(size_t maxBytes)
+{
+    _LockNote();
+    rxPoolRetain = maxBytes;
+    if (rxPool != NULL && !rxPoolLent && rxPoolSize != maxBytes) {
+        _Free(rxPool);
+        rxPool = NULL;
+        rxPoolSize = 0;
+    }
+
+    // Allocate the pooled buffer now, ahead of the transactions that use it
+    if (maxBytes && rxPool == NULL) {
+        rxPool = (uint8_t *)_Malloc(maxBytes + 1);
+        rxPoolSize = ((rxPool != NULL) ? maxBytes : 0);
+    }
+    _UnlockNote();
+}
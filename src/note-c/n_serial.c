@@ -16,6 +16,15 @@
 
 #include "n_lib.h"
 
+// Forwards
+NOTE_C_STATIC const char *_serialReceiveResponse(char **response, size_t *responseLen);
+NOTE_C_STATIC const char *_serialStreamResponse(NoteJStream *stream);
+
+// Resync state. Fast resync is disabled by default, which preserves the full
+// drain window on every reset.
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL bool serialFastResync = false;
+NOTE_C_STATIC NOTE_C_THREAD_LOCAL uint32_t serialResyncMs = 0;
+
 /**************************************************************************/
 /*!
   @brief  Given a JSON string, perform a serial transaction with the Notecard.
@@ -26,13 +35,15 @@
   @param   response [out] A pointer to a c-string buffer that will contain the
             newline ('\n') terminated JSON response from the Notercard. If NULL,
             no response will be captured.
+  @param   responseLen [out] The length of the response, excluding its
+            null-terminator, if not NULL.
   @param   timeoutMs The maximum amount of time, in milliseconds, to wait
             for data to arrive. Passing zero (0) disables the timeout.
 
   @returns a c-string with an error, or `NULL` if no error occurred.
 */
 /**************************************************************************/
-const char *_serialNoteTransaction(const char *request, size_t reqLen, char **response, uint32_t timeoutMs)
+const char *_serialNoteTransaction(const char *request, size_t reqLen, char **response, size_t *responseLen, uint32_t timeoutMs)
 {
     const char *err = NULL;
 
@@ -45,6 +56,7 @@ const char *_serialNoteTransaction(const char *request, size_t reqLen, char **re
             reqLen--; // remove carriage return if it exists
         }
 
+        NOTE_C_METRICS_START(transmitMs);
         err = _serialChunkedTransmit((const uint8_t *)request, reqLen, true);
         if (err) {
             NOTE_C_LOG_ERROR(err);
@@ -56,6 +68,9 @@ const char *_serialNoteTransaction(const char *request, size_t reqLen, char **re
         // non-const hook. TODO: Remove when serialTransmitFn accepts const uint8_t *.
         uint8_t newline[] = {'\r', '\n'};
         _SerialTransmit(newline, c_newline_len, true);
+        cardRequestTransmitted = true;
+        NOTE_C_METRICS_COUNT(bytesOut, c_newline_len);
+        NOTE_C_METRICS_PHASE(NOTE_METRICS_PHASE_TRANSMIT, transmitMs);
     }
 
     // If no reply expected, we're done
@@ -66,23 +81,56 @@ const char *_serialNoteTransaction(const char *request, size_t reqLen, char **re
     // Wait for something to become available, processing timeout errors
     // up-front because the json parse operation immediately following is
     // subject to the serial port timeout. We'd like more flexibility in
-    // max timeout and ultimately in our error handling.
+    // max timeout and ultimately in our error handling. When a response
+    // notification hook is available, sleep in it rather than polling.
+    NOTE_C_METRICS_START(firstByteMs);
     for (const uint32_t startMs = _GetMs(); !_SerialAvailable(); ) {
         if (timeoutMs && (_GetMs() - startMs) >= timeoutMs) {
             NOTE_C_LOG_DEBUG(ERRSTR("reply to request didn't arrive from module in time", c_iotimeout));
             return ERRSTR("transaction timeout {io}", c_iotimeout);
         }
-        if (!cardTurboIO) {
-            _DelayMs(10);
+        if (!_ResponseWait(timeoutMs ? (timeoutMs - (_GetMs() - startMs)) : 0) && !cardTurboIO) {
+            _DelayMs(CARD_REQUEST_SERIAL_POLL_MS);
         }
     }
+    NOTE_C_METRICS_PHASE(NOTE_METRICS_PHASE_FIRST_BYTE, firstByteMs);
+
+    NOTE_C_METRICS_START(receiveMs);
+    err = _serialReceiveResponse(response, responseLen);
+    NOTE_C_METRICS_PHASE(NOTE_METRICS_PHASE_RECEIVE, receiveMs);
+    return err;
+}
+
+/**************************************************************************/
+/*!
+  @brief  Receive a complete JSON response from the Notecard over Serial.
+
+  @param   response [out] A pointer to a c-string buffer that will contain the
+            newline ('\n') terminated JSON response from the Notecard.
+  @param   responseLen [out] The length of the response, excluding its
+            null-terminator, if not NULL.
+
+  @returns a c-string with an error, or `NULL` if no error occurred.
+*/
+/**************************************************************************/
+NOTE_C_STATIC const char *_serialReceiveResponse(char **response, size_t *responseLen)
+{
+    const char *err = NULL;
+
+    // Feed a streamed response to its parser, rather than buffering it
+    if (cardResponseStream != NULL) {
+        *response = NULL;
+        return _serialStreamResponse(cardResponseStream);
+    }
 
-    // Allocate a buffer for input, noting that we always put the +1 in the
-    // alloc so we can be assured that it can be null-terminated. This must be
-    // the case because json parsing requires a null-terminated string.
+    // Get a buffer for input, noting that there is always room for a
+    // null-terminator. This must be the case because json parsing requires a
+    // null-terminated string. The size of the response isn't known in
+    // advance, so a pooled buffer is used as it is, and a new one is only
+    // large enough for a short response.
     uint32_t available = 0;
-    uint32_t jsonbufAllocLen = ALLOC_CHUNK;
-    uint8_t *jsonbuf = (uint8_t *)_Malloc(jsonbufAllocLen + 1);
+    size_t jsonbufSize = ALLOC_CHUNK;
+    uint8_t *jsonbuf = _rxBufferAlloc(&jsonbufSize);
     if (jsonbuf == NULL) {
         err = ERRSTR("transaction: jsonbuf malloc failed", c_mem);
         NOTE_C_LOG_ERROR(err);
@@ -90,16 +138,14 @@ const char *_serialNoteTransaction(const char *request, size_t reqLen, char **re
     }
 
     // Receive the Notecard response
-    uint32_t jsonbufLen = 0;
+    size_t jsonbufLen = 0;
     do {
-        uint32_t jsonbufAvailLen = (jsonbufAllocLen - jsonbufLen);
+        uint32_t jsonbufAvailLen = (uint32_t)(jsonbufSize - jsonbufLen);
 
         // Append into the json buffer
         err = _serialChunkedReceive((uint8_t *)(jsonbuf + jsonbufLen), &jsonbufAvailLen, true, (CARD_INTRA_TRANSACTION_TIMEOUT_SEC * 1000), &available);
         if (err) {
-            if (jsonbuf) {
-                _Free(jsonbuf);
-            }
+            _rxBufferFree(jsonbuf);
             NOTE_C_LOG_ERROR(ERRSTR(err, c_iobad));
             return err;
         }
@@ -107,28 +153,17 @@ const char *_serialNoteTransaction(const char *request, size_t reqLen, char **re
         jsonbuf[jsonbufLen] = '\0';
 
         if (available) {
-            // When more bytes are available than we have buffer to accommodate
-            // (i.e. overflow), then we allocate blocks of size `ALLOC_CHUNK` to
-            // reduce heap fragmentation.
-            // NOTE: We always put the +1 in the allocation so we can be assured
-            // that it can be null-terminated, because the json parser requires
-            // a null-terminated string.
-            jsonbufAllocLen += (ALLOC_CHUNK * ((available / ALLOC_CHUNK) + ((available % ALLOC_CHUNK) > 0)));
-            uint8_t *jsonbufNew = (uint8_t *)_Malloc(jsonbufAllocLen + 1);
-            if (jsonbufNew == NULL) {
-                err = ERRSTR("transaction: jsonbuf grow malloc failed", c_mem);
+            // When more bytes are available than we have buffer to
+            // accommodate (i.e. overflow), grow the buffer geometrically, so
+            // that a large response arriving in many chunks is only copied a
+            // few times.
+            err = _rxBufferGrow(&jsonbuf, jsonbufLen, &jsonbufSize, (jsonbufLen + available));
+            if (err) {
                 NOTE_C_LOG_ERROR(err);
-                if (jsonbuf) {
-                    _Free(jsonbuf);
-                }
+                _rxBufferFree(jsonbuf);
                 return err;
             }
-            if (jsonbuf) {
-                memcpy(jsonbufNew, jsonbuf, jsonbufLen);
-                _Free(jsonbuf);
-            }
-            jsonbuf = jsonbufNew;
-            NOTE_C_LOG_DEBUG("additional receive buffer chunk allocated");
+            NOTE_C_LOG_DEBUG("receive buffer grown");
         }
     } while (available);
 
@@ -139,9 +174,80 @@ const char *_serialNoteTransaction(const char *request, size_t reqLen, char **re
 
     // Return it
     *response = (char *)jsonbuf;
+    if (responseLen != NULL) {
+        *responseLen = jsonbufLen;
+    }
+    return NULL;
+}
+
+/**************************************************************************/
+/*!
+  @brief  Receive a complete JSON response from the Notecard over Serial,
+  feeding each chunk to a parser as it arrives.
+
+  @param   stream The parser to feed.
+
+  @returns a c-string with an error, or `NULL` if no error occurred.
+*/
+/**************************************************************************/
+NOTE_C_STATIC const char *_serialStreamResponse(NoteJStream *stream)
+{
+    uint32_t bufferLen = 0;
+    uint8_t *buffer = _jStreamBuffer(stream, &bufferLen);
+
+    uint32_t available = 0;
+    do {
+        uint32_t received = bufferLen;
+        const char *err = _serialChunkedReceive(buffer, &received, true, (CARD_INTRA_TRANSACTION_TIMEOUT_SEC * 1000), &available);
+        if (err) {
+            NOTE_C_LOG_ERROR(ERRSTR(err, c_iobad));
+            return err;
+        }
+        _jStreamFeed(stream, buffer, received);
+    } while (available);
+
+    return NULL;
+}
+
+/**************************************************************************/
+/*!
+  @brief  Query, without blocking, whether the Notecard has a response ready
+          to be received over Serial.
+
+  @param   available [out] Non-zero if data is waiting to be received.
+
+  @returns a c-string with an error, or `NULL` if no error occurred.
+*/
+/**************************************************************************/
+const char *_serialNoteResponseQuery(uint32_t *available)
+{
+    *available = _SerialAvailable();
     return NULL;
 }
 
+/**************************************************************************/
+/*!
+  @brief  Receive a response, already reported as available by
+          `_serialNoteResponseQuery`, from the Notecard over Serial.
+
+  @param   available Unused. Serial responses are delimited by a newline.
+  @param   response [out] A pointer to a c-string buffer that will contain the
+            newline ('\n') terminated JSON response from the Notecard.
+  @param   responseLen [out] The length of the response, excluding its
+            null-terminator, if not NULL.
+
+  @returns a c-string with an error, or `NULL` if no error occurred.
+*/
+/**************************************************************************/
+const char *_serialNoteResponseReceive(uint32_t available, char **response, size_t *responseLen)
+{
+    (void)available;
+    NOTE_C_METRICS_START(receiveMs);
+    const char *err = _serialReceiveResponse(response, responseLen);
+    NOTE_C_METRICS_PHASE(NOTE_METRICS_PHASE_RECEIVE, receiveMs);
+    return err;
+}
+
 //**************************************************************************/
 /*!
     @brief  Initialize or re-initialize the Serial bus, returning false if
@@ -153,9 +259,14 @@ const char *_serialNoteTransaction(const char *request, size_t reqLen, char **re
 bool _serialNoteReset(void)
 {
     NOTE_C_LOG_DEBUG("resetting Serial interface...");
+    NOTE_C_METRICS_COUNT(resets, 1);
 
-    // Reset the Serial subsystem and exit if failure
-    _DelayMs(CARD_REQUEST_SERIAL_SEGMENT_DELAY_MS);
+    // Reset the Serial subsystem and exit if failure. The fast resync relies
+    // on the drain below to flush anything still in flight instead.
+    const uint32_t resetStartMs = _GetMs();
+    if (!serialFastResync) {
+        _DelayMs(CARD_REQUEST_SERIAL_SEGMENT_DELAY_MS);
+    }
     if (!_SerialReset()) {
         NOTE_C_LOG_ERROR(ERRSTR("unable to reset Serial interface.", c_err));
         return false;
@@ -178,27 +289,39 @@ bool _serialNoteReset(void)
         // Drain all communications for 500ms
         bool somethingFound = false;
         bool nonControlCharFound = false;
+        bool echoFound = false;
+        uint32_t lastRxMs = 0;
 
         // Read Serial data for at least CARD_RESET_DRAIN_MS continously
         for (uint32_t startMs = _GetMs() ; (_GetMs() - startMs) < CARD_RESET_DRAIN_MS ;) {
             // Determine if Serial data is available
             while (_SerialAvailable()) {
                 somethingFound = true;
+                lastRxMs = _GetMs();
                 // The Notecard responds to a bare `\n` with `\r\n`. If we get
                 // any other characters back, it means the host and Notecard
                 // aren't synced up yet and we need to transmit `\n` again.
                 char ch = _SerialReceive();
-                if (ch != '\n' && ch != '\r') {
+                if (ch == '\n') {
+                    echoFound = true;
+                } else if (ch != '\r') {
                     nonControlCharFound = true;
                     // Reset the timer with each non-control character
                     startMs = _GetMs();
                 }
             }
+
+            // A complete, clean echo followed by silence means we're in sync
+            if (serialFastResync && echoFound && !nonControlCharFound
+                    && (_GetMs() - lastRxMs) >= CARD_RESET_FAST_QUIET_MS) {
+                break;
+            }
             _DelayMs(1);
         }
 
         // If all we got back is newlines, we're ready
         if (somethingFound && !nonControlCharFound) {
+            serialResyncMs = (_GetMs() - resetStartMs);
             notecardReady = true;
             break;
         }
@@ -218,6 +341,54 @@ bool _serialNoteReset(void)
     return notecardReady;
 }
 
+void NoteSetSerialFastResync(bool enable)
+{
+    _LockNote();
+    serialFastResync = enable;
+    _UnlockNote();
+}
+
+uint32_t NoteGetSerialResyncMs(void)
+{
+    _LockNote();
+    const uint32_t resyncMs = serialResyncMs;
+    _UnlockNote();
+    return resyncMs;
+}
+
+/*!
+ @internal
+
+ @brief Save the Serial resync state into a context.
+
+ @param ctx The context to save the state into.
+ */
+void _noteSerialContextSave(NoteContext *ctx)
+{
+    ctx->serialFastResync = serialFastResync;
+    ctx->serialResyncMs = serialResyncMs;
+}
+
+/*!
+ @internal
+
+ @brief Restore the Serial resync state from a context.
+
+ @param ctx The context to restore the state from, or NULL for the full drain
+        window of a Notecard that has not yet been reset.
+ */
+void _noteSerialContextRestore(const NoteContext *ctx)
+{
+    if (ctx == NULL) {
+        serialFastResync = false;
+        serialResyncMs = 0;
+        return;
+    }
+
+    serialFastResync = ctx->serialFastResync;
+    serialResyncMs = ctx->serialResyncMs;
+}
+
 /**************************************************************************/
 /*!
   @brief  Receive bytes over Serial from the Notecard.
@@ -259,14 +430,19 @@ const char *_serialChunkedReceive(uint8_t *buffer, uint32_t *size, bool delay, u
         timeoutMs = (CARD_INTRA_TRANSACTION_TIMEOUT_SEC * 1000);
         startMs = _GetMs();
 
-        // Receive the next character
-        char ch = _SerialReceive();
-
-        // Place into the buffer
-        buffer[received++] = ch;
+        // Receive everything that has arrived, up to the end-of-packet marker,
+        // falling back to the next character when bulk receive is unavailable
+        // or returns nothing, so that the loop always makes progress
+        size_t count = 0;
+        if (!_SerialReceiveBulk(&buffer[received], (*size - received), '\n', &count) || count == 0) {
+            buffer[received] = _SerialReceive();
+            count = 1;
+        }
+        received += count;
+        NOTE_C_METRICS_COUNT(bytesIn, count);
 
         // Look for end-of-packet marker
-        eop = (ch == '\n');
+        eop = (buffer[received - 1] == '\n');
 
         // Check overflow condition
         overflow = ((received >= *size) && !eop);
@@ -307,18 +483,33 @@ const char *_serialChunkedTransmit(const uint8_t *buffer, uint32_t size, bool de
 #endif
 
     // Transmit the request in segments so as not to overwhelm the Notecard's
-    // interrupt buffers
+    // interrupt buffers. When flow control is available, the request is sent
+    // in small chunks instead, each flushed onto the wire only once the
+    // Notecard is clear to receive it, rather than after a fixed delay.
+    bool flowControl = false;
     for (uint32_t segRem = size, segOff = 0; segRem > 0; ) {
         size_t segLen;
 
+        bool clear = false;
+        flowControl = _SerialClearToSend(&clear);
+        for (const uint32_t startMs = _GetMs(); flowControl && !clear; flowControl = _SerialClearToSend(&clear)) {
+            if ((_GetMs() - startMs) >= CARD_REQUEST_SERIAL_FLOW_TIMEOUT_MS) {
+                NOTE_C_LOG_ERROR(ERRSTR("Notecard not clear to send", c_iotimeout));
+                return ERRSTR("timeout: flow control {io}", c_iotimeout);
+            }
+            _DelayMs(1);
+        }
+
         // Set the segment length to the max or the remainder, whichever is less
-        if (segRem > CARD_REQUEST_SERIAL_SEGMENT_MAX_LEN) {
-            segLen = CARD_REQUEST_SERIAL_SEGMENT_MAX_LEN;
+        const uint32_t segMax = (flowControl ? CARD_REQUEST_SERIAL_FLOW_CHUNK_LEN : CARD_REQUEST_SERIAL_SEGMENT_MAX_LEN);
+        if (segRem > segMax) {
+            segLen = segMax;
         } else {
             segLen = (size_t)segRem;
         }
 
-        _SerialTransmit(&buffer[segOff], segLen, false);
+        _SerialTransmit(&buffer[segOff], segLen, flowControl);
+        NOTE_C_METRICS_COUNT(bytesOut, segLen);
         segOff += segLen;
 
         // Check here to avoid an unnecessary delay at the end of the last segment
@@ -326,7 +517,7 @@ const char *_serialChunkedTransmit(const uint8_t *buffer, uint32_t size, bool de
         if (segRem == 0) {
             break;
         }
-        if (delay) {
+        if (delay && !flowControl) {
             _DelayMs(CARD_REQUEST_SERIAL_SEGMENT_DELAY_MS);
         }
     }
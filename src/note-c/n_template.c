@@ -0,0 +1,348 @@
+// Copyright 2026 Blues Inc.  All rights reserved.
+// Use of this source code is governed by licenses granted by the
+// copyright holder including that found in the LICENSE file.
+
+// Request templates, which compile a request once and then send it repeatedly
+// with new values filled into its slots, without building or printing a `J`
+// object for every request.
+
+#include "n_lib.h"
+
+#include <string.h>
+
+// Marks the place of a slot in the printed request, followed by two digits
+// holding the number of the slot. Printed strings never hold a raw control
+// character, so the mark cannot otherwise appear.
+#define TEMPLATE_MARK           '\x01'
+#define TEMPLATE_MARK_LEN       3
+
+// The longest printed boolean
+#define TEMPLATE_BOOL_MAX       5
+
+#ifdef NOTE_C_LOW_MEM
+#define TEMPLATE_RESERVE        0
+#else
+#define TEMPLATE_RESERVE        CRC_FIELD_LENGTH
+#endif
+
+// A slot of a request template
+typedef struct {
+    char *value;        // The printed value, null-terminated
+    size_t at;          // Offset in the request text at which the value goes
+    size_t length;      // Length of the printed value
+    size_t capacity;    // Longest printed value the slot holds
+    int type;           // JNumber, JString, or JTrue for a boolean
+} NoteRequestTemplateSlot;
+
+struct NoteRequestTemplate {
+    char *text;                         // The request text, without its slots
+    char *json;                         // The rendered request, with room for a CRC
+    size_t jsonCap;
+    size_t textLen;
+    size_t count;
+    uint32_t id;
+    uint32_t timeoutMs;
+    bool cmd;
+    NoteRequestTemplateSlot *slots;     // Slots, in the order they are numbered
+    uint8_t *order;                     // Slot numbers, in the order they appear
+};
+
+/**************************************************************************/
+/*!
+  @brief  Find the item of a request at a path of fields.
+  @param   req The request.
+  @param   path The field name, or a path of names separated by '.'.
+  @param   parent (out) The object holding the item.
+  @returns The item, or NULL if it is missing.
+*/
+/**************************************************************************/
+NOTE_C_STATIC J *_templateFind(J *req, const char *path, J **parent)
+{
+    char name[64];
+    J *item = req;
+    for (;;) {
+        const char *dot = strchr(path, '.');
+        const size_t nameLen = (dot == NULL ? strlen(path) : (size_t)(dot - path));
+        if (!JIsObject(item) || nameLen >= sizeof(name)) {
+            return NULL;
+        }
+        memcpy(name, path, nameLen);
+        name[nameLen] = '\0';
+        *parent = item;
+        item = JGetObjectItem(item, name);
+        if (item == NULL || dot == NULL) {
+            return item;
+        }
+        path = dot + 1;
+    }
+}
+
+/**************************************************************************/
+/*!
+  @brief  Print a value into a slot of a request template.
+  @param   tpl The template.
+  @param   slot The number of the slot.
+  @param   item The value.
+  @returns `true` if the value fits the slot, `false` otherwise, in which case
+           the slot keeps its previous value.
+  @note    The value is printed into the rendering buffer of the template, which
+           is only in use while the template is being sent, and is copied into
+           the slot once it is known to fit.
+*/
+/**************************************************************************/
+NOTE_C_STATIC bool _templateFill(NoteRequestTemplate *tpl, size_t slot, const J *item)
+{
+    NoteRequestTemplateSlot *s = &tpl->slots[slot];
+    const size_t length = _jPrintValueText(item, tpl->json, tpl->jsonCap);
+    if (length == 0 || length > s->capacity) {
+        return false;
+    }
+    memcpy(s->value, tpl->json, length + 1);
+    s->length = length;
+    return true;
+}
+
+/**************************************************************************/
+/*!
+  @brief  Delete the placeholders of the slots of a template being compiled.
+  @param   placeholders The placeholders.
+  @param   count The number of placeholders.
+*/
+/**************************************************************************/
+NOTE_C_STATIC void _templateDeletePlaceholders(J **placeholders, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        JDelete(placeholders[i]);
+    }
+}
+
+NoteRequestTemplate *NoteNewRequestTemplate(J *req, const char * const *slots, size_t count)
+{
+    if (req == NULL) {
+        return NULL;
+    }
+    if ((count > 0 && slots == NULL) || count > NOTE_REQUEST_TEMPLATE_SLOTS_MAX) {
+        NOTE_C_LOG_ERROR(ERRSTR("template: too many slots", c_bad));
+        JDelete(req);
+        return NULL;
+    }
+
+    // Settle what the transaction needs to know of the request
+    const bool reqFound = (JGetString(req, "req")[0] != '\0');
+    const bool cmdFound = (JGetString(req, "cmd")[0] != '\0');
+    if (reqFound == cmdFound) {
+        NOTE_C_LOG_ERROR(ERRSTR("template: request needs either req or cmd", c_bad));
+        JDelete(req);
+        return NULL;
+    }
+    const uint32_t id = JGetInt(req, "id");
+    const uint32_t timeoutMs = _noteTransaction_calculateTimeoutMs(req, reqFound);
+
+    // Replace the placeholder of each slot with a mark, noting its type and
+    // how long a printed value it holds
+    int types[NOTE_REQUEST_TEMPLATE_SLOTS_MAX];
+    size_t capacities[NOTE_REQUEST_TEMPLATE_SLOTS_MAX];
+    J *placeholders[NOTE_REQUEST_TEMPLATE_SLOTS_MAX];
+    size_t valuesLen = 0;
+    for (size_t i = 0; i < count; i++) {
+        J *parent = NULL;
+        J *item = _templateFind(req, slots[i], &parent);
+        const int type = (item == NULL ? JInvalid : (item->type & 0xFF));
+        if (type == JNumber) {
+            capacities[i] = JNTOA_MAX;
+        } else if (type == JTrue || type == JFalse) {
+            capacities[i] = TEMPLATE_BOOL_MAX;
+        } else if (type == JString) {
+            // Quotes, plus the placeholder with its characters escaped
+            capacities[i] = strlen(item->valuestring) + 2;
+            for (const char *c = item->valuestring; *c != '\0'; c++) {
+                if (*c == '"' || *c == '\\' || *c == '\b' || *c == '\f' || *c == '\n' || *c == '\r' || *c == '\t') {
+                    capacities[i] += 1;
+                } else if ((unsigned char)*c < 32) {
+                    capacities[i] += 5;
+                }
+            }
+        } else {
+            NOTE_C_LOG_ERROR(ERRSTR("template: slot missing or not a number, string or boolean", c_bad));
+            _templateDeletePlaceholders(placeholders, i);
+            JDelete(req);
+            return NULL;
+        }
+        types[i] = ((type == JFalse) ? JTrue : type);
+        valuesLen += (capacities[i] + 1);
+
+        char mark[TEMPLATE_MARK_LEN + 1] = { TEMPLATE_MARK, (char)('0' + (i / 10)), (char)('0' + (i % 10)), '\0' };
+        J *raw = JCreateRaw(mark);
+        placeholders[i] = JDuplicate(item, false);
+        if (raw == NULL || placeholders[i] == NULL) {
+            JDelete(raw);
+            _templateDeletePlaceholders(placeholders, i + 1);
+            NOTE_C_LOG_ERROR(ERRSTR("template: insufficient memory", c_mem));
+            JDelete(req);
+            return NULL;
+        }
+        // The mark takes over the name of the item it replaces
+        raw->string = item->string;
+        raw->type |= (item->type & JStringIsConst);
+        item->string = NULL;
+        JReplaceItemViaPointer(parent, item, raw);
+    }
+
+    char *printed = JPrintUnformatted(req);
+    JDelete(req);
+    if (printed == NULL) {
+        NOTE_C_LOG_ERROR(ERRSTR("template: insufficient memory", c_mem));
+        _templateDeletePlaceholders(placeholders, count);
+        return NULL;
+    }
+    const size_t printedLen = strlen(printed);
+    const size_t textLen = printedLen - (count * TEMPLATE_MARK_LEN);
+
+    // Allocate the template, its slots, its text and its rendering together
+    size_t jsonCap = textLen + TEMPLATE_RESERVE + 1;
+    for (size_t i = 0; i < count; i++) {
+        jsonCap += capacities[i];
+    }
+    const size_t size = sizeof(NoteRequestTemplate) + (count * sizeof(NoteRequestTemplateSlot)) + count + (textLen + 1) + jsonCap + valuesLen;
+    NoteRequestTemplate *tpl = (NoteRequestTemplate *)_Malloc(size);
+    if (tpl == NULL) {
+        NOTE_C_LOG_ERROR(ERRSTR("template: insufficient memory", c_mem));
+        JFree(printed);
+        _templateDeletePlaceholders(placeholders, count);
+        return NULL;
+    }
+    memset(tpl, 0, size);
+    tpl->slots = (NoteRequestTemplateSlot *)(tpl + 1);
+    tpl->order = (uint8_t *)(tpl->slots + count);
+    tpl->text = (char *)(tpl->order + count);
+    tpl->json = tpl->text + textLen + 1;
+    char *values = tpl->json + jsonCap;
+    tpl->jsonCap = jsonCap;
+    tpl->textLen = textLen;
+    tpl->count = count;
+    tpl->id = id;
+    tpl->timeoutMs = timeoutMs;
+    tpl->cmd = cmdFound;
+
+    // Split the printed request at its marks
+    size_t out = 0;
+    size_t seen = 0;
+    for (size_t in = 0; in < printedLen; in++) {
+        if (printed[in] == TEMPLATE_MARK) {
+            const size_t i = (size_t)(((printed[in+1] - '0') * 10) + (printed[in+2] - '0'));
+            tpl->slots[i].at = out;
+            tpl->order[seen++] = (uint8_t)i;
+            in += (TEMPLATE_MARK_LEN - 1);
+        } else {
+            tpl->text[out++] = printed[in];
+        }
+    }
+    tpl->text[out] = '\0';
+    JFree(printed);
+
+    // Fill each slot with its placeholder
+    bool filled = (seen == count);
+    for (size_t i = 0; i < count; i++) {
+        NoteRequestTemplateSlot *slot = &tpl->slots[i];
+        slot->value = values;
+        slot->capacity = capacities[i];
+        slot->type = types[i];
+        values += (capacities[i] + 1);
+        filled = (filled && _templateFill(tpl, i, placeholders[i]));
+    }
+    _templateDeletePlaceholders(placeholders, count);
+    if (!filled) {
+        NOTE_C_LOG_ERROR(ERRSTR("template: slot could not be filled", c_bad));
+        _Free(tpl);
+        return NULL;
+    }
+
+    return tpl;
+}
+
+void NoteDeleteRequestTemplate(NoteRequestTemplate *tpl)
+{
+    _Free(tpl);
+}
+
+bool NoteRequestTemplateSetNumber(NoteRequestTemplate *tpl, size_t slot, JNUMBER value)
+{
+    if (tpl == NULL || slot >= tpl->count || tpl->slots[slot].type != JNumber) {
+        return false;
+    }
+    J item;
+    memset(&item, 0, sizeof(item));
+    item.type = JNumber;
+    JSetNumberHelper(&item, value);
+    return _templateFill(tpl, slot, &item);
+}
+
+bool NoteRequestTemplateSetInt(NoteRequestTemplate *tpl, size_t slot, JINTEGER value)
+{
+    if (tpl == NULL || slot >= tpl->count || tpl->slots[slot].type != JNumber) {
+        return false;
+    }
+    J item;
+    memset(&item, 0, sizeof(item));
+    item.type = JNumber;
+    item.valuenumber = (JNUMBER)value;
+    item.valueint = value;
+    return _templateFill(tpl, slot, &item);
+}
+
+bool NoteRequestTemplateSetString(NoteRequestTemplate *tpl, size_t slot, const char *value)
+{
+    if (tpl == NULL || slot >= tpl->count || tpl->slots[slot].type != JString) {
+        return false;
+    }
+    J item;
+    memset(&item, 0, sizeof(item));
+    item.type = JString;
+    item.valuestring = (char *)value;
+    return _templateFill(tpl, slot, &item);
+}
+
+bool NoteRequestTemplateSetBool(NoteRequestTemplate *tpl, size_t slot, bool value)
+{
+    if (tpl == NULL || slot >= tpl->count || tpl->slots[slot].type != JTrue) {
+        return false;
+    }
+    J item;
+    memset(&item, 0, sizeof(item));
+    item.type = (value ? JTrue : JFalse);
+    return _templateFill(tpl, slot, &item);
+}
+
+bool NoteRequestTemplateSend(NoteRequestTemplate *tpl)
+{
+    if (tpl == NULL) {
+        return false;
+    }
+
+    // Render the request, placing the value of each slot within its text
+    NOTE_C_METRICS_START(serializeMs);
+    size_t out = 0;
+    size_t from = 0;
+    for (size_t k = 0; k < tpl->count; k++) {
+        const NoteRequestTemplateSlot *slot = &tpl->slots[tpl->order[k]];
+        memcpy(&tpl->json[out], &tpl->text[from], (slot->at - from));
+        out += (slot->at - from);
+        from = slot->at;
+        memcpy(&tpl->json[out], slot->value, slot->length);
+        out += slot->length;
+    }
+    memcpy(&tpl->json[out], &tpl->text[from], (tpl->textLen - from));
+    out += (tpl->textLen - from);
+    tpl->json[out] = '\0';
+    NOTE_C_METRICS_PHASE(NOTE_METRICS_PHASE_SERIALIZE, serializeMs);
+
+    size_t rspLen = 0;
+    char *rsp = _noteTransactionText(tpl->json, out, tpl->id, tpl->timeoutMs, tpl->cmd, &rspLen);
+    if (rsp == NULL) {
+        return false;
+    }
+    JField err = { c_err, NULL, 0, JInvalid };
+    const bool success = (JScanWithLength(rsp, rspLen, &err, 1) >= 0 && JFieldIsNullString(&err));
+    JFree(rsp);
+    return success;
+}
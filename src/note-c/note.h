@@ -229,6 +229,17 @@ typedef void * (*mallocFn) (size_t size);
  */
 typedef void (*mutexFn) (void);
 
+/*!
+ @typedef noteRequestCompleteFn
+
+ @brief The type for the completion callback of a queued request.
+
+ @param rsp The response to the request, which the callback must free with
+        `JDelete`, or NULL if there was insufficient memory.
+ @param context The context passed along with the request.
+ */
+typedef void (*noteRequestCompleteFn) (J *rsp, void *context);
+
 /*!
  @typedef serialAvailableFn
 
@@ -247,6 +258,37 @@ typedef bool (*serialAvailableFn) (void);
  */
 typedef char (*serialReceiveFn) (void);
 
+/*!
+ @typedef serialReceiveBulkFn
+
+ @brief The type for the optional serial bulk receive hook.
+
+ This hook copies every byte that has already arrived into the buffer, without
+ waiting for more, and stops early once the end-of-packet character has been
+ copied so that no data belonging to a later packet is consumed.
+
+ @param rxBuf A buffer to receive bytes into.
+ @param rxBufSize The size, in bytes, of `rxBuf`.
+ @param eop The end-of-packet character.
+
+ @returns The number of bytes copied into `rxBuf`.
+ */
+typedef size_t (*serialReceiveBulkFn) (uint8_t *rxBuf, size_t rxBufSize, char eop);
+
+/*!
+ @typedef serialClearToSendFn
+
+ @brief The type for the optional serial flow control hook.
+
+ This hook reports whether the Notecard is ready to accept more data, such as
+ by sampling a CTS signal. It is consulted before each 16 byte chunk of a
+ request is transmitted, in place of the fixed delay between 250 byte
+ segments, and each chunk is flushed before the hook is consulted again.
+
+ @returns `true` if data may be sent, `false` otherwise.
+ */
+typedef bool (*serialClearToSendFn) (void);
+
 /*!
  @typedef serialResetFn
 
@@ -288,6 +330,57 @@ typedef bool (*txnStartFn) (uint32_t timeoutMs);
  */
 typedef void (*txnStopFn) (void);
 
+/*!
+ @typedef responseWaitFn
+
+ @brief The type for the response notification hook.
+
+ This hook is used in place of a fixed polling delay while note-c waits for
+ the Notecard to produce a response. It should block (or sleep) until the
+ platform observes a response-ready signal, such as the ATTN pin being
+ asserted or a UART RX interrupt, or until the timeout elapses. A spurious or
+ early return is harmless, because note-c always confirms that data is
+ available before reading it.
+
+ @param timeoutMs The maximum amount of time, in milliseconds, to wait.
+
+ @returns `true` if the signal was observed, `false` on timeout.
+ */
+typedef bool (*responseWaitFn) (uint32_t timeoutMs);
+/*!
+ @typedef crc32Fn
+
+ @brief The type for a platform's CRC32 function, such as one driving an MCU's
+        CRC peripheral.
+
+ The function must compute the standard (IEEE 802.3) CRC-32, as produced by
+ zlib's `crc32`: reflected polynomial 0xEDB88320, an initial value of
+ 0xFFFFFFFF and a final XOR of 0xFFFFFFFF. It must accept any buffer
+ alignment and length.
+
+ @param data The buffer.
+ @param length The length of the buffer, in bytes.
+
+ @returns The CRC32 of the buffer.
+ */
+typedef uint32_t (*crc32Fn) (const void *data, size_t length);
+/*!
+ @typedef reallocFn
+
+ @brief The type for a platform's memory reallocation function, such as the
+        standard `realloc`.
+
+ The function must operate on the same heap as the `mallocFn` hook. It may
+ resize the block in place, or move it and free the original.
+
+ @param ptr The block to resize, or NULL.
+ @param size The new size of the block, in bytes.
+
+ @returns The resized block, or NULL on failure, in which case the original
+          block must be left untouched.
+ */
+typedef void * (*reallocFn) (void *ptr, size_t size);
+
 // External API
 
 /*!
@@ -359,7 +452,9 @@ J *NoteRequestResponse(J *req);
           the request.
 
  @note Timeouts may occur when either there is no response, or if the response
-       contains an I/O error.
+       contains an I/O error. The time limit spans the retries of each
+       attempt (see `NoteSetRetryPolicy`) as well, so no attempt is begun,
+       and no backoff is waited out, past it.
 
  @see NoteResponseError to check the response for errors.
  */
@@ -389,6 +484,34 @@ J *NoteRequestResponseWithRetry(J *req, uint32_t timeoutSeconds);
        the memory associated with the request string.
  */
 char * NoteRequestResponseJSON(const char *reqJSON);
+// The bytes that must follow a request in its buffer, for the CRC and newline
+// that `NoteRequestResponseJSONBuffer` appends
+#define NOTE_JSON_REQUEST_RESERVE 23
+/*!
+ @brief Send a request, as JSON text, to the Notecard and receive the response
+        as JSON text, using only the buffers provided by the caller.
+
+ No memory is allocated, on either the I2C or the Serial interface. The
+ request is sent with a CRC, and retried like any other, and the response is
+ received directly into the response buffer.
+
+ @param request The JSON request. A CRC and a newline are appended to it in
+        place while it is sent, and it is restored, null-terminated, before
+        this function returns.
+ @param requestLen The length of the request.
+ @param requestSize The size of the request buffer, which must be at least
+        `requestLen + NOTE_JSON_REQUEST_RESERVE`.
+ @param response The buffer into which the response is received.
+ @param responseSize The size of the response buffer.
+ @param responseLen [out] The length of the null-terminated response, without
+        its CRC or newline, if not NULL.
+
+ @returns NULL if a response was received, even one with an "err" field (or, for
+          a "cmd", if the command was sent), or an error string. The error
+          contains "{overflow}" if the request buffer has no room for the CRC
+          or the response doesn't fit in the response buffer.
+ */
+const char *NoteRequestResponseJSONBuffer(char *request, size_t requestLen, size_t requestSize, char *response, size_t responseSize, size_t *responseLen);
 NOTE_C_DEPRECATED void NoteSuspendTransactionDebug(void);
 NOTE_C_DEPRECATED void NoteResumeTransactionDebug(void);
 #define SYNCSTATUS_LEVEL_MAJOR         0
@@ -482,6 +605,598 @@ uint32_t NoteSetRequestTimeout(uint32_t overrideSecs);
  @see NoteResponseError to check the response for errors.
  */
 J *NoteTransaction(J *req);
+/*!
+ @brief Send a list of requests to the Notecard and return their responses.
+
+ The requests are sent in order under a single hold of the Notecard lock and a
+ single CTX/RTX window, so a burst of requests costs one wake handshake. This
+ function doesn't free the passed in array. The caller is responsible for
+ freeing it.
+
+ @param reqs Pointer to a `J` array of request objects.
+
+ @returns A `J` array with one response per request, in the same order, or
+          NULL if `reqs` is not an array or there is insufficient memory.
+
+ @see NoteTransaction for the handling of each individual request.
+ */
+J *NoteTransactionBatch(J *reqs);
+/*!
+ @brief Send a list of requests to the Notecard, stopping at the first that
+        fails, and return their responses.
+
+ This behaves as `NoteTransactionBatch`, except that the requests that follow
+ a failed request are not sent. A caller that acts on each request once it has
+ succeeded, such as one that releases the records sent as Notes, can then
+ resend every request from the first that failed without duplicating any.
+
+ @param reqs Pointer to a `J` array of request objects.
+
+ @returns A `J` array with one response per request sent, in the same order,
+          ending with the response of the request that failed, if any, or NULL
+          if `reqs` is not an array or there is insufficient memory.
+
+ @see NoteTransactionBatch
+ */
+J *NoteTransactionBatchUntilError(J *reqs);
+/*!
+ @brief How a request that fails with an I/O error is retried.
+
+ After each failed attempt, the request backs off for `baseDelayMs`, growing
+ by `backoffFactor` after every retry up to `maxDelayMs`, less a random share
+ of up to `jitterPercent` of the backoff, so that devices that fail together
+ do not all retry together. The request gives up once `attempts` have been
+ made, or as soon as its `deadlineMs` would be overrun, without waiting for a
+ backoff that leaves no time for another attempt.
+ */
+typedef struct {
+    uint32_t baseDelayMs;   ///< Backoff before the first retry.
+    uint32_t maxDelayMs;    ///< Longest backoff between two attempts.
+    uint32_t deadlineMs;    ///< Time allowed over all attempts, or 0 for no limit.
+    uint8_t attempts;       ///< Attempts allowed, including the first.
+    uint8_t backoffFactor;  ///< Growth of the backoff after each retry (1 for constant).
+    uint8_t jitterPercent;  ///< Largest share of each backoff randomly cut from it.
+} NoteRetryPolicy;
+
+/*!
+ The default retry policy: six attempts, 500ms apart, with no deadline.
+ */
+#define NOTE_RETRY_POLICY_DEFAULT { 500, 500, 0, 6, 1, 0 }
+
+/*!
+ @brief Set the retry policy of every request that isn't sent with a policy
+        of its own.
+
+ @param policy Pointer to the policy, which is copied, or NULL to restore
+        `NOTE_RETRY_POLICY_DEFAULT`.
+ */
+void NoteSetRetryPolicy(const NoteRetryPolicy *policy);
+/*!
+ @brief Send a request to the Notecard, retrying it as the given policy
+        allows, and return the response.
+
+ This allows a time-critical request to fail fast, with a short deadline and
+ few attempts, and a bulk upload to retry patiently, with a long exponential
+ backoff, regardless of the policy set with `NoteSetRetryPolicy`.
+
+ The passed in request object is always freed, regardless of if the request was
+ successful or not.
+
+ @param req Pointer to a `J` request object.
+ @param policy Pointer to the retry policy, or NULL for the policy set with
+        `NoteSetRetryPolicy`.
+
+ @returns A `J` object with the response or NULL if there was an error sending
+          the request.
+ */
+J *NoteRequestResponseWithPolicy(J *req, const NoteRetryPolicy *policy);
+/*!
+ @brief Send a request to the Notecard, retrying it as the given policy
+        allows.
+
+ @param req Pointer to a `J` request object, which is always freed.
+ @param policy Pointer to the retry policy, or NULL for the policy set with
+        `NoteSetRetryPolicy`.
+
+ @returns `true` if successful and `false` if an error occurs (e.g. out of
+          memory or the response from the Notecard has an "err" field).
+
+ @see NoteRequestResponseWithPolicy if you need to work with the response.
+ */
+bool NoteRequestWithPolicy(J *req, const NoteRetryPolicy *policy);
+/*!
+ @brief The state of a non-blocking Notecard transaction.
+
+ The contents of this structure are private to note-c. It may be allocated
+ anywhere (e.g. on the stack or as a global), and is initialized by
+ `NoteTransactionAsyncBegin`.
+ */
+typedef struct {
+    char *json;            ///< Serialized request.
+    size_t jsonLen;        ///< Length of the serialized request.
+    char *rspJsonStr;      ///< Raw response text.
+    size_t rspJsonLen;     ///< Length of the raw response text.
+    J *rsp;                ///< Parsed response.
+    const char *errStr;    ///< Most recent error.
+    uint32_t id;           ///< The "id" of the request.
+    uint32_t timeoutMs;    ///< Time allowed for each response.
+    uint32_t stepMs;       ///< Time at which the current wait began.
+    uint32_t queryMs;      ///< Time of the most recent response query.
+    uint32_t available;    ///< Bytes of the response waiting to be received.
+    uint16_t seqNo;        ///< Sequence number reserved for the request.
+    const NoteRetryPolicy *policy; ///< How the request is retried.
+    uint32_t startMs;      ///< Time from which the deadline runs.
+    uint32_t deadlineMs;   ///< Time allowed over all attempts, or 0 for no limit.
+    uint32_t backoffMs;    ///< Backoff before the next attempt.
+    uint8_t retries;       ///< Retries consumed so far.
+    uint8_t state;         ///< Current step of the transaction.
+    bool cmd;              ///< No response is expected.
+    bool crc;              ///< A CRC was added to the request.
+    bool heartbeat;        ///< Awaiting the response that follows a heartbeat.
+    bool lock;             ///< The Notecard lock is held by the transaction.
+    bool window;           ///< The CTX/RTX window was opened by the transaction.
+    bool blocking;         ///< Each exchange runs to completion in one step.
+    bool yielded;          ///< The Notecard lock is released for the backoff.
+    bool delivered;        ///< The latest attempt was transmitted in full.
+    bool text;             ///< The response is kept as text rather than parsed.
+    bool borrowed;         ///< The serialized request belongs to the caller.
+    bool raw;              ///< No J objects are made; errors stay in errStr.
+    struct NoteJStream *stream; ///< Parses the response as it arrives.
+    struct JField *fields; ///< Located in a response kept as text, "err" first.
+    size_t fieldCount;     ///< The number of fields.
+    char *rxBuffer;        ///< Caller's buffer for the response, or NULL.
+    size_t rxBufferSize;   ///< Bytes of the caller's buffer, less the terminator.
+} NoteTransactionAsync;
+/*!
+ @brief Begin a non-blocking transaction with the Notecard.
+
+ The request is serialized immediately, so this function doesn't free the
+ passed in request object and the caller may free it as soon as this function
+ returns. The transaction must then be driven to completion with
+ `NoteTransactionAsyncPoll` and finished with `NoteTransactionAsyncEnd`.
+
+ @param txn Pointer to the transaction state.
+ @param req Pointer to a `J` request object.
+
+ @note The Notecard lock is held from this call until the transaction is
+       finished, so no other request may be issued from the same thread in the
+       meantime. Waiting for CTX/RTX and any required interface reset, which
+       happen here, and a reset following an I/O error remain blocking.
+ */
+void NoteTransactionAsyncBegin(NoteTransactionAsync *txn, J *req);
+/*!
+ @brief Advance a non-blocking transaction by a single step.
+
+ Each call performs at most one step of the transaction (transmit, query for
+ a response, receive, or check and parse the response). The usual retry, CRC
+ and heartbeat handling apply.
+
+ Waiting for the Notecard to process the request, and the backoff between
+ retries, never block. A step that moves data does block for as long as the
+ transfer takes:
+ - Transmitting sends the whole request, including the usual delays between
+   chunks and segments (250ms per 250 bytes over Serial without flow control,
+   and the paced chunk and segment delays over I2C), and a reset of the
+   interface after an I/O error.
+ - Receiving reads the whole response once it is available. Over Serial, this
+   waits for each byte as it arrives, for up to a second between bytes.
+
+ Small requests and responses therefore cost a few milliseconds per call, but
+ large ones block for the duration of their transfer.
+
+ @param txn Pointer to the transaction state.
+
+ @returns `true` once the transaction is complete, `false` if it should be
+          polled again.
+ */
+bool NoteTransactionAsyncPoll(NoteTransactionAsync *txn);
+/*!
+ @brief Finish a non-blocking transaction and collect its response.
+
+ Calling this function before `NoteTransactionAsyncPoll` has returned `true`
+ abandons the transaction and queues a reset of the Notecard interface.
+
+ @param txn Pointer to the transaction state.
+
+ @returns A `J` object with the response, exactly as `NoteTransaction` would
+          have returned it.
+ */
+J *NoteTransactionAsyncEnd(NoteTransactionAsync *txn);
+
+// Retry lock policies for NoteSetRetryLockPolicy
+#define NOTE_RETRY_LOCK_HOLD  0   ///< Hold the Notecard lock through every retry.
+#define NOTE_RETRY_LOCK_YIELD 1   ///< Release the Notecard lock for each backoff after an undelivered attempt.
+
+/*!
+ @brief Set whether the Notecard lock is held while a request backs off
+        before being retried.
+
+ A request that fails with an I/O error is retried as its retry policy (see
+ `NoteSetRetryPolicy`) allows, by default up to five times after a 500ms
+ backoff. By default (`NOTE_RETRY_LOCK_HOLD`), the Notecard lock (see
+ `NoteSetFnNoteMutex`) is held throughout, so every other task waiting on the
+ lock is blocked for the entire series of retries. With
+ `NOTE_RETRY_LOCK_YIELD`, the lock is released for the backoff after an
+ attempt that never reached the Notecard, such as one whose transmission
+ failed, so the tasks waiting on the lock, in the order chosen by the mutex
+ implementation (e.g. by priority), may transact with the Notecard before the
+ retry. The Notecard only recognizes a retry as a duplicate of the
+ immediately preceding request, so after an attempt that did reach it (an
+ I/O error reported by the Notecard, a CRC error or a lost response), the
+ lock is held until the retry, which is then not processed twice.
+
+ Each request reserves its sequence number before its first attempt and
+ carries it, and the matching CRC, on every retry, so interleaved requests
+ never share a sequence number and each response is checked against the
+ request that produced it.
+
+ @param policy `NOTE_RETRY_LOCK_HOLD` or `NOTE_RETRY_LOCK_YIELD`.
+
+ @note Requests sent with `NoteTransactionBatch` hold the lock for the whole
+       batch regardless of this policy.
+ */
+void NoteSetRetryLockPolicy(uint8_t policy);
+
+/*!
+ @brief Set whether responses are parsed as they are received.
+
+ By default, each response is received in full into a buffer, whose CRC is
+ then checked before it is parsed. When streaming is enabled, each chunk
+ received over I2C or Serial is parsed, and added to the CRC, as soon as it
+ arrives, so the parse completes with the last byte of the response and the
+ response text is never held in memory as a whole. This is of most benefit
+ to large responses, such as those of `note.changes`.
+
+ @param enable `true` to parse responses as they are received, `false` (the
+        default) to buffer them first.
+
+ @note A streamed response is not written to the debug log, because its text
+       is never held, and the platform's CRC hook (see `NoteSetFnCRC32`) is
+       not used to check it.
+ */
+void NoteSetResponseStreaming(bool enable);
+
+/*!
+ @brief Keep the buffer into which responses are received between
+        transactions.
+
+ Each response is received into a buffer sized from the count of bytes the
+ Notecard first reports as available, which at least doubles whenever it must
+ grow. By default, it is freed once the response has been parsed. When
+ pooled, a buffer of `maxBytes` is allocated once, by this function, and is
+ reused in place by every transaction, so that most responses are received
+ without any allocation. A response larger than the pool is received into a
+ buffer of its own, which is freed once the response has been parsed.
+
+ @param maxBytes The size of the pooled buffer, in bytes, or 0 (the default)
+        to free the buffer after every transaction.
+
+ @note When note-c is built with `NOTE_C_THREAD_CONTEXT` defined, each thread
+       has its own pool, which it should free with a `maxBytes` of 0 before
+       it exits.
+ */
+void NoteSetReceiveBufferPool(size_t maxBytes);
+
+/*!
+ @brief The statistics of the response cache.
+ */
+typedef struct {
+    uint32_t hits;           ///< Requests answered from the cache.
+    uint32_t misses;         ///< Cacheable requests sent to the Notecard.
+    uint32_t evictions;      ///< Responses dropped to make room for another.
+    uint32_t invalidations;  ///< Responses dropped by a write, or on request.
+    uint32_t entries;        ///< Responses currently cached.
+    uint32_t bytes;          ///< Bytes currently held by the cached responses.
+} NoteResponseCacheStats;
+
+/*!
+ @brief Enable, resize or disable the response cache.
+
+ While enabled, `NoteRequestResponse` (and so `NoteRequest`) answers a request
+ that only reads from the Notecard, such as `card.version` or `hub.get`, with
+ the response to an identical earlier request, for as long as the time to
+ live of its API (see `NoteSetResponseCacheTTL`) allows. Requests are
+ identical when they have the same fields with the same values, in any
+ order. Requests that carry an "id" are never cached.
+
+ A request that may change what a cached API reports drops its cached
+ responses before it is sent: `hub.set` those of `hub.get`, `env.set` and
+ `env.default` those of `env.get` (and likewise for any `.set` or `.default`
+ of a cached `.get`), a request with arguments to a cached API other than a
+ `.get` (e.g. `card.wireless` with a `mode`) those of the API, and
+ `card.restart` and `card.restore` every response. This applies equally to
+ requests sent as JSON text, into a buffer, or from a request template.
+
+ @param entries The most responses held at once, or 0 to disable the cache.
+ @param maxBytes The most bytes held by the cached requests and responses.
+        The least recently used responses are evicted to make room.
+
+ @returns `true` on success, `false` if the cache could not be allocated, in
+          which case it is left as it was.
+
+ @note Enabling, resizing or disabling the cache drops every response and
+       resets its statistics.
+ */
+bool NoteSetResponseCache(uint8_t entries, size_t maxBytes);
+/*!
+ @brief Set how long the responses of an API are cached.
+
+ By default, `card.version` is cached for an hour, `hub.get` for a minute,
+ `env.get` for 30 seconds and `card.wireless` for 10 seconds. Up to eight
+ APIs may be cached.
+
+ @param api The name of the API, e.g. `"card.temp"`.
+ @param ttlSecs The time to live of each response, in seconds, or 0 to stop
+        caching the API.
+
+ @returns `true` on success, `false` if the name is too long or too many APIs
+          are cached.
+ */
+bool NoteSetResponseCacheTTL(const char *api, uint32_t ttlSecs);
+/*!
+ @brief Drop the cached responses of an API, e.g. after changing the state of
+        the Notecard by means the cache cannot observe.
+
+ @param api The name of the API, or NULL to drop every response.
+ */
+void NoteResponseCacheInvalidate(const char *api);
+/*!
+ @brief Get the statistics of the response cache.
+
+ @param stats Pointer to the structure to fill in.
+ */
+void NoteGetResponseCacheStats(NoteResponseCacheStats *stats);
+
+#ifdef NOTE_C_METRICS
+#define NOTE_METRICS_PHASE_START      0   ///< Waiting for the Notecard to be ready (CTX/RTX).
+#define NOTE_METRICS_PHASE_SERIALIZE  1   ///< Printing the request.
+#define NOTE_METRICS_PHASE_TRANSMIT   2   ///< Transmitting the request.
+#define NOTE_METRICS_PHASE_FIRST_BYTE 3   ///< Waiting for the response to begin.
+#define NOTE_METRICS_PHASE_RECEIVE    4   ///< Receiving the response.
+#define NOTE_METRICS_PHASE_CRC        5   ///< Checking the CRC of the response.
+#define NOTE_METRICS_PHASE_PARSE      6   ///< Parsing the response, as far as it was not parsed while received.
+#define NOTE_METRICS_PHASES           7
+
+/*!
+ The number of buckets of each histogram. Bucket 0 counts the phases that took
+ less than a millisecond, bucket `n` those that took from `2^(n-1)` to
+ `2^n - 1` milliseconds, and the last bucket every phase that took longer.
+ */
+#define NOTE_METRICS_BUCKETS          16
+
+/*!
+ @brief The durations of one phase of the transactions with the Notecard.
+ */
+typedef struct {
+    uint32_t count;                             ///< Times the phase was timed.
+    uint32_t totalMs;                           ///< Total time spent in the phase.
+    uint32_t maxMs;                             ///< Longest time spent in the phase.
+    uint32_t buckets[NOTE_METRICS_BUCKETS];     ///< Counts by duration.
+} NoteMetricsHistogram;
+
+/*!
+ @brief Counters and per-phase latencies of the transactions with the
+        Notecard, collected when note-c is built with `NOTE_C_METRICS`.
+ */
+typedef struct {
+    NoteMetricsHistogram phases[NOTE_METRICS_PHASES];  ///< Indexed by `NOTE_METRICS_PHASE_*`.
+    uint32_t transactions;  ///< Transactions prepared with the Notecard.
+    uint32_t retries;       ///< Attempts scheduled after a retryable error.
+    uint32_t crcErrors;     ///< Responses that failed their CRC check.
+    uint32_t resets;        ///< Resets of the I2C or Serial interface.
+    uint32_t heartbeats;    ///< Heartbeat responses received.
+    uint32_t bytesOut;      ///< Bytes transmitted to the Notecard.
+    uint32_t bytesIn;       ///< Bytes received from the Notecard.
+} NoteMetrics;
+
+/*!
+ @brief Get the metrics collected since they were last reset.
+
+ @param metrics Pointer to the metrics to fill in.
+
+ @note Durations are measured with the `getMs` hook, so they are only as
+       precise as its millisecond clock.
+ */
+void NoteGetMetrics(NoteMetrics *metrics);
+/*!
+ @brief Reset the collected metrics to zero.
+ */
+void NoteResetMetrics(void);
+#endif // NOTE_C_METRICS
+
+/*!
+ @brief A request waiting in a `NoteRequestQueue`.
+ */
+typedef struct {
+    J *req;                             ///< The request, owned by the queue.
+    noteRequestCompleteFn completeFn;   ///< Called with the response.
+    void *context;                      ///< Passed to `completeFn`.
+} NoteRequestQueueEntry;
+/*!
+ @brief A bounded queue of requests, filled by any number of producer tasks
+        and drained by a single worker task.
+
+ Producers calling `NoteRequest` directly each block on the Notecard lock for
+ the full latency of every transaction. Instead, producers may push requests
+ into a queue, which only takes long enough to copy an entry, while a single
+ worker task owns the Notecard and sends the queued requests in order. The
+ contents of this structure are private to note-c, and are initialized by
+ `NoteRequestQueueInit`.
+ */
+typedef struct {
+    NoteRequestQueueEntry *entries;     ///< Ring of `capacity` entries.
+    size_t capacity;                    ///< Size of the ring.
+    size_t head;                        ///< Index of the oldest entry.
+    size_t count;                       ///< Number of entries waiting.
+    mutexFn lockFn;                     ///< Takes the queue lock.
+    mutexFn unlockFn;                   ///< Releases the queue lock.
+} NoteRequestQueue;
+/*!
+ @brief Initialize a request queue.
+
+ @param queue Pointer to the queue.
+ @param entries Storage for the entries of the queue, which must outlive it.
+ @param capacity The number of entries in `entries`, which is the most
+        requests that may wait in the queue at once.
+ @param lockFn A hook that takes a lock shared by the producers and the
+        worker, which must not be the Notecard lock, or NULL if the queue is
+        only ever used from a single task.
+ @param unlockFn A hook that releases the lock taken by `lockFn`.
+
+ @returns `true` if the queue was initialized, `false` if the storage is
+          missing.
+ */
+bool NoteRequestQueueInit(NoteRequestQueue *queue, NoteRequestQueueEntry *entries,
+                          size_t capacity, mutexFn lockFn, mutexFn unlockFn);
+/*!
+ @brief Add a request to a queue, from any task.
+
+ This function never waits for the Notecard, or for room in the queue.
+
+ @param queue Pointer to the queue.
+ @param req Pointer to a `J` request object. Once pushed, the request is owned
+        by the queue and is freed once it has been sent.
+ @param completeFn A callback, run by the worker task, which receives the
+        response, or NULL to discard the response, as `NoteRequest` does.
+ @param context A context passed to `completeFn`.
+
+ @returns `true` if the request was queued, `false` if the queue is full, in
+          which case the caller retains ownership of the request.
+ */
+bool NoteRequestQueuePush(NoteRequestQueue *queue, J *req,
+                          noteRequestCompleteFn completeFn, void *context);
+/*!
+ @brief Send the requests waiting in a queue to the Notecard, in order.
+
+ This function must only be called from the single worker task that owns the
+ queue. Each request is sent with `NoteRequestResponse`, so the usual locking
+ and retry behavior applies, and its completion callback is run before the
+ next request is sent. The queue lock is never held during a transaction.
+
+ @param queue Pointer to the queue.
+ @param maxRequests The most requests to send, or zero (0) to send requests
+        until the queue is empty.
+
+ @returns The number of requests sent.
+ */
+size_t NoteRequestQueueProcess(NoteRequestQueue *queue, size_t maxRequests);
+/*!
+ @brief Get the number of requests waiting in a queue.
+
+ @param queue Pointer to the queue.
+
+ @returns The number of requests waiting to be sent.
+ */
+size_t NoteRequestQueueCount(NoteRequestQueue *queue);
+/*!
+ @brief Discard the requests waiting in a queue without sending them.
+
+ Each discarded request is freed, and its completion callback is run with a
+ NULL response, as though the transaction had failed, so that its producer
+ may release the context. The queue lock is never held during a callback,
+ so producers may keep pushing while the queue is cleared, and only the
+ requests that were waiting when this function was called are discarded.
+
+ @param queue Pointer to the queue.
+
+ @returns The number of requests discarded.
+ */
+size_t NoteRequestQueueClear(NoteRequestQueue *queue);
+
+// The most value slots a request template may have
+#define NOTE_REQUEST_TEMPLATE_SLOTS_MAX 32
+
+/*!
+ @brief A request compiled once, whose values are then filled into slots and
+        sent repeatedly without building or printing a `J` object.
+
+ The contents of this structure are private to note-c. Templates are created
+ with `NoteNewRequestTemplate` and freed with `NoteDeleteRequestTemplate`.
+ */
+typedef struct NoteRequestTemplate NoteRequestTemplate;
+/*!
+ @brief Compile a request into a template.
+
+ Each slot names a field of the request, or a path of fields separated by '.'
+ (e.g. "body.temp"), whose value in `req` is a placeholder. A slot takes the
+ type of its placeholder, which must be a number, a string or a boolean, and
+ begins with its value. A number slot holds any number. A string slot holds a
+ string as long as its placeholder, once escaped, so the placeholder should
+ be as long as the longest value the slot is to hold.
+
+ @param req Pointer to a `J` request object, which is always freed.
+ @param slots The paths of the slots, in the order in which they are numbered.
+ @param count The number of slots, at most `NOTE_REQUEST_TEMPLATE_SLOTS_MAX`.
+
+ @returns The template, or NULL if a slot is missing or of another type, the
+          request is invalid, or there is insufficient memory.
+
+ @note The timeout of the request, and whether the user agent is added to a
+       `hub.set` request, are settled when the template is compiled.
+ */
+NoteRequestTemplate *NoteNewRequestTemplate(J *req, const char * const *slots, size_t count);
+/*!
+ @brief Free a request template.
+
+ @param tpl Pointer to the template, which may be NULL.
+ */
+void NoteDeleteRequestTemplate(NoteRequestTemplate *tpl);
+/*!
+ @brief Fill a number slot of a request template.
+
+ @param tpl Pointer to the template.
+ @param slot The number of the slot.
+ @param value The value.
+
+ @returns `true` if the slot was filled, `false` if it is not a number slot.
+ */
+bool NoteRequestTemplateSetNumber(NoteRequestTemplate *tpl, size_t slot, JNUMBER value);
+/*!
+ @brief Fill a number slot of a request template with an integer.
+
+ @param tpl Pointer to the template.
+ @param slot The number of the slot.
+ @param value The value.
+
+ @returns `true` if the slot was filled, `false` if it is not a number slot.
+ */
+bool NoteRequestTemplateSetInt(NoteRequestTemplate *tpl, size_t slot, JINTEGER value);
+/*!
+ @brief Fill a string slot of a request template.
+
+ @param tpl Pointer to the template.
+ @param slot The number of the slot.
+ @param value The value, which is copied.
+
+ @returns `true` if the slot was filled, `false` if it is not a string slot or
+          the value is longer than the slot holds, in which case the slot
+          keeps its previous value.
+ */
+bool NoteRequestTemplateSetString(NoteRequestTemplate *tpl, size_t slot, const char *value);
+/*!
+ @brief Fill a boolean slot of a request template.
+
+ @param tpl Pointer to the template.
+ @param slot The number of the slot.
+ @param value The value.
+
+ @returns `true` if the slot was filled, `false` if it is not a boolean slot.
+ */
+bool NoteRequestTemplateSetBool(NoteRequestTemplate *tpl, size_t slot, bool value);
+/*!
+ @brief Send the request of a template, with the current values of its slots,
+        to the Notecard.
+
+ The request is written into a buffer allocated with the template, and the
+ response is checked for an error without being parsed into `J` objects, so
+ that the usual locking, CRC and retry behavior apply without building or
+ printing a `J` object.
+
+ @param tpl Pointer to the template.
+
+ @returns `true` if the response has no error, `false` otherwise.
+ */
+bool NoteRequestTemplateSend(NoteRequestTemplate *tpl);
 /*!
  @brief Check if an error string contains a specific error type.
 
@@ -557,6 +1272,67 @@ void NoteSetFnTransaction(txnStartFn startFn, txnStopFn stopFn);
        interested in that particular function pointer.
  */
 void NoteGetFnTransaction(txnStartFn *startFn, txnStopFn *stopFn);
+/*!
+ @brief Set the response notification hook function.
+
+ When set, note-c sleeps in this hook while awaiting a response from the
+ Notecard, rather than polling the I2C bus every 50ms or the serial port every
+ 10ms.
+
+ @param waitFn Function to block until a response is signaled, or NULL to
+        restore polling.
+
+ @note This operation will lock Notecard access while in progress, if Notecard
+       mutex functions have been set.
+ */
+void NoteSetFnResponseWait(responseWaitFn waitFn);
+/*!
+ @brief Get the platform-specific response notification hook function.
+
+ @param waitFn Pointer to store the current response notification function.
+ */
+void NoteGetFnResponseWait(responseWaitFn *waitFn);
+/*!
+ @brief Set the CRC32 hook function.
+
+ When set, note-c uses this hook to compute the CRC32 that protects requests
+ and responses exchanged with the Notecard, instead of its own software
+ implementation. This allows a platform to offload the work to a CRC
+ peripheral.
+
+ @param crcFn Function to compute a CRC32, or NULL to restore the software
+        implementation.
+
+ @note This operation will lock Notecard access while in progress, if Notecard
+       mutex functions have been set.
+ */
+void NoteSetFnCRC32(crc32Fn crcFn);
+/*!
+ @brief Get the platform-specific CRC32 hook function.
+
+ @param crcFn Pointer to store the current CRC32 function.
+ */
+void NoteGetFnCRC32(crc32Fn *crcFn);
+/*!
+ @brief Set the memory reallocation hook function.
+
+ This hook is optional, and complements the hooks set with `NoteSetFn`. When
+ set, a receive buffer that must grow to hold a large response is resized
+ with it, often in place, rather than moved to a new allocation.
+
+ @param reallocHook Function to resize a block of memory, or NULL to move
+        blocks with the `mallocFn` and `freeFn` hooks.
+
+ @note This operation will lock Notecard access while in progress, if Notecard
+       mutex functions have been set.
+ */
+void NoteSetFnRealloc(reallocFn reallocHook);
+/*!
+ @brief Get the platform-specific memory reallocation hook function.
+
+ @param reallocHook Pointer to store the current reallocation function.
+ */
+void NoteGetFnRealloc(reallocFn *reallocHook);
 /*!
  @brief Set the mutex functions for I2C and Notecard access protection.
 
@@ -698,6 +1474,49 @@ void NoteSetFnSerialDefault(serialResetFn resetFn, serialTransmitFn transmitFn,
  */
 void NoteGetFnSerial(serialResetFn *resetFn, serialTransmitFn *transmitFn,
                      serialAvailableFn *availFn, serialReceiveFn *receiveFn);
+/*!
+ @brief Set the optional serial bulk receive hook function.
+
+ When set, note-c drains each response in as few calls as possible, rather than
+ one byte at a time through the serial available and receive hooks.
+
+ @param receiveBulkFn The platform-specific function to receive all available
+        serial data, or NULL to receive one byte at a time.
+
+ @note `NoteSetFnSerial` clears this hook, so it must be set afterwards.
+ @note This operation will lock Notecard access while in progress, if Notecard
+       mutex functions have been set.
+ */
+void NoteSetFnSerialReceiveBulk(serialReceiveBulkFn receiveBulkFn);
+/*!
+ @brief Get the platform-specific serial bulk receive hook function.
+
+ @param receiveBulkFn Pointer to store the current serial bulk receive
+        function.
+ */
+void NoteGetFnSerialReceiveBulk(serialReceiveBulkFn *receiveBulkFn);
+/*!
+ @brief Set the optional serial flow control hook function.
+
+ When set, requests are streamed to the Notecard in small chunks, as fast as
+ this hook allows, rather than in segments separated by a fixed 250ms delay.
+
+ @param clearToSendFn The platform-specific function reporting whether the
+        Notecard is ready to accept more data, or NULL to restore the fixed
+        delay.
+
+ @note `NoteSetFnSerial` clears this hook, so it must be set afterwards.
+ @note This operation will lock Notecard access while in progress, if Notecard
+       mutex functions have been set.
+ */
+void NoteSetFnSerialFlowControl(serialClearToSendFn clearToSendFn);
+/*!
+ @brief Get the platform-specific serial flow control hook function.
+
+ @param clearToSendFn Pointer to store the current serial flow control
+        function.
+ */
+void NoteGetFnSerialFlowControl(serialClearToSendFn *clearToSendFn);
 /*!
  @brief Set the platform-specific I2C communication hook functions, address and MTU.
 
@@ -771,6 +1590,127 @@ int NoteGetActiveInterface(void);
  This function sets all hook functions to disabled/stub implementations.
  */
 void NoteSetFnDisabled(void);
+// The sizes of the strings cached by the helpers for each Notecard
+#define NOTE_C_CACHED_ZONE_SIZE     10
+#define NOTE_C_CACHED_AREA_SIZE     64
+#define NOTE_C_CACHED_COUNTRY_SIZE  8
+#define NOTE_C_CACHED_ERR_SIZE      64
+#define NOTE_C_CACHED_CONFIG_SIZE   128
+
+/*!
+ @brief The per-Notecard state of note-c.
+
+ A context holds everything note-c knows about one Notecard: the active
+ interface and its Serial, I2C, transaction and response wait hooks, the
+ request sequencing state, the I2C pacing and bus sharing settings, the Serial
+ resync settings, the response cache, and the time, location, connectivity
+ and service configuration cached by the helpers. The platform hooks (memory,
+ timing, the I2C mutex and debug output) and the retry policies are shared by
+ all contexts.
+
+ Several Notecards may be driven in two ways:
+ - From a single thread, each Notecard is given its own context, which is
+   swapped in with `NoteContextRestore` before talking to that Notecard, after
+   the outgoing one has been saved with `NoteContextSave`. Transactions on
+   different Notecards take turns.
+ - In parallel, when note-c is built with `NOTE_C_THREAD_CONTEXT` defined.
+   The current context, and the Notecard mutex hooks, are then kept per
+   thread, so each thread configures and drives its own Notecard without
+   waiting on the others. This requires C11 thread-local storage, as
+   provided on Linux hosts.
+
+ The fields are private to note-c.
+ */
+typedef struct {
+    int interface;
+    serialResetFn serialReset;
+    serialTransmitFn serialTransmit;
+    serialAvailableFn serialAvailable;
+    serialReceiveFn serialReceive;
+    serialReceiveBulkFn serialReceiveBulk;
+    serialClearToSendFn serialClearToSend;
+    uint32_t i2cAddress;
+    uint32_t i2cMax;
+    i2cResetFn i2cReset;
+    i2cTransmitFn i2cTransmit;
+    i2cReceiveFn i2cReceive;
+    txnStartFn transactionStart;
+    txnStopFn transactionStop;
+    responseWaitFn responseWait;
+    bool resetRequired;
+    uint16_t seqNo;
+    bool crcSupported;
+    bool turboIO;
+    bool i2cPacingAdaptive;
+    uint8_t i2cPacingLevel;
+    uint8_t i2cPacingFloor;
+    uint8_t i2cPacingStreak;
+    uint16_t i2cPacingSettled;
+    bool i2cBusSharing;
+    bool serialFastResync;
+    uint32_t serialResyncMs;
+    void *cacheEntries;
+    uint8_t cacheCapacity;
+    size_t cacheMaxBytes;
+    NoteResponseCacheStats cacheStats;
+    uint32_t timeBaseSetAtMs;
+    JTIME timeBaseSec;
+    bool timeBaseSetManually;
+    uint32_t timeSuppressionSecs;
+    uint32_t timeRefreshSecs;
+    uint32_t timeTimer;
+    uint32_t timeRefreshTimer;
+    bool zoneStillUnavailable;
+    bool zoneForceRefresh;
+    char zone[NOTE_C_CACHED_ZONE_SIZE];
+    char area[NOTE_C_CACHED_AREA_SIZE];
+    char country[NOTE_C_CACHED_COUNTRY_SIZE];
+    int zoneOffsetMins;
+    uint32_t locationTimer;
+    char locationLastErr[NOTE_C_CACHED_ERR_SIZE];
+    bool locationValid;
+    uint32_t connectivityTimer;
+    bool cardConnected;
+    uint32_t statusTimer;
+    uint32_t serviceConfigTimer;
+    char scDevice[NOTE_C_CACHED_CONFIG_SIZE];
+    char scSN[NOTE_C_CACHED_CONFIG_SIZE];
+    char scProduct[NOTE_C_CACHED_CONFIG_SIZE];
+    char scService[NOTE_C_CACHED_CONFIG_SIZE];
+} NoteContext;
+
+/*!
+ @brief Save the state of the Notecard currently being driven.
+
+ The saved context takes over the response cache of the Notecard, which is
+ released by `NoteContextFree` if the context is never restored.
+
+ @param ctx The context to save the state into.
+
+ @note This operation will lock Notecard access while in progress, if Notecard
+       mutex functions have been set.
+ */
+void NoteContextSave(NoteContext *ctx);
+/*!
+ @brief Begin driving the Notecard described by a context.
+
+ @param ctx A context previously filled in by `NoteContextSave`, or NULL to
+        begin from a fresh state with no interface configured.
+
+ @note Any transaction in progress must be completed before switching
+       contexts.
+ @note This operation will lock Notecard access while in progress, if Notecard
+       mutex functions have been set.
+ */
+void NoteContextRestore(const NoteContext *ctx);
+/*!
+ @brief Release the resources held by a saved context that will not be
+        restored, such as its response cache.
+
+ @param ctx A context previously filled in by `NoteContextSave`, which must
+        not be restored afterwards.
+ */
+void NoteContextFree(NoteContext *ctx);
 /*!
  @brief Set the I2C address for Notecard communication.
 
@@ -802,6 +1742,97 @@ void NoteGetI2CAddress(uint32_t *i2cAddr);
  */
 void NoteGetI2CMtu(uint32_t *i2cMtu);
 
+/*!
+ @brief The pacing level that reproduces the legacy fixed I2C delays.
+
+ The I2C delays (before each I/O, after each chunk and after each segment)
+ scale linearly from zero at level 0 to their historical values at this level.
+ */
+#define NOTE_I2C_PACING_LEVEL_MAX 8
+
+/*!
+ @brief A learned I2C pacing profile.
+
+ The profile may be read with `NoteGetI2CPacing`, saved to non-volatile
+ storage by the host, and handed back to `NoteSetI2CPacingAdaptive` on the next
+ boot so that the learning process does not have to start over.
+ */
+typedef struct {
+    uint8_t level;            ///< Current pacing level (0 to `NOTE_I2C_PACING_LEVEL_MAX`).
+    uint8_t floor;            ///< Lowest level not recently observed to produce an I/O failure.
+    uint16_t ioDelayMs;       ///< [out] Resulting delay before each I2C I/O.
+    uint16_t chunkDelayMs;    ///< [out] Resulting delay after each transmitted chunk.
+    uint16_t segmentDelayMs;  ///< [out] Resulting delay after each transmitted segment.
+} NoteI2CPacing;
+
+/*!
+ @brief Enable or disable adaptive I2C pacing.
+
+ When enabled, note-c starts with the shortest delays (or those of a
+ previously learned profile), backs off whenever an I2C NACK, transfer timeout
+ or CRC retry is observed, and slowly steps back down after a run of clean
+ transactions. A level that has failed is only retried after a much longer run
+ of clean transactions. Waiting for the Notecard to finish processing a request
+ is not treated as a failure. When disabled, the legacy fixed delays are used.
+
+ @param enable `true` to enable adaptive pacing, `false` to restore the fixed
+        delays.
+ @param profile A profile previously obtained from `NoteGetI2CPacing`, or NULL
+        to begin learning from the most aggressive level. Ignored when
+        `enable` is `false`.
+ */
+void NoteSetI2CPacingAdaptive(bool enable, const NoteI2CPacing *profile);
+/*!
+ @brief Enable or disable I2C bus sharing.
+
+ By default, the I2C lock (see `NoteSetFnI2CMutex`) is held for the whole of
+ each transaction with the Notecard, including the time spent waiting for it
+ to process a request. When bus sharing is enabled, the lock is released
+ between each physical transfer, and for every delay and poll in between, so
+ that other devices on the same bus are not starved by a slow request.
+
+ @param enable `true` to hold the I2C lock only around each transfer, `false`
+        to hold it for the whole transaction.
+ */
+void NoteSetI2CBusSharing(bool enable);
+/*!
+ @brief Determine whether I2C bus sharing is enabled.
+
+ @returns `true` if bus sharing is enabled, `false` otherwise.
+ */
+bool NoteGetI2CBusSharing(void);
+/*!
+ @brief Get the current I2C pacing profile.
+
+ @param [out] profile Pointer to store the current pacing profile.
+
+ @returns `true` if adaptive pacing is enabled, `false` otherwise.
+ */
+bool NoteGetI2CPacing(NoteI2CPacing *profile);
+
+/*!
+ @brief Enable or disable fast Serial resynchronization.
+
+ When resetting the Serial interface, note-c sends a newline and drains the
+ link for 500ms before deciding whether the Notecard echoed a blank line. When
+ fast resynchronization is enabled, the drain ends as soon as a clean `\r\n`
+ echo has been received and the link has been quiet for a few milliseconds,
+ and the initial settling delay is skipped, so a recovered link is usable
+ again in tens of milliseconds. Any other data falls back to the full drain.
+
+ @param enable `true` to enable fast resynchronization, `false` to restore
+        the fixed drain window.
+ */
+void NoteSetSerialFastResync(bool enable);
+/*!
+ @brief Get the duration of the most recent successful Serial reset.
+
+ @returns The time, in milliseconds, taken to resynchronize with the Notecard
+          by the most recent successful Serial reset, or zero if none has
+          occurred.
+ */
+uint32_t NoteGetSerialResyncMs(void);
+
 // The Notecard, whose default I2C address is below, uses a serial-to-i2c
 // protocol whose "byte count" must fit into a single byte and which must not
 // include a 2-byte header field.  This is why the maximum that can be
@@ -1321,6 +2352,109 @@ bool JIsExactString(J *json, const char *field, const char *teststr);
  @returns `true` if the field exists and contains the substring, `false` otherwise.
  */
 bool JContainsString(J *json, const char *field, const char *substr);
+
+// The most fields that may be located by a single call to JScan
+#define JSCAN_FIELDS_MAX 32
+
+/*!
+ @brief A field to be located by `JScan` in the text of a JSON object.
+ */
+typedef struct JField {
+    const char *name;   ///< The field name, or a path of names separated by '.' (e.g. "body.temp").
+    const char *value;  ///< Set to the start of the value's JSON text.
+    size_t length;      ///< Set to the length of the value's JSON text.
+    int type;           ///< Set to the type of the value (e.g. `JNumber`), or `JInvalid` if the field is absent.
+} JField;
+/*!
+ @brief Locate fields in the text of a JSON object, without parsing it into
+        `J` objects.
+
+ The text is checked in a single pass, exactly as `JParse` would check it, and
+ no memory is allocated. Each field refers to its value within the text, so
+ the text must outlive the fields. Field names are matched in the same way as
+ `JGetObjectItem`, and a name within a path is only matched by a value that is
+ an object. Should a field appear more than once, the first is located.
+
+ @param json The null-terminated JSON text.
+ @param fields The fields to locate, of which at most `JSCAN_FIELDS_MAX` are
+        considered.
+ @param count The number of fields.
+
+ @returns The number of fields located, or -1 if the text is not valid JSON,
+          in which case none are located.
+ */
+int JScan(const char *json, JField *fields, size_t count);
+/*!
+ @brief Locate fields in JSON text of a known length, which need not be
+        null-terminated, exactly as `JScan` would.
+
+ @param json The JSON text.
+ @param length The length of the JSON text.
+ @param fields The fields to locate.
+ @param count The number of fields.
+
+ @returns The number of fields located, or -1 if the text is not valid JSON.
+ */
+int JScanWithLength(const char *json, size_t length, JField *fields, size_t count);
+/*!
+ @brief Get the numeric value of a field located by `JScan`.
+
+ @param field The field.
+
+ @returns The numeric value, or 0.0f if the field is absent or isn't a number.
+ */
+JNUMBER JFieldNumber(const JField *field);
+/*!
+ @brief Get the integer value of a field located by `JScan`.
+
+ @param field The field.
+
+ @returns The integer value, or 0 if the field is absent or isn't a number.
+ */
+JINTEGER JFieldInt(const JField *field);
+/*!
+ @brief Get the boolean value of a field located by `JScan`.
+
+ @param field The field.
+
+ @returns The boolean value, or `false` if the field is absent or isn't a
+          boolean.
+ */
+bool JFieldBool(const JField *field);
+/*!
+ @brief Copy the string value of a field located by `JScan`, decoding any
+        escape sequences.
+
+ @param field The field.
+ @param buf (out) The buffer in which to place the string, which is truncated
+        to fit and always null-terminated.
+ @param buflen The length of the buffer.
+
+ @returns `true` if the field is a string, `false` otherwise, in which case an
+          empty string is placed in the buffer.
+ */
+bool JFieldString(const JField *field, char *buf, size_t buflen);
+/*!
+ @brief Check if a field located by `JScan` is absent or an empty string.
+
+ @param field The field.
+
+ @returns `true` if the field is absent or an empty string; `false` otherwise.
+ */
+bool JFieldIsNullString(const JField *field);
+/*!
+ @brief Check if the string value of a field located by `JScan` contains a
+        substring.
+
+ @param field The field.
+ @param substr The substring to search for, which is compared with the string
+        as it is written in the JSON text, before its escape sequences are
+        decoded.
+
+ @returns `true` if the field is a string that contains the substring, `false`
+          otherwise.
+ */
+bool JFieldContains(const JField *field, const char *substr);
 /*!
  @brief Add binary data to a JSON object as a base64-encoded string.
 
@@ -1,8 +1,10 @@
 #include "NoteI2c_Arduino.hpp"
+#include "NoteDefines.h"
 #include "TestFunction.hpp"
 
 #include <cassert>
 #include <cstring>
+#include <vector>
 
 // Compile command: g++ -Wall -Wextra -Wpedantic mock/mock-arduino.cpp mock/mock-note-c-note.c ../src/NoteI2c_Arduino.cpp NoteI2c_Arduino.test.cpp -std=c++11 -I. -I../src -DNOTE_MOCK -ggdb -O0 -o noteI2c_arduino.tests && ./noteI2c_arduino.tests || echo "Tests Result: $?"
 
@@ -64,6 +66,76 @@ int test_make_note_i2c_enforces_singleton_by_returning_same_notei2c_object_for_a
   return result;
 }
 
+int test_make_note_i2c_returns_a_separate_notei2c_object_for_each_port()
+{
+  int result;
+
+  // Arrange
+  TwoWire wire_1;
+  NoteI2c * const notei2c_wire = make_note_i2c(Wire);
+
+  // Action
+  NoteI2c * const notei2c_wire_1 = make_note_i2c(wire_1);
+  NoteI2c * const notei2c_wire_1_again = make_note_i2c(wire_1);
+
+  // Assert
+  if (nullptr != notei2c_wire
+   && nullptr != notei2c_wire_1
+   && notei2c_wire != notei2c_wire_1
+   && notei2c_wire_1 == notei2c_wire_1_again
+   && notei2c_wire == make_note_i2c(Wire))
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('i' + '2' + 'c');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tnotei2c_wire == " << std::hex << notei2c_wire << ", notei2c_wire_1 == " << notei2c_wire_1 << ", EXPECTED: different, not nullptr" << std::endl;
+    std::cout << "\tnotei2c_wire_1_again == " << std::hex << notei2c_wire_1_again << ", EXPECTED: " << notei2c_wire_1 << std::endl;
+    std::cout << "[";
+  }
+
+  // Clean-up
+  make_note_i2c(nullptr);
+
+  return result;
+}
+
+int test_make_note_i2c_returns_nullptr_once_every_port_is_in_use()
+{
+  int result;
+
+  // Arrange
+  TwoWire wires[NOTE_ARDUINO_MAX_INTERFACES + 1];
+  bool all_made = true;
+  for (size_t i = 0 ; i < NOTE_ARDUINO_MAX_INTERFACES ; ++i) {
+    all_made = (all_made && nullptr != make_note_i2c(wires[i]));
+  }
+
+  // Action
+  NoteI2c * const notei2c = make_note_i2c(wires[NOTE_ARDUINO_MAX_INTERFACES]);
+
+  // Assert
+  if (all_made && nullptr == notei2c)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('i' + '2' + 'c');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tall_made == " << all_made << ", EXPECTED: 1" << std::endl;
+    std::cout << "\tnotei2c == " << std::hex << notei2c << ", EXPECTED: 0 (nullptr)" << std::endl;
+    std::cout << "[";
+  }
+
+  // Clean-up
+  make_note_i2c(nullptr);
+
+  return result;
+}
+
 //int test_make_note_i2c_returns_nullptr_when_nullptr_is_passed_as_parameter()
 int test_make_note_i2c_deletes_singleton_when_nullptr_is_passed_as_parameter()
 {
@@ -1223,6 +1295,108 @@ int test_notei2c_arduino_receive_returns_error_message_on_serial_over_i2c_protoc
   return result;
 }
 
+int test_notei2c_arduino_receive_uses_repeated_start_without_delay_when_block_transfer_enabled()
+{
+  int result;
+
+  // Arrange
+  const uint16_t EXPECTED_ADDRESS = 0x17;
+  const uint8_t REQUEST_SIZE = 13;
+  uint8_t response_buffer[32];
+  uint32_t bytes_remaining;
+
+  noteDelayMs_Parameters.reset();
+  twoWireBeginTransmission_Parameters.reset();
+  twoWireWriteByte_Parameters.reset();
+  twoWireEndTransmission_Parameters.reset();
+  twoWireRequestFrom_Parameters.reset();
+  twoWireRequestFrom_Parameters.result = (REQUEST_SIZE + NoteI2c::REQUEST_HEADER_SIZE);
+  twoWireRead_Parameters.reset();
+  twoWireRead_Parameters.results = {0, REQUEST_SIZE, 'T', 'e', 's', 't', ' ', 'P', 'a', 's', 's', 'e', 'd', '!', '\0'};
+  NoteI2c_Arduino notei2c(Wire);
+  notei2c.setBlockTransfer(true);
+
+  // Action
+  notei2c.receive(
+    EXPECTED_ADDRESS,
+    response_buffer,
+    REQUEST_SIZE,
+    &bytes_remaining
+  );
+
+  // Assert
+  if (
+      twoWireEndTransmission_Parameters.invoked
+   && !twoWireEndTransmission_Parameters.send_stop
+   && !noteDelayMs_Parameters.invoked
+  )
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('i' + '2' + 'c');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\ttwoWireEndTransmission_Parameters.invoked == " << twoWireEndTransmission_Parameters.invoked << ", EXPECTED: > 0" << std::endl;
+    std::cout << "\ttwoWireEndTransmission_Parameters.send_stop == " << (twoWireEndTransmission_Parameters.send_stop ? "true" : "false") << ", EXPECTED: false" << std::endl;
+    std::cout << "\tnoteDelayMs_Parameters.invoked == " << noteDelayMs_Parameters.invoked << ", EXPECTED: 0" << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_notei2c_arduino_receive_reads_response_data_from_notecard_when_block_transfer_enabled()
+{
+  int result;
+
+  // Arrange
+  const uint16_t EXPECTED_ADDRESS = 0x17;
+  const uint8_t REQUEST_SIZE = 13;
+  const char * EXPECTED_RESPONSE = "Test Passed!";
+  uint8_t response_buffer[32];
+  uint32_t bytes_remaining;
+
+  twoWireBeginTransmission_Parameters.reset();
+  twoWireWriteByte_Parameters.reset();
+  twoWireEndTransmission_Parameters.reset();
+  twoWireRequestFrom_Parameters.reset();
+  twoWireRequestFrom_Parameters.result = (REQUEST_SIZE + NoteI2c::REQUEST_HEADER_SIZE);
+  twoWireRead_Parameters.reset();
+  twoWireRead_Parameters.results = {0, REQUEST_SIZE, 'T', 'e', 's', 't', ' ', 'P', 'a', 's', 's', 'e', 'd', '!', '\0'};
+  NoteI2c_Arduino notei2c(Wire);
+  notei2c.setBlockTransfer(true);
+
+  // Action
+  const char * const ACTUAL_RESULT = notei2c.receive(
+    EXPECTED_ADDRESS,
+    response_buffer,
+    REQUEST_SIZE,
+    &bytes_remaining
+  );
+
+  // Assert
+  if (
+      !ACTUAL_RESULT
+   && twoWireRead_Parameters.invoked == (NoteI2c::REQUEST_HEADER_SIZE + REQUEST_SIZE)
+   && !memcmp(response_buffer, EXPECTED_RESPONSE, REQUEST_SIZE)
+  )
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('i' + '2' + 'c');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tnotei2c.receive(EXPECTED_ADDRESS,response_buffer,REQUEST_SIZE,&bytes_remaining) == " << (ACTUAL_RESULT ? ACTUAL_RESULT : "nullptr") << ", EXPECTED: nullptr" << std::endl;
+    std::cout << "\ttwoWireRead_Parameters.invoked == " << twoWireRead_Parameters.invoked << ", EXPECTED: " << (NoteI2c::REQUEST_HEADER_SIZE + REQUEST_SIZE) << std::endl;
+    std::cout << "\tresponse_buffer == \"" << response_buffer << "\"" << ", EXPECTED: " << EXPECTED_RESPONSE << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
 int test_notei2c_arduino_reset_invokes_begin_method_on_constructor_twowire_parameter()
 {
   int result;
@@ -1343,6 +1517,32 @@ int test_notei2c_arduino_reset_invokes_end_method_on_constructor_twowire_paramet
 
 #endif // not defined(WIRE_HAS_END)
 
+int test_notei2c_arduino_set_block_transfer_returns_true()
+{
+  int result;
+
+  // Arrange
+  NoteI2c_Arduino notei2c(Wire);
+
+  // Action
+  const bool ACTUAL_RESULT = notei2c.setBlockTransfer(true);
+
+  // Assert
+  if (ACTUAL_RESULT)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('i' + '2' + 'c');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tnotei2c.setBlockTransfer(true) == " << ACTUAL_RESULT << ", EXPECTED: true" << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
 int test_notei2c_arduino_transmit_translates_parameters_for_arduino_two_wire()
 {
   int result;
@@ -1691,11 +1891,77 @@ int test_notei2c_arduino_transmit_returns_error_message_on_unexpected_i2c_transm
   return result;
 }
 
+int test_notei2c_arduino_receive_block_transfer_removes_the_settle_delay_per_chunk()
+{
+  int result;
+
+  // Arrange
+  const uint16_t EXPECTED_ADDRESS = 0x17;
+  const size_t CHUNK_COUNT = 64;
+  const uint8_t REQUEST_SIZE = (NoteI2c::REQUEST_MAX_SIZE - NoteI2c::REQUEST_HEADER_SIZE);
+  uint8_t response_buffer[REQUEST_SIZE];
+  uint32_t bytes_remaining;
+
+  std::vector<int> frame = {0, REQUEST_SIZE};
+  frame.insert(frame.end(), REQUEST_SIZE, 'x');
+
+  double delay_ms[2];
+
+  NoteI2c_Arduino notei2c(Wire);
+
+  // Action
+  for (size_t mode = 0 ; mode < 2 ; ++mode) {
+    notei2c.setBlockTransfer(mode == 1);
+    noteGetMs_Parameters.reset();
+    noteDelayMs_Parameters.reset();
+    noteDelayMs_Parameters.mock_time = true;
+
+    for (size_t chunk = 0 ; chunk < CHUNK_COUNT ; ++chunk) {
+      twoWireEndTransmission_Parameters.reset();
+      twoWireRequestFrom_Parameters.reset();
+      twoWireRequestFrom_Parameters.result = (REQUEST_SIZE + NoteI2c::REQUEST_HEADER_SIZE);
+      twoWireRead_Parameters.reset();
+      twoWireRead_Parameters.results = frame;
+      notei2c.receive(EXPECTED_ADDRESS, response_buffer, REQUEST_SIZE, &bytes_remaining);
+    }
+
+    delay_ms[mode] = (static_cast<double>(noteGetMs_Parameters.default_result) / CHUNK_COUNT);
+  }
+  noteDelayMs_Parameters.reset();
+  noteGetMs_Parameters.reset();
+
+  // Report
+  std::cout << "\tdelay per " << static_cast<int>(REQUEST_SIZE) << " byte chunk (stop -> repeated start): "
+            << delay_ms[0] << " ms -> " << delay_ms[1] << " ms" << std::endl;
+  std::cout << "[";
+
+  // Assert
+  if (
+      2 == delay_ms[0]
+   && 0 == delay_ms[1]
+  )
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('i' + '2' + 'c');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tbyte-wise delay per chunk == " << delay_ms[0] << " ms, EXPECTED: 2 ms" << std::endl;
+    std::cout << "\tblock delay per chunk == " << delay_ms[1] << " ms, EXPECTED: 0 ms" << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
 int main(void)
 {
   TestFunction tests[] = {
       {test_make_note_i2c_instantiates_notei2c_object, "test_make_note_i2c_instantiates_notei2c_object"},
       {test_make_note_i2c_enforces_singleton_by_returning_same_notei2c_object_for_all_calls, "test_make_note_i2c_enforces_singleton_by_returning_same_notei2c_object_for_all_calls"},
+      {test_make_note_i2c_returns_a_separate_notei2c_object_for_each_port, "test_make_note_i2c_returns_a_separate_notei2c_object_for_each_port"},
+      {test_make_note_i2c_returns_nullptr_once_every_port_is_in_use, "test_make_note_i2c_returns_nullptr_once_every_port_is_in_use"},
       {test_make_note_i2c_deletes_singleton_when_nullptr_is_passed_as_parameter, "test_make_note_i2c_deletes_singleton_when_nullptr_is_passed_as_parameter"},
       {test_notei2c_arduino_constructor_invokes_twowire_parameter_begin_method, "test_notei2c_arduino_constructor_invokes_twowire_parameter_begin_method"},
 #if not defined(WIRE_HAS_END)
@@ -1725,6 +1991,8 @@ int main(void)
       {test_notei2c_arduino_receive_returns_error_message_on_i2c_protocol_unexpected_raw_byte_count, "test_notei2c_arduino_receive_returns_error_message_on_i2c_protocol_unexpected_raw_byte_count"},
       {test_notei2c_arduino_receive_returns_error_message_on_serial_over_i2c_protocol_unexpected_available_byte_count, "test_notei2c_arduino_receive_returns_error_message_on_serial_over_i2c_protocol_unexpected_available_byte_count"},
       {test_notei2c_arduino_receive_returns_error_message_on_serial_over_i2c_protocol_unexpected_protocol_byte_count, "test_notei2c_arduino_receive_returns_error_message_on_serial_over_i2c_protocol_unexpected_protocol_byte_count"},
+      {test_notei2c_arduino_receive_uses_repeated_start_without_delay_when_block_transfer_enabled, "test_notei2c_arduino_receive_uses_repeated_start_without_delay_when_block_transfer_enabled"},
+      {test_notei2c_arduino_receive_reads_response_data_from_notecard_when_block_transfer_enabled, "test_notei2c_arduino_receive_reads_response_data_from_notecard_when_block_transfer_enabled"},
       {test_notei2c_arduino_reset_invokes_begin_method_on_constructor_twowire_parameter, "test_notei2c_arduino_reset_invokes_begin_method_on_constructor_twowire_parameter"},
       {test_notei2c_arduino_reset_returns_true, "test_notei2c_arduino_reset_returns_true"},
 #if not defined(WIRE_HAS_END)
@@ -1732,6 +2000,7 @@ int main(void)
 #else // defined(WIRE_HAS_END)
       {test_notei2c_arduino_reset_invokes_end_method_on_constructor_twowire_parameter_ifdef_WIRE_HAS_END, "test_notei2c_arduino_reset_invokes_end_method_on_constructor_twowire_parameter_ifdef_WIRE_HAS_END"},
 #endif // not defined(WIRE_HAS_END)
+      {test_notei2c_arduino_set_block_transfer_returns_true, "test_notei2c_arduino_set_block_transfer_returns_true"},
       {test_notei2c_arduino_transmit_translates_parameters_for_arduino_two_wire, "test_notei2c_arduino_transmit_translates_parameters_for_arduino_two_wire"},
       {test_notei2c_arduino_transmit_returns_nullptr_on_success, "test_notei2c_arduino_transmit_returns_nullptr_on_success"},
       {test_notei2c_arduino_transmit_returns_error_message_on_i2c_transmission_failure1, "test_notei2c_arduino_transmit_returns_error_message_on_i2c_transmission_failure1"},
@@ -1740,6 +2009,7 @@ int main(void)
       {test_notei2c_arduino_transmit_returns_error_message_on_i2c_transmission_failure4, "test_notei2c_arduino_transmit_returns_error_message_on_i2c_transmission_failure4"},
       {test_notei2c_arduino_transmit_returns_error_message_on_i2c_transmission_failure5, "test_notei2c_arduino_transmit_returns_error_message_on_i2c_transmission_failure5"},
       {test_notei2c_arduino_transmit_returns_error_message_on_unexpected_i2c_transmission_failure, "test_notei2c_arduino_transmit_returns_error_message_on_unexpected_i2c_transmission_failure"},
+      {test_notei2c_arduino_receive_block_transfer_removes_the_settle_delay_per_chunk, "test_notei2c_arduino_receive_block_transfer_removes_the_settle_delay_per_chunk"},
   };
 
   return TestFunction::runTests(tests, (sizeof(tests) / sizeof(TestFunction)));
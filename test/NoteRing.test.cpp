@@ -0,0 +1,401 @@
+#include "NoteRing.hpp"
+#include "TestFunction.hpp"
+
+#include <cstdint>
+#include <iostream>
+
+#include <pthread.h>
+#include <sched.h>
+
+// Compile command: g++ -Wall -Wextra -Wpedantic -pthread ../src/NoteRing.cpp NoteRing.test.cpp -std=c++11 -I. -I../src -ggdb -O0 -o noteRing.tests && ./noteRing.tests || echo "Tests Result: $?"
+
+namespace
+{
+
+struct Sample {
+  uint32_t sequence;
+  uint16_t reading;
+};
+
+const uint32_t STRESS_RECORDS = 200000;
+
+struct StressContext {
+  NoteRing *ring;
+  uint32_t pushed;
+};
+
+void * stressProducer(void *arg_)
+{
+  // Push as fast as possible, as an interrupt handler would, without waiting
+  StressContext *ctx = static_cast<StressContext *>(arg_);
+  for (uint32_t sequence = 1 ; sequence <= STRESS_RECORDS ; ++sequence) {
+    const Sample sample = {sequence, static_cast<uint16_t>(sequence * 7)};
+    ctx->ring->push(&sample);
+    if (!(sequence % 64)) {
+      sched_yield();
+    }
+  }
+  __atomic_store_n(&ctx->pushed, STRESS_RECORDS, __ATOMIC_RELEASE);
+  return nullptr;
+}
+
+} // namespace
+
+int test_noteRing_capacity_is_one_less_than_the_number_of_slots()
+{
+  int result;
+
+   // Arrange
+  ////////////
+
+  uint8_t storage[5 * sizeof(Sample)];
+  NoteRing ring(storage, sizeof(Sample), 5);
+
+   // Action
+  ///////////
+
+  const size_t ACTUAL_RESULT = ring.capacity();
+
+   // Assert
+  ///////////
+
+  if (4 == ACTUAL_RESULT
+   && sizeof(Sample) == ring.recordSize()
+   && 0 == ring.count())
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('r' + 'i' + 'n' + 'g');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tring.capacity() == " << ACTUAL_RESULT << ", EXPECTED: 4" << std::endl;
+    std::cout << "\tring.recordSize() == " << ring.recordSize() << ", EXPECTED: " << sizeof(Sample) << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_noteRing_peek_returns_records_oldest_first()
+{
+  int result;
+
+   // Arrange
+  ////////////
+
+  NoteRingBuffer<sizeof(Sample), 4> ring;
+  for (uint32_t sequence = 1 ; sequence <= 3 ; ++sequence) {
+    const Sample sample = {sequence, 0};
+    ring.push(&sample);
+  }
+
+   // Action
+  ///////////
+
+  const Sample *first = static_cast<const Sample *>(ring.peek(0));
+  const Sample *third = static_cast<const Sample *>(ring.peek(2));
+  const void *missing = ring.peek(3);
+
+   // Assert
+  ///////////
+
+  if (first && 1 == first->sequence
+   && third && 3 == third->sequence
+   && nullptr == missing
+   && 3 == ring.count())
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('r' + 'i' + 'n' + 'g');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tring.peek(0)->sequence == " << (first ? first->sequence : 0) << ", EXPECTED: 1" << std::endl;
+    std::cout << "\tring.peek(2)->sequence == " << (third ? third->sequence : 0) << ", EXPECTED: 3" << std::endl;
+    std::cout << "\tring.peek(3) == " << missing << ", EXPECTED: 0" << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_noteRing_consume_releases_the_oldest_records()
+{
+  int result;
+
+   // Arrange
+  ////////////
+
+  NoteRingBuffer<sizeof(Sample), 4> ring;
+  for (uint32_t sequence = 1 ; sequence <= 3 ; ++sequence) {
+    const Sample sample = {sequence, 0};
+    ring.push(&sample);
+  }
+
+   // Action
+  ///////////
+
+  ring.consume(2);
+
+   // Assert
+  ///////////
+
+  const Sample *oldest = static_cast<const Sample *>(ring.peek());
+  if (1 == ring.count()
+   && oldest && 3 == oldest->sequence)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('r' + 'i' + 'n' + 'g');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tring.count() == " << ring.count() << ", EXPECTED: 1" << std::endl;
+    std::cout << "\tring.peek()->sequence == " << (oldest ? oldest->sequence : 0) << ", EXPECTED: 3" << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_noteRing_consume_does_not_release_more_records_than_are_waiting()
+{
+  int result;
+
+   // Arrange
+  ////////////
+
+  NoteRingBuffer<sizeof(Sample), 4> ring;
+  const Sample sample = {1, 0};
+  ring.push(&sample);
+
+   // Action
+  ///////////
+
+  ring.consume(3);
+
+   // Assert
+  ///////////
+
+  if (0 == ring.count()
+   && ring.push(&sample)
+   && 1 == ring.count())
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('r' + 'i' + 'n' + 'g');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tring.count() == " << ring.count() << ", EXPECTED: 1" << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_noteRing_push_drops_and_counts_records_when_full()
+{
+  int result;
+
+   // Arrange
+  ////////////
+
+  NoteRingBuffer<sizeof(Sample), 2> ring;
+  const Sample sample = {1, 0};
+  ring.push(&sample);
+  ring.push(&sample);
+
+   // Action
+  ///////////
+
+  const bool ACTUAL_RESULT = ring.push(&sample);
+  ring.push(&sample);
+
+   // Assert
+  ///////////
+
+  if (!ACTUAL_RESULT
+   && 2 == ring.overflows()
+   && 2 == ring.count())
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('r' + 'i' + 'n' + 'g');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tring.push(&sample) == " << ACTUAL_RESULT << ", EXPECTED: 0" << std::endl;
+    std::cout << "\tring.overflows() == " << ring.overflows() << ", EXPECTED: 2" << std::endl;
+    std::cout << "\tring.count() == " << ring.count() << ", EXPECTED: 2" << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_noteRing_high_watermark_records_the_most_records_ever_waiting()
+{
+  int result;
+
+   // Arrange
+  ////////////
+
+  NoteRingBuffer<sizeof(Sample), 8> ring;
+  const Sample sample = {1, 0};
+  for (size_t i = 0 ; i < 5 ; ++i) {
+    ring.push(&sample);
+  }
+  ring.consume(4);
+
+   // Action
+  ///////////
+
+  ring.push(&sample);
+  ring.push(&sample);
+
+   // Assert
+  ///////////
+
+  if (5 == ring.highWatermark()
+   && 3 == ring.count())
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('r' + 'i' + 'n' + 'g');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tring.highWatermark() == " << ring.highWatermark() << ", EXPECTED: 5" << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_noteRing_preserves_order_when_records_wrap_around_the_storage()
+{
+  int result = 0;
+
+   // Arrange
+  ////////////
+
+  NoteRingBuffer<sizeof(Sample), 3> ring;
+  uint32_t pushed = 0;
+  uint32_t expected = 1;
+
+   // Action
+  ///////////
+
+  for (size_t pass = 0 ; pass < 10 && !result ; ++pass) {
+    for (size_t i = 0 ; i < 2 ; ++i) {
+      const Sample sample = {++pushed, 0};
+      ring.push(&sample);
+    }
+    for (size_t i = 0 ; i < 2 ; ++i) {
+      const Sample *oldest = static_cast<const Sample *>(ring.peek());
+      if (!oldest || expected != oldest->sequence) {
+        result = static_cast<int>('r' + 'i' + 'n' + 'g');
+        std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+        std::cout << "\tring.peek()->sequence == " << (oldest ? oldest->sequence : 0) << ", EXPECTED: " << expected << std::endl;
+        std::cout << "[";
+        break;
+      }
+      ring.consume();
+      ++expected;
+    }
+  }
+
+   // Assert
+  ///////////
+
+  if (!result && (0 != ring.count() || 0 != ring.overflows()))
+  {
+    result = static_cast<int>('r' + 'i' + 'n' + 'g');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tring.count() == " << ring.count() << ", EXPECTED: 0" << std::endl;
+    std::cout << "\tring.overflows() == " << ring.overflows() << ", EXPECTED: 0" << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_noteRing_delivers_every_record_pushed_concurrently_in_order_or_counts_it_as_an_overflow()
+{
+  int result;
+
+   // Arrange
+  ////////////
+
+  NoteRingBuffer<sizeof(Sample), 16> ring;
+  StressContext ctx = {&ring, 0};
+  uint32_t received = 0;
+  uint32_t lastSequence = 0;
+  bool ordered = true;
+  bool intact = true;
+
+   // Action
+  ///////////
+
+  pthread_t producer;
+  pthread_create(&producer, nullptr, stressProducer, &ctx);
+  for (;;) {
+    // Only stop once the producer has finished and the ring is drained
+    const bool finished = (0 != __atomic_load_n(&ctx.pushed, __ATOMIC_ACQUIRE));
+    const size_t waiting = ring.count();
+    if (!waiting) {
+      if (finished) {
+        break;
+      }
+      sched_yield();
+      continue;
+    }
+    for (size_t i = 0 ; i < waiting ; ++i) {
+      const Sample *sample = static_cast<const Sample *>(ring.peek(i));
+      ordered = ordered && (sample->sequence > lastSequence);
+      intact = intact && (static_cast<uint16_t>(sample->sequence * 7) == sample->reading);
+      lastSequence = sample->sequence;
+    }
+    ring.consume(waiting);
+    received += waiting;
+  }
+  pthread_join(producer, nullptr);
+
+   // Assert
+  ///////////
+
+  if (ordered && intact
+   && STRESS_RECORDS == (received + ring.overflows()))
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('r' + 'i' + 'n' + 'g');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tordered == " << ordered << ", EXPECTED: 1" << std::endl;
+    std::cout << "\tintact == " << intact << ", EXPECTED: 1" << std::endl;
+    std::cout << "\treceived + ring.overflows() == " << (received + ring.overflows()) << ", EXPECTED: " << STRESS_RECORDS << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int main(void)
+{
+  TestFunction tests[] = {
+      {test_noteRing_capacity_is_one_less_than_the_number_of_slots, "test_noteRing_capacity_is_one_less_than_the_number_of_slots"},
+      {test_noteRing_peek_returns_records_oldest_first, "test_noteRing_peek_returns_records_oldest_first"},
+      {test_noteRing_consume_releases_the_oldest_records, "test_noteRing_consume_releases_the_oldest_records"},
+      {test_noteRing_consume_does_not_release_more_records_than_are_waiting, "test_noteRing_consume_does_not_release_more_records_than_are_waiting"},
+      {test_noteRing_push_drops_and_counts_records_when_full, "test_noteRing_push_drops_and_counts_records_when_full"},
+      {test_noteRing_high_watermark_records_the_most_records_ever_waiting, "test_noteRing_high_watermark_records_the_most_records_ever_waiting"},
+      {test_noteRing_preserves_order_when_records_wrap_around_the_storage, "test_noteRing_preserves_order_when_records_wrap_around_the_storage"},
+      {test_noteRing_delivers_every_record_pushed_concurrently_in_order_or_counts_it_as_an_overflow, "test_noteRing_delivers_every_record_pushed_concurrently_in_order_or_counts_it_as_an_overflow"},
+  };
+
+  return TestFunction::runTests(tests, (sizeof(tests) / sizeof(TestFunction)));
+}
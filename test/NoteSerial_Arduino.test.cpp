@@ -68,6 +68,41 @@ int test_make_note_serial_enforces_singleton_by_returning_same_noteserial_object
 }
 
 //int test_make_note_serial_returns_nullptr_when_nullptr_is_passed_as_parameter()
+int test_make_note_serial_returns_a_separate_noteserial_object_for_each_port()
+{
+    int result;
+
+    // Arrange
+    HardwareSerial serial_1;
+    MakeNoteSerial_ArduinoParameters<HardwareSerial> arduino_parameters(Serial, 9600);
+    MakeNoteSerial_ArduinoParameters<HardwareSerial> arduino_parameters_1(serial_1, 115200);
+    NoteSerial * const noteserial = make_note_serial<MakeNoteSerial_ArduinoParameters<HardwareSerial>>(arduino_parameters);
+
+    // Action
+    NoteSerial * const noteserial_1 = make_note_serial<MakeNoteSerial_ArduinoParameters<HardwareSerial>>(arduino_parameters_1);
+
+    // Assert
+    if (nullptr != noteserial
+     && nullptr != noteserial_1
+     && noteserial != noteserial_1
+     && noteserial_1 == make_note_serial<MakeNoteSerial_ArduinoParameters<HardwareSerial>>(arduino_parameters_1))
+    {
+        result = 0;
+    }
+    else
+    {
+        result = static_cast<int>('s' + 'e' + 'r' + 'i' + 'a' + 'l');
+        std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+        std::cout << "\tnoteserial == " << std::hex << noteserial << ", noteserial_1 == " << noteserial_1 << ", EXPECTED: different, not nullptr" << std::endl;
+        std::cout << "[";
+    }
+
+    // Clean-up
+    make_note_serial(nullptr);
+
+    return result;
+}
+
 int test_make_note_serial_deletes_singleton_when_nullptr_is_passed_as_parameter()
 {
     int result;
@@ -234,6 +269,71 @@ int test_noteserial_arduino_available_does_not_modify_hardware_serial_available_
     return result;
 }
 
+int test_noteserial_arduino_clearToSend_returns_true_when_flow_control_is_disabled()
+{
+    int result;
+
+    // Arrange
+    const uint8_t CTS_PIN = 17;
+    NoteSerial_Arduino<HardwareSerial> noteserial(Serial, 9600);
+    digitalRead_Parameters.reset();
+    digitalRead_Parameters.default_result[CTS_PIN] = HIGH;
+
+    // Action
+    const bool ACTUAL_RESULT = noteserial.clearToSend();
+
+    // Assert
+    if (ACTUAL_RESULT
+     && !digitalRead_Parameters.invoked[CTS_PIN])
+    {
+        result = 0;
+    }
+    else
+    {
+        result = static_cast<int>('s' + 'e' + 'r' + 'i' + 'a' + 'l');
+        std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+        std::cout << "\tnoteserial.clearToSend() == " << ACTUAL_RESULT << ", EXPECTED: " << true << std::endl;
+        std::cout << "\tdigitalRead_Parameters.invoked[CTS_PIN] == " << digitalRead_Parameters.invoked[CTS_PIN] << ", EXPECTED: 0" << std::endl;
+        std::cout << "[";
+    }
+
+    return result;
+}
+
+int test_noteserial_arduino_clearToSend_reflects_the_cts_pin_when_flow_control_is_enabled()
+{
+    int result;
+
+    // Arrange
+    const uint8_t CTS_PIN = 17;
+    NoteSerial_Arduino<HardwareSerial> noteserial(Serial, 9600);
+    noteserial.setFlowControl(true, CTS_PIN);
+    digitalRead_Parameters.reset();
+    digitalRead_Parameters.result[CTS_PIN].push_back(HIGH);
+    digitalRead_Parameters.result[CTS_PIN].push_back(LOW);
+
+    // Action
+    const bool ACTUAL_DEASSERTED = noteserial.clearToSend();
+    const bool ACTUAL_ASSERTED = noteserial.clearToSend();
+
+    // Assert
+    if (!ACTUAL_DEASSERTED
+     && ACTUAL_ASSERTED)
+    {
+        result = 0;
+    }
+    else
+    {
+        result = static_cast<int>('s' + 'e' + 'r' + 'i' + 'a' + 'l');
+        std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+        std::cout << "\tnoteserial.clearToSend() == " << ACTUAL_DEASSERTED << ", EXPECTED: " << false << " (CTS HIGH)" << std::endl;
+        std::cout << "\tnoteserial.clearToSend() == " << ACTUAL_ASSERTED << ", EXPECTED: " << true << " (CTS LOW)" << std::endl;
+        std::cout << "[";
+    }
+
+    return result;
+}
+
 int test_noteserial_arduino_receive_invokes_hardware_serial_read()
 {
     int result;
@@ -292,6 +392,74 @@ int test_noteserial_arduino_receive_does_not_modify_hardware_serial_read_result_
     return result;
 }
 
+int test_noteserial_arduino_receivebulk_reads_available_bytes_through_the_end_of_packet_character()
+{
+    int result;
+
+    // Arrange
+    NoteSerial_Arduino<HardwareSerial> noteserial(Serial, 9600);
+    uint8_t buffer[32] = {0};
+
+    hardwareSerialAvailable_Parameters.reset();
+    hardwareSerialRead_Parameters.reset();
+    hardwareSerialRead_Parameters.stream = "{\"ok\":true}\n{\"next\":1}\n";
+
+    // Action
+    const size_t ACTUAL_RESULT = noteserial.receiveBulk(buffer, sizeof(buffer), '\n');
+
+    // Assert
+    if (12 == ACTUAL_RESULT
+     && !memcmp(buffer, "{\"ok\":true}\n", 12)
+     && 12 == hardwareSerialRead_Parameters.consumed
+     && 1 == hardwareSerialAvailable_Parameters.invoked)
+    {
+        result = 0;
+    }
+    else
+    {
+        result = static_cast<int>('s' + 'e' + 'r' + 'i' + 'a' + 'l');
+        std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+        std::cout << "\tnoteserial.receiveBulk(buffer, sizeof(buffer), '\\n') == " << ACTUAL_RESULT << ", EXPECTED: 12" << std::endl;
+        std::cout << "\thardwareSerialRead_Parameters.consumed == " << hardwareSerialRead_Parameters.consumed << ", EXPECTED: 12" << std::endl;
+        std::cout << "\thardwareSerialAvailable_Parameters.invoked == " << hardwareSerialAvailable_Parameters.invoked << ", EXPECTED: 1" << std::endl;
+        std::cout << "[";
+    }
+
+    return result;
+}
+
+int test_noteserial_arduino_receivebulk_does_not_read_beyond_the_size_of_the_buffer()
+{
+    int result;
+
+    // Arrange
+    NoteSerial_Arduino<HardwareSerial> noteserial(Serial, 9600);
+    uint8_t buffer[8] = {0};
+
+    hardwareSerialRead_Parameters.reset();
+    hardwareSerialRead_Parameters.stream = "{\"ok\":true}\n";
+
+    // Action
+    const size_t ACTUAL_RESULT = noteserial.receiveBulk(buffer, 4, '\n');
+
+    // Assert
+    if (4 == ACTUAL_RESULT
+     && !memcmp(buffer, "{\"ok", 4)
+     && 0 == buffer[4])
+    {
+        result = 0;
+    }
+    else
+    {
+        result = static_cast<int>('s' + 'e' + 'r' + 'i' + 'a' + 'l');
+        std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+        std::cout << "\tnoteserial.receiveBulk(buffer, 4, '\\n') == " << ACTUAL_RESULT << ", EXPECTED: 4" << std::endl;
+        std::cout << "[";
+    }
+
+    return result;
+}
+
 int test_noteserial_arduino_reset_invokes_hardware_serial_end()
 {
     int result;
@@ -401,6 +569,37 @@ int test_noteserial_arduino_reset_always_returns_true()
     return result;
 }
 
+int test_noteserial_arduino_setFlowControl_configures_the_cts_pin_as_an_input()
+{
+    int result;
+
+    // Arrange
+    const uint8_t CTS_PIN = 17;
+    NoteSerial_Arduino<HardwareSerial> noteserial(Serial, 9600);
+    pinMode_Parameters.reset();
+
+    // Action
+    const bool ACTUAL_RESULT = noteserial.setFlowControl(true, CTS_PIN);
+
+    // Assert
+    if (ACTUAL_RESULT
+     && pinMode_Parameters.invoked[CTS_PIN]
+     && INPUT == pinMode_Parameters.pin_mode[CTS_PIN].back())
+    {
+        result = 0;
+    }
+    else
+    {
+        result = static_cast<int>('s' + 'e' + 'r' + 'i' + 'a' + 'l');
+        std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+        std::cout << "\tnoteserial.setFlowControl() == " << ACTUAL_RESULT << ", EXPECTED: " << true << std::endl;
+        std::cout << "\tpinMode_Parameters.invoked[CTS_PIN] == " << pinMode_Parameters.invoked[CTS_PIN] << ", EXPECTED: > 0" << std::endl;
+        std::cout << "[";
+    }
+
+    return result;
+}
+
 int test_noteserial_arduino_transmit_invokes_hardware_serial_write()
 {
     int result;
@@ -576,18 +775,24 @@ int main(void)
     TestFunction tests[] = {
         {test_make_note_serial_instantiates_noteserial_object, "test_make_note_serial_instantiates_noteserial_object"},
         {test_make_note_serial_enforces_singleton_by_returning_same_noteserial_object_for_all_calls, "test_make_note_serial_enforces_singleton_by_returning_same_noteserial_object_for_all_calls"},
+        {test_make_note_serial_returns_a_separate_noteserial_object_for_each_port, "test_make_note_serial_returns_a_separate_noteserial_object_for_each_port"},
         {test_make_note_serial_deletes_singleton_when_nullptr_is_passed_as_parameter, "test_make_note_serial_deletes_singleton_when_nullptr_is_passed_as_parameter"},
         {test_noteserial_arduino_constructor_invokes_hardware_serial_parameter_begin_method, "test_noteserial_arduino_constructor_invokes_hardware_serial_parameter_begin_method"},
         {test_noteserial_arduino_constructor_does_not_modify_baud_parameter_before_passing_to_hardware_serial_begin, "test_noteserial_arduino_constructor_does_not_modify_baud_parameter_before_passing_to_hardware_serial_begin"},
         {test_noteserial_arduino_deconstructor_invokes_hardware_serial_end_method, "test_noteserial_arduino_deconstructor_invokes_hardware_serial_end_method"},
         {test_noteserial_arduino_available_invokes_hardware_serial_available, "test_noteserial_arduino_available_invokes_hardware_serial_available"},
         {test_noteserial_arduino_available_does_not_modify_hardware_serial_available_result_value_before_returning_to_caller, "test_noteserial_arduino_available_does_not_modify_hardware_serial_available_result_value_before_returning_to_caller"},
+        {test_noteserial_arduino_clearToSend_returns_true_when_flow_control_is_disabled, "test_noteserial_arduino_clearToSend_returns_true_when_flow_control_is_disabled"},
+        {test_noteserial_arduino_clearToSend_reflects_the_cts_pin_when_flow_control_is_enabled, "test_noteserial_arduino_clearToSend_reflects_the_cts_pin_when_flow_control_is_enabled"},
         {test_noteserial_arduino_receive_invokes_hardware_serial_read, "test_noteserial_arduino_receive_invokes_hardware_serial_read"},
         {test_noteserial_arduino_receive_does_not_modify_hardware_serial_read_result_value_before_returning_to_caller, "test_noteserial_arduino_receive_does_not_modify_hardware_serial_read_result_value_before_returning_to_caller"},
+        {test_noteserial_arduino_receivebulk_reads_available_bytes_through_the_end_of_packet_character, "test_noteserial_arduino_receivebulk_reads_available_bytes_through_the_end_of_packet_character"},
+        {test_noteserial_arduino_receivebulk_does_not_read_beyond_the_size_of_the_buffer, "test_noteserial_arduino_receivebulk_does_not_read_beyond_the_size_of_the_buffer"},
         {test_noteserial_arduino_reset_invokes_hardware_serial_begin, "test_noteserial_arduino_reset_invokes_hardware_serial_begin"},
         {test_noteserial_arduino_reset_invokes_hardware_serial_begin_with_the_baud_parameter_that_was_originally_supplied_to_the_constructor, "test_noteserial_arduino_reset_invokes_hardware_serial_begin_with_the_baud_parameter_that_was_originally_supplied_to_the_constructor"},
         {test_noteserial_arduino_reset_invokes_hardware_serial_end, "test_noteserial_arduino_reset_invokes_hardware_serial_end"},
         {test_noteserial_arduino_reset_always_returns_true, "test_noteserial_arduino_reset_always_returns_true"},
+        {test_noteserial_arduino_setFlowControl_configures_the_cts_pin_as_an_input, "test_noteserial_arduino_setFlowControl_configures_the_cts_pin_as_an_input"},
         {test_noteserial_arduino_transmit_invokes_hardware_serial_write, "test_noteserial_arduino_transmit_invokes_hardware_serial_write"},
         {test_noteserial_arduino_transmit_does_not_modify_buffer_parameter_value_before_passing_to_hardware_serial_write, "test_noteserial_arduino_transmit_does_not_modify_buffer_parameter_value_before_passing_to_hardware_serial_write"},
         {test_noteserial_arduino_transmit_does_not_modify_size_parameter_value_before_passing_to_hardware_serial_write, "test_noteserial_arduino_transmit_does_not_modify_size_parameter_value_before_passing_to_hardware_serial_write"},
@@ -38,7 +38,7 @@ int test_make_note_txn_instantiates_notetxn_object()
   return result;
 }
 
-int test_make_note_txn_enforces_singleton_by_returning_same_notetxn_object_for_all_calls()
+int test_make_note_txn_enforces_singleton_by_returning_same_notetxn_object_for_the_same_pins()
 {
   int result;
 
@@ -47,7 +47,7 @@ int test_make_note_txn_enforces_singleton_by_returning_same_notetxn_object_for_a
   NoteTxn * const notetxn_1 = make_note_txn(txn_pins_1);
 
   // Action
-  uint8_t txn_pins_2[2] = {9, 17};
+  uint8_t txn_pins_2[2] = {19, 79};
   NoteTxn * const notetxn_2 = make_note_txn(txn_pins_2);
 
   // Assert
@@ -70,6 +70,39 @@ int test_make_note_txn_enforces_singleton_by_returning_same_notetxn_object_for_a
   return result;
 }
 
+int test_make_note_txn_returns_a_separate_notetxn_object_for_each_pair_of_pins()
+{
+  int result;
+
+  // Arrange
+  uint8_t txn_pins_1[2] = {19, 79};
+  NoteTxn * const notetxn_1 = make_note_txn(txn_pins_1);
+
+  // Action
+  uint8_t txn_pins_2[2] = {9, 17};
+  NoteTxn * const notetxn_2 = make_note_txn(txn_pins_2);
+
+  // Assert
+  if (nullptr != notetxn_1
+   && nullptr != notetxn_2
+   && notetxn_1 != notetxn_2)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('t' + 'x' + 'n');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tnotetxn_1 == " << std::hex << notetxn_1 << ", notetxn_2 == " << notetxn_2 << ", EXPECTED: different, not nullptr" << std::endl;
+    std::cout << "[";
+  }
+
+  // Clean-up
+  make_note_txn(nullptr);
+
+  return result;
+}
+
 //int test_make_note_txn_returns_nullptr_when_same_pins_are_passed_as_parameter()
 int test_make_note_txn_deletes_singleton_when_same_pins_are_passed_as_parameter()
 {
@@ -608,7 +641,8 @@ int main(void)
 {
   TestFunction tests[] = {
       {test_make_note_txn_instantiates_notetxn_object, "test_make_note_txn_instantiates_notetxn_object"},
-      {test_make_note_txn_enforces_singleton_by_returning_same_notetxn_object_for_all_calls, "test_make_note_txn_enforces_singleton_by_returning_same_notetxn_object_for_all_calls"},
+      {test_make_note_txn_enforces_singleton_by_returning_same_notetxn_object_for_the_same_pins, "test_make_note_txn_enforces_singleton_by_returning_same_notetxn_object_for_the_same_pins"},
+      {test_make_note_txn_returns_a_separate_notetxn_object_for_each_pair_of_pins, "test_make_note_txn_returns_a_separate_notetxn_object_for_each_pair_of_pins"},
       {test_make_note_txn_deletes_singleton_when_same_pins_are_passed_as_parameter, "test_make_note_txn_deletes_singleton_when_same_pins_are_passed_as_parameter"},
       {test_notetxn_arduino_constructor_floats_ctx_pin, "test_notetxn_arduino_constructor_floats_ctx_pin"},
       {test_notetxn_arduino_constructor_floats_rtx_pin, "test_notetxn_arduino_constructor_floats_rtx_pin"},
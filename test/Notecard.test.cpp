@@ -2,6 +2,9 @@
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 #include "TestFunction.hpp"
 
@@ -12,7 +15,7 @@
 #include "mock/NoteSerial_Mock.hpp"
 #include "mock/NoteTxn_Mock.hpp"
 
-// Compile command: g++ -Wall -Wextra -Wpedantic mock/mock-arduino.cpp mock/mock-note-c-note.c mock/NoteI2c_Mock.cpp mock/NoteLog_Mock.cpp mock/NoteSerial_Mock.cpp mock/NoteTime_Mock.cpp mock/NoteTxn_Mock.cpp ../src/Notecard.cpp Notecard.test.cpp -std=c++11 -I. -I../src -DNOTE_MOCK -ggdb -O0 -o notecard.tests && ./notecard.tests || echo "Tests Result: $?"
+// Compile command: g++ -Wall -Wextra -Wpedantic mock/mock-arduino.cpp mock/mock-note-c-note.c mock/NoteI2c_Mock.cpp mock/NoteLog_Mock.cpp mock/NoteSerial_Mock.cpp mock/NoteTime_Mock.cpp mock/NoteTxn_Mock.cpp ../src/Notecard.cpp ../src/NoteRing.cpp Notecard.test.cpp -std=c++11 -I. -I../src -DNOTE_MOCK -ggdb -O0 -o notecard.tests && ./notecard.tests || echo "Tests Result: $?"
 
 int test_notecard_begin_i2c_sets_user_agent_to_note_arduino()
 {
@@ -1381,6 +1384,81 @@ int test_notecard_begin_serial_sets_serial_receive_function_pointer_to_nullptr_w
   return result;
 }
 
+int test_notecard_begin_serial_shares_a_serial_receive_bulk_function_pointer_when_the_default_serial_hooks_are_in_use()
+{
+  int result;
+
+   // Arrange
+  ////////////
+
+  Notecard notecard;
+  NoteSerial_Mock mockSerial;  // Instantiate NoteSerial (mocked)
+  notecard.begin(&mockSerial);
+  noteGetFnSerial_Parameters.reset();
+  noteGetFnSerial_Parameters.receiveFn_result = noteSetFnSerialDefault_Parameters.readfn;  // Report the default serial hooks as active
+  noteSetFnSerialReceiveBulk_Parameters.reset();
+
+   // Action
+  ///////////
+
+  notecard.begin(&mockSerial);
+
+   // Assert
+  ///////////
+
+  if (noteSetFnSerialReceiveBulk_Parameters.receivebulkfn)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tnoteSetFnSerialReceiveBulk_Parameters.receivebulkfn == " << !!noteSetFnSerialReceiveBulk_Parameters.receivebulkfn << ", EXPECTED: not 0 (`nullptr`)" << std::endl;
+    std::cout << "[";
+  }
+
+  noteGetFnSerial_Parameters.reset();
+  return result;
+}
+
+int test_notecard_begin_serial_does_not_share_a_serial_receive_bulk_function_pointer_when_the_serial_hooks_have_been_overridden()
+{
+  int result;
+
+   // Arrange
+  ////////////
+
+  Notecard notecard;
+  NoteSerial_Mock mockSerial;  // Instantiate NoteSerial (mocked)
+  noteGetFnSerial_Parameters.reset();
+  noteGetFnSerial_Parameters.receiveFn_result = reinterpret_cast<serialReceiveFn>(0x19790917);  // User-supplied serial hooks
+  noteSetFnSerialReceiveBulk_Parameters.reset();
+
+   // Action
+  ///////////
+
+  notecard.begin(&mockSerial);
+
+   // Assert
+  ///////////
+
+  if (!noteSetFnSerialReceiveBulk_Parameters.invoked)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tnoteSetFnSerialReceiveBulk_Parameters.invoked == " << noteSetFnSerialReceiveBulk_Parameters.invoked << ", EXPECTED: zero (0)" << std::endl;
+    std::cout << "[";
+  }
+
+  noteGetFnSerial_Parameters.reset();
+  return result;
+}
+
 int test_notecard_end_does_not_call_wire_end_when_the_i2c_interface_has_not_been_instantiated()
 {
   int result;
@@ -2039,6 +2117,234 @@ int test_notecard_setFnNoteMutex_does_not_modify_unlocking_mutex_func_parameter_
   return result;
 }
 
+int test_notecard_setFnResponseWait_does_not_modify_wait_func_parameter_value_before_passing_to_note_c()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  const responseWaitFn waitFn = reinterpret_cast<responseWaitFn>(0x19790917);
+  Notecard notecard;
+  noteSetFnResponseWait_Parameters.reset();
+
+   // Action
+  ///////////
+
+  notecard.setFnResponseWait(waitFn);
+
+   // Assert
+  ///////////
+
+  if (waitFn == noteSetFnResponseWait_Parameters.waitFn)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\nnoteSetFnResponseWait_Parameters.waitFn == " << !!noteSetFnResponseWait_Parameters.waitFn << ", EXPECTED: not 0 (`nullptr`)" << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_notecard_setI2cBlockTransfer_passes_enable_parameter_to_the_i2c_interface()
+{
+  int result;
+
+   // Arrange
+  ////////////
+
+  Notecard notecard;
+  NoteI2c_Mock mockI2c;
+  notecard.begin(&mockI2c);
+  noteI2cSetBlockTransfer_Parameters.reset();
+  noteI2cSetBlockTransfer_Parameters.result = true;
+
+   // Action
+  ///////////
+
+  const bool ACTUAL_RESULT = notecard.setI2cBlockTransfer(true);
+
+   // Assert
+  ///////////
+
+  if (ACTUAL_RESULT
+   && noteI2cSetBlockTransfer_Parameters.invoked
+   && noteI2cSetBlockTransfer_Parameters.enable)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tnotecard.setI2cBlockTransfer(true) == " << ACTUAL_RESULT << ", EXPECTED: " << true << std::endl;
+    std::cout << "\tnoteI2cSetBlockTransfer_Parameters.invoked == " << noteI2cSetBlockTransfer_Parameters.invoked << ", EXPECTED: > 0" << std::endl;
+    std::cout << "\tnoteI2cSetBlockTransfer_Parameters.enable == " << noteI2cSetBlockTransfer_Parameters.enable << ", EXPECTED: true" << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_notecard_setI2cBlockTransfer_returns_false_without_an_i2c_interface()
+{
+  int result;
+
+   // Arrange
+  ////////////
+
+  Notecard notecard;
+  NoteSerial_Mock mockSerial;
+  notecard.begin(&mockSerial);
+  noteI2cSetBlockTransfer_Parameters.reset();
+  noteI2cSetBlockTransfer_Parameters.result = true;
+
+   // Action
+  ///////////
+
+  const bool ACTUAL_RESULT = notecard.setI2cBlockTransfer(true);
+
+   // Assert
+  ///////////
+
+  if (!ACTUAL_RESULT
+   && !noteI2cSetBlockTransfer_Parameters.invoked)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tnotecard.setI2cBlockTransfer(true) == " << ACTUAL_RESULT << ", EXPECTED: " << false << std::endl;
+    std::cout << "\tnoteI2cSetBlockTransfer_Parameters.invoked == " << noteI2cSetBlockTransfer_Parameters.invoked << ", EXPECTED: 0" << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_notecard_setI2cBusSharing_does_not_modify_enable_parameter_value_before_passing_to_note_c()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  Notecard notecard;
+  noteSetI2CBusSharing_Parameters.reset();
+
+   // Action
+  ///////////
+
+  notecard.setI2cBusSharing(true);
+
+   // Assert
+  ///////////
+
+  if (noteSetI2CBusSharing_Parameters.invoked && noteSetI2CBusSharing_Parameters.enable)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tnoteSetI2CBusSharing_Parameters.invoked == " << noteSetI2CBusSharing_Parameters.invoked << ", EXPECTED: 1" << std::endl;
+    std::cout << "\tnoteSetI2CBusSharing_Parameters.enable == " << noteSetI2CBusSharing_Parameters.enable << ", EXPECTED: true" << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_notecard_setSerialFlowControl_shares_a_clear_to_send_function_pointer_when_supported()
+{
+  int result;
+
+   // Arrange
+  ////////////
+
+  Notecard notecard;
+  NoteSerial_Mock mockSerial;
+  notecard.begin(&mockSerial);
+  noteSerialSetFlowControl_Parameters.reset();
+  noteSerialSetFlowControl_Parameters.result = true;
+  noteSetFnSerialFlowControl_Parameters.reset();
+
+   // Action
+  ///////////
+
+  const bool ACTUAL_RESULT = notecard.setSerialFlowControl(true, 17);
+
+   // Assert
+  ///////////
+
+  if (ACTUAL_RESULT
+   && noteSerialSetFlowControl_Parameters.enable
+   && 17 == noteSerialSetFlowControl_Parameters.cts_pin
+   && noteSetFnSerialFlowControl_Parameters.invoked
+   && noteSetFnSerialFlowControl_Parameters.cleartosendfn)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tnotecard.setSerialFlowControl() == " << ACTUAL_RESULT << ", EXPECTED: " << true << std::endl;
+    std::cout << "\tnoteSerialSetFlowControl_Parameters.cts_pin == " << static_cast<int>(noteSerialSetFlowControl_Parameters.cts_pin) << ", EXPECTED: 17" << std::endl;
+    std::cout << "\tnoteSetFnSerialFlowControl_Parameters.cleartosendfn == " << !!noteSetFnSerialFlowControl_Parameters.cleartosendfn << ", EXPECTED: not 0 (`nullptr`)" << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_notecard_setSerialFlowControl_clears_the_clear_to_send_function_pointer_when_unsupported()
+{
+  int result;
+
+   // Arrange
+  ////////////
+
+  Notecard notecard;
+  NoteSerial_Mock mockSerial;
+  notecard.begin(&mockSerial);
+  noteSerialSetFlowControl_Parameters.reset();
+  noteSerialSetFlowControl_Parameters.result = false;
+  noteSetFnSerialFlowControl_Parameters.reset();
+  noteSetFnSerialFlowControl_Parameters.cleartosendfn = reinterpret_cast<serialClearToSendFn>(0x19790917);
+
+   // Action
+  ///////////
+
+  const bool ACTUAL_RESULT = notecard.setSerialFlowControl(true, 17);
+
+   // Assert
+  ///////////
+
+  if (!ACTUAL_RESULT
+   && noteSetFnSerialFlowControl_Parameters.invoked
+   && !noteSetFnSerialFlowControl_Parameters.cleartosendfn)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tnotecard.setSerialFlowControl() == " << ACTUAL_RESULT << ", EXPECTED: " << false << std::endl;
+    std::cout << "\tnoteSetFnSerialFlowControl_Parameters.cleartosendfn == " << !!noteSetFnSerialFlowControl_Parameters.cleartosendfn << ", EXPECTED: 0 (`nullptr`)" << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
 int test_notecard_setTransactionPins_shares_a_transaction_start_function_pointer()
 {
   int result;
@@ -2541,7 +2847,7 @@ int test_notecard_requestAndResponse_does_not_modify_note_c_result_value_before_
   return result;
 }
 
-int test_notecard_requestAndResponseWithRetry_does_not_modify_j_object_parameter_value_before_passing_to_note_c()
+int test_notecard_requestAndResponseBatch_does_not_modify_j_object_parameter_value_before_passing_to_note_c()
 {
   int result;
 
@@ -2549,27 +2855,18 @@ int test_notecard_requestAndResponseWithRetry_does_not_modify_j_object_parameter
   ////////////
 
   Notecard notecard;
-  J *EXPECTED_JSON = reinterpret_cast<J *>(malloc(sizeof(J)));
-  J *json_cpy;
-  assert(nullptr != EXPECTED_JSON);
-
-  noteRequestResponseWithRetry_Parameters.reset();
-  memset(EXPECTED_JSON, 0x55, sizeof(J));
-  {
-    json_cpy = reinterpret_cast<J *>(malloc(sizeof(J)));
-    assert(nullptr != json_cpy);
-    memcpy(json_cpy, EXPECTED_JSON, sizeof(J));
-  }
+  J * EXPECTED_JSON = reinterpret_cast<J *>(0x19790917);
+  noteTransactionBatch_Parameters.reset();
 
    // Action
   ///////////
 
-  notecard.requestAndResponseWithRetry(json_cpy, 0);
+  notecard.requestAndResponseBatch(EXPECTED_JSON);
 
    // Assert
   ///////////
 
-  if (!memcmp(EXPECTED_JSON, noteRequestResponseWithRetry_Parameters.req, sizeof(J)))
+  if (EXPECTED_JSON == noteTransactionBatch_Parameters.reqs)
   {
     result = 0;
   }
@@ -2577,12 +2874,128 @@ int test_notecard_requestAndResponseWithRetry_does_not_modify_j_object_parameter
   {
     result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
     std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
-    std::cout << "\tnoteRequestResponseWithRetry_Parameters.req != EXPECTED_JSON" << std::endl;
+    std::cout << "\tnoteTransactionBatch_Parameters.reqs == " << noteTransactionBatch_Parameters.reqs << ", EXPECTED: " << EXPECTED_JSON << std::endl;
     std::cout << "[";
   }
 
-  free(json_cpy);
-  free(EXPECTED_JSON);
+  return result;
+}
+
+int test_notecard_requestAndResponseBatch_deletes_the_request_array_after_the_batch_completes()
+{
+  int result;
+
+   // Arrange
+  ////////////
+
+  Notecard notecard;
+  J * EXPECTED_JSON = reinterpret_cast<J *>(0x19790917);
+  jDelete_Parameters.reset();
+  noteTransactionBatch_Parameters.reset();
+
+   // Action
+  ///////////
+
+  notecard.requestAndResponseBatch(EXPECTED_JSON);
+
+   // Assert
+  ///////////
+
+  if (1 == noteTransactionBatch_Parameters.invoked
+   && 1 == jDelete_Parameters.invoked
+   && EXPECTED_JSON == jDelete_Parameters.item)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tjDelete_Parameters.invoked == " << jDelete_Parameters.invoked << ", EXPECTED: 1" << std::endl;
+    std::cout << "\tjDelete_Parameters.item == " << jDelete_Parameters.item << ", EXPECTED: " << EXPECTED_JSON << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_notecard_requestAndResponseBatch_does_not_modify_note_c_result_value_before_returning_to_caller()
+{
+  int result;
+
+   // Arrange
+  ////////////
+
+  Notecard notecard;
+  J * EXPECTED_JSON = reinterpret_cast<J *>(0x19790917);
+  noteTransactionBatch_Parameters.reset();
+  noteTransactionBatch_Parameters.result = EXPECTED_JSON;
+
+   // Action
+  ///////////
+
+  const J * const ACTUAL_RESULT = notecard.requestAndResponseBatch(nullptr);
+
+   // Assert
+  ///////////
+
+  if (EXPECTED_JSON == ACTUAL_RESULT)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tnotecard.requestAndResponseBatch(nullptr) == " << ACTUAL_RESULT << ", EXPECTED: " << EXPECTED_JSON << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_notecard_requestAndResponseWithRetry_does_not_modify_j_object_parameter_value_before_passing_to_note_c()
+{
+  int result;
+
+   // Arrange
+  ////////////
+
+  Notecard notecard;
+  J *EXPECTED_JSON = reinterpret_cast<J *>(malloc(sizeof(J)));
+  J *json_cpy;
+  assert(nullptr != EXPECTED_JSON);
+
+  noteRequestResponseWithRetry_Parameters.reset();
+  memset(EXPECTED_JSON, 0x55, sizeof(J));
+  {
+    json_cpy = reinterpret_cast<J *>(malloc(sizeof(J)));
+    assert(nullptr != json_cpy);
+    memcpy(json_cpy, EXPECTED_JSON, sizeof(J));
+  }
+
+   // Action
+  ///////////
+
+  notecard.requestAndResponseWithRetry(json_cpy, 0);
+
+   // Assert
+  ///////////
+
+  if (!memcmp(EXPECTED_JSON, noteRequestResponseWithRetry_Parameters.req, sizeof(J)))
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tnoteRequestResponseWithRetry_Parameters.req != EXPECTED_JSON" << std::endl;
+    std::cout << "[";
+  }
+
+  free(json_cpy);
+  free(EXPECTED_JSON);
   return result;
 }
 
@@ -2642,12 +3055,814 @@ int test_notecard_requestAndResponseWithRetry_does_not_modify_note_c_result_valu
    // Action
   ///////////
 
-  const J * const ACTUAL_RESULT = notecard.requestAndResponseWithRetry(nullptr, 0);
+  const J * const ACTUAL_RESULT = notecard.requestAndResponseWithRetry(nullptr, 0);
+
+   // Assert
+  ///////////
+
+  if (!memcmp(EXPECTED_JSON, ACTUAL_RESULT, sizeof(J)))
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tnotecard.requestAndResponseWithRetry(nullptr, 0) != EXPECTED_JSON" << std::endl;
+    std::cout << "[";
+  }
+
+  free(noteRequestResponseWithRetry_Parameters.result);
+  free(EXPECTED_JSON);
+  return result;
+}
+
+int test_notecard_requestAsync_does_not_modify_parameter_values_before_passing_to_note_c()
+{
+  int result;
+
+   // Arrange
+  ////////////
+
+  Notecard notecard;
+  NoteTransactionAsync txn;
+  J * EXPECTED_JSON = reinterpret_cast<J *>(0x19790917);
+  noteTransactionAsyncBegin_Parameters.reset();
+
+   // Action
+  ///////////
+
+  notecard.requestAsync(&txn, EXPECTED_JSON);
+
+   // Assert
+  ///////////
+
+  if (&txn == noteTransactionAsyncBegin_Parameters.txn
+   && EXPECTED_JSON == noteTransactionAsyncBegin_Parameters.req)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tnoteTransactionAsyncBegin_Parameters.txn == " << noteTransactionAsyncBegin_Parameters.txn << ", EXPECTED: " << &txn << std::endl;
+    std::cout << "\tnoteTransactionAsyncBegin_Parameters.req == " << noteTransactionAsyncBegin_Parameters.req << ", EXPECTED: " << EXPECTED_JSON << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_notecard_requestAsync_deletes_the_request_after_passing_it_to_note_c()
+{
+  int result;
+
+   // Arrange
+  ////////////
+
+  Notecard notecard;
+  NoteTransactionAsync txn;
+  J * EXPECTED_JSON = reinterpret_cast<J *>(0x19790917);
+  jDelete_Parameters.reset();
+  noteTransactionAsyncBegin_Parameters.reset();
+
+   // Action
+  ///////////
+
+  notecard.requestAsync(&txn, EXPECTED_JSON);
+
+   // Assert
+  ///////////
+
+  if (1 == noteTransactionAsyncBegin_Parameters.invoked
+   && 1 == jDelete_Parameters.invoked
+   && EXPECTED_JSON == jDelete_Parameters.item)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tjDelete_Parameters.invoked == " << jDelete_Parameters.invoked << ", EXPECTED: 1" << std::endl;
+    std::cout << "\tjDelete_Parameters.item == " << jDelete_Parameters.item << ", EXPECTED: " << EXPECTED_JSON << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_notecard_pollAsync_does_not_modify_note_c_result_value_before_returning_to_caller()
+{
+  int result;
+
+   // Arrange
+  ////////////
+
+  Notecard notecard;
+  NoteTransactionAsync txn;
+  const bool EXPECTED_RESULT = true;
+  noteTransactionAsyncPoll_Parameters.reset();
+  noteTransactionAsyncPoll_Parameters.result = EXPECTED_RESULT;
+
+   // Action
+  ///////////
+
+  const bool ACTUAL_RESULT = notecard.pollAsync(&txn);
+
+   // Assert
+  ///////////
+
+  if (EXPECTED_RESULT == ACTUAL_RESULT
+   && &txn == noteTransactionAsyncPoll_Parameters.txn)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tnotecard.pollAsync(&txn) == " << ACTUAL_RESULT << ", EXPECTED: " << EXPECTED_RESULT << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+static void pumpNotesRecordFn(J *, const void *record_, void *context_)
+{
+  // Remember the order in which the records were described
+  uint8_t *described = static_cast<uint8_t *>(context_);
+  described[described[0]++ + 1] = *static_cast<const uint8_t *>(record_);
+}
+
+static void pumpNotesArrange(NoteRing &ring_, uint8_t records_)
+{
+  jAddItemToArray_Parameters.reset();
+  jAddItemToObject_Parameters.reset();
+  jAddStringToObject_Parameters.reset();
+  jCreateArray_Parameters.reset();
+  jCreateArray_Parameters.result = reinterpret_cast<J *>(0x19790917);
+  jCreateObject_Parameters.reset();
+  jCreateObject_Parameters.result = reinterpret_cast<J *>(0x19790918);
+  jDelete_Parameters.reset();
+  jGetArrayItem_Parameters.reset();
+  jGetArrayItem_Parameters.result = reinterpret_cast<J *>(0x19790919);
+  noteNewRequest_Parameters.reset();
+  noteNewRequest_Parameters.result = reinterpret_cast<J *>(0x19790920);
+  noteResponseError_Parameters.reset();
+  noteTransactionBatch_Parameters.reset();
+  noteTransactionBatchUntilError_Parameters.reset();
+  noteTransactionBatchUntilError_Parameters.result = reinterpret_cast<J *>(0x19790921);
+
+  for (uint8_t record = 1 ; record <= records_ ; ++record) {
+    ring_.push(&record);
+  }
+}
+
+int test_notecard_pumpNotes_sends_waiting_records_as_a_single_batch_of_note_add_requests()
+{
+  int result;
+
+   // Arrange
+  ////////////
+
+  Notecard notecard;
+  NoteRingBuffer<1, 4> ring;
+  uint8_t described[5] = {0};
+  pumpNotesArrange(ring, 3);
+
+   // Action
+  ///////////
+
+  const size_t ACTUAL_RESULT = notecard.pumpNotes(ring, "sensor.qo", pumpNotesRecordFn, described);
+
+   // Assert
+  ///////////
+
+  if (3 == ACTUAL_RESULT
+   && 1 == noteTransactionBatchUntilError_Parameters.invoked
+   && jCreateArray_Parameters.result == noteTransactionBatchUntilError_Parameters.reqs
+   && 0 == noteTransactionBatch_Parameters.invoked
+   && 3 == jAddItemToArray_Parameters.invoked
+   && !strcmp("note.add", noteNewRequest_Parameters.request_cache.c_str())
+   && 3 == jAddStringToObject_Parameters.invoked
+   && "file" == jAddStringToObject_Parameters.name[2]
+   && "sensor.qo" == jAddStringToObject_Parameters.string[2]
+   && "body" == jAddItemToObject_Parameters.string
+   && 3 == described[0] && 1 == described[1] && 2 == described[2] && 3 == described[3])
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tnotecard.pumpNotes(ring, \"sensor.qo\", pumpNotesRecordFn, described) == " << ACTUAL_RESULT << ", EXPECTED: 3" << std::endl;
+    std::cout << "\tnoteTransactionBatchUntilError_Parameters.invoked == " << noteTransactionBatchUntilError_Parameters.invoked << ", EXPECTED: 1" << std::endl;
+    std::cout << "\tnoteTransactionBatch_Parameters.invoked == " << noteTransactionBatch_Parameters.invoked << ", EXPECTED: 0 (the batch stops at the first failure)" << std::endl;
+    std::cout << "\tjAddItemToArray_Parameters.invoked == " << jAddItemToArray_Parameters.invoked << ", EXPECTED: 3" << std::endl;
+    std::cout << "\tjAddStringToObject_Parameters.invoked == " << jAddStringToObject_Parameters.invoked << ", EXPECTED: 3" << std::endl;
+    std::cout << "\tdescribed == {" << static_cast<int>(described[1]) << ", " << static_cast<int>(described[2]) << ", " << static_cast<int>(described[3]) << "}, EXPECTED: {1, 2, 3}" << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_notecard_pumpNotes_releases_records_once_they_have_been_sent()
+{
+  int result;
+
+   // Arrange
+  ////////////
+
+  Notecard notecard;
+  NoteRingBuffer<1, 4> ring;
+  uint8_t described[5] = {0};
+  pumpNotesArrange(ring, 3);
+
+   // Action
+  ///////////
+
+  notecard.pumpNotes(ring, "sensor.qo", pumpNotesRecordFn, described);
+
+   // Assert
+  ///////////
+
+  if (0 == ring.count()
+   && noteTransactionBatchUntilError_Parameters.result == jDelete_Parameters.item)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tring.count() == " << ring.count() << ", EXPECTED: 0" << std::endl;
+    std::cout << "\tjDelete_Parameters.item == " << jDelete_Parameters.item << ", EXPECTED: " << noteTransactionBatchUntilError_Parameters.result << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_notecard_pumpNotes_keeps_records_when_the_batch_fails()
+{
+  int result;
+
+   // Arrange
+  ////////////
+
+  Notecard notecard;
+  NoteRingBuffer<1, 4> ring;
+  uint8_t described[5] = {0};
+  pumpNotesArrange(ring, 3);
+  noteTransactionBatchUntilError_Parameters.result = nullptr;
+
+   // Action
+  ///////////
+
+  const size_t ACTUAL_RESULT = notecard.pumpNotes(ring, "sensor.qo", pumpNotesRecordFn, described);
+
+   // Assert
+  ///////////
+
+  if (0 == ACTUAL_RESULT
+   && 3 == ring.count()
+   && 1 == *static_cast<const uint8_t *>(ring.peek()))
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tnotecard.pumpNotes(ring, \"sensor.qo\", pumpNotesRecordFn, described) == " << ACTUAL_RESULT << ", EXPECTED: 0" << std::endl;
+    std::cout << "\tring.count() == " << ring.count() << ", EXPECTED: 3" << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_notecard_pumpNotes_keeps_records_when_the_notecard_returns_an_error()
+{
+  int result;
+
+   // Arrange
+  ////////////
+
+  Notecard notecard;
+  NoteRingBuffer<1, 4> ring;
+  uint8_t described[5] = {0};
+  pumpNotesArrange(ring, 3);
+  noteResponseError_Parameters.result = true;
+
+   // Action
+  ///////////
+
+  const size_t ACTUAL_RESULT = notecard.pumpNotes(ring, "sensor.qo", pumpNotesRecordFn, described);
+
+   // Assert
+  ///////////
+
+  if (0 == ACTUAL_RESULT
+   && 3 == ring.count())
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tnotecard.pumpNotes(ring, \"sensor.qo\", pumpNotesRecordFn, described) == " << ACTUAL_RESULT << ", EXPECTED: 0" << std::endl;
+    std::cout << "\tring.count() == " << ring.count() << ", EXPECTED: 3" << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_notecard_pumpNotes_sends_no_more_than_max_records_in_a_batch()
+{
+  int result;
+
+   // Arrange
+  ////////////
+
+  Notecard notecard;
+  NoteRingBuffer<1, 4> ring;
+  uint8_t described[5] = {0};
+  pumpNotesArrange(ring, 3);
+
+   // Action
+  ///////////
+
+  const size_t ACTUAL_RESULT = notecard.pumpNotes(ring, nullptr, pumpNotesRecordFn, described, 2);
+
+   // Assert
+  ///////////
+
+  if (2 == ACTUAL_RESULT
+   && 2 == jAddItemToArray_Parameters.invoked
+   && 0 == jAddStringToObject_Parameters.invoked
+   && 1 == ring.count()
+   && 3 == *static_cast<const uint8_t *>(ring.peek()))
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tnotecard.pumpNotes(ring, nullptr, pumpNotesRecordFn, described, 2) == " << ACTUAL_RESULT << ", EXPECTED: 2" << std::endl;
+    std::cout << "\tjAddItemToArray_Parameters.invoked == " << jAddItemToArray_Parameters.invoked << ", EXPECTED: 2" << std::endl;
+    std::cout << "\tjAddStringToObject_Parameters.invoked == " << jAddStringToObject_Parameters.invoked << ", EXPECTED: 0" << std::endl;
+    std::cout << "\tring.count() == " << ring.count() << ", EXPECTED: 1" << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_notecard_pumpNotes_does_not_send_a_batch_when_no_records_are_waiting()
+{
+  int result;
+
+   // Arrange
+  ////////////
+
+  Notecard notecard;
+  NoteRingBuffer<1, 4> ring;
+  uint8_t described[5] = {0};
+  pumpNotesArrange(ring, 0);
+
+   // Action
+  ///////////
+
+  const size_t ACTUAL_RESULT = notecard.pumpNotes(ring, "sensor.qo", pumpNotesRecordFn, described);
+
+   // Assert
+  ///////////
+
+  if (0 == ACTUAL_RESULT
+   && 0 == jCreateArray_Parameters.invoked
+   && 0 == noteTransactionBatchUntilError_Parameters.invoked)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tnotecard.pumpNotes(ring, \"sensor.qo\", pumpNotesRecordFn, described) == " << ACTUAL_RESULT << ", EXPECTED: 0" << std::endl;
+    std::cout << "\tnoteTransactionBatchUntilError_Parameters.invoked == " << noteTransactionBatchUntilError_Parameters.invoked << ", EXPECTED: 0" << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_notecard_pumpNotes_activates_its_instance_before_describing_records()
+{
+  int result;
+
+   // Arrange
+  ////////////
+
+  Notecard notecard1;
+  Notecard notecard2;
+  NoteSerial_Mock mockSerial1;
+  NoteSerial_Mock mockSerial2;
+  NoteRingBuffer<1, 4> ring;
+  uint8_t described[5] = {0};
+  notecard1.begin(&mockSerial1);
+  notecard2.begin(&mockSerial2);
+  pumpNotesArrange(ring, 0);
+  noteContextSave_Parameters.reset();
+
+   // Action
+  ///////////
+
+  notecard1.pumpNotes(ring, "sensor.qo", pumpNotesRecordFn, described);
+
+   // Assert
+  ///////////
+
+  if (1 == noteContextSave_Parameters.invoked)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tnoteContextSave_Parameters.invoked == " << noteContextSave_Parameters.invoked << ", EXPECTED: 1" << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_notecard_finishAsync_does_not_modify_note_c_result_value_before_returning_to_caller()
+{
+  int result;
+
+   // Arrange
+  ////////////
+
+  Notecard notecard;
+  NoteTransactionAsync txn;
+  J * EXPECTED_JSON = reinterpret_cast<J *>(0x19790917);
+  noteTransactionAsyncEnd_Parameters.reset();
+  noteTransactionAsyncEnd_Parameters.result = EXPECTED_JSON;
+
+   // Action
+  ///////////
+
+  const J * const ACTUAL_RESULT = notecard.finishAsync(&txn);
+
+   // Assert
+  ///////////
+
+  if (EXPECTED_JSON == ACTUAL_RESULT
+   && &txn == noteTransactionAsyncEnd_Parameters.txn)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tnotecard.finishAsync(&txn) == " << ACTUAL_RESULT << ", EXPECTED: " << EXPECTED_JSON << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_notecard_deleteResponse_does_not_modify_j_object_parameter_pointer_before_passing_to_note_c()
+{
+  int result;
+
+   // Arrange
+  ////////////
+
+  Notecard notecard;
+  J *const EXPECTED_POINTER = reinterpret_cast<J *>(0x19790917);
+
+  noteDeleteResponse_Parameters.reset();
+
+   // Action
+  ///////////
+
+  notecard.deleteResponse(EXPECTED_POINTER);
+
+   // Assert
+  ///////////
+
+  if (EXPECTED_POINTER == noteDeleteResponse_Parameters.response)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tnoteDeleteResponse_Parameters.response == " << std::hex << noteDeleteResponse_Parameters.response << ", EXPECTED: " << EXPECTED_POINTER << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_notecard_logDebug_does_not_modify_string_parameter_value_before_passing_to_note_c()
+{
+  int result;
+
+   // Arrange
+  ////////////
+
+  const char str[] = "Hello, Test!";
+  Notecard notecard;
+
+  noteDebug_Parameters.reset();
+
+   // Action
+  ///////////
+
+  notecard.logDebug(str);
+
+   // Assert
+  ///////////
+
+  if (!strcmp(str, noteDebug_Parameters.message_cache.c_str()))
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tnoteDebug_Parameters.message_cache.c_str() == \"" << noteDebug_Parameters.message_cache.c_str() << "\", EXPECTED: \"" << str << "\"" << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_notecard_logDebugf_does_not_modify_string_parameter_value_before_passing_to_note_c()
+{
+  int result;
+
+   // Arrange
+  ////////////
+
+  const char str[] = "Hello, Test 123!";
+  Notecard notecard;
+
+  noteDebug_Parameters.reset();
+
+   // Action
+  ///////////
+
+  notecard.logDebugf("Hello, %s %d%c", "Test", 123, '!');
+
+   // Assert
+  ///////////
+
+  if (!strcmp(str, noteDebug_Parameters.message_cache.c_str()))
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tnoteDebug_Parameters.message_cache.c_str() == \"" << noteDebug_Parameters.message_cache.c_str() << "\", EXPECTED: \"" << str << "\"" << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_notecard_debugSyncStatus_does_not_modify_pollFrequencyMs_parameter_before_passing_to_note_c()
+{
+  int result;
+
+   // Arrange
+  ////////////
+
+  Notecard notecard;
+  const int EXPECTED_RESULT = 79;
+
+  noteDebugSyncStatus_Parameters.reset();
+
+   // Action
+  ///////////
+
+  notecard.debugSyncStatus(EXPECTED_RESULT, 0);
+
+   // Assert
+  ///////////
+
+  if (EXPECTED_RESULT == noteDebugSyncStatus_Parameters.pollFrequencyMs)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tnoteDebugSyncStatus_Parameters.pollFrequencyMs == " << noteDebugSyncStatus_Parameters.pollFrequencyMs << ", EXPECTED: " << EXPECTED_RESULT << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_notecard_debugSyncStatus_does_not_modify_maxLevel_parameter_before_passing_to_note_c()
+{
+  int result;
+
+   // Arrange
+  ////////////
+
+  Notecard notecard;
+  const int EXPECTED_RESULT = 79;
+
+  noteDebugSyncStatus_Parameters.reset();
+
+   // Action
+  ///////////
+
+  notecard.debugSyncStatus(0, EXPECTED_RESULT);
+
+   // Assert
+  ///////////
+
+  if (EXPECTED_RESULT == noteDebugSyncStatus_Parameters.maxLevel)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tnoteDebugSyncStatus_Parameters.maxLevel == " << noteDebugSyncStatus_Parameters.maxLevel << ", EXPECTED: " << EXPECTED_RESULT << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_notecard_debugSyncStatus_does_not_modify_note_c_result_value_before_returning_to_caller()
+{
+  int result;
+
+   // Arrange
+  ////////////
+
+  Notecard notecard;
+  const bool EXPECTED_RESULT = true;
+
+  noteDebugSyncStatus_Parameters.reset();
+  noteDebugSyncStatus_Parameters.result = EXPECTED_RESULT;
+
+   // Action
+  ///////////
+
+  const bool ACTUAL_RESULT = notecard.debugSyncStatus(0, 0);
+
+   // Assert
+  ///////////
+
+  if (EXPECTED_RESULT == ACTUAL_RESULT)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tnotecard.debugSyncStatus(0, 0) == " << ACTUAL_RESULT << ", EXPECTED: " << EXPECTED_RESULT << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_notecard_responseError_does_not_modify_j_object_parameter_value_before_passing_to_note_c()
+{
+  int result;
+
+   // Arrange
+  ////////////
+
+  Notecard notecard;
+  J * EXPECTED_JSON = reinterpret_cast<J *>(malloc(sizeof(J))); // JCreateObject();
+  J * json_cpy;
+  assert(nullptr != EXPECTED_JSON);
+
+  noteResponseError_Parameters.reset();
+  memset(EXPECTED_JSON, 0x55, sizeof(J)); //assert(nullptr != JAddStringToObject(EXPECTED_JSON,"key1", "value1"));
+  {
+    json_cpy = reinterpret_cast<J *>(malloc(sizeof(J)));
+    assert(nullptr != json_cpy);
+    memcpy(json_cpy, EXPECTED_JSON, sizeof(J));
+  } //assert(nullptr != (json_cpy = JDuplicate(EXPECTED_JSON,true)));
+
+   // Action
+  ///////////
+
+  notecard.responseError(json_cpy);
+
+   // Assert
+  ///////////
+
+  if (!memcmp(EXPECTED_JSON, noteResponseError_Parameters.rsp, sizeof(J)) /*JCompare(EXPECTED_JSON, noteRequestResponse_Parameters.rsp, false)*/)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tnoteResponseError_Parameters.rsp != EXPECTED_JSON" << std::endl;
+    std::cout << "[";
+  }
+
+  free(json_cpy);
+  free(EXPECTED_JSON);
+  return result;
+}
+
+int test_notecard_responseError_does_not_modify_note_c_result_value_before_returning_to_caller()
+{
+  int result;
+
+   // Arrange
+  ////////////
+
+  Notecard notecard;
+  const bool EXPECTED_RESULT = true;
+
+  noteResponseError_Parameters.reset();
+  noteResponseError_Parameters.result = EXPECTED_RESULT;
+
+   // Action
+  ///////////
+
+  const bool ACTUAL_RESULT = notecard.responseError(nullptr);
+
+   // Assert
+  ///////////
+
+  if (EXPECTED_RESULT == ACTUAL_RESULT)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tnotecard.responseError(nullptr) == " << ACTUAL_RESULT << ", EXPECTED: " << EXPECTED_RESULT << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+#ifdef NOTE_C_METRICS
+int test_notecard_getMetrics_returns_the_metrics_collected_by_note_c()
+{
+  int result;
+
+   // Arrange
+  ////////////
+
+  Notecard notecard;
+  NoteMetrics metrics{};
+  noteGetMetrics_Parameters.reset();
+  noteResetMetrics_Parameters.reset();
+  noteGetMetrics_Parameters.result.transactions = 17;
+  noteGetMetrics_Parameters.result.phases[NOTE_METRICS_PHASE_RECEIVE].buckets[3] = 9;
+
+   // Action
+  ///////////
+
+  notecard.getMetrics(&metrics);
 
    // Assert
   ///////////
 
-  if (!memcmp(EXPECTED_JSON, ACTUAL_RESULT, sizeof(J)))
+  if (noteGetMetrics_Parameters.invoked
+   && &metrics == noteGetMetrics_Parameters.metrics
+   && 17 == metrics.transactions
+   && 9 == metrics.phases[NOTE_METRICS_PHASE_RECEIVE].buckets[3]
+   && !noteResetMetrics_Parameters.invoked)
   {
     result = 0;
   }
@@ -2655,16 +3870,16 @@ int test_notecard_requestAndResponseWithRetry_does_not_modify_note_c_result_valu
   {
     result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
     std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
-    std::cout << "\tnotecard.requestAndResponseWithRetry(nullptr, 0) != EXPECTED_JSON" << std::endl;
+    std::cout << "\tnoteGetMetrics_Parameters.invoked == " << noteGetMetrics_Parameters.invoked << ", EXPECTED: 1" << std::endl;
+    std::cout << "\tmetrics.transactions == " << metrics.transactions << ", EXPECTED: 17" << std::endl;
+    std::cout << "\tnoteResetMetrics_Parameters.invoked == " << noteResetMetrics_Parameters.invoked << ", EXPECTED: 0" << std::endl;
     std::cout << "[";
   }
 
-  free(noteRequestResponseWithRetry_Parameters.result);
-  free(EXPECTED_JSON);
   return result;
 }
 
-int test_notecard_deleteResponse_does_not_modify_j_object_parameter_pointer_before_passing_to_note_c()
+int test_notecard_getMetrics_resets_the_metrics_once_they_have_been_read()
 {
   int result;
 
@@ -2672,19 +3887,21 @@ int test_notecard_deleteResponse_does_not_modify_j_object_parameter_pointer_befo
   ////////////
 
   Notecard notecard;
-  J *const EXPECTED_POINTER = reinterpret_cast<J *>(0x19790917);
-
-  noteDeleteResponse_Parameters.reset();
+  NoteMetrics metrics{};
+  noteGetMetrics_Parameters.reset();
+  noteResetMetrics_Parameters.reset();
 
    // Action
   ///////////
 
-  notecard.deleteResponse(EXPECTED_POINTER);
+  notecard.getMetrics(&metrics, true);
 
    // Assert
   ///////////
 
-  if (EXPECTED_POINTER == noteDeleteResponse_Parameters.response)
+  if (noteGetMetrics_Parameters.invoked
+   && noteResetMetrics_Parameters.invoked
+   && noteResetMetrics_Parameters.afterGetMetrics)
   {
     result = 0;
   }
@@ -2692,34 +3909,36 @@ int test_notecard_deleteResponse_does_not_modify_j_object_parameter_pointer_befo
   {
     result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
     std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
-    std::cout << "\tnoteDeleteResponse_Parameters.response == " << std::hex << noteDeleteResponse_Parameters.response << ", EXPECTED: " << EXPECTED_POINTER << std::endl;
+    std::cout << "\tnoteResetMetrics_Parameters.invoked == " << noteResetMetrics_Parameters.invoked << ", EXPECTED: 1" << std::endl;
+    std::cout << "\tnoteResetMetrics_Parameters.afterGetMetrics == " << noteResetMetrics_Parameters.afterGetMetrics << ", EXPECTED: 1" << std::endl;
     std::cout << "[";
   }
 
   return result;
 }
+#endif
 
-int test_notecard_logDebug_does_not_modify_string_parameter_value_before_passing_to_note_c()
+int test_notecard_newCommand_does_not_modify_string_parameter_value_before_passing_to_note_c()
 {
   int result;
 
    // Arrange
   ////////////
 
-  const char str[] = "Hello, Test!";
   Notecard notecard;
+  const char EXPECTED_RESULT[] = "Hello, Test!";
 
-  noteDebug_Parameters.reset();
+  noteNewCommand_Parameters.reset();
 
    // Action
   ///////////
 
-  notecard.logDebug(str);
+  notecard.newCommand(EXPECTED_RESULT);
 
    // Assert
   ///////////
 
-  if (!strcmp(str, noteDebug_Parameters.message_cache.c_str()))
+  if (!strcmp(EXPECTED_RESULT, noteNewCommand_Parameters.request_cache.c_str()))
   {
     result = 0;
   }
@@ -2727,34 +3946,41 @@ int test_notecard_logDebug_does_not_modify_string_parameter_value_before_passing
   {
     result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
     std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
-    std::cout << "\tnoteDebug_Parameters.message_cache.c_str() == \"" << noteDebug_Parameters.message_cache.c_str() << "\", EXPECTED: \"" << str << "\"" << std::endl;
+    std::cout << "\tnoteNewCommand_Parameters.request_cache.c_str() == \"" << noteNewCommand_Parameters.request_cache.c_str() << "\", EXPECTED: \"" << EXPECTED_RESULT << "\"" << std::endl;
     std::cout << "[";
   }
 
   return result;
 }
 
-int test_notecard_logDebugf_does_not_modify_string_parameter_value_before_passing_to_note_c()
+int test_notecard_newCommand_does_not_modify_note_c_result_value_before_returning_to_caller()
 {
   int result;
 
    // Arrange
   ////////////
 
-  const char str[] = "Hello, Test 123!";
   Notecard notecard;
+  J * EXPECTED_JSON = reinterpret_cast<J *>(malloc(sizeof(J))); // JCreateObject();
+  assert(nullptr != EXPECTED_JSON);
 
-  noteDebug_Parameters.reset();
+  noteNewCommand_Parameters.reset();
+  memset(EXPECTED_JSON, 0x55, sizeof(J)); //assert(nullptr != JAddStringToObject(EXPECTED_JSON,"key1", "value1"));
+  {
+    noteNewCommand_Parameters.result = reinterpret_cast<J *>(malloc(sizeof(J)));
+    assert(nullptr != noteNewCommand_Parameters.result);
+    memcpy(noteNewCommand_Parameters.result, EXPECTED_JSON, sizeof(J));
+  } //assert(nullptr != (noteNewCommand_Parameters.result = JDuplicate(EXPECTED_JSON,true)));
 
    // Action
   ///////////
 
-  notecard.logDebugf("Hello, %s %d%c", "Test", 123, '!');
+  const J * const ACTUAL_RESULT = notecard.newCommand(nullptr);
 
    // Assert
   ///////////
 
-  if (!strcmp(str, noteDebug_Parameters.message_cache.c_str()))
+  if (!memcmp(EXPECTED_JSON, ACTUAL_RESULT, sizeof(J)) /*JCompare(EXPECTED_JSON, ACTUAL_RESULT, false)*/)
   {
     result = 0;
   }
@@ -2762,14 +3988,16 @@ int test_notecard_logDebugf_does_not_modify_string_parameter_value_before_passin
   {
     result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
     std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
-    std::cout << "\tnoteDebug_Parameters.message_cache.c_str() == \"" << noteDebug_Parameters.message_cache.c_str() << "\", EXPECTED: \"" << str << "\"" << std::endl;
+    std::cout << "\tnotecard.newCommand(nullptr) != EXPECTED_JSON" << std::endl;
     std::cout << "[";
   }
 
+  free(noteNewCommand_Parameters.result);
+  free(EXPECTED_JSON);
   return result;
 }
 
-int test_notecard_debugSyncStatus_does_not_modify_pollFrequencyMs_parameter_before_passing_to_note_c()
+int test_notecard_single_instance_does_not_switch_note_c_contexts()
 {
   int result;
 
@@ -2777,19 +4005,22 @@ int test_notecard_debugSyncStatus_does_not_modify_pollFrequencyMs_parameter_befo
   ////////////
 
   Notecard notecard;
-  const int EXPECTED_RESULT = 79;
-
-  noteDebugSyncStatus_Parameters.reset();
+  NoteSerial_Mock mockSerial;
+  noteContextRestore_Parameters.reset();
+  noteContextSave_Parameters.reset();
 
    // Action
   ///////////
 
-  notecard.debugSyncStatus(EXPECTED_RESULT, 0);
+  notecard.begin(&mockSerial);
+  notecard.sendRequest(nullptr);
+  notecard.requestAndResponse(nullptr);
 
    // Assert
   ///////////
 
-  if (EXPECTED_RESULT == noteDebugSyncStatus_Parameters.pollFrequencyMs)
+  if (!noteContextSave_Parameters.invoked
+   && !noteContextRestore_Parameters.invoked)
   {
     result = 0;
   }
@@ -2797,34 +4028,36 @@ int test_notecard_debugSyncStatus_does_not_modify_pollFrequencyMs_parameter_befo
   {
     result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
     std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
-    std::cout << "\tnoteDebugSyncStatus_Parameters.pollFrequencyMs == " << noteDebugSyncStatus_Parameters.pollFrequencyMs << ", EXPECTED: " << EXPECTED_RESULT << std::endl;
+    std::cout << "\tnoteContextSave_Parameters.invoked == " << noteContextSave_Parameters.invoked << ", EXPECTED: 0" << std::endl;
+    std::cout << "\tnoteContextRestore_Parameters.invoked == " << noteContextRestore_Parameters.invoked << ", EXPECTED: 0" << std::endl;
     std::cout << "[";
   }
 
   return result;
 }
 
-int test_notecard_debugSyncStatus_does_not_modify_maxLevel_parameter_before_passing_to_note_c()
+int test_notecard_holds_its_note_c_context_by_pointer_and_is_not_copyable()
 {
   int result;
 
    // Arrange
   ////////////
 
-  Notecard notecard;
-  const int EXPECTED_RESULT = 79;
-
-  noteDebugSyncStatus_Parameters.reset();
+  const size_t notecard_size = sizeof(Notecard);
+  const size_t context_size = sizeof(NoteContext);
 
    // Action
   ///////////
 
-  notecard.debugSyncStatus(0, EXPECTED_RESULT);
+  const bool copy_constructible = std::is_copy_constructible<Notecard>::value;
+  const bool copy_assignable = std::is_copy_assignable<Notecard>::value;
 
    // Assert
   ///////////
 
-  if (EXPECTED_RESULT == noteDebugSyncStatus_Parameters.maxLevel)
+  if (notecard_size < context_size
+   && !copy_constructible
+   && !copy_assignable)
   {
     result = 0;
   }
@@ -2832,35 +4065,46 @@ int test_notecard_debugSyncStatus_does_not_modify_maxLevel_parameter_before_pass
   {
     result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
     std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
-    std::cout << "\tnoteDebugSyncStatus_Parameters.maxLevel == " << noteDebugSyncStatus_Parameters.maxLevel << ", EXPECTED: " << EXPECTED_RESULT << std::endl;
+    std::cout << "\tsizeof(Notecard) == " << notecard_size << ", EXPECTED: < " << context_size << " (`sizeof(NoteContext)`)" << std::endl;
+    std::cout << "\tstd::is_copy_constructible<Notecard>::value == " << copy_constructible << ", EXPECTED: 0 (`false`)" << std::endl;
+    std::cout << "\tstd::is_copy_assignable<Notecard>::value == " << copy_assignable << ", EXPECTED: 0 (`false`)" << std::endl;
     std::cout << "[";
   }
 
   return result;
 }
 
-int test_notecard_debugSyncStatus_does_not_modify_note_c_result_value_before_returning_to_caller()
+int test_notecard_switching_instances_saves_the_outgoing_context_and_restores_the_incoming_context()
 {
   int result;
 
    // Arrange
   ////////////
 
-  Notecard notecard;
-  const bool EXPECTED_RESULT = true;
-
-  noteDebugSyncStatus_Parameters.reset();
-  noteDebugSyncStatus_Parameters.result = EXPECTED_RESULT;
+  Notecard notecard1;
+  Notecard notecard2;
+  NoteSerial_Mock mockSerial;
+  notecard1.begin(&mockSerial);
+  noteContextRestore_Parameters.reset();
+  noteContextSave_Parameters.reset();
 
    // Action
   ///////////
 
-  const bool ACTUAL_RESULT = notecard.debugSyncStatus(0, 0);
+  notecard2.sendRequest(nullptr);
+  NoteContext * const notecard1_context = noteContextSave_Parameters.ctx;
+  const NoteContext * const notecard2_initial_context = noteContextRestore_Parameters.ctx;
+  notecard1.sendRequest(nullptr);
 
    // Assert
   ///////////
 
-  if (EXPECTED_RESULT == ACTUAL_RESULT)
+  if (2 == noteContextSave_Parameters.invoked
+   && 2 == noteContextRestore_Parameters.invoked
+   && nullptr != notecard1_context
+   && nullptr == notecard2_initial_context
+   && notecard1_context == noteContextRestore_Parameters.ctx
+   && notecard1_context != noteContextSave_Parameters.ctx)
   {
     result = 0;
   }
@@ -2868,42 +4112,43 @@ int test_notecard_debugSyncStatus_does_not_modify_note_c_result_value_before_ret
   {
     result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
     std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
-    std::cout << "\tnotecard.debugSyncStatus(0, 0) == " << ACTUAL_RESULT << ", EXPECTED: " << EXPECTED_RESULT << std::endl;
+    std::cout << "\tnoteContextSave_Parameters.invoked == " << noteContextSave_Parameters.invoked << ", EXPECTED: 2" << std::endl;
+    std::cout << "\tnoteContextRestore_Parameters.invoked == " << noteContextRestore_Parameters.invoked << ", EXPECTED: 2" << std::endl;
+    std::cout << "\tnotecard2_initial_context == " << !!notecard2_initial_context << ", EXPECTED: 0 (`nullptr`)" << std::endl;
     std::cout << "[";
   }
 
   return result;
 }
 
-int test_notecard_responseError_does_not_modify_j_object_parameter_value_before_passing_to_note_c()
+int test_notecard_switching_instances_swaps_the_interface_behind_the_static_callbacks()
 {
   int result;
 
    // Arrange
   ////////////
 
-  Notecard notecard;
-  J * EXPECTED_JSON = reinterpret_cast<J *>(malloc(sizeof(J))); // JCreateObject();
-  J * json_cpy;
-  assert(nullptr != EXPECTED_JSON);
-
-  noteResponseError_Parameters.reset();
-  memset(EXPECTED_JSON, 0x55, sizeof(J)); //assert(nullptr != JAddStringToObject(EXPECTED_JSON,"key1", "value1"));
-  {
-    json_cpy = reinterpret_cast<J *>(malloc(sizeof(J)));
-    assert(nullptr != json_cpy);
-    memcpy(json_cpy, EXPECTED_JSON, sizeof(J));
-  } //assert(nullptr != (json_cpy = JDuplicate(EXPECTED_JSON,true)));
+  Notecard notecard1;
+  Notecard notecard2;
+  NoteSerial_Mock mockSerial;
+  notecard1.begin(&mockSerial);  // Provides access to the hidden static callback methods through `note-c` mocks
+  serialAvailableFn noteSerialAvailable = noteSetFnSerialDefault_Parameters.availfn;  // Capture the internal Notecard serial function, `noteSerialAvailable`
+  noteSerialAvailable_Parameters.reset();
 
    // Action
   ///////////
 
-  notecard.responseError(json_cpy);
+  notecard2.sendRequest(nullptr);
+  noteSerialAvailable();
+  const size_t ACTUAL_INVOKED_FOR_NOTECARD2 = noteSerialAvailable_Parameters.invoked;
+  notecard1.sendRequest(nullptr);
+  noteSerialAvailable();
 
    // Assert
   ///////////
 
-  if (!memcmp(EXPECTED_JSON, noteResponseError_Parameters.rsp, sizeof(J)) /*JCompare(EXPECTED_JSON, noteRequestResponse_Parameters.rsp, false)*/)
+  if (0 == ACTUAL_INVOKED_FOR_NOTECARD2
+   && 1 == noteSerialAvailable_Parameters.invoked)
   {
     result = 0;
   }
@@ -2911,72 +4156,96 @@ int test_notecard_responseError_does_not_modify_j_object_parameter_value_before_
   {
     result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
     std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
-    std::cout << "\tnoteResponseError_Parameters.rsp != EXPECTED_JSON" << std::endl;
+    std::cout << "\tACTUAL_INVOKED_FOR_NOTECARD2 == " << ACTUAL_INVOKED_FOR_NOTECARD2 << ", EXPECTED: 0" << std::endl;
+    std::cout << "\tnoteSerialAvailable_Parameters.invoked == " << noteSerialAvailable_Parameters.invoked << ", EXPECTED: 1" << std::endl;
     std::cout << "[";
   }
 
-  free(json_cpy);
-  free(EXPECTED_JSON);
   return result;
 }
 
-int test_notecard_responseError_does_not_modify_note_c_result_value_before_returning_to_caller()
+int test_notecard_configuration_methods_switch_to_the_instance_they_configure()
 {
-  int result;
+  int result = 0;
 
    // Arrange
   ////////////
 
-  Notecard notecard;
-  const bool EXPECTED_RESULT = true;
-
-  noteResponseError_Parameters.reset();
-  noteResponseError_Parameters.result = EXPECTED_RESULT;
+  Notecard notecard1;
+  Notecard notecard2;
+  NoteSerial_Mock mockSerial;
+  notecard1.begin(&mockSerial);
 
    // Action
   ///////////
 
-  const bool ACTUAL_RESULT = notecard.responseError(nullptr);
+  // Each method must swap in `notecard2` before touching `note-c`
+  struct Method {
+    const char *name;
+    void (*invoke)(Notecard &);
+  };
+  const Method methods[] = {
+    {"newCommand", [](Notecard &notecard) { notecard.newCommand(nullptr); }},
+    {"newRequest", [](Notecard &notecard) { notecard.newRequest(nullptr); }},
+    {"setDebugOutputStream", [](Notecard &notecard) { notecard.setDebugOutputStream(nullptr); }},
+    {"setFn", [](Notecard &notecard) { notecard.setFn(nullptr, nullptr, nullptr, nullptr); }},
+    {"setFnI2cMutex", [](Notecard &notecard) { notecard.setFnI2cMutex(nullptr, nullptr); }},
+    {"setFnNoteMutex", [](Notecard &notecard) { notecard.setFnNoteMutex(nullptr, nullptr); }},
+    {"setI2cBusSharing", [](Notecard &notecard) { notecard.setI2cBusSharing(true); }},
+  };
+  std::vector<std::string> missed;
+  for (const Method &method : methods) {
+    notecard1.sendRequest(nullptr);
+    noteContextSave_Parameters.reset();
+    method.invoke(notecard2);
+    if (1 != noteContextSave_Parameters.invoked) {
+      missed.push_back(method.name);
+    }
+  }
 
    // Assert
   ///////////
 
-  if (EXPECTED_RESULT == ACTUAL_RESULT)
-  {
-    result = 0;
-  }
-  else
+  if (!missed.empty())
   {
     result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
     std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
-    std::cout << "\tnotecard.responseError(nullptr) == " << ACTUAL_RESULT << ", EXPECTED: " << EXPECTED_RESULT << std::endl;
+    for (const std::string &name : missed) {
+      std::cout << "\t" << name << "() did not switch to its instance" << std::endl;
+    }
     std::cout << "[";
   }
 
   return result;
 }
 
-int test_notecard_newCommand_does_not_modify_string_parameter_value_before_passing_to_note_c()
+int test_notecard_destroying_an_inactive_instance_frees_its_saved_context()
 {
   int result;
 
    // Arrange
   ////////////
 
-  Notecard notecard;
-  const char EXPECTED_RESULT[] = "Hello, Test!";
-
-  noteNewCommand_Parameters.reset();
+  Notecard notecard1;
+  Notecard * const notecard2 = new Notecard;
+  notecard2->sendRequest(nullptr);
+  notecard1.sendRequest(nullptr);
+  NoteContext * const notecard2_context = noteContextSave_Parameters.ctx;
+  noteContextFree_Parameters.reset();
+  make_note_serial_Parameters.reset();
+  make_note_serial_Parameters.serial_parameters = &Serial;
 
    // Action
   ///////////
 
-  notecard.newCommand(EXPECTED_RESULT);
+  delete notecard2;
 
    // Assert
   ///////////
 
-  if (!strcmp(EXPECTED_RESULT, noteNewCommand_Parameters.request_cache.c_str()))
+  if (1 == noteContextFree_Parameters.invoked
+   && notecard2_context == noteContextFree_Parameters.ctx
+   && &Serial == make_note_serial_Parameters.serial_parameters)
   {
     result = 0;
   }
@@ -2984,41 +4253,46 @@ int test_notecard_newCommand_does_not_modify_string_parameter_value_before_passi
   {
     result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
     std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
-    std::cout << "\tnoteNewCommand_Parameters.request_cache.c_str() == \"" << noteNewCommand_Parameters.request_cache.c_str() << "\", EXPECTED: \"" << EXPECTED_RESULT << "\"" << std::endl;
+    std::cout << "\tnoteContextFree_Parameters.invoked == " << noteContextFree_Parameters.invoked << ", EXPECTED: 1" << std::endl;
+    std::cout << "\tnoteContextFree_Parameters.ctx == notecard2_context == " << (notecard2_context == noteContextFree_Parameters.ctx) << ", EXPECTED: 1" << std::endl;
+    std::cout << "\tmake_note_serial_Parameters.serial_parameters == 0x" << std::hex << !!make_note_serial_Parameters.serial_parameters << ", EXPECTED: not 0x0 (the shared interfaces are kept)" << std::endl;
     std::cout << "[";
   }
 
   return result;
 }
 
-int test_notecard_newCommand_does_not_modify_note_c_result_value_before_returning_to_caller()
+int test_notecard_end_leaves_the_shared_interfaces_and_callbacks_while_other_instances_exist()
 {
   int result;
 
    // Arrange
   ////////////
 
-  Notecard notecard;
-  J * EXPECTED_JSON = reinterpret_cast<J *>(malloc(sizeof(J))); // JCreateObject();
-  assert(nullptr != EXPECTED_JSON);
-
-  noteNewCommand_Parameters.reset();
-  memset(EXPECTED_JSON, 0x55, sizeof(J)); //assert(nullptr != JAddStringToObject(EXPECTED_JSON,"key1", "value1"));
-  {
-    noteNewCommand_Parameters.result = reinterpret_cast<J *>(malloc(sizeof(J)));
-    assert(nullptr != noteNewCommand_Parameters.result);
-    memcpy(noteNewCommand_Parameters.result, EXPECTED_JSON, sizeof(J));
-  } //assert(nullptr != (noteNewCommand_Parameters.result = JDuplicate(EXPECTED_JSON,true)));
+  Notecard notecard1;
+  Notecard notecard2;
+  NoteI2c_Mock mockI2c;  // Instantiate NoteI2c (mocked)
+  notecard2.begin(&mockI2c);
+  notecard1.begin(&mockI2c);
+  make_note_i2c_Parameters.reset();
+  make_note_i2c_Parameters.i2c_parameters = &Wire;
+  noteGetFnSerial_Parameters.reset();
+  noteGetFnI2C_Parameters.reset();
+  noteGetFnI2C_Parameters.transmitFn_result = reinterpret_cast<i2cTransmitFn>(0x1);
+  noteSetFn_Parameters.reset();
+  noteSetFnI2C_Parameters.reset();
 
    // Action
-  ///////////
+  ////////////
 
-  const J * const ACTUAL_RESULT = notecard.newCommand(nullptr);
+  notecard1.end();
 
    // Assert
-  ///////////
+  ////////////
 
-  if (!memcmp(EXPECTED_JSON, ACTUAL_RESULT, sizeof(J)) /*JCompare(EXPECTED_JSON, ACTUAL_RESULT, false)*/)
+  if (&Wire == make_note_i2c_Parameters.i2c_parameters
+   && !noteSetFn_Parameters.invoked
+   && noteSetFnI2C_Parameters.invoked)
   {
     result = 0;
   }
@@ -3026,12 +4300,12 @@ int test_notecard_newCommand_does_not_modify_note_c_result_value_before_returnin
   {
     result = static_cast<int>('n' + 'o' + 't' + 'e' + 'c' + 'a' + 'r' + 'd');
     std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
-    std::cout << "\tnotecard.newCommand(nullptr) != EXPECTED_JSON" << std::endl;
+    std::cout << "\tmake_note_i2c_Parameters.i2c_parameters == 0x" << std::hex << !!make_note_i2c_Parameters.i2c_parameters << ", EXPECTED: not 0x0 (the shared interface is kept)" << std::endl;
+    std::cout << "\tnoteSetFn_Parameters.invoked == " << noteSetFn_Parameters.invoked << ", EXPECTED: 0" << std::endl;
+    std::cout << "\tnoteSetFnI2C_Parameters.invoked == " << noteSetFnI2C_Parameters.invoked << ", EXPECTED: > 0" << std::endl;
     std::cout << "[";
   }
 
-  free(noteNewCommand_Parameters.result);
-  free(EXPECTED_JSON);
   return result;
 }
 
@@ -4375,6 +5649,142 @@ int test_static_callback_note_serial_receive_returns_false_when_interface_has_no
   return result;
 }
 
+int test_static_callback_note_serial_clear_to_send_invokes_notecard_serial_clear_to_send()
+{
+  int result;
+
+   // Arrange
+  ////////////
+
+  Notecard notecard;
+  NoteSerial_Mock mockSerial;  // Instantiate NoteSerial (mocked)
+  notecard.begin(&mockSerial);
+  noteSerialSetFlowControl_Parameters.reset();
+  noteSerialSetFlowControl_Parameters.result = true;
+  notecard.setSerialFlowControl(true, 17);  // Provides access to the hidden static callback methods through `note-c` mocks
+  serialClearToSendFn noteSerialClearToSend = noteSetFnSerialFlowControl_Parameters.cleartosendfn;  // Capture the internal Notecard serial function, `noteSerialClearToSend`
+  noteSerialClearToSend_Parameters.reset();  // Clear the structure for testing results
+  noteSerialClearToSend_Parameters.result = false;
+
+   // Action
+  ///////////
+
+  const bool ACTUAL_RESULT = noteSerialClearToSend();
+
+   // Assert
+  ///////////
+
+  if (noteSerialClearToSend_Parameters.invoked
+   && !ACTUAL_RESULT)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('c' + 'a' + 'l' + 'l' + 'b' + 'a' + 'c' + 'k');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tnoteSerialClearToSend_Parameters.invoked == " << noteSerialClearToSend_Parameters.invoked << ", EXPECTED: > 0" << std::endl;
+    std::cout << "\tACTUAL_RESULT == " << ACTUAL_RESULT << ", EXPECTED: " << false << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_static_callback_note_serial_receive_bulk_does_not_modify_parameters_before_passing_to_interface_method()
+{
+  int result;
+
+   // Arrange
+  ////////////
+
+  Notecard notecard;
+  NoteSerial_Mock mockSerial;  // Instantiate NoteSerial (mocked)
+  notecard.begin(&mockSerial);
+  noteGetFnSerial_Parameters.reset();
+  noteGetFnSerial_Parameters.receiveFn_result = noteSetFnSerialDefault_Parameters.readfn;  // Report the default serial hooks as active
+  notecard.begin(&mockSerial);  // Provides access to the hidden static callback methods through `note-c` mocks
+  serialReceiveBulkFn noteSerialReceiveBulk = noteSetFnSerialReceiveBulk_Parameters.receivebulkfn;  // Capture the internal Notecard serial function, `noteSerialReceiveBulk`
+  noteSerialReceiveBulk_Parameters.reset();  // Clear the structure for testing results
+  noteSerialReceiveBulk_Parameters.result = 7;
+  uint8_t buffer[16];
+
+   // Action
+  ///////////
+
+  const size_t ACTUAL_RESULT = noteSerialReceiveBulk(buffer, sizeof(buffer), '\n');
+
+   // Assert
+  ///////////
+
+  if (noteSerialReceiveBulk_Parameters.invoked
+   && buffer == noteSerialReceiveBulk_Parameters.buffer
+   && sizeof(buffer) == noteSerialReceiveBulk_Parameters.size
+   && '\n' == noteSerialReceiveBulk_Parameters.eop
+   && noteSerialReceiveBulk_Parameters.result == ACTUAL_RESULT)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('c' + 'a' + 'l' + 'l' + 'b' + 'a' + 'c' + 'k');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tnoteSerialReceiveBulk_Parameters.invoked == " << noteSerialReceiveBulk_Parameters.invoked << ", EXPECTED: > 0" << std::endl;
+    std::cout << "\tnoteSerialReceiveBulk_Parameters.size == " << noteSerialReceiveBulk_Parameters.size << ", EXPECTED: " << sizeof(buffer) << std::endl;
+    std::cout << "\tACTUAL_RESULT == " << ACTUAL_RESULT << ", EXPECTED: " << noteSerialReceiveBulk_Parameters.result << std::endl;
+    std::cout << "[";
+  }
+
+  noteGetFnSerial_Parameters.reset();
+  return result;
+}
+
+int test_static_callback_note_serial_receive_bulk_returns_zero_when_interface_has_not_been_instantiated()
+{
+  int result;
+
+   // Arrange
+  ////////////
+
+  Notecard notecard;
+  NoteSerial_Mock mockSerial;  // Instantiate NoteSerial (mocked)
+  notecard.begin(&mockSerial);
+  noteGetFnSerial_Parameters.reset();
+  noteGetFnSerial_Parameters.receiveFn_result = noteSetFnSerialDefault_Parameters.readfn;  // Report the default serial hooks as active
+  notecard.begin(&mockSerial);  // Provides access to the hidden static callback methods through `note-c` mocks
+  serialReceiveBulkFn noteSerialReceiveBulk = noteSetFnSerialReceiveBulk_Parameters.receivebulkfn;  // Capture the internal Notecard serial function, `noteSerialReceiveBulk`
+
+  // Reset to ensure the interface is not instantiated
+  notecard.begin(static_cast<NoteSerial *>(nullptr));
+  noteSerialReceiveBulk_Parameters.reset();  // Clear the structure for testing results
+  noteSerialReceiveBulk_Parameters.result = 7;
+  uint8_t buffer[16];
+
+   // Action
+  ///////////
+
+  const size_t ACTUAL_RESULT = noteSerialReceiveBulk(buffer, sizeof(buffer), '\n');
+
+   // Assert
+  ///////////
+
+  if (!noteSerialReceiveBulk_Parameters.invoked && 0 == ACTUAL_RESULT)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('c' + 'a' + 'l' + 'l' + 'b' + 'a' + 'c' + 'k');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tnoteSerialReceiveBulk_Parameters.invoked == " << noteSerialReceiveBulk_Parameters.invoked << ", EXPECTED: zero (0)" << std::endl;
+    std::cout << "\tACTUAL_RESULT == " << ACTUAL_RESULT << ", EXPECTED: zero (0)" << std::endl;
+    std::cout << "[";
+  }
+
+  noteGetFnSerial_Parameters.reset();
+  return result;
+}
+
 int test_static_callback_note_serial_reset_invokes_noteserial_reset()
 {
   int result;
@@ -5068,6 +6478,8 @@ int main(void)
       {test_notecard_begin_serial_shares_a_serial_receive_function_pointer, "test_notecard_begin_serial_shares_a_serial_receive_function_pointer"},
       {test_notecard_begin_serial_sets_serial_receive_function_pointer_to_nullptr_when_interface_has_not_been_instantiated, "test_notecard_begin_serial_sets_serial_receive_function_pointer_to_nullptr_when_interface_has_not_been_instantiated"},
       {test_notecard_end_clears_all_i2c_interface_function_pointers_when_the_i2c_interface_has_been_instantiated, "test_notecard_end_clears_all_i2c_interface_function_pointers_when_the_i2c_interface_has_been_instantiated"},
+      {test_notecard_begin_serial_shares_a_serial_receive_bulk_function_pointer_when_the_default_serial_hooks_are_in_use, "test_notecard_begin_serial_shares_a_serial_receive_bulk_function_pointer_when_the_default_serial_hooks_are_in_use"},
+      {test_notecard_begin_serial_does_not_share_a_serial_receive_bulk_function_pointer_when_the_serial_hooks_have_been_overridden, "test_notecard_begin_serial_does_not_share_a_serial_receive_bulk_function_pointer_when_the_serial_hooks_have_been_overridden"},
       {test_notecard_end_does_not_call_wire_end_when_the_i2c_interface_has_not_been_instantiated, "test_notecard_end_does_not_call_wire_end_when_the_i2c_interface_has_not_been_instantiated"},
       {test_notecard_end_does_not_call_serial_end_when_the_serial_interface_has_not_been_instantiated, "test_notecard_end_does_not_call_serial_end_when_the_serial_interface_has_not_been_instantiated"},
       {test_notecard_end_clears_all_serial_interface_function_pointers_when_the_serial_interface_has_been_instantiated, "test_notecard_end_clears_all_serial_interface_function_pointers_when_the_serial_interface_has_been_instantiated"},
@@ -5085,6 +6497,12 @@ int main(void)
       {test_notecard_setFnI2cMutex_does_not_modify_unlocking_mutex_func_parameter_value_before_passing_to_note_c, "test_notecard_setFnI2cMutex_does_not_modify_unlocking_mutex_func_parameter_value_before_passing_to_note_c"},
       {test_notecard_setFnNoteMutex_does_not_modify_locking_mutex_func_parameter_value_before_passing_to_note_c, "test_notecard_setFnNoteMutex_does_not_modify_locking_mutex_func_parameter_value_before_passing_to_note_c"},
       {test_notecard_setFnNoteMutex_does_not_modify_unlocking_mutex_func_parameter_value_before_passing_to_note_c, "test_notecard_setFnNoteMutex_does_not_modify_unlocking_mutex_func_parameter_value_before_passing_to_note_c"},
+      {test_notecard_setFnResponseWait_does_not_modify_wait_func_parameter_value_before_passing_to_note_c, "test_notecard_setFnResponseWait_does_not_modify_wait_func_parameter_value_before_passing_to_note_c"},
+      {test_notecard_setI2cBlockTransfer_passes_enable_parameter_to_the_i2c_interface, "test_notecard_setI2cBlockTransfer_passes_enable_parameter_to_the_i2c_interface"},
+      {test_notecard_setI2cBlockTransfer_returns_false_without_an_i2c_interface, "test_notecard_setI2cBlockTransfer_returns_false_without_an_i2c_interface"},
+      {test_notecard_setI2cBusSharing_does_not_modify_enable_parameter_value_before_passing_to_note_c, "test_notecard_setI2cBusSharing_does_not_modify_enable_parameter_value_before_passing_to_note_c"},
+      {test_notecard_setSerialFlowControl_shares_a_clear_to_send_function_pointer_when_supported, "test_notecard_setSerialFlowControl_shares_a_clear_to_send_function_pointer_when_supported"},
+      {test_notecard_setSerialFlowControl_clears_the_clear_to_send_function_pointer_when_unsupported, "test_notecard_setSerialFlowControl_clears_the_clear_to_send_function_pointer_when_unsupported"},
       {test_notecard_setTransactionPins_shares_a_transaction_start_function_pointer, "test_notecard_setTransactionPins_shares_a_transaction_start_function_pointer"},
       {test_notecard_setTransactionPins_shares_a_transaction_stop_function_pointer, "test_notecard_setTransactionPins_shares_a_transaction_stop_function_pointer"},
       {test_notecard_setTransactionPins_clears_the_transaction_start_function_pointer_when_nullptr_is_provided, "test_notecard_setTransactionPins_clears_the_transaction_start_function_pointer_when_nullptr_is_provided"},
@@ -5098,9 +6516,23 @@ int main(void)
       {test_notecard_sendRequestWithRetry_does_not_modify_note_c_result_value_before_returning_to_caller, "test_notecard_sendRequestWithRetry_does_not_modify_note_c_result_value_before_returning_to_caller"},
       {test_notecard_requestAndResponse_does_not_modify_j_object_parameter_value_before_passing_to_note_c, "test_notecard_requestAndResponse_does_not_modify_j_object_parameter_value_before_passing_to_note_c"},
       {test_notecard_requestAndResponse_does_not_modify_note_c_result_value_before_returning_to_caller, "test_notecard_requestAndResponse_does_not_modify_note_c_result_value_before_returning_to_caller"},
+      {test_notecard_requestAndResponseBatch_does_not_modify_j_object_parameter_value_before_passing_to_note_c, "test_notecard_requestAndResponseBatch_does_not_modify_j_object_parameter_value_before_passing_to_note_c"},
+      {test_notecard_requestAndResponseBatch_deletes_the_request_array_after_the_batch_completes, "test_notecard_requestAndResponseBatch_deletes_the_request_array_after_the_batch_completes"},
+      {test_notecard_requestAndResponseBatch_does_not_modify_note_c_result_value_before_returning_to_caller, "test_notecard_requestAndResponseBatch_does_not_modify_note_c_result_value_before_returning_to_caller"},
       {test_notecard_requestAndResponseWithRetry_does_not_modify_j_object_parameter_value_before_passing_to_note_c, "test_notecard_requestAndResponseWithRetry_does_not_modify_j_object_parameter_value_before_passing_to_note_c"},
       {test_notecard_requestAndResponseWithRetry_does_not_modify_timeout_parameter_value_before_passing_to_note_c, "test_notecard_requestAndResponseWithRetry_does_not_modify_timeout_parameter_value_before_passing_to_note_c"},
       {test_notecard_requestAndResponseWithRetry_does_not_modify_note_c_result_value_before_returning_to_caller, "test_notecard_requestAndResponseWithRetry_does_not_modify_note_c_result_value_before_returning_to_caller"},
+      {test_notecard_requestAsync_does_not_modify_parameter_values_before_passing_to_note_c, "test_notecard_requestAsync_does_not_modify_parameter_values_before_passing_to_note_c"},
+      {test_notecard_requestAsync_deletes_the_request_after_passing_it_to_note_c, "test_notecard_requestAsync_deletes_the_request_after_passing_it_to_note_c"},
+      {test_notecard_pollAsync_does_not_modify_note_c_result_value_before_returning_to_caller, "test_notecard_pollAsync_does_not_modify_note_c_result_value_before_returning_to_caller"},
+      {test_notecard_pumpNotes_sends_waiting_records_as_a_single_batch_of_note_add_requests, "test_notecard_pumpNotes_sends_waiting_records_as_a_single_batch_of_note_add_requests"},
+      {test_notecard_pumpNotes_releases_records_once_they_have_been_sent, "test_notecard_pumpNotes_releases_records_once_they_have_been_sent"},
+      {test_notecard_pumpNotes_keeps_records_when_the_batch_fails, "test_notecard_pumpNotes_keeps_records_when_the_batch_fails"},
+      {test_notecard_pumpNotes_keeps_records_when_the_notecard_returns_an_error, "test_notecard_pumpNotes_keeps_records_when_the_notecard_returns_an_error"},
+      {test_notecard_pumpNotes_sends_no_more_than_max_records_in_a_batch, "test_notecard_pumpNotes_sends_no_more_than_max_records_in_a_batch"},
+      {test_notecard_pumpNotes_does_not_send_a_batch_when_no_records_are_waiting, "test_notecard_pumpNotes_does_not_send_a_batch_when_no_records_are_waiting"},
+      {test_notecard_pumpNotes_activates_its_instance_before_describing_records, "test_notecard_pumpNotes_activates_its_instance_before_describing_records"},
+      {test_notecard_finishAsync_does_not_modify_note_c_result_value_before_returning_to_caller, "test_notecard_finishAsync_does_not_modify_note_c_result_value_before_returning_to_caller"},
       {test_notecard_deleteResponse_does_not_modify_j_object_parameter_pointer_before_passing_to_note_c, "test_notecard_deleteResponse_does_not_modify_j_object_parameter_pointer_before_passing_to_note_c"},
       {test_notecard_logDebug_does_not_modify_string_parameter_value_before_passing_to_note_c, "test_notecard_logDebug_does_not_modify_string_parameter_value_before_passing_to_note_c"},
       {test_notecard_logDebugf_does_not_modify_string_parameter_value_before_passing_to_note_c, "test_notecard_logDebugf_does_not_modify_string_parameter_value_before_passing_to_note_c"},
@@ -5109,8 +6541,19 @@ int main(void)
       {test_notecard_debugSyncStatus_does_not_modify_note_c_result_value_before_returning_to_caller, "test_notecard_debugSyncStatus_does_not_modify_note_c_result_value_before_returning_to_caller"},
       {test_notecard_responseError_does_not_modify_j_object_parameter_value_before_passing_to_note_c, "test_notecard_responseError_does_not_modify_j_object_parameter_value_before_passing_to_note_c"},
       {test_notecard_responseError_does_not_modify_note_c_result_value_before_returning_to_caller, "test_notecard_responseError_does_not_modify_note_c_result_value_before_returning_to_caller"},
+#ifdef NOTE_C_METRICS
+      {test_notecard_getMetrics_returns_the_metrics_collected_by_note_c, "test_notecard_getMetrics_returns_the_metrics_collected_by_note_c"},
+      {test_notecard_getMetrics_resets_the_metrics_once_they_have_been_read, "test_notecard_getMetrics_resets_the_metrics_once_they_have_been_read"},
+#endif
       {test_notecard_newCommand_does_not_modify_string_parameter_value_before_passing_to_note_c, "test_notecard_newCommand_does_not_modify_string_parameter_value_before_passing_to_note_c"},
       {test_notecard_newCommand_does_not_modify_note_c_result_value_before_returning_to_caller, "test_notecard_newCommand_does_not_modify_note_c_result_value_before_returning_to_caller"},
+      {test_notecard_single_instance_does_not_switch_note_c_contexts, "test_notecard_single_instance_does_not_switch_note_c_contexts"},
+      {test_notecard_holds_its_note_c_context_by_pointer_and_is_not_copyable, "test_notecard_holds_its_note_c_context_by_pointer_and_is_not_copyable"},
+      {test_notecard_switching_instances_saves_the_outgoing_context_and_restores_the_incoming_context, "test_notecard_switching_instances_saves_the_outgoing_context_and_restores_the_incoming_context"},
+      {test_notecard_switching_instances_swaps_the_interface_behind_the_static_callbacks, "test_notecard_switching_instances_swaps_the_interface_behind_the_static_callbacks"},
+      {test_notecard_configuration_methods_switch_to_the_instance_they_configure, "test_notecard_configuration_methods_switch_to_the_instance_they_configure"},
+      {test_notecard_destroying_an_inactive_instance_frees_its_saved_context, "test_notecard_destroying_an_inactive_instance_frees_its_saved_context"},
+      {test_notecard_end_leaves_the_shared_interfaces_and_callbacks_while_other_instances_exist, "test_notecard_end_leaves_the_shared_interfaces_and_callbacks_while_other_instances_exist"},
       {test_static_callback_note_i2c_receive_invokes_notei2c_receive, "test_static_callback_note_i2c_receive_invokes_notei2c_receive"},
       {test_static_callback_note_i2c_receive_does_not_modify_device_address_parameter_before_passing_to_interface_method, "test_static_callback_note_i2c_receive_does_not_modify_device_address_parameter_before_passing_to_interface_method"},
       {test_static_callback_note_i2c_receive_does_not_modify_buffer_parameter_address_before_passing_to_interface_method, "test_static_callback_note_i2c_receive_does_not_modify_buffer_parameter_address_before_passing_to_interface_method"},
@@ -5144,6 +6587,9 @@ int main(void)
       {test_static_callback_note_serial_receive_does_not_modify_interface_method_return_value, "test_static_callback_note_serial_receive_does_not_modify_interface_method_return_value"},
       {test_static_callback_note_serial_receive_does_not_call_interface_method_when_interface_has_not_been_instantiated, "test_static_callback_note_serial_receive_does_not_call_interface_method_when_interface_has_not_been_instantiated"},
       {test_static_callback_note_serial_receive_returns_false_when_interface_has_not_been_instantiated, "test_static_callback_note_serial_receive_returns_false_when_interface_has_not_been_instantiated"},
+      {test_static_callback_note_serial_clear_to_send_invokes_notecard_serial_clear_to_send, "test_static_callback_note_serial_clear_to_send_invokes_notecard_serial_clear_to_send"},
+      {test_static_callback_note_serial_receive_bulk_does_not_modify_parameters_before_passing_to_interface_method, "test_static_callback_note_serial_receive_bulk_does_not_modify_parameters_before_passing_to_interface_method"},
+      {test_static_callback_note_serial_receive_bulk_returns_zero_when_interface_has_not_been_instantiated, "test_static_callback_note_serial_receive_bulk_returns_zero_when_interface_has_not_been_instantiated"},
       {test_static_callback_note_serial_reset_invokes_noteserial_reset, "test_static_callback_note_serial_reset_invokes_noteserial_reset"},
       {test_static_callback_note_serial_reset_does_not_modify_interface_method_return_value, "test_static_callback_note_serial_reset_does_not_modify_interface_method_return_value"},
       {test_static_callback_note_serial_reset_does_not_call_interface_method_when_interface_has_not_been_instantiated, "test_static_callback_note_serial_reset_does_not_call_interface_method_when_interface_has_not_been_instantiated"},
@@ -3,6 +3,7 @@
 MakeNoteI2c_Parameters<TwoWire> make_note_i2c_Parameters;
 NoteI2cReceive_Parameters noteI2cReceive_Parameters;
 NoteI2cReset_Parameters noteI2cReset_Parameters;
+NoteI2cSetBlockTransfer_Parameters noteI2cSetBlockTransfer_Parameters;
 NoteI2cTransmit_Parameters noteI2cTransmit_Parameters;
 
 NoteI2c *
@@ -68,6 +69,20 @@ NoteI2c_Mock::reset (
     return noteI2cReset_Parameters.result;
 }
 
+bool
+NoteI2c_Mock::setBlockTransfer (
+    bool enable_
+) {
+    // Record invocation(s)
+    ++noteI2cSetBlockTransfer_Parameters.invoked;
+
+    // Stash parameter(s)
+    noteI2cSetBlockTransfer_Parameters.enable = enable_;
+
+    // Return user-supplied result
+    return noteI2cSetBlockTransfer_Parameters.result;
+}
+
 const char *
 NoteI2c_Mock::transmit (
     uint16_t device_address_,
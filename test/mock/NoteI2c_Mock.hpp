@@ -14,6 +14,7 @@ class NoteI2c_Mock final : public NoteI2c
 public:
     const char * receive(uint16_t device_address, uint8_t * buffer, uint16_t requested_byte_count, uint32_t * available) override;
     bool reset(uint16_t device_address) override;
+    bool setBlockTransfer(bool enable) override;
     const char * transmit(uint16_t device_address, uint8_t * buffer, uint16_t size) override;
 };
 
@@ -89,6 +90,26 @@ struct NoteI2cReset_Parameters {
     bool result;
 };
 
+struct NoteI2cSetBlockTransfer_Parameters {
+    NoteI2cSetBlockTransfer_Parameters(
+        void
+    ) :
+        invoked(0),
+        enable(false),
+        result(false)
+    { }
+    void reset (
+        void
+    ) {
+        invoked = 0;
+        enable = false;
+        result = false;
+    }
+    size_t invoked;
+    bool enable;
+    bool result;
+};
+
 struct NoteI2cTransmit_Parameters {
     NoteI2cTransmit_Parameters(
         void
@@ -120,6 +141,7 @@ struct NoteI2cTransmit_Parameters {
 extern MakeNoteI2c_Parameters<TwoWire> make_note_i2c_Parameters;
 extern NoteI2cReceive_Parameters noteI2cReceive_Parameters;
 extern NoteI2cReset_Parameters noteI2cReset_Parameters;
+extern NoteI2cSetBlockTransfer_Parameters noteI2cSetBlockTransfer_Parameters;
 extern NoteI2cTransmit_Parameters noteI2cTransmit_Parameters;
 
 #endif // MOCK_NOTE_I2C_HPP
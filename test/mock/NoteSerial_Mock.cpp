@@ -2,8 +2,11 @@
 
 MakeNoteSerial_Parameters<HardwareSerial> make_note_serial_Parameters;
 NoteSerialAvailable_Parameters noteSerialAvailable_Parameters;
+NoteSerialClearToSend_Parameters noteSerialClearToSend_Parameters;
 NoteSerialReceive_Parameters noteSerialReceive_Parameters;
+NoteSerialReceiveBulk_Parameters noteSerialReceiveBulk_Parameters;
 NoteSerialReset_Parameters noteSerialReset_Parameters;
+NoteSerialSetFlowControl_Parameters noteSerialSetFlowControl_Parameters;
 NoteSerialTransmit_Parameters noteSerialTransmit_Parameters;
 
 NoteSerial *
@@ -50,6 +53,20 @@ NoteSerial_Mock::available (
     return noteSerialAvailable_Parameters.result;
 }
 
+bool
+NoteSerial_Mock::clearToSend (
+    void
+)
+{
+    // Record invocation(s)
+    ++noteSerialClearToSend_Parameters.invoked;
+
+    // Stash parameter(s)
+
+    // Return user-supplied result
+    return noteSerialClearToSend_Parameters.result;
+}
+
 char
 NoteSerial_Mock::receive (
     void
@@ -64,6 +81,25 @@ NoteSerial_Mock::receive (
     return noteSerialReceive_Parameters.result;
 }
 
+size_t
+NoteSerial_Mock::receiveBulk (
+    uint8_t *buffer_,
+    size_t size_,
+    char eop_
+)
+{
+    // Record invocation(s)
+    ++noteSerialReceiveBulk_Parameters.invoked;
+
+    // Stash parameter(s)
+    noteSerialReceiveBulk_Parameters.buffer = buffer_;
+    noteSerialReceiveBulk_Parameters.size = size_;
+    noteSerialReceiveBulk_Parameters.eop = eop_;
+
+    // Return user-supplied result
+    return noteSerialReceiveBulk_Parameters.result;
+}
+
 bool
 NoteSerial_Mock::reset (
     void
@@ -78,6 +114,23 @@ NoteSerial_Mock::reset (
     return noteSerialReset_Parameters.result;
 }
 
+bool
+NoteSerial_Mock::setFlowControl (
+    bool enable_,
+    uint8_t cts_pin_
+)
+{
+    // Record invocation(s)
+    ++noteSerialSetFlowControl_Parameters.invoked;
+
+    // Stash parameter(s)
+    noteSerialSetFlowControl_Parameters.enable = enable_;
+    noteSerialSetFlowControl_Parameters.cts_pin = cts_pin_;
+
+    // Return user-supplied result
+    return noteSerialSetFlowControl_Parameters.result;
+}
+
 size_t
 NoteSerial_Mock::transmit (
     uint8_t *buffer_,
@@ -11,8 +11,11 @@ class NoteSerial_Mock final : public NoteSerial
 {
 public:
     size_t available(void) override;
+    bool clearToSend(void) override;
     char receive(void) override;
+    size_t receiveBulk(uint8_t * buffer, size_t size, char eop) override;
     bool reset(void) override;
+    bool setFlowControl(bool enable, uint8_t cts_pin) override;
     size_t transmit(uint8_t * buffer, size_t size, bool flush) override;
 };
 
@@ -54,6 +57,23 @@ struct NoteSerialAvailable_Parameters {
     size_t result;
 };
 
+struct NoteSerialClearToSend_Parameters {
+    NoteSerialClearToSend_Parameters(
+        void
+    ) :
+        invoked(0),
+        result(false)
+    { }
+    void reset (
+        void
+    ) {
+        invoked = 0;
+        result = false;
+    }
+    size_t invoked;
+    bool result;
+};
+
 struct NoteSerialReceive_Parameters {
     NoteSerialReceive_Parameters(
         void
@@ -71,6 +91,32 @@ struct NoteSerialReceive_Parameters {
     char result;
 };
 
+struct NoteSerialReceiveBulk_Parameters {
+    NoteSerialReceiveBulk_Parameters(
+        void
+    ) :
+        invoked(0),
+        buffer(nullptr),
+        size(0),
+        eop('\0'),
+        result(0)
+    { }
+    void reset (
+        void
+    ) {
+        invoked = 0;
+        buffer = nullptr;
+        size = 0;
+        eop = '\0';
+        result = 0;
+    }
+    size_t invoked;
+    uint8_t * buffer;
+    size_t size;
+    char eop;
+    size_t result;
+};
+
 struct NoteSerialReset_Parameters {
     NoteSerialReset_Parameters(
         void
@@ -88,6 +134,29 @@ struct NoteSerialReset_Parameters {
     bool result;
 };
 
+struct NoteSerialSetFlowControl_Parameters {
+    NoteSerialSetFlowControl_Parameters(
+        void
+    ) :
+        invoked(0),
+        enable(false),
+        cts_pin(0),
+        result(false)
+    { }
+    void reset (
+        void
+    ) {
+        invoked = 0;
+        enable = false;
+        cts_pin = 0;
+        result = false;
+    }
+    size_t invoked;
+    bool enable;
+    uint8_t cts_pin;
+    bool result;
+};
+
 struct NoteSerialTransmit_Parameters {
     NoteSerialTransmit_Parameters(
         void
@@ -116,8 +185,11 @@ struct NoteSerialTransmit_Parameters {
 
 extern MakeNoteSerial_Parameters<HardwareSerial> make_note_serial_Parameters;
 extern NoteSerialAvailable_Parameters noteSerialAvailable_Parameters;
+extern NoteSerialClearToSend_Parameters noteSerialClearToSend_Parameters;
 extern NoteSerialReceive_Parameters noteSerialReceive_Parameters;
+extern NoteSerialReceiveBulk_Parameters noteSerialReceiveBulk_Parameters;
 extern NoteSerialReset_Parameters noteSerialReset_Parameters;
+extern NoteSerialSetFlowControl_Parameters noteSerialSetFlowControl_Parameters;
 extern NoteSerialTransmit_Parameters noteSerialTransmit_Parameters;
 
 #endif // MOCK_NOTE_SERIAL_HPP
@@ -129,6 +129,9 @@ HardwareSerial::available (
     ++hardwareSerialAvailable_Parameters.invoked;
 
     // Return user-supplied result
+    if (!hardwareSerialRead_Parameters.stream.empty()) {
+        return (hardwareSerialRead_Parameters.stream.size() - hardwareSerialRead_Parameters.consumed);
+    }
     return hardwareSerialAvailable_Parameters.result;
 }
 
@@ -167,6 +170,9 @@ HardwareSerial::read (
     ++hardwareSerialRead_Parameters.invoked;
 
     // Return user-supplied result
+    if (hardwareSerialRead_Parameters.consumed < hardwareSerialRead_Parameters.stream.size()) {
+        return hardwareSerialRead_Parameters.stream[hardwareSerialRead_Parameters.consumed++];
+    }
     return hardwareSerialRead_Parameters.result;
 }
 
@@ -307,13 +313,16 @@ TwoWire::end (
 
 uint8_t
 TwoWire::endTransmission (
-    void
+    bool sendStop
 ) {
     uint8_t result;
 
     // Record invocation(s)
     const size_t invocation = twoWireEndTransmission_Parameters.invoked++;
 
+    // Stash parameter(s)
+    twoWireEndTransmission_Parameters.send_stop = sendStop;
+
     // Return user-supplied result if available
     if (twoWireEndTransmission_Parameters.results.size() > invocation) {
         result = twoWireEndTransmission_Parameters.results[invocation];
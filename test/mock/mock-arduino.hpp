@@ -250,12 +250,16 @@ struct HardwareSerialOperatorBool_Parameters {
     bool result;
 };
 
+// NOTE: When `stream` is populated, `HardwareSerial::read()` returns its bytes
+//       in order (tracked by `consumed`) and `HardwareSerial::available()`
+//       reports the number remaining, instead of the fixed results.
 struct HardwareSerialRead_Parameters {
     HardwareSerialRead_Parameters(
         void
     ) :
         invoked(0),
-        result(0)
+        result(0),
+        consumed(0)
     { }
     void
     reset (
@@ -263,9 +267,13 @@ struct HardwareSerialRead_Parameters {
     ) {
         invoked = 0;
         result = 0;
+        consumed = 0;
+        stream.clear();
     }
     size_t invoked;
     char result;
+    size_t consumed;
+    std::string stream;
 };
 
 struct HardwareSerialWrite_Parameters {
@@ -436,7 +444,7 @@ struct TwoWire {
     void begin(void);
     void beginTransmission(uint8_t address);
     void end(void);
-    uint8_t endTransmission(void);
+    uint8_t endTransmission(bool sendStop = true);
     int read(void);
     uint8_t requestFrom(int address, int quantity);
     size_t write(uint8_t c);
@@ -492,15 +500,18 @@ struct TwoWireEndTransmission_Parameters {
     TwoWireEndTransmission_Parameters(
         void
     ) :
-        invoked(0)
+        invoked(0),
+        send_stop(true)
     { }
     void reset (
         void
     ) {
         invoked = 0;
+        send_stop = true;
         results.clear();
     }
     size_t invoked;
+    bool send_stop;
     std::vector<uint8_t> results;
 };
 
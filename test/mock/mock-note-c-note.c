@@ -1,12 +1,25 @@
 #include "mock-parameters.hpp"
 
 JAddIntToObject_Parameters jAddIntToObject_Parameters;
+JAddItemToArray_Parameters jAddItemToArray_Parameters;
+JAddItemToObject_Parameters jAddItemToObject_Parameters;
+JAddStringToObject_Parameters jAddStringToObject_Parameters;
+JCreateArray_Parameters jCreateArray_Parameters;
+JCreateObject_Parameters jCreateObject_Parameters;
+JDelete_Parameters jDelete_Parameters;
+JGetArrayItem_Parameters jGetArrayItem_Parameters;
+NoteContextFree_Parameters noteContextFree_Parameters;
+NoteContextRestore_Parameters noteContextRestore_Parameters;
+NoteContextSave_Parameters noteContextSave_Parameters;
 NoteDebug_Parameters noteDebug_Parameters;
 NoteDebugSyncStatus_Parameters noteDebugSyncStatus_Parameters;
 NoteDelayMs_Parameters noteDelayMs_Parameters;
 NoteDeleteResponse_Parameters noteDeleteResponse_Parameters;
 NoteGetFnI2C_Parameters noteGetFnI2C_Parameters;
 NoteGetFnSerial_Parameters noteGetFnSerial_Parameters;
+#ifdef NOTE_C_METRICS
+NoteGetMetrics_Parameters noteGetMetrics_Parameters;
+#endif
 NoteGetMs_Parameters noteGetMs_Parameters;
 NoteNewCommand_Parameters noteNewCommand_Parameters;
 NoteNewRequest_Parameters noteNewRequest_Parameters;
@@ -14,6 +27,9 @@ NoteRequest_Parameters noteRequest_Parameters;
 NoteRequestWithRetry_Parameters noteRequestWithRetry_Parameters;
 NoteRequestResponse_Parameters noteRequestResponse_Parameters;
 NoteRequestResponseWithRetry_Parameters noteRequestResponseWithRetry_Parameters;
+#ifdef NOTE_C_METRICS
+NoteResetMetrics_Parameters noteResetMetrics_Parameters;
+#endif
 NoteResponseError_Parameters noteResponseError_Parameters;
 NoteSetFnDebugOutput_Parameters noteSetFnDebugOutput_Parameters;
 NoteSetFn_Parameters noteSetFn_Parameters;
@@ -22,12 +38,21 @@ NoteSetFnI2C_Parameters noteSetFnI2C_Parameters;
 NoteSetFnI2CDefault_Parameters noteSetFnI2CDefault_Parameters;
 NoteSetFnI2CMutex_Parameters noteSetFnI2CMutex_Parameters;
 NoteSetFnNoteMutex_Parameters noteSetFnNoteMutex_Parameters;
+NoteSetFnResponseWait_Parameters noteSetFnResponseWait_Parameters;
 NoteSetFnSerial_Parameters noteSetFnSerial_Parameters;
 NoteSetFnSerialDefault_Parameters noteSetFnSerialDefault_Parameters;
+NoteSetFnSerialFlowControl_Parameters noteSetFnSerialFlowControl_Parameters;
+NoteSetFnSerialReceiveBulk_Parameters noteSetFnSerialReceiveBulk_Parameters;
 NoteSetFnTransaction_Parameters noteSetFnTransaction_Parameters;
 NoteSetI2CAddress_Parameters noteSetI2CAddress_Parameters;
+NoteSetI2CBusSharing_Parameters noteSetI2CBusSharing_Parameters;
 NoteSetI2CMtu_Parameters noteSetI2CMtu_Parameters;
 NoteSetUserAgent_Parameters noteSetUserAgent_Parameters;
+NoteTransactionAsyncBegin_Parameters noteTransactionAsyncBegin_Parameters;
+NoteTransactionAsyncEnd_Parameters noteTransactionAsyncEnd_Parameters;
+NoteTransactionAsyncPoll_Parameters noteTransactionAsyncPoll_Parameters;
+NoteTransactionBatch_Parameters noteTransactionBatch_Parameters;
+NoteTransactionBatchUntilError_Parameters noteTransactionBatchUntilError_Parameters;
 
 J *
 JAddIntToObject (
@@ -51,6 +76,105 @@ JAddIntToObject (
     }
 }
 
+void
+JAddItemToArray (
+    J * array_,
+    J * item_
+) {
+    // Record invocation(s)
+    ++jAddItemToArray_Parameters.invoked;
+
+    // Stash parameter(s)
+    jAddItemToArray_Parameters.array = array_;
+    jAddItemToArray_Parameters.item = item_;
+}
+
+void
+JAddItemToObject (
+    J * object_,
+    const char * string_,
+    J * item_
+) {
+    // Record invocation(s)
+    ++jAddItemToObject_Parameters.invoked;
+
+    // Stash parameter(s)
+    jAddItemToObject_Parameters.object = object_;
+    jAddItemToObject_Parameters.string = string_;
+    jAddItemToObject_Parameters.item = item_;
+}
+
+J *
+JAddStringToObject (
+    J * const object_,
+    const char * const name_,
+    const char * const string_
+) {
+    // Record invocation(s)
+    ++jAddStringToObject_Parameters.invoked;
+
+    // Stash parameter(s)
+    jAddStringToObject_Parameters.object.push_back(object_);
+    jAddStringToObject_Parameters.name.push_back(name_);
+    jAddStringToObject_Parameters.string.push_back(string_);
+
+    // Return user-supplied result
+    if (jAddStringToObject_Parameters.result.size() < jAddStringToObject_Parameters.invoked) {
+        return jAddStringToObject_Parameters.default_result;
+    } else {
+        return jAddStringToObject_Parameters.result[(jAddStringToObject_Parameters.invoked - 1)];
+    }
+}
+
+J *
+JCreateArray (
+    void
+) {
+    // Record invocation(s)
+    ++jCreateArray_Parameters.invoked;
+
+    // Return user-supplied result
+    return jCreateArray_Parameters.result;
+}
+
+J *
+JCreateObject (
+    void
+) {
+    // Record invocation(s)
+    ++jCreateObject_Parameters.invoked;
+
+    // Return user-supplied result
+    return jCreateObject_Parameters.result;
+}
+
+void
+JDelete (
+    J * item_
+) {
+    // Record invocation(s)
+    ++jDelete_Parameters.invoked;
+
+    // Stash parameter(s)
+    jDelete_Parameters.item = item_;
+}
+
+J *
+JGetArrayItem (
+    const J * array_,
+    int index_
+) {
+    // Record invocation(s)
+    ++jGetArrayItem_Parameters.invoked;
+
+    // Stash parameter(s)
+    jGetArrayItem_Parameters.array = array_;
+    jGetArrayItem_Parameters.index = index_;
+
+    // Return user-supplied result
+    return jGetArrayItem_Parameters.result;
+}
+
 void
 MockNoteDeleteResponse (
     J * response_
@@ -76,6 +200,39 @@ MockNoteResponseError (
     return noteResponseError_Parameters.result;
 }
 
+void
+NoteContextFree(
+    NoteContext * ctx_
+) {
+    // Record invocation(s)
+    ++noteContextFree_Parameters.invoked;
+
+    // Stash parameter(s)
+    noteContextFree_Parameters.ctx = ctx_;
+}
+
+void
+NoteContextRestore(
+    const NoteContext * ctx_
+) {
+    // Record invocation(s)
+    ++noteContextRestore_Parameters.invoked;
+
+    // Stash parameter(s)
+    noteContextRestore_Parameters.ctx = ctx_;
+}
+
+void
+NoteContextSave(
+    NoteContext * ctx_
+) {
+    // Record invocation(s)
+    ++noteContextSave_Parameters.invoked;
+
+    // Stash parameter(s)
+    noteContextSave_Parameters.ctx = ctx_;
+}
+
 void
 NoteDebug(
     const char * message_
@@ -181,6 +338,24 @@ void NoteGetFnSerial(serialResetFn *resetFn, serialTransmitFn *transmitFn,
     }
 }
 
+#ifdef NOTE_C_METRICS
+void
+NoteGetMetrics(
+    NoteMetrics * metrics_
+) {
+    // Record invocation(s)
+    ++noteGetMetrics_Parameters.invoked;
+
+    // Stash parameter(s)
+    noteGetMetrics_Parameters.metrics = metrics_;
+
+    // Return user-supplied result
+    if (metrics_) {
+        *metrics_ = noteGetMetrics_Parameters.result;
+    }
+}
+#endif
+
 uint32_t
 NoteGetMs(
     void
@@ -290,6 +465,19 @@ NoteRequestResponseWithRetry(
     return noteRequestResponseWithRetry_Parameters.result;
 }
 
+#ifdef NOTE_C_METRICS
+void
+NoteResetMetrics(
+    void
+) {
+    // Record invocation(s)
+    ++noteResetMetrics_Parameters.invoked;
+
+    // Record the order of invocation(s)
+    noteResetMetrics_Parameters.afterGetMetrics = (noteGetMetrics_Parameters.invoked > 0);
+}
+#endif
+
 void
 NoteSetFnDebugOutput(
     debugOutputFn fn_
@@ -399,6 +587,17 @@ NoteSetFnNoteMutex(
     noteSetFnNoteMutex_Parameters.unlockNoteFn = unlockNoteFn_;
 }
 
+void
+NoteSetFnResponseWait(
+    responseWaitFn waitFn_
+) {
+    // Record invocation(s)
+    ++noteSetFnResponseWait_Parameters.invoked;
+
+    // Stash parameter(s)
+    noteSetFnResponseWait_Parameters.waitFn = waitFn_;
+}
+
 void
 NoteSetFnSerial(
     serialResetFn reset_fn_,
@@ -433,6 +632,28 @@ NoteSetFnSerialDefault(
     noteSetFnSerialDefault_Parameters.readfn = read_fn_;
 }
 
+void
+NoteSetFnSerialFlowControl(
+    serialClearToSendFn clear_to_send_fn_
+) {
+    // Record invocation(s)
+    ++noteSetFnSerialFlowControl_Parameters.invoked;
+
+    // Stash parameter(s)
+    noteSetFnSerialFlowControl_Parameters.cleartosendfn = clear_to_send_fn_;
+}
+
+void
+NoteSetFnSerialReceiveBulk(
+    serialReceiveBulkFn receive_bulk_fn_
+) {
+    // Record invocation(s)
+    ++noteSetFnSerialReceiveBulk_Parameters.invoked;
+
+    // Stash parameter(s)
+    noteSetFnSerialReceiveBulk_Parameters.receivebulkfn = receive_bulk_fn_;
+}
+
 void
 NoteSetFnTransaction(
     txnStartFn start_fn_,
@@ -457,6 +678,17 @@ NoteSetI2CAddress(
     noteSetI2CAddress_Parameters.i2caddr = i2c_addr_;
 }
 
+void
+NoteSetI2CBusSharing(
+    bool enable_
+) {
+    // Record invocation(s)
+    ++noteSetI2CBusSharing_Parameters.invoked;
+
+    // Stash parameter(s)
+    noteSetI2CBusSharing_Parameters.enable = enable_;
+}
+
 void
 NoteSetI2CMtu(
     uint32_t i2c_mtu_
@@ -481,3 +713,72 @@ NoteSetUserAgent(
         noteSetUserAgent_Parameters.agent_cache = agent_;
     }
 }
+
+void
+NoteTransactionAsyncBegin(
+    NoteTransactionAsync * txn_,
+    J * req_
+) {
+    // Record invocation(s)
+    ++noteTransactionAsyncBegin_Parameters.invoked;
+
+    // Stash parameter(s)
+    noteTransactionAsyncBegin_Parameters.txn = txn_;
+    noteTransactionAsyncBegin_Parameters.req = req_;
+}
+
+J *
+NoteTransactionAsyncEnd(
+    NoteTransactionAsync * txn_
+) {
+    // Record invocation(s)
+    ++noteTransactionAsyncEnd_Parameters.invoked;
+
+    // Stash parameter(s)
+    noteTransactionAsyncEnd_Parameters.txn = txn_;
+
+    // Return user-supplied result
+    return noteTransactionAsyncEnd_Parameters.result;
+}
+
+bool
+NoteTransactionAsyncPoll(
+    NoteTransactionAsync * txn_
+) {
+    // Record invocation(s)
+    ++noteTransactionAsyncPoll_Parameters.invoked;
+
+    // Stash parameter(s)
+    noteTransactionAsyncPoll_Parameters.txn = txn_;
+
+    // Return user-supplied result
+    return noteTransactionAsyncPoll_Parameters.result;
+}
+
+J *
+NoteTransactionBatch(
+    J * reqs_
+) {
+    // Record invocation(s)
+    ++noteTransactionBatch_Parameters.invoked;
+
+    // Stash parameter(s)
+    noteTransactionBatch_Parameters.reqs = reqs_;
+
+    // Return user-supplied result
+    return noteTransactionBatch_Parameters.result;
+}
+
+J *
+NoteTransactionBatchUntilError(
+    J * reqs_
+) {
+    // Record invocation(s)
+    ++noteTransactionBatchUntilError_Parameters.invoked;
+
+    // Stash parameter(s)
+    noteTransactionBatchUntilError_Parameters.reqs = reqs_;
+
+    // Return user-supplied result
+    return noteTransactionBatchUntilError_Parameters.result;
+}
@@ -50,6 +50,208 @@ struct JAddIntToObject_Parameters {
     J *default_result;
 };
 
+struct JAddItemToArray_Parameters {
+    JAddItemToArray_Parameters(
+        void
+    ) :
+        invoked(0),
+        array(nullptr),
+        item(nullptr)
+    { }
+    void
+    reset (
+        void
+    ) {
+        invoked = 0;
+        array = nullptr;
+        item = nullptr;
+    }
+    size_t invoked;
+    J *array;
+    J *item;
+};
+
+struct JAddItemToObject_Parameters {
+    JAddItemToObject_Parameters(
+        void
+    ) :
+        invoked(0),
+        object(nullptr),
+        item(nullptr)
+    { }
+    void
+    reset (
+        void
+    ) {
+        invoked = 0;
+        object = nullptr;
+        string.clear();
+        item = nullptr;
+    }
+    size_t invoked;
+    J *object;
+    std::string string;
+    J *item;
+};
+
+struct JAddStringToObject_Parameters {
+    JAddStringToObject_Parameters(
+        void
+    ) :
+        invoked(0),
+        default_result(nullptr)
+    { }
+    void
+    reset (
+        void
+    ) {
+        invoked = 0;
+        object.clear();
+        name.clear();
+        string.clear();
+        result.clear();
+        default_result = nullptr;
+    }
+    size_t invoked;
+    std::vector<J *> object;
+    std::vector<std::string> name;
+    std::vector<std::string> string;
+    std::vector<J *> result;
+    J *default_result;
+};
+
+struct JCreateArray_Parameters {
+    JCreateArray_Parameters(
+        void
+    ) :
+        invoked(0),
+        result(nullptr)
+    { }
+    void
+    reset (
+        void
+    ) {
+        invoked = 0;
+        result = nullptr;
+    }
+    size_t invoked;
+    J *result;
+};
+
+struct JCreateObject_Parameters {
+    JCreateObject_Parameters(
+        void
+    ) :
+        invoked(0),
+        result(nullptr)
+    { }
+    void
+    reset (
+        void
+    ) {
+        invoked = 0;
+        result = nullptr;
+    }
+    size_t invoked;
+    J *result;
+};
+
+struct JDelete_Parameters {
+    JDelete_Parameters(
+        void
+    ) :
+        invoked(0),
+        item(nullptr)
+    { }
+    void
+    reset (
+        void
+    ) {
+        invoked = 0;
+        item = nullptr;
+    }
+    size_t invoked;
+    J *item;
+};
+
+struct JGetArrayItem_Parameters {
+    JGetArrayItem_Parameters(
+        void
+    ) :
+        invoked(0),
+        array(nullptr),
+        index(0),
+        result(nullptr)
+    { }
+    void
+    reset (
+        void
+    ) {
+        invoked = 0;
+        array = nullptr;
+        index = 0;
+        result = nullptr;
+    }
+    size_t invoked;
+    const J *array;
+    int index;
+    J *result;
+};
+
+struct NoteContextFree_Parameters {
+    NoteContextFree_Parameters(
+        void
+    ) :
+        invoked(0),
+        ctx(nullptr)
+    { }
+    void
+    reset (
+        void
+    ) {
+        invoked = 0;
+        ctx = nullptr;
+    }
+    size_t invoked;
+    NoteContext *ctx;
+};
+
+struct NoteContextRestore_Parameters {
+    NoteContextRestore_Parameters(
+        void
+    ) :
+        invoked(0),
+        ctx(nullptr)
+    { }
+    void
+    reset (
+        void
+    ) {
+        invoked = 0;
+        ctx = nullptr;
+    }
+    size_t invoked;
+    const NoteContext *ctx;
+};
+
+struct NoteContextSave_Parameters {
+    NoteContextSave_Parameters(
+        void
+    ) :
+        invoked(0),
+        ctx(nullptr)
+    { }
+    void
+    reset (
+        void
+    ) {
+        invoked = 0;
+        ctx = nullptr;
+    }
+    size_t invoked;
+    NoteContext *ctx;
+};
+
 struct NoteDebug_Parameters {
     NoteDebug_Parameters(
         void
@@ -217,6 +419,29 @@ struct NoteGetFnSerial_Parameters {
     serialReceiveFn receiveFn_result;
 };
 
+#ifdef NOTE_C_METRICS
+struct NoteGetMetrics_Parameters {
+    NoteGetMetrics_Parameters(
+        void
+    ) :
+        invoked(0),
+        metrics(nullptr),
+        result{}
+    { }
+    void
+    reset (
+        void
+    ) {
+        invoked = 0;
+        metrics = nullptr;
+        result = NoteMetrics{};
+    }
+    size_t invoked;
+    NoteMetrics *metrics;
+    NoteMetrics result;
+};
+#endif
+
 struct NoteGetMs_Parameters {
     NoteGetMs_Parameters(
         void
@@ -374,6 +599,26 @@ struct NoteRequestResponseWithRetry_Parameters {
     J *result;
 };
 
+#ifdef NOTE_C_METRICS
+struct NoteResetMetrics_Parameters {
+    NoteResetMetrics_Parameters(
+        void
+    ) :
+        invoked(0),
+        afterGetMetrics(false)
+    { }
+    void
+    reset (
+        void
+    ) {
+        invoked = 0;
+        afterGetMetrics = false;
+    }
+    size_t invoked;
+    bool afterGetMetrics;
+};
+#endif
+
 struct NoteResponseError_Parameters {
     NoteResponseError_Parameters(
         void
@@ -569,6 +814,24 @@ struct NoteSetFnNoteMutex_Parameters {
     mutexFn unlockNoteFn;
 };
 
+struct NoteSetFnResponseWait_Parameters {
+    NoteSetFnResponseWait_Parameters(
+        void
+    ) :
+        invoked(0),
+        waitFn(nullptr)
+    { }
+    void
+    reset (
+        void
+    ) {
+        invoked = 0;
+        waitFn = nullptr;
+    }
+    size_t invoked;
+    responseWaitFn waitFn;
+};
+
 struct NoteSetFnSerial_Parameters {
     NoteSetFnSerial_Parameters(
         void
@@ -623,6 +886,42 @@ struct NoteSetFnSerialDefault_Parameters {
     serialReceiveFn readfn;
 };
 
+struct NoteSetFnSerialFlowControl_Parameters {
+    NoteSetFnSerialFlowControl_Parameters(
+        void
+    ) :
+        invoked(0),
+        cleartosendfn(nullptr)
+    { }
+    void
+    reset (
+        void
+    ) {
+        invoked = 0;
+        cleartosendfn = nullptr;
+    }
+    size_t invoked;
+    serialClearToSendFn cleartosendfn;
+};
+
+struct NoteSetFnSerialReceiveBulk_Parameters {
+    NoteSetFnSerialReceiveBulk_Parameters(
+        void
+    ) :
+        invoked(0),
+        receivebulkfn(nullptr)
+    { }
+    void
+    reset (
+        void
+    ) {
+        invoked = 0;
+        receivebulkfn = nullptr;
+    }
+    size_t invoked;
+    serialReceiveBulkFn receivebulkfn;
+};
+
 struct NoteSetFnTransaction_Parameters {
     NoteSetFnTransaction_Parameters(
         void
@@ -662,6 +961,24 @@ struct NoteSetI2CAddress_Parameters {
     uint32_t i2caddr;
 };
 
+struct NoteSetI2CBusSharing_Parameters {
+    NoteSetI2CBusSharing_Parameters(
+        void
+    ) :
+        invoked(0),
+        enable(false)
+    { }
+    void
+    reset (
+        void
+    ) {
+        invoked = 0;
+        enable = false;
+    }
+    size_t invoked;
+    bool enable;
+};
+
 struct NoteSetI2CMtu_Parameters {
     NoteSetI2CMtu_Parameters(
         void
@@ -700,13 +1017,131 @@ struct NoteSetUserAgent_Parameters {
     std::string agent_cache;
 };
 
+struct NoteTransactionAsyncBegin_Parameters {
+    NoteTransactionAsyncBegin_Parameters(
+        void
+    ) :
+        invoked(0),
+        txn(nullptr),
+        req(nullptr)
+    { }
+    void
+    reset (
+        void
+    ) {
+        invoked = 0;
+        txn = nullptr;
+        req = nullptr;
+    }
+    size_t invoked;
+    NoteTransactionAsync *txn;
+    J *req;
+};
+
+struct NoteTransactionAsyncEnd_Parameters {
+    NoteTransactionAsyncEnd_Parameters(
+        void
+    ) :
+        invoked(0),
+        txn(nullptr),
+        result(nullptr)
+    { }
+    void
+    reset (
+        void
+    ) {
+        invoked = 0;
+        txn = nullptr;
+        result = nullptr;
+    }
+    size_t invoked;
+    NoteTransactionAsync *txn;
+    J *result;
+};
+
+struct NoteTransactionAsyncPoll_Parameters {
+    NoteTransactionAsyncPoll_Parameters(
+        void
+    ) :
+        invoked(0),
+        txn(nullptr),
+        result(false)
+    { }
+    void
+    reset (
+        void
+    ) {
+        invoked = 0;
+        txn = nullptr;
+        result = false;
+    }
+    size_t invoked;
+    NoteTransactionAsync *txn;
+    bool result;
+};
+
+struct NoteTransactionBatch_Parameters {
+    NoteTransactionBatch_Parameters(
+        void
+    ) :
+        invoked(0),
+        reqs(nullptr),
+        result(nullptr)
+    { }
+    void
+    reset (
+        void
+    ) {
+        invoked = 0;
+        reqs = nullptr;
+        result = nullptr;
+    }
+    size_t invoked;
+    J *reqs;
+    J *result;
+};
+
+struct NoteTransactionBatchUntilError_Parameters {
+    NoteTransactionBatchUntilError_Parameters(
+        void
+    ) :
+        invoked(0),
+        reqs(nullptr),
+        result(nullptr)
+    { }
+    void
+    reset (
+        void
+    ) {
+        invoked = 0;
+        reqs = nullptr;
+        result = nullptr;
+    }
+    size_t invoked;
+    J *reqs;
+    J *result;
+};
+
 extern JAddIntToObject_Parameters jAddIntToObject_Parameters;
+extern JAddItemToArray_Parameters jAddItemToArray_Parameters;
+extern JAddItemToObject_Parameters jAddItemToObject_Parameters;
+extern JAddStringToObject_Parameters jAddStringToObject_Parameters;
+extern JCreateArray_Parameters jCreateArray_Parameters;
+extern JCreateObject_Parameters jCreateObject_Parameters;
+extern JDelete_Parameters jDelete_Parameters;
+extern JGetArrayItem_Parameters jGetArrayItem_Parameters;
+extern NoteContextFree_Parameters noteContextFree_Parameters;
+extern NoteContextRestore_Parameters noteContextRestore_Parameters;
+extern NoteContextSave_Parameters noteContextSave_Parameters;
 extern NoteDebug_Parameters noteDebug_Parameters;
 extern NoteDebugSyncStatus_Parameters noteDebugSyncStatus_Parameters;
 extern NoteDelayMs_Parameters noteDelayMs_Parameters;
 extern NoteDeleteResponse_Parameters noteDeleteResponse_Parameters;
 extern NoteGetFnI2C_Parameters noteGetFnI2C_Parameters;
 extern NoteGetFnSerial_Parameters noteGetFnSerial_Parameters;
+#ifdef NOTE_C_METRICS
+extern NoteGetMetrics_Parameters noteGetMetrics_Parameters;
+#endif
 extern NoteGetMs_Parameters noteGetMs_Parameters;
 extern NoteNewCommand_Parameters noteNewCommand_Parameters;
 extern NoteNewRequest_Parameters noteNewRequest_Parameters;
@@ -714,6 +1149,9 @@ extern NoteRequest_Parameters noteRequest_Parameters;
 extern NoteRequestWithRetry_Parameters noteRequestWithRetry_Parameters;
 extern NoteRequestResponse_Parameters noteRequestResponse_Parameters;
 extern NoteRequestResponseWithRetry_Parameters noteRequestResponseWithRetry_Parameters;
+#ifdef NOTE_C_METRICS
+extern NoteResetMetrics_Parameters noteResetMetrics_Parameters;
+#endif
 extern NoteResponseError_Parameters noteResponseError_Parameters;
 extern NoteSetFnDebugOutput_Parameters noteSetFnDebugOutput_Parameters;
 extern NoteSetFn_Parameters noteSetFn_Parameters;
@@ -722,11 +1160,20 @@ extern NoteSetFnI2C_Parameters noteSetFnI2C_Parameters;
 extern NoteSetFnI2CDefault_Parameters noteSetFnI2CDefault_Parameters;
 extern NoteSetFnI2CMutex_Parameters noteSetFnI2CMutex_Parameters;
 extern NoteSetFnNoteMutex_Parameters noteSetFnNoteMutex_Parameters;
+extern NoteSetFnResponseWait_Parameters noteSetFnResponseWait_Parameters;
 extern NoteSetFnSerial_Parameters noteSetFnSerial_Parameters;
 extern NoteSetFnSerialDefault_Parameters noteSetFnSerialDefault_Parameters;
+extern NoteSetFnSerialFlowControl_Parameters noteSetFnSerialFlowControl_Parameters;
+extern NoteSetFnSerialReceiveBulk_Parameters noteSetFnSerialReceiveBulk_Parameters;
 extern NoteSetFnTransaction_Parameters noteSetFnTransaction_Parameters;
 extern NoteSetI2CAddress_Parameters noteSetI2CAddress_Parameters;
+extern NoteSetI2CBusSharing_Parameters noteSetI2CBusSharing_Parameters;
 extern NoteSetI2CMtu_Parameters noteSetI2CMtu_Parameters;
 extern NoteSetUserAgent_Parameters noteSetUserAgent_Parameters;
+extern NoteTransactionAsyncBegin_Parameters noteTransactionAsyncBegin_Parameters;
+extern NoteTransactionAsyncEnd_Parameters noteTransactionAsyncEnd_Parameters;
+extern NoteTransactionAsyncPoll_Parameters noteTransactionAsyncPoll_Parameters;
+extern NoteTransactionBatch_Parameters noteTransactionBatch_Parameters;
+extern NoteTransactionBatchUntilError_Parameters noteTransactionBatchUntilError_Parameters;
 
 #endif // MOCK_PARAMETERS_HPP
@@ -0,0 +1,282 @@
+#include "n_lib.h"
+#include "TestFunction.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+// Compile command: gcc -c -Wall -Wextra -Wpedantic -I../src/note-c ../src/note-c/*.c && g++ -Wall -Wextra -Wpedantic n_*.o n_cjson_helpers.test.cpp -std=c++11 -I. -I../src/note-c -ggdb -O0 -o n_cjson_helpers.tests && ./n_cjson_helpers.tests || echo "Tests Result: $?"
+
+namespace
+{
+
+const char * const DOCUMENTS[] = {
+  "{}",
+  "[{\"value\":1}]",
+  "{\"value\":4.21,\"connected\":true,\"text\":\"q\\\" \\u00e9\\ud83d\\ude00\",\"n\":null}\r\n",
+  "  { \"Value\" : -12.5e1 , \"value\" : 2 , \"CONNECTED\" : false }  ",
+  "{\"body\":{\"temp\":21.5,\"count\":9007199254740993,\"deep\":{\"ok\":true}},\"list\":[{\"temp\":1}],\"text\":{\"a\":1}}",
+  "{\"status\":\"connected {connected}\",\"body\":[1,2],\"err\":\"\",\"value\":\"4.21\"}",
+};
+const size_t DOCUMENT_COUNT = (sizeof(DOCUMENTS) / sizeof(DOCUMENTS[0]));
+
+const char * const FIELD_NAMES[] = {
+  "value", "connected", "text", "n", "body", "body.temp", "body.count",
+  "body.deep.ok", "body.missing", "list.temp", "text.a", "status", "err", "missing",
+};
+const size_t FIELD_COUNT = (sizeof(FIELD_NAMES) / sizeof(FIELD_NAMES[0]));
+
+const char * const INVALID_DOCUMENTS[] = {
+  "",
+  "{",
+  "{\"a\":1",
+  "{\"a\" 1}",
+  "{\"a\":1,}",
+  "{\"a\":1]",
+  "[1,2}",
+  "{\"a\":tru}",
+  "{\"a\":\"\\x\"}",
+  "{\"a\":\"\\u12\"}",
+  "{\"a\":\"\\udc00\"}",
+  "{\"a\":\"\\ud83dx\"}",
+  "{\"a\":\"unterminated}",
+  "{1:2}",
+  "{\"a\":-}",
+};
+const size_t INVALID_DOCUMENT_COUNT = (sizeof(INVALID_DOCUMENTS) / sizeof(INVALID_DOCUMENTS[0]));
+
+size_t allocations;
+
+void * countingMalloc(size_t size)
+{
+  ++allocations;
+  return malloc(size);
+}
+
+// Find a field the way a caller would with J objects, one name at a time
+J *lookUp(J *json, const std::string &path)
+{
+  size_t start = 0;
+  for (;;) {
+    if (!JIsObject(json)) {
+      return nullptr;
+    }
+    const size_t dot = path.find('.', start);
+    json = JGetObjectItem(json, path.substr(start, dot - start).c_str());
+    if (!json || std::string::npos == dot) {
+      return json;
+    }
+    start = (dot + 1);
+  }
+}
+
+// Describe a field as found by JScan
+std::string described(const JField &field)
+{
+  char string[64];
+  const bool isString = JFieldString(&field, string, sizeof(string));
+  return (std::to_string(field.type) + ":" + std::to_string(JFieldNumber(&field)) + ":" + std::to_string(JFieldInt(&field))
+          + ":" + std::to_string(JFieldBool(&field)) + ":" + std::to_string(isString) + ":" + string);
+}
+
+// Describe an item in the same way, as JParse produced it
+std::string described(J *item)
+{
+  if (!item) {
+    return (std::to_string(JInvalid) + ":" + std::to_string(0.0) + ":0:0:0:");
+  }
+  const int type = (item->type & 0xFF);
+  const std::string string = ((JString == type) ? std::string(item->valuestring).substr(0, 63) : std::string());
+  return (std::to_string(type) + ":" + std::to_string((JNumber == type) ? item->valuenumber : 0.0) + ":" + std::to_string((JNumber == type) ? item->valueint : 0)
+          + ":" + std::to_string(JTrue == type) + ":" + std::to_string(JString == type) + ":" + string);
+}
+
+}
+
+int test_n_cjson_helpers_jscan_locates_fields_as_jparse_finds_them()
+{
+  int result = 0;
+
+   // Arrange
+  ////////////
+  NoteSetFnDefault(malloc, free, nullptr, nullptr);
+  JField fields[FIELD_COUNT];
+  for (size_t f = 0 ; f < FIELD_COUNT ; ++f) {
+    fields[f].name = FIELD_NAMES[f];
+  }
+
+  for (size_t d = 0 ; d < DOCUMENT_COUNT && !result ; ++d) {
+   // Action
+  ///////////
+    const int found = JScan(DOCUMENTS[d], fields, FIELD_COUNT);
+    J *json = JParse(DOCUMENTS[d]);
+
+   // Assert
+  ///////////
+    int expectedFound = 0;
+    for (size_t f = 0 ; f < FIELD_COUNT && !result ; ++f) {
+      J *item = lookUp(json, FIELD_NAMES[f]);
+      expectedFound += (item ? 1 : 0);
+      if (described(fields[f]) != described(item)) {
+        result = static_cast<int>('n' + '_' + 'c' + 'j' + 's' + 'o' + 'n');
+        std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+        std::cout << "\tDOCUMENTS[" << d << "] field " << FIELD_NAMES[f] << " == " << described(fields[f]) << ", EXPECTED: " << described(item) << std::endl;
+        std::cout << "[";
+      }
+    }
+    if (!result && expectedFound != found) {
+      result = static_cast<int>('n' + '_' + 'c' + 'j' + 's' + 'o' + 'n');
+      std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+      std::cout << "\tJScan(DOCUMENTS[" << d << "], ...) == " << found << ", EXPECTED: " << expectedFound << std::endl;
+      std::cout << "[";
+    }
+    JDelete(json);
+  }
+
+  return result;
+}
+
+int test_n_cjson_helpers_jscan_rejects_what_jparse_rejects()
+{
+  int result = 0;
+
+   // Arrange
+  ////////////
+  NoteSetFnDefault(malloc, free, nullptr, nullptr);
+  JField field = { "a", nullptr, 0, JInvalid };
+
+  for (size_t d = 0 ; d < INVALID_DOCUMENT_COUNT && !result ; ++d) {
+   // Action
+  ///////////
+    const int found = JScan(INVALID_DOCUMENTS[d], &field, 1);
+    J *json = JParse(INVALID_DOCUMENTS[d]);
+
+   // Assert
+  ///////////
+    if (-1 != found || JInvalid != field.type || json) {
+      result = static_cast<int>('n' + '_' + 'c' + 'j' + 's' + 'o' + 'n');
+      std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+      std::cout << "\tJScan(INVALID_DOCUMENTS[" << d << "], ...) == " << found << " (type " << field.type << "), EXPECTED: -1 (type 0), with JParse(...) == NULL" << std::endl;
+      std::cout << "[";
+    }
+    JDelete(json);
+  }
+
+  return result;
+}
+
+int test_n_cjson_helpers_jfield_string_truncates_without_splitting_a_character()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  const char * const JSON = "{\"err\":\"caf\\u00e9 {io}\",\"empty\":\"\"}";
+  JField fields[] = {{"err", nullptr, 0, JInvalid}, {"empty", nullptr, 0, JInvalid}, {"absent", nullptr, 0, JInvalid}};
+
+   // Action
+  ///////////
+  const int found = JScan(JSON, fields, 3);
+  char whole[16];
+  char truncated[5];
+  const bool wholeOk = JFieldString(&fields[0], whole, sizeof(whole));
+  const bool truncatedOk = JFieldString(&fields[0], truncated, sizeof(truncated));
+
+   // Assert
+  ///////////
+  if (2 == found
+   && wholeOk && std::string("caf\xc3\xa9 {io}") == whole
+   && truncatedOk && std::string("caf") == truncated
+   && JFieldContains(&fields[0], "{io}")
+   && !JFieldContains(&fields[0], "{bad}")
+   && !JFieldIsNullString(&fields[0])
+   && JFieldIsNullString(&fields[1])
+   && JFieldIsNullString(&fields[2]))
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'c' + 'j' + 's' + 'o' + 'n');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tJScan(...) == " << found << ", EXPECTED: 2" << std::endl;
+    std::cout << "\tJFieldString(...) == " << whole << " then " << truncated << ", EXPECTED: caf\xc3\xa9 {io} then caf" << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_n_cjson_helpers_jscan_outperforms_jparse_without_allocating()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  const char * const JSON = "{\"connected\":true,\"status\":\"connected (session open) {connected}\",\"body\":{\"temp\":21.5,\"voltage\":4.21,\"tags\":[\"a\",\"b\",\"c\"]},\"time\":1700000000}\r\n";
+  const size_t ITERATIONS = 10000;
+  NoteSetFn(countingMalloc, free, nullptr, nullptr);
+
+   // Action
+  ///////////
+  allocations = 0;
+  JNUMBER parsed = 0;
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for (size_t i = 0 ; i < ITERATIONS ; ++i) {
+    J *json = JParse(JSON);
+    parsed += JGetNumber(JGetObject(json, "body"), "voltage");
+    JDelete(json);
+  }
+  const std::chrono::duration<double, std::micro> parsedElapsed = (std::chrono::steady_clock::now() - start);
+  const size_t parsedAllocations = (allocations / ITERATIONS);
+
+  allocations = 0;
+  JNUMBER scanned = 0;
+  start = std::chrono::steady_clock::now();
+  for (size_t i = 0 ; i < ITERATIONS ; ++i) {
+    JField field = { "body.voltage", nullptr, 0, JInvalid };
+    JScan(JSON, &field, 1);
+    scanned += JFieldNumber(&field);
+  }
+  const std::chrono::duration<double, std::micro> scannedElapsed = (std::chrono::steady_clock::now() - start);
+  const size_t scannedAllocations = allocations;
+
+  NoteSetFn(malloc, free, nullptr, nullptr);
+
+   // Assert
+  ///////////
+  std::cout << "\33[33mINFO\33[0m] body.voltage of hub.status-sized response: JParse " << parsedAllocations << " allocations, "
+            << std::fixed << std::setprecision(2) << (parsedElapsed.count() / ITERATIONS) << " us; JScan " << scannedAllocations << " allocations, "
+            << (scannedElapsed.count() / ITERATIONS) << " us" << std::endl << "[";
+  if (parsed == scanned
+   && 0 == scannedAllocations
+   && scannedElapsed < parsedElapsed)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'c' + 'j' + 's' + 'o' + 'n');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tscanned == " << scanned << ", EXPECTED: " << parsed << std::endl;
+    std::cout << "\tJScan allocations == " << scannedAllocations << ", EXPECTED: 0, and JScan to outperform JParse" << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int main(void)
+{
+  TestFunction tests[] = {
+      {test_n_cjson_helpers_jscan_locates_fields_as_jparse_finds_them, "test_n_cjson_helpers_jscan_locates_fields_as_jparse_finds_them"},
+      {test_n_cjson_helpers_jscan_rejects_what_jparse_rejects, "test_n_cjson_helpers_jscan_rejects_what_jparse_rejects"},
+      {test_n_cjson_helpers_jfield_string_truncates_without_splitting_a_character, "test_n_cjson_helpers_jfield_string_truncates_without_splitting_a_character"},
+      {test_n_cjson_helpers_jscan_outperforms_jparse_without_allocating, "test_n_cjson_helpers_jscan_outperforms_jparse_without_allocating"},
+  };
+
+  return TestFunction::runTests(tests, (sizeof(tests) / sizeof(TestFunction)));
+}
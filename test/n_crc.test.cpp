@@ -0,0 +1,271 @@
+#include "n_lib.h"
+#include "TestFunction.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+// Compile command: gcc -c -Wall -Wextra -Wpedantic -I../src/note-c ../src/note-c/*.c && g++ -Wall -Wextra -Wpedantic n_*.o n_crc.test.cpp -std=c++11 -I. -I../src/note-c -ggdb -O0 -o n_crc.tests && ./n_crc.tests || echo "Tests Result: $?"
+
+namespace
+{
+
+typedef uint32_t (*crcImplementation)(const void *data, size_t length);
+
+struct Implementation {
+  const char *name;
+  crcImplementation fn;
+};
+
+const Implementation IMPLEMENTATIONS[] = {
+  {"nibble", _crc32Nibble},
+#if defined(NOTE_C_CRC32_SLICE_BY_4) || defined(NOTE_C_CRC32_SLICE_BY_8)
+  {"slice-by-4", _crc32SliceBy4},
+#endif
+#if defined(NOTE_C_CRC32_SLICE_BY_8)
+  {"slice-by-8", _crc32SliceBy8},
+#endif
+};
+const size_t IMPLEMENTATION_COUNT = (sizeof(IMPLEMENTATIONS) / sizeof(IMPLEMENTATIONS[0]));
+
+size_t hookInvoked;
+
+uint32_t crc32Bitwise(const void *data_, size_t length_)
+{
+  const uint8_t *data = static_cast<const uint8_t *>(data_);
+  uint32_t crc = 0xFFFFFFFF;
+  for (size_t i = 0 ; i < length_ ; ++i) {
+    crc ^= data[i];
+    for (int bit = 0 ; bit < 8 ; ++bit) {
+      crc = ((crc >> 1) ^ ((crc & 1) ? 0xEDB88320 : 0));
+    }
+  }
+  return ~crc;
+}
+
+// Stands in for a CRC peripheral, which the host does not have
+uint32_t crc32Peripheral(const void *data_, size_t length_)
+{
+  ++hookInvoked;
+  return _crc32Nibble(data_, length_);
+}
+
+std::vector<uint8_t> pseudoRandomBytes(size_t length_)
+{
+  std::vector<uint8_t> bytes(length_);
+  uint32_t state = 0x19790917;
+  for (size_t i = 0 ; i < length_ ; ++i) {
+    state = ((state * 1103515245) + 12345);
+    bytes[i] = static_cast<uint8_t>(state >> 16);
+  }
+  return bytes;
+}
+
+#if defined(NOTE_C_CRC32_SLICE_BY_4) || defined(NOTE_C_CRC32_SLICE_BY_8)
+// Returns the throughput of a CRC implementation, in megabytes per second
+double benchmark(crcImplementation fn_, const std::vector<uint8_t> &buffer_, size_t totalBytes_, uint32_t *crc_)
+{
+  const size_t iterations = ((totalBytes_ / buffer_.size()) ? (totalBytes_ / buffer_.size()) : 1);
+  uint32_t crc = 0;
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0 ; i < iterations ; ++i) {
+    crc ^= fn_(buffer_.data(), buffer_.size());
+  }
+  const std::chrono::duration<double> elapsed = (std::chrono::steady_clock::now() - start);
+  *crc_ = crc;
+  return ((iterations * buffer_.size()) / (elapsed.count() * 1000000.0));
+}
+#endif
+
+}
+
+int test_n_crc_implementations_produce_the_standard_check_value()
+{
+  int result = 0;
+
+   // Arrange
+  ////////////
+  static const char CHECK_INPUT[] = "123456789";
+  const uint32_t EXPECTED_CRC = 0xCBF43926;
+
+   // Action
+  ///////////
+  uint32_t actual[IMPLEMENTATION_COUNT];
+  for (size_t i = 0 ; i < IMPLEMENTATION_COUNT ; ++i) {
+    actual[i] = IMPLEMENTATIONS[i].fn(CHECK_INPUT, (sizeof(CHECK_INPUT) - 1));
+  }
+
+   // Assert
+  ///////////
+  for (size_t i = 0 ; i < IMPLEMENTATION_COUNT ; ++i) {
+    if (EXPECTED_CRC != actual[i]) {
+      if (!result) {
+        result = static_cast<int>('n' + '_' + 'c' + 'r' + 'c');
+        std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+      }
+      std::cout << "\t" << IMPLEMENTATIONS[i].name << "(\"123456789\") == 0x" << std::hex << actual[i] << ", EXPECTED: 0x" << EXPECTED_CRC << std::dec << std::endl;
+    }
+  }
+  if (result) {
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_n_crc_implementations_agree_for_every_length_and_alignment()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  const std::vector<uint8_t> bytes = pseudoRandomBytes(128);
+  bool mismatch = false;
+  size_t mismatchImplementation = 0;
+  size_t mismatchOffset = 0;
+  size_t mismatchLength = 0;
+
+   // Action
+  ///////////
+  for (size_t offset = 0 ; offset < 8 && !mismatch ; ++offset) {
+    for (size_t length = 0 ; (offset + length) <= 100 && !mismatch ; ++length) {
+      const uint32_t expected = crc32Bitwise(&bytes[offset], length);
+      for (size_t i = 0 ; i < IMPLEMENTATION_COUNT && !mismatch ; ++i) {
+        if (expected != IMPLEMENTATIONS[i].fn(&bytes[offset], length)) {
+          mismatch = true;
+          mismatchImplementation = i;
+          mismatchOffset = offset;
+          mismatchLength = length;
+        }
+      }
+    }
+  }
+
+   // Assert
+  ///////////
+  if (!mismatch)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'c' + 'r' + 'c');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\t" << IMPLEMENTATIONS[mismatchImplementation].name << "(&bytes[" << mismatchOffset << "], " << mismatchLength << ") == 0x" << std::hex << IMPLEMENTATIONS[mismatchImplementation].fn(&bytes[mismatchOffset], mismatchLength) << ", EXPECTED: 0x" << crc32Bitwise(&bytes[mismatchOffset], mismatchLength) << std::dec << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_n_crc_uses_the_crc32_hook_until_it_is_cleared()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  static const char CHECK_INPUT[] = "123456789";
+  hookInvoked = 0;
+
+   // Action
+  ///////////
+  NoteSetFnCRC32(crc32Peripheral);
+  crc32Fn installed = nullptr;
+  NoteGetFnCRC32(&installed);
+  const uint32_t withHook = _crc32(CHECK_INPUT, (sizeof(CHECK_INPUT) - 1));
+  const size_t invokedWithHook = hookInvoked;
+  NoteSetFnCRC32(nullptr);
+  const uint32_t withoutHook = _crc32(CHECK_INPUT, (sizeof(CHECK_INPUT) - 1));
+
+   // Assert
+  ///////////
+  if (crc32Peripheral == installed
+   && 1 == invokedWithHook
+   && 1 == hookInvoked
+   && 0xCBF43926 == withHook
+   && 0xCBF43926 == withoutHook)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'c' + 'r' + 'c');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\thookInvoked == " << invokedWithHook << " then " << hookInvoked << ", EXPECTED: 1 then 1" << std::endl;
+    std::cout << "\t_crc32(\"123456789\") == 0x" << std::hex << withHook << " then 0x" << withoutHook << ", EXPECTED: 0xcbf43926 then 0xcbf43926" << std::dec << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+#if defined(NOTE_C_CRC32_SLICE_BY_4) || defined(NOTE_C_CRC32_SLICE_BY_8)
+int test_n_crc_slice_by_n_outperforms_the_nibble_table()
+{
+  int result = 0;
+
+   // Arrange
+  ////////////
+  const size_t SIZES[] = {256, 4096, 65536};
+  const size_t TOTAL_BYTES = (1024 * 1024);
+  NoteSetFnCRC32(crc32Peripheral);
+
+   // Action
+  ///////////
+  double throughput[3][IMPLEMENTATION_COUNT + 1];
+  uint32_t crc[3][IMPLEMENTATION_COUNT + 1];
+  for (size_t s = 0 ; s < 3 ; ++s) {
+    const std::vector<uint8_t> buffer = pseudoRandomBytes(SIZES[s]);
+    for (size_t i = 0 ; i < IMPLEMENTATION_COUNT ; ++i) {
+      throughput[s][i] = benchmark(IMPLEMENTATIONS[i].fn, buffer, TOTAL_BYTES, &crc[s][i]);
+    }
+    throughput[s][IMPLEMENTATION_COUNT] = benchmark(_crc32, buffer, TOTAL_BYTES, &crc[s][IMPLEMENTATION_COUNT]);
+  }
+  NoteSetFnCRC32(nullptr);
+
+   // Assert
+  ///////////
+  for (size_t s = 0 ; s < 3 ; ++s) {
+    std::cout << "\33[33mINFO\33[0m] " << std::setw(5) << SIZES[s] << " B:";
+    for (size_t i = 0 ; i < IMPLEMENTATION_COUNT ; ++i) {
+      std::cout << " " << IMPLEMENTATIONS[i].name << " " << std::fixed << std::setprecision(1) << throughput[s][i] << " MB/s,";
+    }
+    std::cout << " hook " << throughput[s][IMPLEMENTATION_COUNT] << " MB/s" << std::endl << "[";
+    for (size_t i = 1 ; i <= IMPLEMENTATION_COUNT ; ++i) {
+      if (crc[s][0] != crc[s][i]) {
+        result = static_cast<int>('n' + '_' + 'c' + 'r' + 'c');
+      }
+    }
+  }
+  const size_t LARGEST = 2;
+  for (size_t i = 1 ; i < IMPLEMENTATION_COUNT ; ++i) {
+    if (throughput[LARGEST][i] <= throughput[LARGEST][0]) {
+      result = static_cast<int>('n' + '_' + 'c' + 'r' + 'c');
+    }
+  }
+  if (result)
+  {
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tEXPECTED: every implementation to agree, and each slice-by-N table to outperform the nibble table on 64 KB" << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+#endif
+
+int main(void)
+{
+  TestFunction tests[] = {
+      {test_n_crc_implementations_produce_the_standard_check_value, "test_n_crc_implementations_produce_the_standard_check_value"},
+      {test_n_crc_implementations_agree_for_every_length_and_alignment, "test_n_crc_implementations_agree_for_every_length_and_alignment"},
+      {test_n_crc_uses_the_crc32_hook_until_it_is_cleared, "test_n_crc_uses_the_crc32_hook_until_it_is_cleared"},
+#if defined(NOTE_C_CRC32_SLICE_BY_4) || defined(NOTE_C_CRC32_SLICE_BY_8)
+      {test_n_crc_slice_by_n_outperforms_the_nibble_table, "test_n_crc_slice_by_n_outperforms_the_nibble_table"},
+#endif
+  };
+
+  return TestFunction::runTests(tests, (sizeof(tests) / sizeof(TestFunction)));
+}
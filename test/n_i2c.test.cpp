@@ -0,0 +1,509 @@
+#include "note.h"
+#include "TestFunction.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+// Compile command: gcc -c -Wall -Wextra -Wpedantic -I../src/note-c ../src/note-c/*.c && g++ -Wall -Wextra -Wpedantic n_*.o n_i2c.test.cpp -std=c++11 -I. -I../src/note-c -ggdb -O0 -o n_i2c.tests && ./n_i2c.tests || echo "Tests Result: $?"
+
+// This suite links against the real note-c library and stands up a simulated
+// I2C bus, shared by a fake Notecard and a fake sensor. Time is simulated, so
+// the stress tests can measure how long the sensor waits for the bus while the
+// Notecard processes requests, without actually waiting.
+
+namespace
+{
+
+const uint32_t NOTECARD_LATENCY_MS = 1500;
+const uint32_t SENSOR_PERIOD_MS = 5;
+
+// Simulated clock and bus
+uint32_t nowMs;
+int busLockDepth;
+bool busLockUnbalanced;
+uint32_t busLockedAtMs;
+uint32_t maxBusHoldMs;
+uint32_t maxTransferMs;
+
+// Fake sensor, serviced whenever time passes or the bus is released
+uint32_t sensorDueMs;
+uint32_t sensorMaxWaitMs;
+size_t sensorReads;
+
+// Fake Notecard
+std::string notecardRequest;
+std::string notecardResponse;
+uint32_t notecardResponseReadyMs;
+uint32_t notecardLatencyMs;
+bool notecardNackNext;
+size_t notecardNacks;
+
+void serviceSensor(void)
+{
+  if (busLockDepth || nowMs < sensorDueMs) {
+    return;
+  }
+  const uint32_t waitMs = (nowMs - sensorDueMs);
+  if (waitMs > sensorMaxWaitMs) {
+    sensorMaxWaitMs = waitMs;
+  }
+  ++sensorReads;
+  ++nowMs;  // The sensor read occupies the bus for a millisecond
+  sensorDueMs = (nowMs - (nowMs % SENSOR_PERIOD_MS) + SENSOR_PERIOD_MS);
+}
+
+void advance(uint32_t ms)
+{
+  for (uint32_t i = 0 ; i < ms ; ++i) {
+    ++nowMs;
+    serviceSensor();
+  }
+}
+
+// Model a 100kHz bus, which moves roughly ten bytes per millisecond
+void transfer(size_t bytes)
+{
+  const uint32_t ms = (1 + static_cast<uint32_t>(bytes / 10));
+  if (ms > maxTransferMs) {
+    maxTransferMs = ms;
+  }
+  nowMs += ms;
+}
+
+void delayMs(uint32_t ms)
+{
+  advance(ms);
+}
+
+uint32_t getMs(void)
+{
+  return nowMs;
+}
+
+void lockI2c(void)
+{
+  if (busLockDepth++) {
+    busLockUnbalanced = true;
+  }
+  busLockedAtMs = nowMs;
+}
+
+void unlockI2c(void)
+{
+  if (0 == busLockDepth--) {
+    busLockUnbalanced = true;
+  }
+  const uint32_t holdMs = (nowMs - busLockedAtMs);
+  if (holdMs > maxBusHoldMs) {
+    maxBusHoldMs = holdMs;
+  }
+
+  // A sensor task blocked on the mutex takes the bus as soon as it's released
+  serviceSensor();
+}
+
+bool notecardReset(uint16_t)
+{
+  notecardRequest.clear();
+  notecardResponse.clear();
+  return true;
+}
+
+// Answer a bare newline immediately with `\r\n`, and any request, after the
+// simulated processing latency, with a response padded to the requested size.
+// A new request replaces any response that was never collected.
+void notecardProcess(void)
+{
+  if (notecardRequest.empty()) {
+    notecardResponse += "\r\n";
+    notecardResponseReadyMs = nowMs;
+    return;
+  }
+  size_t size = 0;
+  J *req = JParse(notecardRequest.c_str());
+  if (req) {
+    size = static_cast<size_t>(JGetInt(req, "size"));
+    JDelete(req);
+  }
+  notecardResponse = "{\"size\":" + std::to_string(size) + ",\"pad\":\"" + std::string(size, 'x') + "\"}\r\n";
+  notecardResponseReadyMs = (nowMs + notecardLatencyMs);
+}
+
+const char * notecardTransmit(uint16_t, uint8_t *txBuf, uint16_t txBufSize)
+{
+  transfer(txBufSize);
+  if (notecardNackNext) {
+    notecardNackNext = false;
+    ++notecardNacks;
+    return "i2c: NACK {io}";
+  }
+  for (size_t i = 0 ; i < txBufSize ; ++i) {
+    if ('\n' == txBuf[i]) {
+      notecardProcess();
+      notecardRequest.clear();
+    } else {
+      notecardRequest += static_cast<char>(txBuf[i]);
+    }
+  }
+  return nullptr;
+}
+
+const char * notecardReceive(uint16_t, uint8_t *rxBuf, uint16_t rxBufSize, uint32_t *available)
+{
+  transfer(rxBufSize);
+  const bool ready = (nowMs >= notecardResponseReadyMs);
+  if (!ready || rxBufSize > notecardResponse.size()) {
+    rxBufSize = 0;
+  }
+  memcpy(rxBuf, notecardResponse.data(), rxBufSize);
+  notecardResponse.erase(0, rxBufSize);
+  *available = (ready ? static_cast<uint32_t>(notecardResponse.size()) : 0);
+  return nullptr;
+}
+
+void setUp(bool busSharing)
+{
+  nowMs = 0;
+  busLockDepth = 0;
+  busLockUnbalanced = false;
+  busLockedAtMs = 0;
+  maxBusHoldMs = 0;
+  maxTransferMs = 0;
+  sensorDueMs = SENSOR_PERIOD_MS;
+  sensorMaxWaitMs = 0;
+  sensorReads = 0;
+  notecardRequest.clear();
+  notecardResponse.clear();
+  notecardResponseReadyMs = 0;
+  notecardLatencyMs = NOTECARD_LATENCY_MS;
+  notecardNackNext = false;
+  notecardNacks = 0;
+
+  NoteSetFn(malloc, free, delayMs, getMs);
+  NoteSetFnI2CMutex(lockI2c, unlockI2c);
+  NoteSetFnI2C(NOTE_I2C_ADDR_DEFAULT, NOTE_I2C_MAX_DEFAULT, notecardReset, notecardTransmit, notecardReceive);
+  NoteSetI2CBusSharing(busSharing);
+  NoteSetI2CPacingAdaptive(false, nullptr);
+}
+
+// Send a request asking for a response of the given size, and return the
+// size of the response actually received, or -1 upon failure.
+int transaction(int size)
+{
+  int result = -1;
+  J *req = NoteNewRequest("note.add");
+  JAddIntToObject(req, "size", size);
+  J *rsp = NoteRequestResponse(req);
+  if (rsp) {
+    const char *pad = JGetString(rsp, "pad");
+    if (!NoteResponseError(rsp) && (JGetInt(rsp, "size") == size) && (strlen(pad) == static_cast<size_t>(size))) {
+      result = size;
+    }
+    JDelete(rsp);
+  }
+  return result;
+}
+
+}
+
+int test_n_i2c_without_bus_sharing_other_bus_users_wait_for_the_whole_transaction()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  setUp(false);
+  const int size = 16;
+
+   // Action
+  ///////////
+  const int actual = transaction(size);
+  advance(SENSOR_PERIOD_MS);
+
+   // Assert
+  ///////////
+  if (size == actual
+   && !busLockDepth
+   && !busLockUnbalanced
+   && NOTECARD_LATENCY_MS <= maxBusHoldMs
+   && NOTECARD_LATENCY_MS <= sensorMaxWaitMs)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'i' + '2' + 'c');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\ttransaction(" << size << ") == " << actual << ", EXPECTED: " << size << std::endl;
+    std::cout << "\tbusLockDepth == " << busLockDepth << ", EXPECTED: 0" << std::endl;
+    std::cout << "\tbusLockUnbalanced == " << busLockUnbalanced << ", EXPECTED: false" << std::endl;
+    std::cout << "\tmaxBusHoldMs == " << maxBusHoldMs << ", EXPECTED: >= " << NOTECARD_LATENCY_MS << std::endl;
+    std::cout << "\tsensorMaxWaitMs == " << sensorMaxWaitMs << ", EXPECTED: >= " << NOTECARD_LATENCY_MS << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_n_i2c_with_bus_sharing_other_bus_users_only_wait_for_a_single_transfer()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  setUp(true);
+  const int size = 16;
+
+   // Action
+  ///////////
+  const int actual = transaction(size);
+  advance(SENSOR_PERIOD_MS);
+
+   // Assert
+  ///////////
+  // The sensor may have fallen due an instant after a transfer began, and is
+  // serviced on the following millisecond tick.
+  if (size == actual
+   && !busLockDepth
+   && !busLockUnbalanced
+   && maxTransferMs >= maxBusHoldMs
+   && (maxTransferMs + 1) >= sensorMaxWaitMs
+   && (NOTECARD_LATENCY_MS / SENSOR_PERIOD_MS) <= sensorReads)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'i' + '2' + 'c');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\ttransaction(" << size << ") == " << actual << ", EXPECTED: " << size << std::endl;
+    std::cout << "\tbusLockDepth == " << busLockDepth << ", EXPECTED: 0" << std::endl;
+    std::cout << "\tbusLockUnbalanced == " << busLockUnbalanced << ", EXPECTED: false" << std::endl;
+    std::cout << "\tmaxBusHoldMs == " << maxBusHoldMs << ", EXPECTED: <= " << maxTransferMs << std::endl;
+    std::cout << "\tsensorMaxWaitMs == " << sensorMaxWaitMs << ", EXPECTED: <= " << (maxTransferMs + 1) << std::endl;
+    std::cout << "\tsensorReads == " << sensorReads << ", EXPECTED: >= " << (NOTECARD_LATENCY_MS / SENSOR_PERIOD_MS) << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_n_i2c_with_bus_sharing_stress_keeps_responses_intact_and_the_bus_available()
+{
+  int result = 0;
+
+   // Arrange
+  ////////////
+  setUp(true);
+  const int transactions = 40;
+  int failedSize = -1;
+
+   // Action
+  ///////////
+  // Vary the response size from empty to well over a single segment, so that
+  // both the chunked transmit and the chunked receive yield the bus mid-way.
+  for (int i = 0 ; i < transactions ; ++i) {
+    const int size = ((i * 97) % 1200);
+    if (size != transaction(size)) {
+      failedSize = size;
+      break;
+    }
+    advance(i % SENSOR_PERIOD_MS);
+  }
+
+   // Assert
+  ///////////
+  if (-1 == failedSize
+   && !busLockDepth
+   && !busLockUnbalanced
+   && maxTransferMs >= maxBusHoldMs
+   && (maxTransferMs + 1) >= sensorMaxWaitMs)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'i' + '2' + 'c');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tfailedSize == " << failedSize << ", EXPECTED: -1" << std::endl;
+    std::cout << "\tbusLockDepth == " << busLockDepth << ", EXPECTED: 0" << std::endl;
+    std::cout << "\tbusLockUnbalanced == " << busLockUnbalanced << ", EXPECTED: false" << std::endl;
+    std::cout << "\tmaxBusHoldMs == " << maxBusHoldMs << ", EXPECTED: <= " << maxTransferMs << std::endl;
+    std::cout << "\tsensorMaxWaitMs == " << sensorMaxWaitMs << ", EXPECTED: <= " << (maxTransferMs + 1) << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_n_i2c_adaptive_pacing_converges_on_the_fastest_reliable_level()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  setUp(false);
+  NoteSetI2CPacingAdaptive(true, nullptr);
+  const uint8_t reliableLevel = 3;
+  const int transactions = 400;
+  const int settledFrom = (transactions / 2);
+  int failedSize = -1;
+  int settledAtReliable = 0;
+  uint8_t settledMinLevel = NOTE_I2C_PACING_LEVEL_MAX;
+
+   // Action
+  ///////////
+  // The Notecard NACKs any transfer paced faster than the reliable level
+  for (int i = 0 ; i < transactions ; ++i) {
+    NoteI2CPacing profile;
+    NoteGetI2CPacing(&profile);
+    notecardNackNext = (profile.level < reliableLevel);
+    if (i >= settledFrom) {
+      if (profile.level < settledMinLevel) {
+        settledMinLevel = profile.level;
+      }
+      if (profile.level == reliableLevel || profile.level == (reliableLevel + 1)) {
+        ++settledAtReliable;
+      }
+    }
+    const int size = (i % 64);
+    if (size != transaction(size)) {
+      failedSize = size;
+      break;
+    }
+  }
+
+   // Assert
+  ///////////
+  // Once settled, the floor is only probed occasionally, one level down
+  const int settled = (transactions - settledFrom);
+  if (-1 == failedSize
+   && notecardNacks <= static_cast<size_t>(transactions / 16)
+   && settledMinLevel >= (reliableLevel - 1)
+   && (settledAtReliable * 10) >= (settled * 9))
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'i' + '2' + 'c');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tfailedSize == " << failedSize << ", EXPECTED: -1" << std::endl;
+    std::cout << "\tnotecardNacks == " << notecardNacks << ", EXPECTED: <= " << (transactions / 16) << std::endl;
+    std::cout << "\tsettledMinLevel == " << static_cast<int>(settledMinLevel) << ", EXPECTED: >= " << (reliableLevel - 1) << std::endl;
+    std::cout << "\tsettledAtReliable == " << settledAtReliable << ", EXPECTED: >= " << ((settled * 9) / 10) << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_n_i2c_adaptive_pacing_floor_decays_once_the_bus_recovers()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  setUp(false);
+  NoteI2CPacing learned;
+  learned.level = NOTE_I2C_PACING_LEVEL_MAX;
+  learned.floor = NOTE_I2C_PACING_LEVEL_MAX;
+  NoteSetI2CPacingAdaptive(true, &learned);
+  const int transactions = 600;
+  int failedSize = -1;
+
+   // Action
+  ///////////
+  // The profile was learned on a marginal bus, which has since recovered
+  for (int i = 0 ; i < transactions ; ++i) {
+    const int size = (i % 64);
+    if (size != transaction(size)) {
+      failedSize = size;
+      break;
+    }
+  }
+  NoteI2CPacing profile;
+  NoteGetI2CPacing(&profile);
+
+   // Assert
+  ///////////
+  if (-1 == failedSize
+   && 0 == notecardNacks
+   && 0 == profile.level
+   && 0 == profile.floor)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'i' + '2' + 'c');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tfailedSize == " << failedSize << ", EXPECTED: -1" << std::endl;
+    std::cout << "\tnotecardNacks == " << notecardNacks << ", EXPECTED: 0" << std::endl;
+    std::cout << "\tprofile.level == " << static_cast<int>(profile.level) << ", EXPECTED: 0" << std::endl;
+    std::cout << "\tprofile.floor == " << static_cast<int>(profile.floor) << ", EXPECTED: 0" << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_n_i2c_adaptive_pacing_ignores_response_wait_timeouts()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  setUp(false);
+  NoteSetI2CPacingAdaptive(true, nullptr);
+  notecardLatencyMs = 3000;
+  J *req = NoteNewRequest("note.add");
+  JAddIntToObject(req, "size", 16);
+  JAddIntToObject(req, "milliseconds", 500);
+
+   // Action
+  ///////////
+  J *rsp = NoteRequestResponse(req);
+  const bool timedOut = (nullptr == rsp || NoteResponseError(rsp));
+  JDelete(rsp);
+  NoteI2CPacing profile;
+  NoteGetI2CPacing(&profile);
+
+   // Assert
+  ///////////
+  if (timedOut
+   && 0 == notecardNacks
+   && 0 == profile.level
+   && 0 == profile.floor)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'i' + '2' + 'c');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\ttimedOut == " << timedOut << ", EXPECTED: true" << std::endl;
+    std::cout << "\tnotecardNacks == " << notecardNacks << ", EXPECTED: 0" << std::endl;
+    std::cout << "\tprofile.level == " << static_cast<int>(profile.level) << ", EXPECTED: 0" << std::endl;
+    std::cout << "\tprofile.floor == " << static_cast<int>(profile.floor) << ", EXPECTED: 0" << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int main(void)
+{
+  TestFunction tests[] = {
+      {test_n_i2c_without_bus_sharing_other_bus_users_wait_for_the_whole_transaction, "test_n_i2c_without_bus_sharing_other_bus_users_wait_for_the_whole_transaction"},
+      {test_n_i2c_with_bus_sharing_other_bus_users_only_wait_for_a_single_transfer, "test_n_i2c_with_bus_sharing_other_bus_users_only_wait_for_a_single_transfer"},
+      {test_n_i2c_with_bus_sharing_stress_keeps_responses_intact_and_the_bus_available, "test_n_i2c_with_bus_sharing_stress_keeps_responses_intact_and_the_bus_available"},
+      {test_n_i2c_adaptive_pacing_converges_on_the_fastest_reliable_level, "test_n_i2c_adaptive_pacing_converges_on_the_fastest_reliable_level"},
+      {test_n_i2c_adaptive_pacing_floor_decays_once_the_bus_recovers, "test_n_i2c_adaptive_pacing_floor_decays_once_the_bus_recovers"},
+      {test_n_i2c_adaptive_pacing_ignores_response_wait_timeouts, "test_n_i2c_adaptive_pacing_ignores_response_wait_timeouts"},
+  };
+
+  return TestFunction::runTests(tests, (sizeof(tests) / sizeof(TestFunction)));
+}
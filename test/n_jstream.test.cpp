@@ -0,0 +1,222 @@
+#include "n_lib.h"
+#include "TestFunction.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+// Compile command: gcc -c -Wall -Wextra -Wpedantic -I../src/note-c ../src/note-c/*.c && g++ -Wall -Wextra -Wpedantic n_*.o n_jstream.test.cpp -std=c++11 -I. -I../src/note-c -ggdb -O0 -o n_jstream.tests && ./n_jstream.tests || echo "Tests Result: $?"
+
+namespace
+{
+
+const char * const DOCUMENTS[] = {
+  "{}",
+  "[]",
+  "{\"a\":[]}",
+  "{\"req\":\"note.add\",\"body\":{\"temp\":-12.5e1,\"count\":42,\"big\":9007199254740993},\"sync\":true,\"id\":null,\"off\":false}",
+  "{\"escapes\":\"q\\\" b\\\\ s\\/ \\b\\f\\n\\r\\t\",\"utf16\":\"\\u00e9\\u20AC\\ud83d\\ude00\",\"raw\":\"\xc3\xa9\"}",
+  "  {\"nested\" : [ 1 , [ 2 , { \"three\" : [ ] } ] , { } ] }  ",
+  "[1,2.5,\"three\",true,false,null,{\"k\":\"v\"}]",
+};
+const size_t DOCUMENT_COUNT = (sizeof(DOCUMENTS) / sizeof(DOCUMENTS[0]));
+
+const char * const INVALID_DOCUMENTS[] = {
+  "",
+  "{",
+  "{\"a\":1",
+  "{\"a\" 1}",
+  "{\"a\":1,}",
+  "{\"a\":1]",
+  "[1,2}",
+  "{\"a\":tru}",
+  "{\"a\":\"\\x\"}",
+  "{\"a\":\"\\u12G4\"}",
+  "{\"a\":\"\\udc00\"}",
+  "{\"a\":\"\\ud83dx\"}",
+  "{1:2}",
+};
+const size_t INVALID_DOCUMENT_COUNT = (sizeof(INVALID_DOCUMENTS) / sizeof(INVALID_DOCUMENTS[0]));
+
+std::string printed(J *json)
+{
+  char *text = JPrintUnformatted(json);
+  const std::string result = (text ? text : "(null)");
+  JFree(text);
+  return result;
+}
+
+// Feed a document to a parser in two pieces, split at the given offset
+J *parseSplit(NoteJStream *stream, const std::string &document, size_t split)
+{
+  _jStreamReset(stream);
+  _jStreamFeed(stream, reinterpret_cast<const uint8_t *>(document.data()), split);
+  _jStreamFeed(stream, reinterpret_cast<const uint8_t *>(document.data() + split), (document.size() - split));
+  return _jStreamFinish(stream);
+}
+
+// A response as the Notecard sends it, with a CRC field over the rest
+std::string withCrc(const std::string &document, uint16_t seqno)
+{
+  char crc[sizeof(",\"crc\":\"SSSS:CCCCCCCC\"}")];
+  snprintf(crc, sizeof(crc), ",\"crc\":\"%04X:%08X\"}", seqno, static_cast<unsigned int>(_crc32(document.data(), document.size())));
+  return (document.substr(0, document.size() - 1) + crc + "\r\n");
+}
+
+}
+
+int test_n_jstream_matches_jparse_however_the_document_is_split()
+{
+  int result = 0;
+
+   // Arrange
+  ////////////
+  NoteSetFnDefault(malloc, free, nullptr, nullptr);
+  NoteJStream *stream = _jStreamCreate();
+
+   // Action
+  ///////////
+  // Every document is followed by a newline, as a response would be
+  for (size_t d = 0 ; d < DOCUMENT_COUNT && !result ; ++d) {
+    const std::string document = (std::string(DOCUMENTS[d]) + "\r\n");
+    J *expected = JParse(DOCUMENTS[d]);
+    const std::string expectedText = printed(expected);
+    JDelete(expected);
+
+    for (size_t split = 0 ; split <= document.size() && !result ; ++split) {
+      J *actual = parseSplit(stream, document, split);
+      const std::string actualText = printed(actual);
+      JDelete(actual);
+
+   // Assert
+  ///////////
+      if (expectedText != actualText) {
+        result = static_cast<int>('n' + '_' + 'j' + 's' + 't' + 'r' + 'e' + 'a' + 'm');
+        std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+        std::cout << "\tDOCUMENTS[" << d << "] split at " << split << " == " << actualText << ", EXPECTED: " << expectedText << std::endl;
+        std::cout << "[";
+      }
+    }
+  }
+
+  _jStreamDelete(stream);
+  return result;
+}
+
+int test_n_jstream_rejects_invalid_documents_however_they_are_split()
+{
+  int result = 0;
+
+   // Arrange
+  ////////////
+  NoteSetFnDefault(malloc, free, nullptr, nullptr);
+  NoteJStream *stream = _jStreamCreate();
+
+   // Action
+  ///////////
+  for (size_t d = 0 ; d < INVALID_DOCUMENT_COUNT && !result ; ++d) {
+    const std::string document = (std::string(INVALID_DOCUMENTS[d]) + "\r\n");
+    for (size_t split = 0 ; split <= document.size() && !result ; ++split) {
+      J *actual = parseSplit(stream, document, split);
+
+   // Assert
+  ///////////
+      if (actual) {
+        result = static_cast<int>('n' + '_' + 'j' + 's' + 't' + 'r' + 'e' + 'a' + 'm');
+        std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+        std::cout << "\tINVALID_DOCUMENTS[" << d << "] split at " << split << " == " << printed(actual) << ", EXPECTED: (null)" << std::endl;
+        std::cout << "[";
+      }
+      JDelete(actual);
+    }
+  }
+
+  _jStreamDelete(stream);
+  return result;
+}
+
+int test_n_jstream_computes_the_crc_of_the_response_without_its_crc_field()
+{
+  int result = 0;
+
+   // Arrange
+  ////////////
+  const std::string document = "{\"changes\":2,\"notes\":{\"a\":{\"body\":{\"n\":1}},\"b\":{\"body\":{\"n\":2}}}}";
+  const std::string response = withCrc(document, 0x1234);
+  NoteSetFnDefault(malloc, free, nullptr, nullptr);
+  NoteJStream *stream = _jStreamCreate();
+
+   // Action
+  ///////////
+  for (size_t split = 0 ; split <= response.size() && !result ; ++split) {
+    J *rsp = parseSplit(stream, response, split);
+    uint16_t seqno = 0;
+    uint32_t crc = 0;
+    uint32_t expectedCrc = 0;
+    const bool found = _jStreamCrc(stream, &seqno, &crc, &expectedCrc);
+
+   // Assert
+  ///////////
+    if (!rsp || !found || 0x1234 != seqno || crc != expectedCrc || _crc32(document.data(), document.size()) != crc) {
+      result = static_cast<int>('n' + '_' + 'j' + 's' + 't' + 'r' + 'e' + 'a' + 'm');
+      std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+      std::cout << "\tsplit at " << split << ": found == " << found << ", seqno == 0x" << std::hex << seqno << ", crc == 0x" << crc << ", expectedCrc == 0x" << expectedCrc << std::dec << std::endl;
+      std::cout << "[";
+    }
+    JDelete(rsp);
+  }
+
+  _jStreamDelete(stream);
+  return result;
+}
+
+int test_n_jstream_finds_no_crc_in_a_response_without_one()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  const std::string response = "{\"temperature\":21.5,\"humidity\":40.0}\r\n";
+  NoteSetFnDefault(malloc, free, nullptr, nullptr);
+  NoteJStream *stream = _jStreamCreate();
+
+   // Action
+  ///////////
+  J *rsp = parseSplit(stream, response, (response.size() / 2));
+  uint16_t seqno = 0;
+  uint32_t crc = 0;
+  uint32_t expectedCrc = 0;
+  const bool found = _jStreamCrc(stream, &seqno, &crc, &expectedCrc);
+
+   // Assert
+  ///////////
+  if (rsp && !found && 40 == JGetInt(rsp, "humidity"))
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'j' + 's' + 't' + 'r' + 'e' + 'a' + 'm');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\t_jStreamCrc(...) == " << found << ", EXPECTED: false" << std::endl;
+    std::cout << "[";
+  }
+
+  JDelete(rsp);
+  _jStreamDelete(stream);
+  return result;
+}
+
+int main(void)
+{
+  TestFunction tests[] = {
+      {test_n_jstream_matches_jparse_however_the_document_is_split, "test_n_jstream_matches_jparse_however_the_document_is_split"},
+      {test_n_jstream_rejects_invalid_documents_however_they_are_split, "test_n_jstream_rejects_invalid_documents_however_they_are_split"},
+      {test_n_jstream_computes_the_crc_of_the_response_without_its_crc_field, "test_n_jstream_computes_the_crc_of_the_response_without_its_crc_field"},
+      {test_n_jstream_finds_no_crc_in_a_response_without_one, "test_n_jstream_finds_no_crc_in_a_response_without_one"},
+  };
+
+  return TestFunction::runTests(tests, (sizeof(tests) / sizeof(TestFunction)));
+}
@@ -0,0 +1,440 @@
+#include "mock/mock-parameters.hpp"
+#include "TestFunction.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include <pthread.h>
+#include <sched.h>
+
+// Compile command: g++ -Wall -Wextra -Wpedantic -pthread mock/mock-note-c-note.c ../src/note-c/n_queue.c n_queue.test.cpp -std=c++11 -I. -I../src -I../src/note-c -DNOTE_MOCK -ggdb -O0 -o n_queue.tests && ./n_queue.tests || echo "Tests Result: $?"
+
+namespace
+{
+
+J * const RESPONSE = reinterpret_cast<J *>(0x19790917);
+
+pthread_mutex_t queueMutex = PTHREAD_MUTEX_INITIALIZER;
+
+void lockQueue(void)
+{
+  pthread_mutex_lock(&queueMutex);
+}
+
+void unlockQueue(void)
+{
+  pthread_mutex_unlock(&queueMutex);
+}
+
+J * fakeRequest(uintptr_t n)
+{
+  return reinterpret_cast<J *>(n + 1);
+}
+
+// Completions, as seen by the worker
+std::vector<uintptr_t> completedContexts;
+std::vector<J *> completedResponses;
+
+void recordCompletion(J *rsp, void *context)
+{
+  completedContexts.push_back(reinterpret_cast<uintptr_t>(context));
+  completedResponses.push_back(rsp);
+}
+
+// Throughput test state
+const size_t THROUGHPUT_REQUESTS = 16000;
+const size_t THROUGHPUT_QUEUE_CAPACITY = 32;
+
+struct Throughput {
+  NoteRequestQueue queue;
+  size_t producers;
+  size_t perProducer;
+  size_t completed;
+  bool outOfOrder;
+  std::vector<size_t> nextSeq;
+};
+
+struct Producer {
+  Throughput *throughput;
+  uintptr_t id;
+};
+
+Throughput *activeThroughput;
+
+// The context packs the producer above the low 16 bits, which hold the
+// sequence number of the request from that producer
+void throughputRecord(J *, void *context)
+{
+  const uintptr_t packed = reinterpret_cast<uintptr_t>(context);
+  const size_t producer = static_cast<size_t>(packed >> 16);
+  const size_t seq = static_cast<size_t>(packed & 0xFFFF);
+  if (activeThroughput->nextSeq[producer] != seq) {
+    activeThroughput->outOfOrder = true;
+  }
+  activeThroughput->nextSeq[producer] = (seq + 1);
+  ++activeThroughput->completed;
+}
+
+void * produce(void *arg)
+{
+  Producer *producer = static_cast<Producer *>(arg);
+  Throughput *throughput = producer->throughput;
+  for (uintptr_t seq = 0 ; seq < throughput->perProducer ; ++seq) {
+    const uintptr_t packed = ((producer->id << 16) | seq);
+    while (!NoteRequestQueuePush(&throughput->queue, fakeRequest(packed), throughputRecord, reinterpret_cast<void *>(packed))) {
+      sched_yield();
+    }
+  }
+  return nullptr;
+}
+
+void * work(void *arg)
+{
+  Throughput *throughput = static_cast<Throughput *>(arg);
+  const size_t total = (throughput->producers * throughput->perProducer);
+  while (throughput->completed < total) {
+    if (!NoteRequestQueueProcess(&throughput->queue, 0)) {
+      sched_yield();
+    }
+  }
+  return nullptr;
+}
+
+// Drive the queue from the given number of producer threads, with a single
+// worker thread draining it against the mocked transport, and report the
+// throughput of the queue itself.
+int runThroughput(size_t producers)
+{
+  int result;
+
+   // Arrange
+  ////////////
+  std::vector<NoteRequestQueueEntry> entries(THROUGHPUT_QUEUE_CAPACITY);
+  Throughput throughput;
+  NoteRequestQueueInit(&throughput.queue, entries.data(), entries.size(), lockQueue, unlockQueue);
+  throughput.producers = producers;
+  throughput.perProducer = (THROUGHPUT_REQUESTS / producers);
+  throughput.completed = 0;
+  throughput.outOfOrder = false;
+  throughput.nextSeq.assign(producers, 0);
+  activeThroughput = &throughput;
+  std::vector<Producer> producerArgs(producers);
+  std::vector<pthread_t> producerThreads(producers);
+  pthread_t workerThread;
+  noteRequestResponse_Parameters.reset();
+  noteRequestResponse_Parameters.result = RESPONSE;
+
+   // Action
+  ///////////
+  const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  pthread_create(&workerThread, nullptr, work, &throughput);
+  for (size_t i = 0 ; i < producers ; ++i) {
+    producerArgs[i].throughput = &throughput;
+    producerArgs[i].id = i;
+    pthread_create(&producerThreads[i], nullptr, produce, &producerArgs[i]);
+  }
+  for (size_t i = 0 ; i < producers ; ++i) {
+    pthread_join(producerThreads[i], nullptr);
+  }
+  pthread_join(workerThread, nullptr);
+  const std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+
+   // Assert
+  ///////////
+  const size_t total = (producers * throughput.perProducer);
+  if (total == throughput.completed
+   && total == noteRequestResponse_Parameters.invoked
+   && !throughput.outOfOrder
+   && 0 == NoteRequestQueueCount(&throughput.queue))
+  {
+    const double elapsedUs = std::chrono::duration<double, std::micro>(stop - start).count();
+    std::cout << "\33[33mINFO\33[0m] " << producers << " producer(s): " << total << " requests in "
+              << static_cast<uint64_t>(elapsedUs / 1000) << "ms, "
+              << static_cast<uint64_t>(total / (elapsedUs / 1000000)) << " requests/s" << std::endl;
+    std::cout << "[";
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'q' + 'u' + 'e' + 'u' + 'e');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tcompleted == " << throughput.completed << ", EXPECTED: " << total << std::endl;
+    std::cout << "\tnoteRequestResponse_Parameters.invoked == " << noteRequestResponse_Parameters.invoked << ", EXPECTED: " << total << std::endl;
+    std::cout << "\toutOfOrder == " << throughput.outOfOrder << ", EXPECTED: false" << std::endl;
+    std::cout << "\tNoteRequestQueueCount() == " << NoteRequestQueueCount(&throughput.queue) << ", EXPECTED: 0" << std::endl;
+    std::cout << "[";
+  }
+
+  activeThroughput = nullptr;
+  return result;
+}
+
+}
+
+int test_n_queue_init_fails_without_storage()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  NoteRequestQueue queue;
+
+   // Action
+  ///////////
+  const bool ACTUAL_RESULT = NoteRequestQueueInit(&queue, nullptr, 4, lockQueue, unlockQueue);
+
+   // Assert
+  ///////////
+  if (!ACTUAL_RESULT)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'q' + 'u' + 'e' + 'u' + 'e');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tNoteRequestQueueInit(&queue, nullptr, 4, ...) == " << ACTUAL_RESULT << ", EXPECTED: false" << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_n_queue_process_sends_requests_in_order_and_completes_each_with_its_response()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  NoteRequestQueueEntry entries[4];
+  NoteRequestQueue queue;
+  NoteRequestQueueInit(&queue, entries, 4, lockQueue, unlockQueue);
+  noteRequestResponse_Parameters.reset();
+  noteRequestResponse_Parameters.result = RESPONSE;
+  completedContexts.clear();
+  completedResponses.clear();
+  NoteRequestQueuePush(&queue, fakeRequest(1), recordCompletion, reinterpret_cast<void *>(1));
+  NoteRequestQueuePush(&queue, fakeRequest(2), recordCompletion, reinterpret_cast<void *>(2));
+  NoteRequestQueuePush(&queue, fakeRequest(3), recordCompletion, reinterpret_cast<void *>(3));
+
+   // Action
+  ///////////
+  const size_t ACTUAL_RESULT = NoteRequestQueueProcess(&queue, 0);
+
+   // Assert
+  ///////////
+  if (3 == ACTUAL_RESULT
+   && 3 == noteRequestResponse_Parameters.invoked
+   && fakeRequest(3) == noteRequestResponse_Parameters.req
+   && 3 == completedContexts.size()
+   && 1 == completedContexts[0]
+   && 2 == completedContexts[1]
+   && 3 == completedContexts[2]
+   && RESPONSE == completedResponses[2]
+   && 0 == NoteRequestQueueCount(&queue))
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'q' + 'u' + 'e' + 'u' + 'e');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tNoteRequestQueueProcess(&queue, 0) == " << ACTUAL_RESULT << ", EXPECTED: 3" << std::endl;
+    std::cout << "\tnoteRequestResponse_Parameters.invoked == " << noteRequestResponse_Parameters.invoked << ", EXPECTED: 3" << std::endl;
+    std::cout << "\tcompletedContexts.size() == " << completedContexts.size() << ", EXPECTED: 3 (in order 1, 2, 3)" << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_n_queue_process_frees_the_response_when_no_callback_is_provided()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  NoteRequestQueueEntry entries[2];
+  NoteRequestQueue queue;
+  NoteRequestQueueInit(&queue, entries, 2, nullptr, nullptr);
+  noteRequestResponse_Parameters.reset();
+  noteRequestResponse_Parameters.result = RESPONSE;
+  jDelete_Parameters.reset();
+  NoteRequestQueuePush(&queue, fakeRequest(1), nullptr, nullptr);
+
+   // Action
+  ///////////
+  NoteRequestQueueProcess(&queue, 0);
+
+   // Assert
+  ///////////
+  if (1 == jDelete_Parameters.invoked && RESPONSE == jDelete_Parameters.item)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'q' + 'u' + 'e' + 'u' + 'e');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tjDelete_Parameters.invoked == " << jDelete_Parameters.invoked << ", EXPECTED: 1" << std::endl;
+    std::cout << "\tjDelete_Parameters.item == " << jDelete_Parameters.item << ", EXPECTED: " << RESPONSE << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_n_queue_process_sends_no_more_than_max_requests()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  NoteRequestQueueEntry entries[4];
+  NoteRequestQueue queue;
+  NoteRequestQueueInit(&queue, entries, 4, lockQueue, unlockQueue);
+  noteRequestResponse_Parameters.reset();
+  NoteRequestQueuePush(&queue, fakeRequest(1), recordCompletion, nullptr);
+  NoteRequestQueuePush(&queue, fakeRequest(2), recordCompletion, nullptr);
+  NoteRequestQueuePush(&queue, fakeRequest(3), recordCompletion, nullptr);
+
+   // Action
+  ///////////
+  const size_t ACTUAL_RESULT = NoteRequestQueueProcess(&queue, 2);
+
+   // Assert
+  ///////////
+  if (2 == ACTUAL_RESULT
+   && fakeRequest(2) == noteRequestResponse_Parameters.req
+   && 1 == NoteRequestQueueCount(&queue))
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'q' + 'u' + 'e' + 'u' + 'e');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tNoteRequestQueueProcess(&queue, 2) == " << ACTUAL_RESULT << ", EXPECTED: 2" << std::endl;
+    std::cout << "\tNoteRequestQueueCount(&queue) == " << NoteRequestQueueCount(&queue) << ", EXPECTED: 1" << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_n_queue_push_fails_without_queuing_when_the_queue_is_full()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  NoteRequestQueueEntry entries[2];
+  NoteRequestQueue queue;
+  NoteRequestQueueInit(&queue, entries, 2, lockQueue, unlockQueue);
+  NoteRequestQueuePush(&queue, fakeRequest(1), nullptr, nullptr);
+  NoteRequestQueuePush(&queue, fakeRequest(2), nullptr, nullptr);
+
+   // Action
+  ///////////
+  const bool ACTUAL_RESULT = NoteRequestQueuePush(&queue, fakeRequest(3), nullptr, nullptr);
+
+   // Assert
+  ///////////
+  if (!ACTUAL_RESULT && 2 == NoteRequestQueueCount(&queue))
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'q' + 'u' + 'e' + 'u' + 'e');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tNoteRequestQueuePush(...) == " << ACTUAL_RESULT << ", EXPECTED: false" << std::endl;
+    std::cout << "\tNoteRequestQueueCount(&queue) == " << NoteRequestQueueCount(&queue) << ", EXPECTED: 2" << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_n_queue_clear_discards_waiting_requests_without_sending_them()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  NoteRequestQueueEntry entries[4];
+  NoteRequestQueue queue;
+  NoteRequestQueueInit(&queue, entries, 4, lockQueue, unlockQueue);
+  noteRequestResponse_Parameters.reset();
+  jDelete_Parameters.reset();
+  completedContexts.clear();
+  completedResponses.clear();
+  NoteRequestQueuePush(&queue, fakeRequest(1), recordCompletion, reinterpret_cast<void *>(1));
+  NoteRequestQueuePush(&queue, fakeRequest(2), nullptr, nullptr);
+  NoteRequestQueuePush(&queue, fakeRequest(3), recordCompletion, reinterpret_cast<void *>(3));
+
+   // Action
+  ///////////
+  const size_t ACTUAL_RESULT = NoteRequestQueueClear(&queue);
+
+   // Assert
+  ///////////
+  if (3 == ACTUAL_RESULT
+   && 0 == noteRequestResponse_Parameters.invoked
+   && 3 == jDelete_Parameters.invoked
+   && fakeRequest(3) == jDelete_Parameters.item
+   && std::vector<uintptr_t>({1, 3}) == completedContexts
+   && std::vector<J *>({nullptr, nullptr}) == completedResponses
+   && 0 == NoteRequestQueueCount(&queue)
+   && NoteRequestQueuePush(&queue, fakeRequest(4), nullptr, nullptr))
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'q' + 'u' + 'e' + 'u' + 'e');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tNoteRequestQueueClear(&queue) == " << ACTUAL_RESULT << ", EXPECTED: 3" << std::endl;
+    std::cout << "\tnoteRequestResponse_Parameters.invoked == " << noteRequestResponse_Parameters.invoked << ", EXPECTED: 0" << std::endl;
+    std::cout << "\tjDelete_Parameters.invoked == " << jDelete_Parameters.invoked << ", EXPECTED: 3" << std::endl;
+    std::cout << "\tcompletedContexts.size() == " << completedContexts.size() << ", EXPECTED: 2" << std::endl;
+    std::cout << "\tNoteRequestQueueCount(&queue) == " << NoteRequestQueueCount(&queue) << ", EXPECTED: 1" << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_n_queue_delivers_every_request_in_order_from_1_producer()
+{
+  return runThroughput(1);
+}
+
+int test_n_queue_delivers_every_request_in_order_from_4_producers()
+{
+  return runThroughput(4);
+}
+
+int test_n_queue_delivers_every_request_in_order_from_16_producers()
+{
+  return runThroughput(16);
+}
+
+int main(void)
+{
+  TestFunction tests[] = {
+      {test_n_queue_init_fails_without_storage, "test_n_queue_init_fails_without_storage"},
+      {test_n_queue_process_sends_requests_in_order_and_completes_each_with_its_response, "test_n_queue_process_sends_requests_in_order_and_completes_each_with_its_response"},
+      {test_n_queue_process_frees_the_response_when_no_callback_is_provided, "test_n_queue_process_frees_the_response_when_no_callback_is_provided"},
+      {test_n_queue_process_sends_no_more_than_max_requests, "test_n_queue_process_sends_no_more_than_max_requests"},
+      {test_n_queue_push_fails_without_queuing_when_the_queue_is_full, "test_n_queue_push_fails_without_queuing_when_the_queue_is_full"},
+      {test_n_queue_clear_discards_waiting_requests_without_sending_them, "test_n_queue_clear_discards_waiting_requests_without_sending_them"},
+      {test_n_queue_delivers_every_request_in_order_from_1_producer, "test_n_queue_delivers_every_request_in_order_from_1_producer"},
+      {test_n_queue_delivers_every_request_in_order_from_4_producers, "test_n_queue_delivers_every_request_in_order_from_4_producers"},
+      {test_n_queue_delivers_every_request_in_order_from_16_producers, "test_n_queue_delivers_every_request_in_order_from_16_producers"},
+  };
+
+  return TestFunction::runTests(tests, (sizeof(tests) / sizeof(TestFunction)));
+}
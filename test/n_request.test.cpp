@@ -0,0 +1,2668 @@
+#include "note.h"
+#include "TestFunction.hpp"
+
+#include <algorithm>
+#include <chrono>
+#ifdef NOTE_C_THREAD_CONTEXT
+#include <condition_variable>
+#endif
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#ifdef NOTE_C_THREAD_CONTEXT
+#include <mutex>
+#endif
+#include <string>
+#ifdef NOTE_C_THREAD_CONTEXT
+#include <thread>
+#endif
+#include <vector>
+
+// Compile command: gcc -c -Wall -Wextra -Wpedantic -I../src/note-c ../src/note-c/*.c && g++ -Wall -Wextra -Wpedantic n_*.o n_request.test.cpp -std=c++11 -I. -I../src/note-c -ggdb -O0 -o n_request.tests && ./n_request.tests || echo "Tests Result: $?"
+
+// This suite links against the real note-c library and stands up a fake
+// Notecard on a simulated I2C bus and clock. The fake Notecard answers each
+// request with its sequence number and a valid CRC, except for the first
+// attempt of "card.a", which fails with an I/O error and must be retried, or
+// is lost before reaching the Notecard.
+// Another task, which wants to send "card.b", runs whenever time passes while
+// the Notecard lock is free.
+
+namespace
+{
+
+struct Attempt {
+  std::string req;
+  unsigned int seqNo;
+};
+
+// Simulated clock and Notecard lock
+uint32_t nowMs;
+int noteLockDepth;
+bool noteLockUnbalanced;
+
+// Fake Notecard
+std::string notecardRequest;
+std::string notecardResponse;
+bool notecardFailNextA;
+bool notecardDropNextA;
+bool notecardCorruptNextCrc;
+unsigned int notecardFailures;
+std::string notecardRejectReq;
+std::string notecardFields;
+std::vector<Attempt> attempts;
+std::string notecardLastRequest;
+size_t notecardBytesIn;
+size_t notecardBytesOut;
+uint32_t notecardLatencyMs;
+uint32_t notecardReadyMs;
+size_t notecardEmptyPolls;
+
+// Response notification hook
+std::vector<uint32_t> responseWaits;
+
+// The fake Notecard's serial receive FIFO, drained at 115200 baud
+const size_t NOTECARD_FIFO_SIZE = 64;
+const size_t NOTECARD_FIFO_DRAIN_PER_MS = 11;
+size_t notecardFifo;
+size_t notecardFifoPeak;
+
+// Line noise arriving on the serial port shortly after a reset
+std::string notecardNoise;
+std::string notecardNoisePending;
+uint32_t notecardNoiseAtMs;
+
+// Heap accounting, which excludes the fake Notecard's own allocations
+const size_t HEAP_HEADER = 16;
+size_t heapInUse;
+size_t heapPeak;
+size_t heapAllocations;
+bool notecardBusy;
+
+// A small first-fit heap, in which fragmentation can be observed
+struct ArenaBlock {
+  size_t offset;
+  size_t size;
+  bool used;
+};
+const size_t ARENA_SIZE = (256 * 1024);
+const size_t ARENA_ALIGN = 8;
+std::vector<uint8_t> arena;
+std::vector<ArenaBlock> arenaBlocks;
+size_t arenaHighWater;
+size_t arenaAllocations;
+
+// Another task waiting to transact with the Notecard
+bool otherTaskPending;
+bool otherTaskRanDuringBackoff;
+bool otherTaskWantsText;
+bool otherTaskWritesAfterRead;
+J *otherTaskRsp;
+char *otherTaskRspText;
+
+// Waits long enough to be retry backoffs rather than I/O delays
+const uint32_t BACKOFF_MIN_MS = 100;
+std::vector<uint32_t> backoffs;
+
+uint32_t crc32(const std::string &data)
+{
+  uint32_t crc = 0xFFFFFFFF;
+  for (size_t i = 0 ; i < data.size() ; ++i) {
+    crc ^= static_cast<uint8_t>(data[i]);
+    for (int bit = 0 ; bit < 8 ; ++bit) {
+      crc = ((crc >> 1) ^ ((crc & 1) ? 0xEDB88320 : 0));
+    }
+  }
+  return ~crc;
+}
+
+void * trackingMalloc(size_t size)
+{
+  uint8_t *block = static_cast<uint8_t *>(malloc(HEAP_HEADER + size));
+  if (!block) {
+    return nullptr;
+  }
+  memcpy(block, &size, sizeof(size));
+  heapInUse += size;
+  if (!notecardBusy) {
+    ++heapAllocations;
+    if (heapInUse > heapPeak) {
+      heapPeak = heapInUse;
+    }
+  }
+  return (block + HEAP_HEADER);
+}
+
+void trackingFree(void *ptr)
+{
+  if (!ptr) {
+    return;
+  }
+  uint8_t *block = (static_cast<uint8_t *>(ptr) - HEAP_HEADER);
+  size_t size;
+  memcpy(&size, block, sizeof(size));
+  heapInUse -= size;
+  free(block);
+}
+
+void arenaInit(void)
+{
+  arena.assign(ARENA_SIZE, 0);
+  arenaBlocks.assign(1, ArenaBlock{0, ARENA_SIZE, false});
+  arenaHighWater = 0;
+  arenaAllocations = 0;
+}
+
+size_t arenaFind(void *ptr)
+{
+  const size_t offset = static_cast<size_t>(static_cast<uint8_t *>(ptr) - arena.data());
+  for (size_t i = 0 ; i < arenaBlocks.size() ; ++i) {
+    if (arenaBlocks[i].offset == offset && arenaBlocks[i].used) {
+      return i;
+    }
+  }
+  abort();
+}
+
+void * arenaMalloc(size_t size)
+{
+  size = ((size + ARENA_ALIGN - 1) / ARENA_ALIGN) * ARENA_ALIGN;
+  size = (size ? size : ARENA_ALIGN);
+  for (size_t i = 0 ; i < arenaBlocks.size() ; ++i) {
+    if (arenaBlocks[i].used || arenaBlocks[i].size < size) {
+      continue;
+    }
+    if (arenaBlocks[i].size > size) {
+      const ArenaBlock rest = {(arenaBlocks[i].offset + size), (arenaBlocks[i].size - size), false};
+      arenaBlocks.insert(arenaBlocks.begin() + i + 1, rest);
+    }
+    arenaBlocks[i].size = size;
+    arenaBlocks[i].used = true;
+    ++arenaAllocations;
+    if ((arenaBlocks[i].offset + size) > arenaHighWater) {
+      arenaHighWater = (arenaBlocks[i].offset + size);
+    }
+    return (arena.data() + arenaBlocks[i].offset);
+  }
+  return nullptr;
+}
+
+void arenaFree(void *ptr)
+{
+  if (!ptr) {
+    return;
+  }
+  size_t i = arenaFind(ptr);
+  arenaBlocks[i].used = false;
+  if ((i + 1) < arenaBlocks.size() && !arenaBlocks[i + 1].used) {
+    arenaBlocks[i].size += arenaBlocks[i + 1].size;
+    arenaBlocks.erase(arenaBlocks.begin() + i + 1);
+  }
+  if (i > 0 && !arenaBlocks[i - 1].used) {
+    arenaBlocks[i - 1].size += arenaBlocks[i].size;
+    arenaBlocks.erase(arenaBlocks.begin() + i);
+  }
+}
+
+// Grows a block in place when the block after it is free
+void * arenaRealloc(void *ptr, size_t size)
+{
+  if (!ptr) {
+    return arenaMalloc(size);
+  }
+  size = ((size + ARENA_ALIGN - 1) / ARENA_ALIGN) * ARENA_ALIGN;
+  const size_t i = arenaFind(ptr);
+  const size_t oldSize = arenaBlocks[i].size;
+  if (size <= oldSize) {
+    return ptr;
+  }
+  if ((i + 1) < arenaBlocks.size() && !arenaBlocks[i + 1].used && (oldSize + arenaBlocks[i + 1].size) >= size) {
+    arenaBlocks[i + 1].offset += (size - oldSize);
+    arenaBlocks[i + 1].size -= (size - oldSize);
+    if (!arenaBlocks[i + 1].size) {
+      arenaBlocks.erase(arenaBlocks.begin() + i + 1);
+    }
+    arenaBlocks[i].size = size;
+    if ((arenaBlocks[i].offset + size) > arenaHighWater) {
+      arenaHighWater = (arenaBlocks[i].offset + size);
+    }
+    return ptr;
+  }
+  void *moved = arenaMalloc(size);
+  if (moved) {
+    memcpy(moved, ptr, oldSize);
+    arenaFree(ptr);
+  }
+  return moved;
+}
+
+// Determine whether a request carries a valid CRC over the rest of its JSON
+bool requestCrcValid(const std::string &request)
+{
+  const std::string field = ",\"crc\":\"";
+  const size_t crcPos = request.rfind(field);
+  if (std::string::npos == crcPos || (crcPos + field.size() + 15) != request.size()) {
+    return false;
+  }
+  const uint32_t crc = static_cast<uint32_t>(strtoul(request.substr(crcPos + field.size() + 5, 8).c_str(), nullptr, 16));
+  return (crc == crc32(request.substr(0, crcPos) + "}"));
+}
+
+void runOtherTask(void)
+{
+  otherTaskPending = false;
+  if (otherTaskWantsText) {
+    otherTaskRspText = NoteRequestResponseJSON("{\"req\":\"card.b\"}\n");
+    otherTaskRsp = (otherTaskRspText ? JParse(otherTaskRspText) : nullptr);
+  } else {
+    otherTaskRsp = NoteRequestResponse(NoteNewRequest("card.b"));
+  }
+}
+
+void delayMs(uint32_t ms)
+{
+  nowMs += ms;
+  notecardFifo -= std::min<size_t>(notecardFifo, (ms * NOTECARD_FIFO_DRAIN_PER_MS));
+  if (ms >= BACKOFF_MIN_MS) {
+    backoffs.push_back(ms);
+  }
+  if (otherTaskPending && !noteLockDepth) {
+    otherTaskRanDuringBackoff = true;
+    runOtherTask();
+  }
+}
+
+uint32_t getMs(void)
+{
+  return nowMs;
+}
+
+void lockNote(void)
+{
+  if (noteLockDepth++) {
+    noteLockUnbalanced = true;
+  }
+}
+
+void unlockNote(void)
+{
+  if (0 == noteLockDepth--) {
+    noteLockUnbalanced = true;
+  }
+  if (otherTaskWritesAfterRead && !noteLockDepth && !attempts.empty()) {
+    otherTaskWritesAfterRead = false;
+    J *req = NoteNewRequest("hub.set");
+    JAddStringToObject(req, "mode", "periodic");
+    JDelete(NoteRequestResponse(req));
+  }
+}
+
+bool notecardReset(uint16_t)
+{
+  notecardRequest.clear();
+  notecardResponse.clear();
+  return true;
+}
+
+void notecardProcess(void)
+{
+  if (notecardRequest.empty()) {
+    notecardResponse += "\r\n";
+    return;
+  }
+
+  notecardBusy = true;
+  notecardReadyMs = (nowMs + notecardLatencyMs);
+  notecardLastRequest = notecardRequest;
+  Attempt attempt;
+  const size_t crcPos = notecardRequest.find("\"crc\":\"");
+  attempt.seqNo = ((std::string::npos == crcPos) ? 0 : static_cast<unsigned int>(strtoul(notecardRequest.substr(crcPos + 7, 4).c_str(), nullptr, 16)));
+  J *req = JParse(notecardRequest.c_str());
+  attempt.req = JGetString(req, "req");
+  JDelete(req);
+  attempts.push_back(attempt);
+  notecardBusy = false;
+
+  if (notecardFailures) {
+    --notecardFailures;
+    notecardResponse += "{\"err\":\"simulated failure {io}\"}\r\n";
+    return;
+  }
+  if (attempt.req == notecardRejectReq) {
+    notecardResponse += "{\"err\":\"simulated rejection {bad}\"}\r\n";
+    return;
+  }
+  if (notecardFailNextA && "card.a" == attempt.req) {
+    notecardFailNextA = false;
+    notecardResponse += "{\"err\":\"simulated failure {io}\"}\r\n";
+    return;
+  }
+  const std::string body = "{\"seq\":" + std::to_string(attempt.seqNo) + notecardFields + "}";
+  const uint32_t bodyCrc = (crc32(body) ^ (notecardCorruptNextCrc ? 1 : 0));
+  notecardCorruptNextCrc = false;
+  char crc[sizeof(",\"crc\":\"SSSS:CCCCCCCC\"}")];
+  snprintf(crc, sizeof(crc), ",\"crc\":\"%04X:%08X\"}", attempt.seqNo, static_cast<unsigned int>(bodyCrc));
+  notecardResponse += body.substr(0, body.size() - 1) + crc + "\r\n";
+}
+
+const char * notecardTransmit(uint16_t, uint8_t *txBuf, uint16_t txBufSize)
+{
+  // Lose the first chunk of "card.a", so that the Notecard never sees it
+  const std::string chunk(reinterpret_cast<char *>(txBuf), txBufSize);
+  if (notecardDropNextA && notecardRequest.empty() && std::string::npos != chunk.find("\"card.a\"")) {
+    notecardDropNextA = false;
+    return "simulated transmit failure {io}";
+  }
+  notecardBytesOut += txBufSize;
+  for (size_t i = 0 ; i < txBufSize ; ++i) {
+    if ('\n' == txBuf[i]) {
+      notecardProcess();
+      notecardRequest.clear();
+    } else if ('\r' != txBuf[i]) {
+      notecardRequest += static_cast<char>(txBuf[i]);
+    }
+  }
+  return nullptr;
+}
+
+const char * notecardReceive(uint16_t, uint8_t *rxBuf, uint16_t rxBufSize, uint32_t *available)
+{
+  if (nowMs < notecardReadyMs) {
+    ++notecardEmptyPolls;
+    *available = 0;
+    return nullptr;
+  }
+  if (rxBufSize > notecardResponse.size()) {
+    rxBufSize = 0;
+  }
+  memcpy(rxBuf, notecardResponse.data(), rxBufSize);
+  notecardResponse.erase(0, rxBufSize);
+  notecardBytesIn += rxBufSize;
+  // Like a real Notecard, report at most 255 bytes available at a time
+  *available = static_cast<uint32_t>(std::min<size_t>(notecardResponse.size(), 255));
+  return nullptr;
+}
+
+// The same fake Notecard, on a simulated serial port
+bool notecardSerialReset(void)
+{
+  notecardNoisePending = notecardNoise;
+  notecardNoise.clear();
+  notecardNoiseAtMs = (nowMs + 5);
+  return notecardReset(0);
+}
+
+void notecardSerialTransmit(uint8_t *txBuf, size_t txBufSize, bool)
+{
+  notecardTransmit(0, txBuf, static_cast<uint16_t>(txBufSize));
+}
+
+bool notecardSerialAvailable(void)
+{
+  if (!notecardNoisePending.empty() && nowMs >= notecardNoiseAtMs) {
+    notecardResponse += notecardNoisePending;
+    notecardNoisePending.clear();
+  }
+  if (nowMs < notecardReadyMs) {
+    ++notecardEmptyPolls;
+    return false;
+  }
+  return !notecardResponse.empty();
+}
+
+char notecardSerialReceive(void)
+{
+  const char c = notecardResponse[0];
+  notecardResponse.erase(0, 1);
+  ++notecardBytesIn;
+  return c;
+}
+
+// The same serial port, filling the Notecard's receive FIFO
+void notecardSerialFifoTransmit(uint8_t *txBuf, size_t txBufSize, bool)
+{
+  notecardFifo += txBufSize;
+  notecardFifoPeak = std::max(notecardFifoPeak, notecardFifo);
+  notecardSerialTransmit(txBuf, txBufSize, false);
+}
+
+// Assert CTS while the FIFO has room for another chunk of the request
+bool notecardSerialClearToSend(void)
+{
+  return ((notecardFifo + 16) <= NOTECARD_FIFO_SIZE);
+}
+
+// Sleep until the Notecard signals its response, or the timeout elapses
+bool responseWaitSignaled(uint32_t timeoutMs)
+{
+  responseWaits.push_back(timeoutMs);
+  const bool signaled = ((notecardReadyMs - nowMs) <= timeoutMs);
+  nowMs = (signaled ? std::max(nowMs, notecardReadyMs) : (nowMs + timeoutMs));
+  return signaled;
+}
+
+// Sleep for the whole timeout, as though the signal were lost
+bool responseWaitMissed(uint32_t timeoutMs)
+{
+  responseWaits.push_back(timeoutMs);
+  nowMs += timeoutMs;
+  return false;
+}
+
+void setUp(uint8_t policy)
+{
+  nowMs = 0;
+  noteLockDepth = 0;
+  noteLockUnbalanced = false;
+  notecardRequest.clear();
+  notecardResponse.clear();
+  notecardFailNextA = true;
+  notecardDropNextA = false;
+  notecardCorruptNextCrc = false;
+  notecardFailures = 0;
+  notecardRejectReq.clear();
+  notecardFields.clear();
+  attempts.clear();
+  notecardLastRequest.clear();
+  notecardBytesIn = 0;
+  notecardBytesOut = 0;
+  notecardLatencyMs = 0;
+  notecardReadyMs = 0;
+  notecardEmptyPolls = 0;
+  responseWaits.clear();
+  notecardFifo = 0;
+  notecardFifoPeak = 0;
+  notecardNoise.clear();
+  notecardNoisePending.clear();
+  notecardNoiseAtMs = 0;
+  heapInUse = 0;
+  heapPeak = 0;
+  heapAllocations = 0;
+  notecardBusy = false;
+  otherTaskPending = true;
+  otherTaskRanDuringBackoff = false;
+  otherTaskWantsText = false;
+  otherTaskWritesAfterRead = false;
+  otherTaskRsp = nullptr;
+  otherTaskRspText = nullptr;
+  backoffs.clear();
+
+  NoteSetFn(malloc, free, delayMs, getMs);
+  NoteSetFnNoteMutex(lockNote, unlockNote);
+  NoteSetFnI2C(NOTE_I2C_ADDR_DEFAULT, NOTE_I2C_MAX_DEFAULT, notecardReset, notecardTransmit, notecardReceive);
+  NoteSetFnResponseWait(nullptr);
+  NoteSetRetryLockPolicy(policy);
+  NoteSetRetryPolicy(nullptr);
+  NoteSetResponseStreaming(false);
+  NoteSetSerialFastResync(false);
+  NoteSetResponseCache(0, 0);
+  NoteSetReceiveBufferPool(0);
+  NoteSetFnRealloc(nullptr);
+}
+
+#ifdef NOTE_C_THREAD_CONTEXT
+// A fake Notecard per thread, on its own I2C bus and the real clock, whose
+// first request is only answered once every Notecard has received one, which
+// can only happen when the Notecards are driven in parallel
+const size_t THREAD_CARDS = 2;
+const uint32_t RENDEZVOUS_TIMEOUT_MS = 5000;
+
+struct ThreadCard {
+  std::string request;
+  std::string response;
+  bool rendezvous;
+  bool transacted;
+};
+
+thread_local ThreadCard *threadCard;
+std::mutex rendezvousMutex;
+std::condition_variable rendezvousArrived;
+size_t rendezvousArrivals;
+
+void realDelayMs(uint32_t ms)
+{
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+uint32_t realGetMs(void)
+{
+  return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+bool threadCardReset(uint16_t)
+{
+  threadCard->request.clear();
+  threadCard->response.clear();
+  return true;
+}
+
+void threadCardProcess(void)
+{
+  if (threadCard->request.empty()) {
+    threadCard->response += "\r\n";
+    return;
+  }
+
+  const size_t crcPos = threadCard->request.find("\"crc\":\"");
+  const unsigned int seqNo = ((std::string::npos == crcPos) ? 0 : static_cast<unsigned int>(strtoul(threadCard->request.substr(crcPos + 7, 4).c_str(), nullptr, 16)));
+  {
+    std::unique_lock<std::mutex> lock(rendezvousMutex);
+    ++rendezvousArrivals;
+    rendezvousArrived.notify_all();
+    threadCard->rendezvous = rendezvousArrived.wait_for(lock, std::chrono::milliseconds(RENDEZVOUS_TIMEOUT_MS), [] { return (rendezvousArrivals >= THREAD_CARDS); });
+  }
+  const std::string body = "{\"seq\":" + std::to_string(seqNo) + "}";
+  char crc[sizeof(",\"crc\":\"SSSS:CCCCCCCC\"}")];
+  snprintf(crc, sizeof(crc), ",\"crc\":\"%04X:%08X\"}", seqNo, static_cast<unsigned int>(crc32(body)));
+  threadCard->response += body.substr(0, body.size() - 1) + crc + "\r\n";
+}
+
+const char * threadCardTransmit(uint16_t, uint8_t *txBuf, uint16_t txBufSize)
+{
+  for (size_t i = 0 ; i < txBufSize ; ++i) {
+    if ('\n' == txBuf[i]) {
+      threadCardProcess();
+      threadCard->request.clear();
+    } else if ('\r' != txBuf[i]) {
+      threadCard->request += static_cast<char>(txBuf[i]);
+    }
+  }
+  return nullptr;
+}
+
+const char * threadCardReceive(uint16_t, uint8_t *rxBuf, uint16_t rxBufSize, uint32_t *available)
+{
+  if (rxBufSize > threadCard->response.size()) {
+    rxBufSize = 0;
+  }
+  memcpy(rxBuf, threadCard->response.data(), rxBufSize);
+  threadCard->response.erase(0, rxBufSize);
+  *available = static_cast<uint32_t>(std::min<size_t>(threadCard->response.size(), 255));
+  return nullptr;
+}
+
+// Configure this thread's Notecard and send it a single request
+void threadCardRun(ThreadCard *card, uint16_t address)
+{
+  threadCard = card;
+  NoteSetFnI2C(address, NOTE_I2C_MAX_DEFAULT, threadCardReset, threadCardTransmit, threadCardReceive);
+  J *rsp = NoteRequestResponse(NoteNewRequest("card.a"));
+  card->transacted = (rsp && !NoteResponseError(rsp) && JIsPresent(rsp, "seq"));
+  JDelete(rsp);
+}
+#endif
+
+// Fields resembling the notes returned by `note.changes`
+std::string changesFields(size_t notes)
+{
+  std::string fields = ",\"changes\":" + std::to_string(notes) + ",\"notes\":{";
+  for (size_t i = 0 ; i < notes ; ++i) {
+    fields += (i ? "," : "");
+    fields += "\"note-" + std::to_string(i) + "\":{\"body\":{\"temp\":" + std::to_string(20 + (i % 10)) + ".5,\"ok\":true,\"tag\":\"\\u00e9t\\u00e9\"},\"time\":" + std::to_string(1700000000 + i) + "}";
+  }
+  return (fields + "}");
+}
+
+// Determine whether the response is a success carrying the sequence number
+bool responseHasSeqNo(J *rsp, unsigned int seqNo)
+{
+  return (rsp && !NoteResponseError(rsp) && JIsPresent(rsp, "seq") && (seqNo == static_cast<unsigned int>(JGetInt(rsp, "seq"))));
+}
+
+// Determine whether the Notecard saw the expected attempts, in order
+bool attemptsAre(const char * const *reqs, size_t count)
+{
+  if (attempts.size() != count) {
+    return false;
+  }
+  for (size_t i = 0 ; i < count ; ++i) {
+    if (attempts[i].req != reqs[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Send a request, whose first attempts fail with an I/O error, with a retry
+// policy, and measure how long it takes to succeed or give up
+uint32_t recoveryMs(const NoteRetryPolicy *policy, unsigned int faults, bool *recovered)
+{
+  setUp(NOTE_RETRY_LOCK_HOLD);
+  otherTaskPending = false;
+  notecardFailNextA = false;
+  JDelete(NoteRequestResponse(NoteNewRequest("card.warm")));
+  notecardFailures = faults;
+  const uint32_t startMs = nowMs;
+  J *rsp = NoteRequestResponseWithPolicy(NoteNewRequest("card.a"), policy);
+  *recovered = (rsp && !NoteResponseError(rsp));
+  JDelete(rsp);
+  return (nowMs - startMs);
+}
+
+// Send a request and return the sequence number of its response, or -1
+long seqOf(J *req)
+{
+  J *rsp = NoteRequestResponse(req);
+  const long seqNo = ((rsp && !NoteResponseError(rsp) && JIsPresent(rsp, "seq")) ? static_cast<long>(JGetInt(rsp, "seq")) : -1);
+  JDelete(rsp);
+  return seqNo;
+}
+
+J * envGet(const char *name)
+{
+  J *req = NoteNewRequest("env.get");
+  JAddStringToObject(req, "name", name);
+  return req;
+}
+
+struct SoakResult {
+  size_t failures;
+  size_t highWater;
+  size_t holes;
+  size_t holeBytes;
+  size_t largestHole;
+  size_t allocations;
+  size_t leaked;
+};
+
+// Run many transactions with responses of varying size in the arena, while
+// the application holds on to the previous response and a few allocations of
+// its own, and measure how fragmented the arena is left
+SoakResult soak(size_t poolBytes, bool realloc)
+{
+  SoakResult result = {};
+  arenaInit();
+  NoteSetFn(arenaMalloc, arenaFree, delayMs, getMs);
+  NoteSetFnRealloc(realloc ? arenaRealloc : nullptr);
+  NoteSetReceiveBufferPool(poolBytes);
+
+  J *previous = nullptr;
+  std::vector<void *> appBlocks(16, nullptr);
+  for (size_t round = 0 ; round < 300 ; ++round) {
+    notecardFields = changesFields(1 + ((round * 7) % 40));
+    J *rsp = NoteRequestResponse(NoteNewRequest("note.changes"));
+    if (!responseHasSeqNo(rsp, attempts.back().seqNo)) {
+      ++result.failures;
+    }
+    JDelete(previous);
+    previous = rsp;
+    void *&appBlock = appBlocks[round % appBlocks.size()];
+    arenaFree(appBlock);
+    appBlock = arenaMalloc(32 + ((round % 5) * 24));
+  }
+
+  // Holes are the free blocks below the top of the arena's used blocks
+  result.highWater = arenaHighWater;
+  result.allocations = arenaAllocations;
+  for (size_t i = 0 ; (i + 1) < arenaBlocks.size() ; ++i) {
+    if (!arenaBlocks[i].used) {
+      ++result.holes;
+      result.holeBytes += arenaBlocks[i].size;
+      result.largestHole = std::max(result.largestHole, arenaBlocks[i].size);
+    }
+  }
+
+  JDelete(previous);
+  for (size_t i = 0 ; i < appBlocks.size() ; ++i) {
+    arenaFree(appBlocks[i]);
+  }
+  NoteSetReceiveBufferPool(0);
+  NoteSetFnRealloc(nullptr);
+  NoteSetFn(malloc, free, delayMs, getMs);
+  result.leaked = ((1 == arenaBlocks.size() && !arenaBlocks[0].used) ? 0 : (ARENA_SIZE - arenaBlocks.back().size));
+  return result;
+}
+
+void printSoak(const char *name, const SoakResult &result)
+{
+  std::cout << "\33[33mINFO\33[0m] soak (" << name << "): high water " << result.highWater << " bytes, " << result.holes << " holes of " << result.holeBytes
+            << " bytes (largest " << result.largestHole << "), " << result.allocations << " allocations" << std::endl << "[";
+}
+
+void printAttempts(void)
+{
+  std::cout << "\tattempts ==";
+  for (size_t i = 0 ; i < attempts.size() ; ++i) {
+    std::cout << " " << attempts[i].req << ":" << attempts[i].seqNo;
+  }
+  std::cout << std::endl;
+}
+
+}
+
+int test_n_request_retry_lock_hold_blocks_other_tasks_for_every_retry()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  setUp(NOTE_RETRY_LOCK_HOLD);
+  const char * const EXPECTED_ATTEMPTS[] = {"card.a", "card.a", "card.b"};
+
+   // Action
+  ///////////
+  J *rsp = NoteRequestResponse(NoteNewRequest("card.a"));
+  const bool ranDuringBackoff = otherTaskRanDuringBackoff;
+  runOtherTask();
+
+   // Assert
+  ///////////
+  if (!ranDuringBackoff
+   && !noteLockDepth
+   && !noteLockUnbalanced
+   && attemptsAre(EXPECTED_ATTEMPTS, 3)
+   && attempts[0].seqNo == attempts[1].seqNo
+   && attempts[1].seqNo != attempts[2].seqNo
+   && responseHasSeqNo(rsp, attempts[1].seqNo)
+   && responseHasSeqNo(otherTaskRsp, attempts[2].seqNo))
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'r' + 'e' + 'q' + 'u' + 'e' + 's' + 't');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\totherTaskRanDuringBackoff == " << ranDuringBackoff << ", EXPECTED: false" << std::endl;
+    std::cout << "\tnoteLockDepth == " << noteLockDepth << ", EXPECTED: 0" << std::endl;
+    std::cout << "\tnoteLockUnbalanced == " << noteLockUnbalanced << ", EXPECTED: false" << std::endl;
+    printAttempts();
+    std::cout << "\tEXPECTED: card.a:N card.a:N card.b:M, where N != M, with each response carrying its own sequence number" << std::endl;
+    std::cout << "[";
+  }
+
+  JDelete(rsp);
+  JDelete(otherTaskRsp);
+  return result;
+}
+
+int test_n_request_retry_lock_yield_lets_other_tasks_transact_after_an_undelivered_attempt()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  setUp(NOTE_RETRY_LOCK_YIELD);
+  notecardFailNextA = false;
+  notecardDropNextA = true;
+  const char * const EXPECTED_ATTEMPTS[] = {"card.b", "card.a"};
+
+   // Action
+  ///////////
+  J *rsp = NoteRequestResponse(NoteNewRequest("card.a"));
+
+   // Assert
+  ///////////
+  if (otherTaskRanDuringBackoff
+   && !noteLockDepth
+   && !noteLockUnbalanced
+   && attemptsAre(EXPECTED_ATTEMPTS, 2)
+   && attempts[0].seqNo != attempts[1].seqNo
+   && responseHasSeqNo(rsp, attempts[1].seqNo)
+   && responseHasSeqNo(otherTaskRsp, attempts[0].seqNo))
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'r' + 'e' + 'q' + 'u' + 'e' + 's' + 't');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\totherTaskRanDuringBackoff == " << otherTaskRanDuringBackoff << ", EXPECTED: true" << std::endl;
+    std::cout << "\tnoteLockDepth == " << noteLockDepth << ", EXPECTED: 0" << std::endl;
+    std::cout << "\tnoteLockUnbalanced == " << noteLockUnbalanced << ", EXPECTED: false" << std::endl;
+    printAttempts();
+    std::cout << "\tEXPECTED: card.b:M card.a:N, where N != M, with each response carrying its own sequence number" << std::endl;
+    std::cout << "[";
+  }
+
+  JDelete(rsp);
+  JDelete(otherTaskRsp);
+  return result;
+}
+
+int test_n_request_retry_lock_yield_keeps_the_callers_buffer_from_other_tasks()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  setUp(NOTE_RETRY_LOCK_YIELD);
+  notecardFailNextA = false;
+  notecardDropNextA = true;
+  otherTaskWantsText = true;
+  const char * const EXPECTED_ATTEMPTS[] = {"card.b", "card.a"};
+  char request[64] = "{\"req\":\"card.a\"}";
+  char response[128];
+  size_t responseLen = 0;
+
+   // Action
+  ///////////
+  const char *err = NoteRequestResponseJSONBuffer(request, strlen(request), sizeof(request), response, sizeof(response), &responseLen);
+
+   // Assert
+  ///////////
+  J *rsp = (err ? nullptr : JParse(response));
+  if (!err
+   && otherTaskRanDuringBackoff
+   && !noteLockDepth
+   && !noteLockUnbalanced
+   && attemptsAre(EXPECTED_ATTEMPTS, 2)
+   && responseHasSeqNo(rsp, attempts[1].seqNo)
+   && otherTaskRspText != response
+   && responseHasSeqNo(otherTaskRsp, attempts[0].seqNo))
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'r' + 'e' + 'q' + 'u' + 'e' + 's' + 't');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\totherTaskRspText == " << static_cast<void *>(otherTaskRspText) << ", EXPECTED: not the caller's buffer " << static_cast<void *>(response) << std::endl;
+    std::cout << "\terr == " << (err ? err : "NULL") << ", EXPECTED: NULL" << std::endl;
+    std::cout << "\totherTaskRanDuringBackoff == " << otherTaskRanDuringBackoff << ", EXPECTED: true" << std::endl;
+    std::cout << "\tnoteLockDepth == " << noteLockDepth << ", EXPECTED: 0" << std::endl;
+    std::cout << "\tnoteLockUnbalanced == " << noteLockUnbalanced << ", EXPECTED: false" << std::endl;
+    printAttempts();
+    std::cout << "\tEXPECTED: card.b:M card.a:N, with the caller's buffer holding only the response to card.a" << std::endl;
+    std::cout << "[";
+  }
+
+  if (otherTaskRspText != response) {
+    JFree(otherTaskRspText);
+  }
+  JDelete(rsp);
+  JDelete(otherTaskRsp);
+  return result;
+}
+
+int test_n_request_retry_lock_yield_holds_the_lock_after_an_attempt_that_reached_the_notecard()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  setUp(NOTE_RETRY_LOCK_YIELD);
+  const char * const EXPECTED_ATTEMPTS[] = {"card.a", "card.a", "card.b"};
+
+   // Action
+  ///////////
+  // The Notecard processes the first attempt, but reports an I/O error, so
+  // the retry must follow it for the Notecard to recognize the duplicate
+  J *rsp = NoteRequestResponse(NoteNewRequest("card.a"));
+  const bool ranDuringBackoff = otherTaskRanDuringBackoff;
+  runOtherTask();
+
+   // Assert
+  ///////////
+  if (!ranDuringBackoff
+   && !noteLockDepth
+   && !noteLockUnbalanced
+   && attemptsAre(EXPECTED_ATTEMPTS, 3)
+   && attempts[0].seqNo == attempts[1].seqNo
+   && attempts[1].seqNo != attempts[2].seqNo
+   && responseHasSeqNo(rsp, attempts[1].seqNo)
+   && responseHasSeqNo(otherTaskRsp, attempts[2].seqNo))
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'r' + 'e' + 'q' + 'u' + 'e' + 's' + 't');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\totherTaskRanDuringBackoff == " << ranDuringBackoff << ", EXPECTED: false" << std::endl;
+    std::cout << "\tnoteLockDepth == " << noteLockDepth << ", EXPECTED: 0" << std::endl;
+    std::cout << "\tnoteLockUnbalanced == " << noteLockUnbalanced << ", EXPECTED: false" << std::endl;
+    printAttempts();
+    std::cout << "\tEXPECTED: card.a:N card.a:N card.b:M, where N != M, with each response carrying its own sequence number" << std::endl;
+    std::cout << "[";
+  }
+
+  JDelete(rsp);
+  JDelete(otherTaskRsp);
+  return result;
+}
+
+int test_n_request_retry_lock_yield_releases_the_lock_during_a_non_blocking_backoff()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  setUp(NOTE_RETRY_LOCK_YIELD);
+  notecardFailNextA = false;
+  notecardDropNextA = true;
+  const char * const EXPECTED_ATTEMPTS[] = {"card.b", "card.a"};
+  NoteTransactionAsync txn;
+  J *req = NoteNewRequest("card.a");
+
+   // Action
+  ///////////
+  // Poll, letting the other task run as soon as the Notecard lock is free
+  NoteTransactionAsyncBegin(&txn, req);
+  JDelete(req);
+  for (size_t polls = 0 ; polls < 1000 && !NoteTransactionAsyncPoll(&txn) ; ++polls) {
+    if (otherTaskPending && !noteLockDepth) {
+      otherTaskRanDuringBackoff = true;
+      runOtherTask();
+    }
+    nowMs += 10;
+  }
+  J *rsp = NoteTransactionAsyncEnd(&txn);
+
+   // Assert
+  ///////////
+  if (otherTaskRanDuringBackoff
+   && !noteLockDepth
+   && !noteLockUnbalanced
+   && attemptsAre(EXPECTED_ATTEMPTS, 2)
+   && attempts[0].seqNo != attempts[1].seqNo
+   && responseHasSeqNo(rsp, attempts[1].seqNo)
+   && responseHasSeqNo(otherTaskRsp, attempts[0].seqNo))
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'r' + 'e' + 'q' + 'u' + 'e' + 's' + 't');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\totherTaskRanDuringBackoff == " << otherTaskRanDuringBackoff << ", EXPECTED: true" << std::endl;
+    std::cout << "\tnoteLockDepth == " << noteLockDepth << ", EXPECTED: 0" << std::endl;
+    std::cout << "\tnoteLockUnbalanced == " << noteLockUnbalanced << ", EXPECTED: false" << std::endl;
+    printAttempts();
+    std::cout << "\tEXPECTED: card.b:M card.a:N, where N != M, with each response carrying its own sequence number" << std::endl;
+    std::cout << "[";
+  }
+
+  JDelete(rsp);
+  JDelete(otherTaskRsp);
+  return result;
+}
+
+int test_n_request_serializes_the_request_and_its_crc_into_a_single_buffer()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  setUp(NOTE_RETRY_LOCK_HOLD);
+  NoteSetFn(trackingMalloc, trackingFree, delayMs, getMs);
+  otherTaskPending = false;
+  const std::string payload(4096, 'x');
+  J *req = NoteNewRequest("note.add");
+  JAddStringToObject(req, "payload", payload.c_str());
+  const size_t heapBefore = heapInUse;
+  heapPeak = heapInUse;
+
+   // Action
+  ///////////
+  J *rsp = NoteRequestResponse(req);
+
+   // Assert
+  ///////////
+  // The growth in the heap is bounded by a single serialized copy of the
+  // request, plus the small allocations used for the response
+  const size_t heapGrowth = (heapPeak - heapBefore);
+  const size_t requestLen = notecardLastRequest.size();
+  if (requestCrcValid(notecardLastRequest)
+   && requestLen > payload.size()
+   && heapGrowth < (requestLen + (requestLen / 4))
+   && responseHasSeqNo(rsp, attempts[0].seqNo))
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'r' + 'e' + 'q' + 'u' + 'e' + 's' + 't');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\trequestCrcValid(notecardLastRequest) == " << requestCrcValid(notecardLastRequest) << ", EXPECTED: true" << std::endl;
+    std::cout << "\theapGrowth == " << heapGrowth << ", EXPECTED: < " << (requestLen + (requestLen / 4)) << std::endl;
+    std::cout << "[";
+  }
+
+  JDelete(rsp);
+  NoteSetFn(malloc, free, delayMs, getMs);
+  return result;
+}
+
+int test_n_request_streamed_response_matches_the_buffered_response_without_holding_its_text()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  setUp(NOTE_RETRY_LOCK_HOLD);
+  NoteSetFn(trackingMalloc, trackingFree, delayMs, getMs);
+  otherTaskPending = false;
+  notecardFields = changesFields(100);
+
+   // Action
+  ///////////
+  heapPeak = heapInUse;
+  size_t heapBefore = heapInUse;
+  J *buffered = NoteRequestResponse(NoteNewRequest("note.changes"));
+  const size_t bufferedGrowth = (heapPeak - heapBefore);
+  const size_t responseLen = notecardFields.size();
+
+  NoteSetResponseStreaming(true);
+  heapPeak = heapInUse;
+  heapBefore = heapInUse;
+  J *streamed = NoteRequestResponse(NoteNewRequest("note.changes"));
+  const size_t streamedGrowth = (heapPeak - heapBefore);
+
+   // Assert
+  ///////////
+  // Other than its sequence number, the streamed response is identical to
+  // the buffered one, and the heap never holds the text of the response
+  const bool seqNosMatch = (responseHasSeqNo(buffered, attempts[0].seqNo) && responseHasSeqNo(streamed, attempts[1].seqNo));
+  JDeleteItemFromObject(buffered, "seq");
+  JDeleteItemFromObject(streamed, "seq");
+  char *bufferedJson = JPrintUnformatted(buffered);
+  char *streamedJson = JPrintUnformatted(streamed);
+  const std::string bufferedText = (bufferedJson ? bufferedJson : "");
+  const std::string streamedText = (streamedJson ? streamedJson : "");
+  JFree(bufferedJson);
+  JFree(streamedJson);
+  if (seqNosMatch
+   && !bufferedText.empty()
+   && bufferedText == streamedText
+   && (streamedGrowth + responseLen) < (bufferedGrowth + (responseLen / 4)))
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'r' + 'e' + 'q' + 'u' + 'e' + 's' + 't');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tseqNosMatch == " << seqNosMatch << ", EXPECTED: true" << std::endl;
+    std::cout << "\tstreamedText == " << streamedText.substr(0, 80) << ", EXPECTED: " << bufferedText.substr(0, 80) << std::endl;
+    std::cout << "\tstreamedGrowth == " << streamedGrowth << ", EXPECTED: < " << ((bufferedGrowth + (responseLen / 4)) - responseLen) << " (bufferedGrowth == " << bufferedGrowth << ")" << std::endl;
+    std::cout << "[";
+  }
+
+  JDelete(buffered);
+  JDelete(streamed);
+  NoteSetFn(malloc, free, delayMs, getMs);
+  return result;
+}
+
+int test_n_request_streamed_response_with_a_crc_error_is_retried()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  setUp(NOTE_RETRY_LOCK_HOLD);
+  otherTaskPending = false;
+  notecardCorruptNextCrc = true;
+  notecardFields = changesFields(10);
+  NoteSetResponseStreaming(true);
+
+   // Action
+  ///////////
+  J *rsp = NoteRequestResponse(NoteNewRequest("note.changes"));
+
+   // Assert
+  ///////////
+  const char * const expected[] = {"note.changes", "note.changes"};
+  if (attemptsAre(expected, 2)
+   && attempts[0].seqNo == attempts[1].seqNo
+   && responseHasSeqNo(rsp, attempts[1].seqNo)
+   && 10 == JGetInt(rsp, "changes")
+   && !JIsPresent(rsp, "crc"))
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'r' + 'e' + 'q' + 'u' + 'e' + 's' + 't');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    printAttempts();
+    std::cout << "\tJGetInt(rsp, \"changes\") == " << JGetInt(rsp, "changes") << ", EXPECTED: 10" << std::endl;
+    std::cout << "\tJIsPresent(rsp, \"crc\") == " << JIsPresent(rsp, "crc") << ", EXPECTED: false" << std::endl;
+    std::cout << "[";
+  }
+
+  JDelete(rsp);
+  return result;
+}
+
+int test_n_request_streamed_error_response_is_retried_without_a_crc_error()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  setUp(NOTE_RETRY_LOCK_HOLD);
+  otherTaskPending = false;
+  NoteSetResponseStreaming(true);
+
+   // Action
+  ///////////
+  J *rsp = NoteRequestResponse(NoteNewRequest("card.a"));
+
+   // Assert
+  ///////////
+  const char * const expected[] = {"card.a", "card.a"};
+  if (attemptsAre(expected, 2)
+   && responseHasSeqNo(rsp, attempts[1].seqNo)
+   && !noteLockUnbalanced)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'r' + 'e' + 'q' + 'u' + 'e' + 's' + 't');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    printAttempts();
+    std::cout << "\tresponseHasSeqNo(rsp, attempts[1].seqNo) == " << responseHasSeqNo(rsp, (attempts.size() > 1 ? attempts[1].seqNo : 0)) << ", EXPECTED: true" << std::endl;
+    std::cout << "[";
+  }
+
+  JDelete(rsp);
+  return result;
+}
+
+int test_n_request_helpers_read_their_fields_without_parsing_the_response()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  setUp(NOTE_RETRY_LOCK_HOLD);
+  NoteSetFn(trackingMalloc, trackingFree, delayMs, getMs);
+  otherTaskPending = false;
+  notecardFields = ",\"value\":4.21,\"connected\":true,\"text\":\"\\u00e9t\\u00e9\"";
+  const size_t ITERATIONS = 200;
+
+   // Action
+  ///////////
+  // Each helper used to parse the entire response, as this does
+  heapPeak = heapInUse;
+  size_t heapBefore = heapInUse;
+  heapAllocations = 0;
+  JNUMBER parsedVoltage = 0;
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for (size_t i = 0 ; i < ITERATIONS ; ++i) {
+    J *rsp = NoteRequestResponse(NoteNewRequest("card.voltage"));
+    parsedVoltage = (NoteResponseError(rsp) ? 0 : JGetNumber(rsp, "value"));
+    JDelete(rsp);
+  }
+  const std::chrono::duration<double, std::micro> parsedElapsed = (std::chrono::steady_clock::now() - start);
+  const size_t parsedGrowth = (heapPeak - heapBefore);
+  const size_t parsedAllocations = (heapAllocations / ITERATIONS);
+
+  heapPeak = heapInUse;
+  heapBefore = heapInUse;
+  heapAllocations = 0;
+  JNUMBER voltage = 0;
+  bool voltageOk = true;
+  start = std::chrono::steady_clock::now();
+  for (size_t i = 0 ; i < ITERATIONS ; ++i) {
+    voltageOk = (NoteGetVoltage(&voltage) && voltageOk);
+  }
+  const std::chrono::duration<double, std::micro> scannedElapsed = (std::chrono::steady_clock::now() - start);
+  const size_t scannedGrowth = (heapPeak - heapBefore);
+  const size_t scannedAllocations = (heapAllocations / ITERATIONS);
+
+  JNUMBER temp = 0;
+  const bool tempOk = NoteGetTemperature(&temp);
+  const bool connected = NoteIsConnected();
+  char env[8];
+  const bool envOk = NoteGetEnv("place", "nowhere", env, sizeof(env));
+  notecardFields = ",\"text\":\"42\"";
+  const JINTEGER envInt = NoteGetEnvInt("count", 7);
+  notecardFields = ",\"err\":\"no such variable\"";
+  const JINTEGER envDefault = NoteGetEnvInt("count", 7);
+  notecardFields = ",\"err\":\"\",\"value\":4.21";
+  JNUMBER emptyErrVoltage = 0;
+  const bool emptyErrOk = NoteGetVoltage(&emptyErrVoltage);
+
+   // Assert
+  ///////////
+  std::cout << "\33[33mINFO\33[0m] card.voltage per call: parsed " << parsedAllocations << " allocations, " << parsedGrowth << " B peak, "
+            << std::fixed << std::setprecision(1) << (parsedElapsed.count() / ITERATIONS) << " us; scanned " << scannedAllocations << " allocations, "
+            << scannedGrowth << " B peak, " << (scannedElapsed.count() / ITERATIONS) << " us" << std::endl << "[";
+  if (voltageOk && tempOk
+   && parsedVoltage == voltage
+   && static_cast<JNUMBER>(4.21) == voltage
+   && static_cast<JNUMBER>(4.21) == temp
+   && connected
+   && envOk && std::string("\xc3\xa9t\xc3\xa9") == env
+   && 42 == envInt
+   && 7 == envDefault
+   && !emptyErrOk && 0 == emptyErrVoltage
+   && scannedAllocations < parsedAllocations
+   && scannedGrowth < parsedGrowth
+   && 0 == heapInUse)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'r' + 'e' + 'q' + 'u' + 'e' + 's' + 't');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tNoteGetVoltage(...) == " << voltageOk << " (" << voltage << "), EXPECTED: 1 (" << parsedVoltage << ")" << std::endl;
+    std::cout << "\tNoteGetTemperature(...) == " << tempOk << " (" << temp << "), EXPECTED: 1 (4.21)" << std::endl;
+    std::cout << "\tNoteIsConnected() == " << connected << ", EXPECTED: 1" << std::endl;
+    std::cout << "\tNoteGetEnv(...) == " << envOk << " (" << env << "), EXPECTED: 1 (\xc3\xa9t\xc3\xa9)" << std::endl;
+    std::cout << "\tNoteGetEnvInt(...) == " << envInt << " then " << envDefault << ", EXPECTED: 42 then 7" << std::endl;
+    std::cout << "\tNoteGetVoltage(...) with an empty err == " << emptyErrOk << " (" << emptyErrVoltage << "), EXPECTED: 0 (0)" << std::endl;
+    std::cout << "\tscanned allocations == " << scannedAllocations << ", peak == " << scannedGrowth << ", EXPECTED: < " << parsedAllocations << ", < " << parsedGrowth << std::endl;
+    std::cout << "\theapInUse == " << heapInUse << ", EXPECTED: 0" << std::endl;
+    std::cout << "[";
+  }
+
+  NoteSetFn(malloc, free, delayMs, getMs);
+  return result;
+}
+
+int test_n_request_helper_response_with_a_crc_error_is_retried()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  setUp(NOTE_RETRY_LOCK_HOLD);
+  otherTaskPending = false;
+  notecardCorruptNextCrc = true;
+  notecardFields = ",\"value\":-3.5";
+
+   // Action
+  ///////////
+  JNUMBER temp = 0;
+  const bool success = NoteGetTemperature(&temp);
+
+   // Assert
+  ///////////
+  const char * const expected[] = {"card.temp", "card.temp"};
+  if (success
+   && static_cast<JNUMBER>(-3.5) == temp
+   && attemptsAre(expected, 2)
+   && attempts[0].seqNo == attempts[1].seqNo
+   && !noteLockDepth
+   && !noteLockUnbalanced)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'r' + 'e' + 'q' + 'u' + 'e' + 's' + 't');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tNoteGetTemperature(...) == " << success << " (" << temp << "), EXPECTED: 1 (-3.5)" << std::endl;
+    printAttempts();
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_n_request_response_is_read_only_up_to_its_length()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  setUp(NOTE_RETRY_LOCK_HOLD);
+  otherTaskPending = false;
+  const char text[] = "{\"a\":1,\"b\":\"x\"}{\"c\":2";
+  const size_t textLen = (sizeof("{\"a\":1,\"b\":\"x\"}") - 1);
+
+   // Action
+  ///////////
+  // Neither the parser nor the scanner reads past the given length
+  J *parsed = JParseWithLength(text, textLen);
+  J *truncated = JParseWithLength(text, (textLen - 1));
+  JField fields[] = {{"b", NULL, 0, JInvalid}, {"c", NULL, 0, JInvalid}};
+  const int scanned = JScanWithLength(text, textLen, fields, 2);
+  JField truncatedField = {"b", NULL, 0, JInvalid};
+  const int scannedTruncated = JScanWithLength(text, (textLen - 1), &truncatedField, 1);
+
+  // An error response carrying a valid CRC has it stripped, and one with a
+  // CRC error is still not retried
+  JDelete(NoteRequestResponse(NoteNewRequest("card.warm")));
+  attempts.clear();
+  notecardFields = ",\"err\":\"no such variable\"";
+  J *rsp = NoteRequestResponse(NoteNewRequest("env.get"));
+  notecardCorruptNextCrc = true;
+  J *corruptRsp = NoteRequestResponse(NoteNewRequest("env.get"));
+
+   // Assert
+  ///////////
+  const char * const expected[] = {"env.get", "env.get"};
+  if (parsed && 1 == JGetInt(parsed, "a") && JIsPresent(parsed, "b") && !JIsPresent(parsed, "c")
+   && !truncated
+   && 1 == scanned && 3 == fields[0].length && JInvalid == fields[1].type
+   && -1 == scannedTruncated
+   && NoteResponseError(rsp) && !JIsPresent(rsp, "crc")
+   && NoteResponseError(corruptRsp)
+   && attemptsAre(expected, 2))
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'r' + 'e' + 'q' + 'u' + 'e' + 's' + 't');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tparsed == " << (parsed ? JGetInt(parsed, "a") : -1) << ", truncated == " << (truncated ? "J" : "NULL") << ", EXPECTED: 1, NULL" << std::endl;
+    std::cout << "\tscanned == " << scanned << ", scannedTruncated == " << scannedTruncated << ", EXPECTED: 1, -1" << std::endl;
+    std::cout << "\tNoteResponseError(rsp) == " << NoteResponseError(rsp) << ", JIsPresent(rsp, \"crc\") == " << JIsPresent(rsp, "crc") << ", EXPECTED: 1, 0" << std::endl;
+    printAttempts();
+    std::cout << "[";
+  }
+
+  JDelete(parsed);
+  JDelete(truncated);
+  JDelete(rsp);
+  JDelete(corruptRsp);
+  return result;
+}
+
+int test_n_request_template_sends_what_the_j_path_sends()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  setUp(NOTE_RETRY_LOCK_HOLD);
+  otherTaskPending = false;
+  J *skeleton = NoteNewRequest("note.add");
+  JAddStringToObject(skeleton, "file", "data.qo");
+  J *skeletonBody = JAddObjectToObject(skeleton, "body");
+  JAddNumberToObject(skeletonBody, "temp", 0);
+  JAddBoolToObject(skeletonBody, "ok", false);
+  JAddStringToObject(skeletonBody, "tag", "12345678");
+  JAddBoolToObject(skeleton, "sync", true);
+  const char * const SLOTS[] = {"body.temp", "body.ok", "body.tag"};
+  NoteRequestTemplate *tpl = NoteNewRequestTemplate(skeleton, SLOTS, 3);
+
+   // Action
+  ///////////
+  const bool setOk = (NoteRequestTemplateSetNumber(tpl, 0, -21.5)
+                   && NoteRequestTemplateSetBool(tpl, 1, true)
+                   && NoteRequestTemplateSetString(tpl, 2, "\xc3\xa9t\"\xc3\xa9"));
+  const bool tooLongRejected = !NoteRequestTemplateSetString(tpl, 2, "123456789");
+  const bool wrongTypeRejected = (!NoteRequestTemplateSetString(tpl, 0, "1") && !NoteRequestTemplateSetInt(tpl, 2, 1) && !NoteRequestTemplateSetBool(tpl, 3, true));
+  const bool templateSent = NoteRequestTemplateSend(tpl);
+  const std::string templateRequest = notecardLastRequest;
+
+  J *req = NoteNewRequest("note.add");
+  JAddStringToObject(req, "file", "data.qo");
+  J *body = JAddObjectToObject(req, "body");
+  JAddNumberToObject(body, "temp", -21.5);
+  JAddBoolToObject(body, "ok", true);
+  JAddStringToObject(body, "tag", "\xc3\xa9t\"\xc3\xa9");
+  JAddBoolToObject(req, "sync", true);
+  const bool requestSent = NoteRequest(req);
+  const std::string request = notecardLastRequest;
+
+  NoteDeleteRequestTemplate(tpl);
+
+   // Assert
+  ///////////
+  const std::string templateJson = templateRequest.substr(0, templateRequest.rfind(",\"crc\":"));
+  const std::string json = request.substr(0, request.rfind(",\"crc\":"));
+  const char * const expected[] = {"note.add", "note.add"};
+  if (tpl && setOk && tooLongRejected && wrongTypeRejected
+   && templateSent && requestSent
+   && templateJson == json
+   && requestCrcValid(templateRequest)
+   && attemptsAre(expected, 2)
+   && attempts[0].seqNo != attempts[1].seqNo
+   && !noteLockDepth
+   && !noteLockUnbalanced)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'r' + 'e' + 'q' + 'u' + 'e' + 's' + 't');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tNoteNewRequestTemplate(...) == " << tpl << ", set " << setOk << ", too long rejected " << tooLongRejected << ", wrong type rejected " << wrongTypeRejected << std::endl;
+    std::cout << "\tNoteRequestTemplateSend(...) == " << templateSent << ", NoteRequest(...) == " << requestSent << ", EXPECTED: 1, 1" << std::endl;
+    std::cout << "\ttemplate request == " << templateRequest << std::endl;
+    std::cout << "\tEXPECTED: " << request << std::endl;
+    printAttempts();
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_n_request_template_allocates_less_than_building_each_request()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  setUp(NOTE_RETRY_LOCK_HOLD);
+  NoteSetFn(trackingMalloc, trackingFree, delayMs, getMs);
+  otherTaskPending = false;
+  const char * const FIELDS[] = {"temp", "humidity", "pressure", "voltage", "count", "rssi"};
+  const size_t FIELD_COUNT = (sizeof(FIELDS) / sizeof(FIELDS[0]));
+  const size_t ITERATIONS = 200;
+
+   // Action
+  ///////////
+  heapPeak = heapInUse;
+  size_t heapBefore = heapInUse;
+  heapAllocations = 0;
+  bool builtOk = true;
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for (size_t i = 0 ; i < ITERATIONS ; ++i) {
+    J *req = NoteNewRequest("note.add");
+    JAddStringToObject(req, "file", "sensors.qo");
+    J *body = JAddObjectToObject(req, "body");
+    for (size_t f = 0 ; f < FIELD_COUNT ; ++f) {
+      JAddNumberToObject(body, FIELDS[f], (static_cast<JNUMBER>(i) + (f / 4.0)));
+    }
+    builtOk = (NoteRequest(req) && builtOk);
+  }
+  const std::chrono::duration<double, std::micro> builtElapsed = (std::chrono::steady_clock::now() - start);
+  const size_t builtGrowth = (heapPeak - heapBefore);
+  const size_t builtAllocations = (heapAllocations / ITERATIONS);
+  const std::string builtRequest = notecardLastRequest;
+
+  J *skeleton = NoteNewRequest("note.add");
+  JAddStringToObject(skeleton, "file", "sensors.qo");
+  J *skeletonBody = JAddObjectToObject(skeleton, "body");
+  for (size_t f = 0 ; f < FIELD_COUNT ; ++f) {
+    JAddNumberToObject(skeletonBody, FIELDS[f], 0);
+  }
+  const char * const SLOTS[] = {"body.temp", "body.humidity", "body.pressure", "body.voltage", "body.count", "body.rssi"};
+  NoteRequestTemplate *tpl = NoteNewRequestTemplate(skeleton, SLOTS, FIELD_COUNT);
+
+  heapPeak = heapInUse;
+  heapBefore = heapInUse;
+  heapAllocations = 0;
+  bool templateOk = (nullptr != tpl);
+  start = std::chrono::steady_clock::now();
+  for (size_t i = 0 ; i < ITERATIONS && templateOk ; ++i) {
+    for (size_t f = 0 ; f < FIELD_COUNT ; ++f) {
+      NoteRequestTemplateSetNumber(tpl, f, (static_cast<JNUMBER>(i) + (f / 4.0)));
+    }
+    templateOk = NoteRequestTemplateSend(tpl);
+  }
+  const std::chrono::duration<double, std::micro> templateElapsed = (std::chrono::steady_clock::now() - start);
+  const size_t templateGrowth = (heapPeak - heapBefore);
+  const size_t templateAllocations = (heapAllocations / ITERATIONS);
+  const std::string templateRequest = notecardLastRequest;
+
+  NoteDeleteRequestTemplate(tpl);
+
+   // Assert
+  ///////////
+  std::cout << "\33[33mINFO\33[0m] note.add of " << FIELD_COUNT << " numbers per call: built " << builtAllocations << " allocations, " << builtGrowth << " B peak, "
+            << std::fixed << std::setprecision(1) << (builtElapsed.count() / ITERATIONS) << " us; template " << templateAllocations << " allocations, "
+            << templateGrowth << " B peak, " << (templateElapsed.count() / ITERATIONS) << " us" << std::endl << "[";
+  if (builtOk && templateOk
+   && builtRequest.substr(0, builtRequest.rfind(",\"crc\":")) == templateRequest.substr(0, templateRequest.rfind(",\"crc\":"))
+   && templateAllocations < builtAllocations
+   && templateGrowth < builtGrowth
+   && 0 == heapInUse)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'r' + 'e' + 'q' + 'u' + 'e' + 's' + 't');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tNoteRequest(...) == " << builtOk << ", NoteRequestTemplateSend(...) == " << templateOk << ", EXPECTED: 1, 1" << std::endl;
+    std::cout << "\ttemplate request == " << templateRequest << std::endl;
+    std::cout << "\tEXPECTED: " << builtRequest << std::endl;
+    std::cout << "\ttemplate allocations == " << templateAllocations << ", peak == " << templateGrowth << ", EXPECTED: < " << builtAllocations << ", < " << builtGrowth << std::endl;
+    std::cout << "\theapInUse == " << heapInUse << ", EXPECTED: 0" << std::endl;
+    std::cout << "[";
+  }
+
+  NoteSetFn(malloc, free, delayMs, getMs);
+  return result;
+}
+
+int test_n_request_retry_policy_backs_off_exponentially_within_its_jitter()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  setUp(NOTE_RETRY_LOCK_HOLD);
+  otherTaskPending = false;
+  notecardFailNextA = false;
+  JDelete(NoteRequestResponse(NoteNewRequest("card.warm")));
+  attempts.clear();
+  backoffs.clear();
+  notecardFailures = 100;
+  const NoteRetryPolicy policy = {200, 1000, 0, 6, 2, 25};
+  NoteSetRetryPolicy(&policy);
+  const uint32_t NOMINAL_MS[] = {200, 400, 800, 1000, 1000};
+  const size_t NOMINAL_COUNT = (sizeof(NOMINAL_MS) / sizeof(NOMINAL_MS[0]));
+
+   // Action
+  ///////////
+  J *rsp = NoteRequestResponse(NoteNewRequest("card.a"));
+
+   // Assert
+  ///////////
+  bool withinJitter = (NOMINAL_COUNT == backoffs.size());
+  bool jittered = false;
+  for (size_t i = 0 ; withinJitter && i < NOMINAL_COUNT ; ++i) {
+    withinJitter = (backoffs[i] <= NOMINAL_MS[i] && backoffs[i] >= (NOMINAL_MS[i] - (NOMINAL_MS[i] / 4)));
+    jittered = (jittered || backoffs[i] < NOMINAL_MS[i]);
+  }
+  if (withinJitter
+   && jittered
+   && 6 == attempts.size()
+   && NoteResponseError(rsp)
+   && !noteLockDepth
+   && !noteLockUnbalanced)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'r' + 'e' + 'q' + 'u' + 'e' + 's' + 't');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tbackoffs ==";
+    for (size_t i = 0 ; i < backoffs.size() ; ++i) {
+      std::cout << " " << backoffs[i];
+    }
+    std::cout << ", EXPECTED: 150-200 300-400 600-800 750-1000 750-1000, not all at their maximum" << std::endl;
+    std::cout << "\tattempts.size() == " << attempts.size() << ", EXPECTED: 6" << std::endl;
+    std::cout << "\tNoteResponseError(rsp) == " << NoteResponseError(rsp) << ", EXPECTED: 1" << std::endl;
+    std::cout << "[";
+  }
+
+  JDelete(rsp);
+  return result;
+}
+
+int test_n_request_retry_deadline_spans_both_retry_layers()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  setUp(NOTE_RETRY_LOCK_HOLD);
+  otherTaskPending = false;
+  notecardFailNextA = false;
+  JDelete(NoteRequestResponse(NoteNewRequest("card.warm")));
+  attempts.clear();
+  backoffs.clear();
+  notecardFailures = 100;
+
+   // Action
+  ///////////
+  // The default policy makes six attempts, 500ms apart, in each transaction,
+  // which would overrun the two second limit
+  uint32_t startMs = nowMs;
+  J *rsp = NoteRequestResponseWithRetry(NoteNewRequest("card.a"), 2);
+  const uint32_t defaultElapsedMs = (nowMs - startMs);
+  const size_t defaultAttempts = attempts.size();
+  const bool defaultFailed = NoteResponseError(rsp);
+  JDelete(rsp);
+
+  // A policy of two attempts is repeated by the outer loop, which resets the
+  // Notecard interface before each transaction, until the five second limit
+  // leaves no time for another attempt
+  const NoteRetryPolicy policy = {500, 500, 0, 2, 1, 0};
+  NoteSetRetryPolicy(&policy);
+  notecardFailures = 0;
+  JDelete(NoteRequestResponse(NoteNewRequest("card.warm")));
+  attempts.clear();
+  notecardFailures = 100;
+  startMs = nowMs;
+  rsp = NoteRequestResponseWithRetry(NoteNewRequest("card.a"), 5);
+  const uint32_t shortElapsedMs = (nowMs - startMs);
+  const size_t shortAttempts = attempts.size();
+  const bool shortFailed = NoteResponseError(rsp);
+  JDelete(rsp);
+
+   // Assert
+  ///////////
+  if (defaultFailed && defaultElapsedMs < 2000 && 4 == defaultAttempts
+   && shortFailed && shortElapsedMs < 5000 && 6 == shortAttempts
+   && !noteLockDepth
+   && !noteLockUnbalanced)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'r' + 'e' + 'q' + 'u' + 'e' + 's' + 't');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tdefault policy: failed == " << defaultFailed << ", elapsed == " << defaultElapsedMs << " ms, attempts == " << defaultAttempts << ", EXPECTED: 1, < 2000 ms, 4" << std::endl;
+    std::cout << "\ttwo attempts: failed == " << shortFailed << ", elapsed == " << shortElapsedMs << " ms, attempts == " << shortAttempts << ", EXPECTED: 1, < 5000 ms, 6" << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_n_request_retry_policies_recover_from_injected_faults()
+{
+  int result = 0;
+
+   // Arrange
+  ////////////
+  const NoteRetryPolicy failFast = {100, 200, 500, 3, 2, 0};
+  const NoteRetryPolicy standard = NOTE_RETRY_POLICY_DEFAULT;
+  const NoteRetryPolicy patient = {250, 8000, 0, 12, 2, 20};
+  const NoteRetryPolicy * const POLICIES[] = {&failFast, &standard, &patient};
+  const char * const NAMES[] = {"fail-fast", "default", "patient"};
+  const unsigned int FAULTS[] = {0, 1, 2, 3, 5, 8};
+  const unsigned int RECOVERABLE[] = {2, 5, 8};
+  const size_t POLICY_COUNT = (sizeof(POLICIES) / sizeof(POLICIES[0]));
+  const size_t FAULT_COUNT = (sizeof(FAULTS) / sizeof(FAULTS[0]));
+
+   // Action
+  ///////////
+  uint32_t latencyMs[3][6];
+  bool recovered[3][6];
+  for (size_t p = 0 ; p < POLICY_COUNT ; ++p) {
+    for (size_t f = 0 ; f < FAULT_COUNT ; ++f) {
+      latencyMs[p][f] = recoveryMs(POLICIES[p], FAULTS[f], &recovered[p][f]);
+    }
+  }
+
+   // Assert
+  ///////////
+  for (size_t p = 0 ; p < POLICY_COUNT ; ++p) {
+    std::cout << "\33[33mINFO\33[0m] " << NAMES[p] << " recovery after 0, 1, 2, 3, 5, 8 faults:";
+    for (size_t f = 0 ; f < FAULT_COUNT ; ++f) {
+      std::cout << (f ? ", " : " ") << latencyMs[p][f] << " ms" << (recovered[p][f] ? "" : " (gave up)");
+    }
+    std::cout << std::endl << "[";
+  }
+  for (size_t p = 0 ; p < POLICY_COUNT ; ++p) {
+    for (size_t f = 0 ; f < FAULT_COUNT ; ++f) {
+      if (recovered[p][f] != (FAULTS[f] <= RECOVERABLE[p])) {
+        result = static_cast<int>('n' + '_' + 'r' + 'e' + 'q' + 'u' + 'e' + 's' + 't');
+        std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+        std::cout << "\t" << NAMES[p] << " recovered after " << FAULTS[f] << " faults == " << recovered[p][f] << ", EXPECTED: " << (FAULTS[f] <= RECOVERABLE[p]) << std::endl;
+        std::cout << "[";
+      }
+    }
+  }
+  for (size_t f = 0 ; f < FAULT_COUNT && !result ; ++f) {
+    if (latencyMs[0][f] >= failFast.deadlineMs) {
+      result = static_cast<int>('n' + '_' + 'r' + 'e' + 'q' + 'u' + 'e' + 's' + 't');
+      std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+      std::cout << "\tfail-fast latency after " << FAULTS[f] << " faults == " << latencyMs[0][f] << " ms, EXPECTED: < " << failFast.deadlineMs << " ms" << std::endl;
+      std::cout << "[";
+    }
+  }
+  if (!result && latencyMs[2][1] >= latencyMs[1][1]) {
+    result = static_cast<int>('n' + '_' + 'r' + 'e' + 'q' + 'u' + 'e' + 's' + 't');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tpatient latency after 1 fault == " << latencyMs[2][1] << " ms, EXPECTED: < " << latencyMs[1][1] << " ms" << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_n_request_batch_until_error_stops_at_a_failed_request()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  setUp(NOTE_RETRY_LOCK_HOLD);
+  otherTaskPending = false;
+  notecardFailNextA = false;
+  notecardRejectReq = "card.b";
+  const char * const EXPECTED_ATTEMPTS[] = {"card.a", "card.b"};
+  J *reqs = JCreateArray();
+  JAddItemToArray(reqs, NoteNewRequest("card.a"));
+  JAddItemToArray(reqs, NoteNewRequest("card.b"));
+  JAddItemToArray(reqs, NoteNewRequest("card.c"));
+
+   // Action
+  ///////////
+  J *rsps = NoteTransactionBatchUntilError(reqs);
+
+   // Assert
+  ///////////
+  if (rsps && 2 == JGetArraySize(rsps)
+   && responseHasSeqNo(JGetArrayItem(rsps, 0), attempts[0].seqNo)
+   && NoteResponseError(JGetArrayItem(rsps, 1))
+   && attemptsAre(EXPECTED_ATTEMPTS, 2)
+   && !noteLockDepth
+   && !noteLockUnbalanced)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'r' + 'e' + 'q' + 'u' + 'e' + 's' + 't');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tJGetArraySize(rsps) == " << (rsps ? JGetArraySize(rsps) : -1) << ", EXPECTED: 2, the second an error" << std::endl;
+    printAttempts();
+    std::cout << "\tEXPECTED: card.a card.b, with card.c left unsent" << std::endl;
+    std::cout << "[";
+  }
+
+  JDelete(rsps);
+  JDelete(reqs);
+  return result;
+}
+
+int test_n_request_cache_answers_repeated_queries_until_their_ttl_expires()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  setUp(NOTE_RETRY_LOCK_HOLD);
+  otherTaskPending = false;
+  notecardFailNextA = false;
+  const bool enabled = NoteSetResponseCache(4, 1024);
+
+   // Action
+  ///////////
+  const long hubFirst = seqOf(NoteNewRequest("hub.get"));
+  const long hubCached = seqOf(NoteNewRequest("hub.get"));
+  const long envA = seqOf(envGet("a"));
+  const long envB = seqOf(envGet("b"));
+  const long envACached = seqOf(envGet("a"));
+  J *withId = NoteNewRequest("hub.get");
+  JAddIntToObject(withId, "id", 7);
+  const long hubWithId = seqOf(withId);
+  nowMs += 60000;
+  const long hubExpired = seqOf(NoteNewRequest("hub.get"));
+  const long tempFirst = seqOf(NoteNewRequest("card.temp"));
+  const long tempAgain = seqOf(NoteNewRequest("card.temp"));
+  NoteResponseCacheStats stats;
+  NoteGetResponseCacheStats(&stats);
+
+   // Assert
+  ///////////
+  if (enabled
+   && hubFirst >= 0 && hubCached == hubFirst
+   && envA >= 0 && envB >= 0 && envB != envA && envACached == envA
+   && hubWithId >= 0 && hubWithId != hubFirst
+   && hubExpired >= 0 && hubExpired != hubFirst && hubExpired != hubWithId
+   && tempFirst >= 0 && tempAgain != tempFirst
+   && 7 == attempts.size()
+   && 2 == stats.hits
+   && 4 == stats.misses
+   && 3 == stats.entries
+   && !noteLockDepth
+   && !noteLockUnbalanced)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'r' + 'e' + 'q' + 'u' + 'e' + 's' + 't');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tNoteSetResponseCache(4, 1024) == " << enabled << ", EXPECTED: 1" << std::endl;
+    std::cout << "\thub.get == " << hubFirst << ", " << hubCached << ", with id " << hubWithId << ", expired " << hubExpired << ", EXPECTED: N, N, M, L" << std::endl;
+    std::cout << "\tenv.get == " << envA << ", " << envB << ", " << envACached << ", EXPECTED: N, M, N" << std::endl;
+    std::cout << "\tcard.temp == " << tempFirst << ", " << tempAgain << ", EXPECTED: N, M" << std::endl;
+    std::cout << "\thits == " << stats.hits << ", misses == " << stats.misses << ", entries == " << stats.entries << ", EXPECTED: 2, 4, 3" << std::endl;
+    printAttempts();
+    std::cout << "[";
+  }
+
+  NoteSetResponseCache(0, 0);
+  return result;
+}
+
+int test_n_request_cache_is_invalidated_by_every_request_path_and_keyed_by_content()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  setUp(NOTE_RETRY_LOCK_HOLD);
+  otherTaskPending = false;
+  notecardFailNextA = false;
+  NoteSetResponseCache(4, 1024);
+  J *skeleton = NoteNewRequest("hub.set");
+  JAddStringToObject(skeleton, "mode", "periodic");
+  const char * const SLOTS[] = {"mode"};
+  NoteRequestTemplate *tpl = NoteNewRequestTemplate(skeleton, SLOTS, 1);
+
+   // Action
+  ///////////
+  // Requests that differ only in the order of their fields share a response
+  J *nameFirst = envGet("a");
+  JAddStringToObject(nameFirst, "file", "env.dbs");
+  const long envFirst = seqOf(nameFirst);
+  J *fileFirst = NoteNewRequest("env.get");
+  JAddStringToObject(fileFirst, "file", "env.dbs");
+  JAddStringToObject(fileFirst, "name", "a");
+  const long envReordered = seqOf(fileFirst);
+
+  // Writes sent as serialized JSON, into a buffer, or from a template
+  const long hubFirst = seqOf(NoteNewRequest("hub.get"));
+  JFree(NoteRequestResponseJSON("{\"req\":\"hub.get\"}\n"));
+  const long hubAfterRawRead = seqOf(NoteNewRequest("hub.get"));
+  JFree(NoteRequestResponseJSON("{\"req\":\"hub.set\",\"mode\":\"continuous\"}\n"));
+  const long hubAfterRaw = seqOf(NoteNewRequest("hub.get"));
+  char request[128] = "{\"req\":\"hub.set\",\"mode\":\"periodic\"}";
+  char response[128];
+  size_t responseLen = 0;
+  NoteRequestResponseJSONBuffer(request, strlen(request), sizeof(request), response, sizeof(response), &responseLen);
+  const long hubAfterBuffer = seqOf(NoteNewRequest("hub.get"));
+  const bool templateSent = NoteRequestTemplateSend(tpl);
+  const long hubAfterTemplate = seqOf(NoteNewRequest("hub.get"));
+
+  // A cached API is only dropped by a serialized request with arguments
+  const long wirelessFirst = seqOf(NoteNewRequest("card.wireless"));
+  JFree(NoteRequestResponseJSON("{\"req\":\"card.wireless\"}\n"));
+  const long wirelessAfterRead = seqOf(NoteNewRequest("card.wireless"));
+  JFree(NoteRequestResponseJSON("{\"req\":\"card.wireless\",\"mode\":\"auto\"}\n"));
+  const long wirelessAfterWrite = seqOf(NoteNewRequest("card.wireless"));
+  NoteResponseCacheStats stats;
+  NoteGetResponseCacheStats(&stats);
+
+  NoteDeleteRequestTemplate(tpl);
+
+   // Assert
+  ///////////
+  if (envFirst >= 0 && envReordered == envFirst
+   && hubFirst >= 0 && hubAfterRawRead == hubFirst
+   && hubAfterRaw >= 0 && hubAfterRaw != hubFirst
+   && hubAfterBuffer >= 0 && hubAfterBuffer != hubAfterRaw
+   && tpl && templateSent
+   && hubAfterTemplate >= 0 && hubAfterTemplate != hubAfterBuffer
+   && wirelessFirst >= 0 && wirelessAfterRead == wirelessFirst
+   && wirelessAfterWrite >= 0 && wirelessAfterWrite != wirelessFirst
+   && 4 == stats.invalidations
+   && !noteLockDepth
+   && !noteLockUnbalanced)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'r' + 'e' + 'q' + 'u' + 'e' + 's' + 't');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tenv.get == " << envFirst << " then " << envReordered << " reordered, EXPECTED: N then N" << std::endl;
+    std::cout << "\thub.get == " << hubFirst << ", " << hubAfterRawRead << " after a read, then " << hubAfterRaw << ", " << hubAfterBuffer << ", " << hubAfterTemplate
+              << " after raw, buffer and template writes, EXPECTED: N, N, then M, L, K" << std::endl;
+    std::cout << "\tcard.wireless == " << wirelessFirst << ", " << wirelessAfterRead << " after a read, then " << wirelessAfterWrite << " after a write, EXPECTED: N, N, then M" << std::endl;
+    std::cout << "\tinvalidations == " << stats.invalidations << ", EXPECTED: 4" << std::endl;
+    printAttempts();
+    std::cout << "[";
+  }
+
+  NoteSetResponseCache(0, 0);
+  return result;
+}
+
+int test_n_request_cache_does_not_store_a_response_made_stale_by_another_task()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  setUp(NOTE_RETRY_LOCK_HOLD);
+  otherTaskPending = false;
+  notecardFailNextA = false;
+  NoteSetResponseCache(4, 1024);
+  const char * const EXPECTED_ATTEMPTS[] = {"hub.get", "hub.set", "hub.get"};
+
+   // Action
+  ///////////
+  // Another task sends a write as soon as the lock is released after the read
+  otherTaskWritesAfterRead = true;
+  const long hubFirst = seqOf(NoteNewRequest("hub.get"));
+  const long hubAfterWrite = seqOf(NoteNewRequest("hub.get"));
+  NoteResponseCacheStats stats;
+  NoteGetResponseCacheStats(&stats);
+
+   // Assert
+  ///////////
+  if (hubFirst >= 0 && hubAfterWrite >= 0 && hubAfterWrite != hubFirst
+   && attemptsAre(EXPECTED_ATTEMPTS, 3)
+   && 0 == stats.hits
+   && !noteLockDepth
+   && !noteLockUnbalanced)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'r' + 'e' + 'q' + 'u' + 'e' + 's' + 't');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\thub.get == " << hubFirst << " then " << hubAfterWrite << " after another task's write, EXPECTED: N then M" << std::endl;
+    std::cout << "\thits == " << stats.hits << ", EXPECTED: 0" << std::endl;
+    printAttempts();
+    std::cout << "[";
+  }
+
+  NoteSetResponseCache(0, 0);
+  return result;
+}
+
+int test_n_request_cache_is_invalidated_by_writes_and_bounded()
+{
+  int result = 0;
+
+   // Arrange
+  ////////////
+  setUp(NOTE_RETRY_LOCK_HOLD);
+  otherTaskPending = false;
+  notecardFailNextA = false;
+  NoteSetResponseCache(4, 1024);
+
+   // Action
+  ///////////
+  const long hubFirst = seqOf(NoteNewRequest("hub.get"));
+  const long envFirst = seqOf(envGet("a"));
+  const long wirelessFirst = seqOf(NoteNewRequest("card.wireless"));
+  J *hubSet = NoteNewRequest("hub.set");
+  JAddStringToObject(hubSet, "mode", "periodic");
+  const bool hubSetSent = NoteRequest(hubSet);
+  const long hubAfterSet = seqOf(NoteNewRequest("hub.get"));
+  const long envKept = seqOf(envGet("a"));
+  J *envSet = NoteNewRequest("env.set");
+  JAddStringToObject(envSet, "name", "a");
+  JAddStringToObject(envSet, "text", "1");
+  NoteRequest(envSet);
+  const long envAfterSet = seqOf(envGet("a"));
+  J *wirelessSet = NoteNewRequest("card.wireless");
+  JAddStringToObject(wirelessSet, "mode", "auto");
+  NoteRequest(wirelessSet);
+  const long wirelessAfterSet = seqOf(NoteNewRequest("card.wireless"));
+  NoteResponseCacheStats written;
+  NoteGetResponseCacheStats(&written);
+
+  NoteSetResponseCache(2, 1024);
+  const long versionFirst = seqOf(NoteNewRequest("card.version"));
+  seqOf(NoteNewRequest("hub.get"));
+  seqOf(NoteNewRequest("hub.get"));
+  seqOf(NoteNewRequest("card.wireless"));
+  const long versionEvicted = seqOf(NoteNewRequest("card.version"));
+  NoteResponseCacheStats counted;
+  NoteGetResponseCacheStats(&counted);
+
+  NoteSetResponseCache(4, 40);
+  seqOf(NoteNewRequest("card.version"));
+  seqOf(NoteNewRequest("hub.get"));
+  NoteResponseCacheStats sized;
+  NoteGetResponseCacheStats(&sized);
+  NoteResponseCacheInvalidate(nullptr);
+  NoteResponseCacheStats cleared;
+  NoteGetResponseCacheStats(&cleared);
+
+   // Assert
+  ///////////
+  if (!(hubSetSent
+   && hubAfterSet >= 0 && hubAfterSet != hubFirst
+   && envKept == envFirst
+   && envAfterSet >= 0 && envAfterSet != envFirst
+   && wirelessAfterSet >= 0 && wirelessAfterSet != wirelessFirst
+   && 3 == written.invalidations
+   && 3 == written.entries))
+  {
+    result = static_cast<int>('n' + '_' + 'r' + 'e' + 'q' + 'u' + 'e' + 's' + 't');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\thub.get == " << hubFirst << " then " << hubAfterSet << " after hub.set, EXPECTED: N then M" << std::endl;
+    std::cout << "\tenv.get == " << envFirst << ", " << envKept << " then " << envAfterSet << " after env.set, EXPECTED: N, N then M" << std::endl;
+    std::cout << "\tcard.wireless == " << wirelessFirst << " then " << wirelessAfterSet << " after setting its mode, EXPECTED: N then M" << std::endl;
+    std::cout << "\tinvalidations == " << written.invalidations << ", entries == " << written.entries << ", EXPECTED: 3, 3" << std::endl;
+    std::cout << "[";
+  }
+  if (!(versionFirst >= 0 && versionEvicted != versionFirst
+   && 2 == counted.entries
+   && 2 == counted.evictions
+   && 1 == counted.hits))
+  {
+    result = static_cast<int>('n' + '_' + 'r' + 'e' + 'q' + 'u' + 'e' + 's' + 't');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tcard.version == " << versionFirst << " then " << versionEvicted << " once evicted, EXPECTED: N then M" << std::endl;
+    std::cout << "\tentries == " << counted.entries << ", evictions == " << counted.evictions << ", hits == " << counted.hits << ", EXPECTED: 2, 2, 1" << std::endl;
+    std::cout << "[";
+  }
+  if (!(1 == sized.entries && sized.bytes <= 40 && 1 == sized.evictions
+   && 0 == cleared.entries && 0 == cleared.bytes
+   && !noteLockDepth
+   && !noteLockUnbalanced))
+  {
+    result = static_cast<int>('n' + '_' + 'r' + 'e' + 'q' + 'u' + 'e' + 's' + 't');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tentries == " << sized.entries << ", bytes == " << sized.bytes << ", evictions == " << sized.evictions << ", EXPECTED: 1, <= 40, 1" << std::endl;
+    std::cout << "\tafter invalidating every response, entries == " << cleared.entries << ", bytes == " << cleared.bytes << ", EXPECTED: 0, 0" << std::endl;
+    std::cout << "[";
+  }
+
+  NoteSetResponseCache(0, 0);
+  return result;
+}
+
+int test_n_request_response_wait_hook_sleeps_until_the_response_instead_of_polling()
+{
+  int result = 0;
+
+   // Arrange
+  ////////////
+  setUp(NOTE_RETRY_LOCK_HOLD);
+  otherTaskPending = false;
+  notecardFailNextA = false;
+  JDelete(NoteRequestResponse(NoteNewRequest("card.warm")));
+  notecardLatencyMs = 2500;
+  // The longest a single wait may last, `CARD_RESPONSE_WAIT_MAX_MS`
+  const uint32_t WAIT_MAX_MS = 1000;
+
+   // Action
+  ///////////
+  // Over I2C then Serial, by polling, with a hook that is signaled when the
+  // response is ready, and with a hook whose signal is lost
+  struct Outcome {
+    std::string name;
+    bool ok;
+    uint32_t elapsedMs;
+    size_t emptyPolls;
+    size_t waits;
+    uint32_t longestWaitMs;
+  };
+  std::vector<Outcome> outcomes;
+  const auto transact = [&](const char *name, responseWaitFn waitFn) {
+    NoteSetFnResponseWait(waitFn);
+    notecardEmptyPolls = 0;
+    responseWaits.clear();
+    const uint32_t startMs = nowMs;
+    J *rsp = NoteRequestResponse(NoteNewRequest("card.a"));
+    const bool ok = responseHasSeqNo(rsp, attempts.back().seqNo);
+    JDelete(rsp);
+    const uint32_t longestWaitMs = (responseWaits.empty() ? 0 : *std::max_element(responseWaits.begin(), responseWaits.end()));
+    outcomes.push_back({name, ok, (nowMs - startMs), notecardEmptyPolls, responseWaits.size(), longestWaitMs});
+  };
+  for (int serial = 0 ; serial < 2 ; ++serial) {
+    if (serial) {
+      NoteSetFnResponseWait(nullptr);
+      NoteSetFnSerial(notecardSerialReset, notecardSerialTransmit, notecardSerialAvailable, notecardSerialReceive);
+      notecardLatencyMs = 0;
+      JDelete(NoteRequestResponse(NoteNewRequest("card.warm")));
+      notecardLatencyMs = 2500;
+    }
+    const std::string link = (serial ? "serial" : "i2c");
+    transact((link + " polling").c_str(), nullptr);
+    transact((link + " signaled").c_str(), responseWaitSignaled);
+    transact((link + " signal lost").c_str(), responseWaitMissed);
+  }
+  NoteSetFnResponseWait(nullptr);
+
+   // Assert
+  ///////////
+  // A signaled wait answers as soon as the response is ready, after one empty
+  // poll per bounded wait, where polling keeps the bus or port busy the whole
+  // time. A lost signal costs at most one more bounded wait.
+  const size_t signaledPollsMax = ((notecardLatencyMs / WAIT_MAX_MS) + 1);
+  for (size_t i = 0 ; i < outcomes.size() ; i += 3) {
+    const Outcome &polling = outcomes[i];
+    const Outcome &signaled = outcomes[i + 1];
+    const Outcome &lost = outcomes[i + 2];
+    if (!polling.ok || !signaled.ok || !lost.ok
+     || polling.waits
+     || signaled.emptyPolls > signaledPollsMax
+     || (signaled.emptyPolls * 10) >= polling.emptyPolls
+     || signaled.elapsedMs > polling.elapsedMs
+     || signaled.longestWaitMs > WAIT_MAX_MS
+     || lost.longestWaitMs > WAIT_MAX_MS
+     || lost.elapsedMs > (notecardLatencyMs + WAIT_MAX_MS + 100)) {
+      result = static_cast<int>('n' + '_' + 'r' + 'e' + 'q' + 'u' + 'e' + 's' + 't');
+      std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+      for (size_t j = i ; j < (i + 3) ; ++j) {
+        std::cout << "\t" << outcomes[j].name << ": ok == " << outcomes[j].ok << ", elapsed " << outcomes[j].elapsedMs << " ms, "
+                  << outcomes[j].emptyPolls << " empty polls, " << outcomes[j].waits << " waits (longest " << outcomes[j].longestWaitMs << " ms)" << std::endl;
+      }
+      std::cout << "\tEXPECTED: all ok, at most " << signaledPollsMax << " empty polls when signaled, no wait over " << WAIT_MAX_MS << " ms" << std::endl;
+      std::cout << "[";
+    }
+  }
+
+  return result;
+}
+
+int test_n_request_serial_flow_control_never_overruns_the_notecard()
+{
+  int result = 0;
+
+   // Arrange
+  ////////////
+  setUp(NOTE_RETRY_LOCK_HOLD);
+  otherTaskPending = false;
+  NoteSetFnSerial(notecardSerialReset, notecardSerialFifoTransmit, notecardSerialAvailable, notecardSerialReceive);
+  JDelete(NoteRequestResponse(NoteNewRequest("card.warm")));
+  const std::string text(600, 'x');
+
+   // Action
+  ///////////
+  // With fixed delays between segments, then paced by CTS
+  struct Outcome {
+    const char *name;
+    bool ok;
+    bool delivered;
+    uint32_t elapsedMs;
+    size_t fifoPeak;
+  };
+  std::vector<Outcome> outcomes;
+  const auto transact = [&](const char *name, serialClearToSendFn clearToSendFn) {
+    NoteSetFnSerialFlowControl(clearToSendFn);
+    notecardFifo = 0;
+    notecardFifoPeak = 0;
+    const uint32_t startMs = nowMs;
+    J *req = NoteNewRequest("note.add");
+    JAddStringToObject(req, "text", text.c_str());
+    J *rsp = NoteRequestResponse(req);
+    const bool ok = responseHasSeqNo(rsp, attempts.back().seqNo);
+    JDelete(rsp);
+    const bool delivered = (std::string::npos != notecardLastRequest.find(text));
+    outcomes.push_back({name, ok, delivered, (nowMs - startMs), notecardFifoPeak});
+  };
+  transact("fixed delay", nullptr);
+  transact("flow control", notecardSerialClearToSend);
+  NoteSetFnSerialFlowControl(nullptr);
+
+   // Assert
+  ///////////
+  // CTS is sampled before every chunk, so the FIFO never overflows, and the
+  // request goes out far sooner than after a 250ms pause per segment
+  const Outcome &fixed = outcomes[0];
+  const Outcome &paced = outcomes[1];
+  if (!fixed.ok || !fixed.delivered || !paced.ok || !paced.delivered
+   || paced.fifoPeak > NOTECARD_FIFO_SIZE
+   || (paced.elapsedMs * 5) >= fixed.elapsedMs) {
+    result = static_cast<int>('n' + '_' + 'r' + 'e' + 'q' + 'u' + 'e' + 's' + 't');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    for (const Outcome &outcome : outcomes) {
+      std::cout << "\t" << outcome.name << ": ok == " << outcome.ok << ", delivered == " << outcome.delivered
+                << ", elapsed " << outcome.elapsedMs << " ms, FIFO peak " << outcome.fifoPeak << " bytes" << std::endl;
+    }
+    std::cout << "\tEXPECTED: both ok and delivered, FIFO peak <= " << NOTECARD_FIFO_SIZE << " bytes when paced, paced under a fifth of the fixed delay time" << std::endl;
+    std::cout << "[";
+  } else {
+    std::cout << "\33[33mINFO\33[0m] " << text.size() << " byte request: fixed delay " << fixed.elapsedMs << " ms, flow control "
+              << paced.elapsedMs << " ms with a FIFO peak of " << paced.fifoPeak << " bytes" << std::endl << "[";
+  }
+
+  return result;
+}
+
+int test_n_request_serial_fast_resync_ends_the_drain_early_only_on_a_clean_line()
+{
+  int result = 0;
+
+   // Arrange
+  ////////////
+  setUp(NOTE_RETRY_LOCK_HOLD);
+  otherTaskPending = false;
+  notecardFailNextA = false;
+  NoteSetFnSerial(notecardSerialReset, notecardSerialTransmit, notecardSerialAvailable, notecardSerialReceive);
+  JDelete(NoteRequestResponse(NoteNewRequest("card.warm")));
+  // The fixed drain window, `CARD_RESET_DRAIN_MS`
+  const uint32_t DRAIN_MS = 500;
+
+   // Action
+  ///////////
+  // Reset with the fixed drain then the fast resync, on a clean line and on a
+  // line where stale data arrives just after the Notecard's echo
+  struct Outcome {
+    std::string name;
+    bool reset;
+    uint32_t elapsedMs;
+    uint32_t resyncMs;
+    bool transacted;
+  };
+  std::vector<Outcome> outcomes;
+  const auto reset = [&](const char *name, bool fast, const char *noise) {
+    NoteSetSerialFastResync(fast);
+    notecardNoise = noise;
+    const uint32_t startMs = nowMs;
+    const bool ok = NoteReset();
+    const uint32_t elapsedMs = (nowMs - startMs);
+    const uint32_t resyncMs = NoteGetSerialResyncMs();
+    J *rsp = NoteRequestResponse(NoteNewRequest("card.a"));
+    const bool transacted = responseHasSeqNo(rsp, attempts.back().seqNo);
+    JDelete(rsp);
+    outcomes.push_back({name, ok, elapsedMs, resyncMs, transacted});
+  };
+  reset("fixed drain", false, "");
+  reset("fast resync", true, "");
+  reset("fixed drain, noisy line", false, "{\"stale\":true}\r\n");
+  reset("fast resync, noisy line", true, "{\"stale\":true}\r\n");
+  NoteSetSerialFastResync(false);
+
+   // Assert
+  ///////////
+  // A clean echo ends the fast drain within a few quiet milliseconds, but any
+  // stale data, even once the echo is in, still costs the full drain window
+  // and is flushed before the next request
+  const Outcome &fixed = outcomes[0];
+  const Outcome &fast = outcomes[1];
+  const Outcome &fixedNoisy = outcomes[2];
+  const Outcome &fastNoisy = outcomes[3];
+  bool allOk = true;
+  for (const Outcome &outcome : outcomes) {
+    allOk = (allOk && outcome.reset && outcome.transacted && outcome.resyncMs == outcome.elapsedMs);
+  }
+  if (!allOk
+   || fixed.elapsedMs < (250 + DRAIN_MS)
+   || fast.elapsedMs > 50
+   || (fast.elapsedMs * 10) >= fixed.elapsedMs
+   || fixedNoisy.elapsedMs < fixed.elapsedMs
+   || fastNoisy.elapsedMs < DRAIN_MS) {
+    result = static_cast<int>('n' + '_' + 'r' + 'e' + 'q' + 'u' + 'e' + 's' + 't');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    for (const Outcome &outcome : outcomes) {
+      std::cout << "\t" << outcome.name << ": reset == " << outcome.reset << ", transacted == " << outcome.transacted
+                << ", elapsed " << outcome.elapsedMs << " ms, reported " << outcome.resyncMs << " ms" << std::endl;
+    }
+    std::cout << "\tEXPECTED: all reset and transacted, fast resync on a clean line under 50 ms, at least " << DRAIN_MS << " ms on a noisy line" << std::endl;
+    std::cout << "[";
+  } else {
+    std::cout << "\33[33mINFO\33[0m] serial reset: fixed drain " << fixed.elapsedMs << " ms, fast resync " << fast.elapsedMs
+              << " ms; on a noisy line " << fixedNoisy.elapsedMs << " ms and " << fastNoisy.elapsedMs << " ms" << std::endl << "[";
+  }
+
+  return result;
+}
+
+int test_n_request_caller_buffers_transact_without_the_heap()
+{
+  int result = 0;
+
+   // Arrange
+  ////////////
+  setUp(NOTE_RETRY_LOCK_HOLD);
+  otherTaskPending = false;
+  JDelete(NoteRequestResponse(NoteNewRequest("card.warm")));
+  NoteSetFn(trackingMalloc, trackingFree, delayMs, getMs);
+  notecardFields = ",\"value\":4.21";
+  const std::string original = "{\"req\":\"card.voltage\"}";
+  char request[64];
+  char response[128];
+  size_t responseLen = 0;
+
+   // Action
+  ///////////
+  // Over I2C, with a retry for a CRC error, then with each buffer too small,
+  // then over Serial
+  struct Outcome {
+    const char *name;
+    const char *err;
+    std::string response;
+    size_t responseLen;
+    bool requestRestored;
+    size_t attempts;
+    size_t allocations;
+  };
+  std::vector<Outcome> outcomes;
+  const auto transact = [&](const char *name, size_t requestSize, size_t responseSize) {
+    attempts.clear();
+    heapAllocations = 0;
+    memcpy(request, original.c_str(), original.size() + 1);
+    const char *err = NoteRequestResponseJSONBuffer(request, original.size(), requestSize, response, responseSize, &responseLen);
+    outcomes.push_back({name, err, (err ? "" : response), responseLen, (original == request), attempts.size(), heapAllocations});
+  };
+  transact("i2c", sizeof(request), sizeof(response));
+  const unsigned int i2cSeqNo = (attempts.empty() ? 0 : attempts.back().seqNo);
+  const bool i2cCrcSent = requestCrcValid(notecardLastRequest);
+  notecardCorruptNextCrc = true;
+  transact("i2c crc error", sizeof(request), sizeof(response));
+  transact("request overflow", (original.size() + NOTE_JSON_REQUEST_RESERVE - 1), sizeof(response));
+  notecardFields = changesFields(4);
+  transact("response overflow", sizeof(request), sizeof(response));
+  notecardFields = ",\"value\":4.21";
+  transact("i2c after overflow", sizeof(request), sizeof(response));
+  NoteSetFnSerial(notecardSerialReset, notecardSerialTransmit, notecardSerialAvailable, notecardSerialReceive);
+  transact("serial", sizeof(request), sizeof(response));
+  transact("serial", sizeof(request), sizeof(response));
+  const bool serialCrcSent = requestCrcValid(notecardLastRequest);
+
+   // Assert
+  ///////////
+  const std::string i2cExpected = "{\"seq\":" + std::to_string(i2cSeqNo) + ",\"value\":4.21}";
+  const size_t EXPECTED_ATTEMPTS[] = {1, 2, 0, 1, 1, 1, 1};
+  const bool EXPECTED_OVERFLOW[] = {false, false, true, true, false, false, false};
+  for (size_t i = 0 ; i < outcomes.size() ; ++i) {
+    const Outcome &outcome = outcomes[i];
+    const bool overflow = (outcome.err && NoteErrorContains(outcome.err, "{overflow}"));
+    const bool responseOk = (overflow || (!outcome.err && outcome.response.size() == outcome.responseLen && std::string::npos != outcome.response.find(",\"value\":4.21}")));
+    if (0 != outcome.allocations || !outcome.requestRestored || EXPECTED_OVERFLOW[i] != overflow || !responseOk || EXPECTED_ATTEMPTS[i] != outcome.attempts) {
+      result = static_cast<int>('n' + '_' + 'r' + 'e' + 'q' + 'u' + 'e' + 's' + 't');
+      std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+      std::cout << "\t" << outcome.name << ": err == " << (outcome.err ? outcome.err : "NULL") << ", response == " << outcome.response
+                << " (" << outcome.responseLen << "), attempts == " << outcome.attempts << ", allocations == " << outcome.allocations
+                << ", EXPECTED: overflow == " << EXPECTED_OVERFLOW[i] << ", attempts == " << EXPECTED_ATTEMPTS[i] << ", no allocations" << std::endl;
+      std::cout << "[";
+    }
+  }
+  if (!result && (outcomes[0].response != i2cExpected || !i2cCrcSent || !serialCrcSent || 0 != heapInUse)) {
+    result = static_cast<int>('n' + '_' + 'r' + 'e' + 'q' + 'u' + 'e' + 's' + 't');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tresponse == " << outcomes[0].response << ", EXPECTED: " << i2cExpected << std::endl;
+    std::cout << "\ti2cCrcSent == " << i2cCrcSent << ", serialCrcSent == " << serialCrcSent << ", heapInUse == " << heapInUse << ", EXPECTED: 1, 1, 0" << std::endl;
+    std::cout << "[";
+  }
+
+  NoteSetFn(malloc, free, delayMs, getMs);
+  return result;
+}
+
+int test_n_request_receive_buffer_pool_saves_allocations_and_stays_in_place()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  setUp(NOTE_RETRY_LOCK_HOLD);
+  otherTaskPending = false;
+  const size_t POOL_BYTES = 4096;
+
+   // Action
+  ///////////
+  const SoakResult unpooled = soak(0, false);
+  const SoakResult pooled = soak(POOL_BYTES, true);
+  printSoak("unpooled", unpooled);
+  printSoak("pooled", pooled);
+
+   // Assert
+  ///////////
+  // The pooled buffer never moves, so it leaves no hole of its own, but the
+  // holes left between the parsed responses are no fewer
+  if (0 == unpooled.failures && 0 == pooled.failures
+   && 0 == unpooled.leaked && 0 == pooled.leaked
+   && pooled.highWater <= (unpooled.highWater + POOL_BYTES)
+   && pooled.largestHole < unpooled.largestHole
+   && pooled.holeBytes < unpooled.holeBytes
+   && pooled.allocations < unpooled.allocations)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'r' + 'e' + 'q' + 'u' + 'e' + 's' + 't');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\tfailures == " << unpooled.failures << ", " << pooled.failures << ", EXPECTED: 0, 0" << std::endl;
+    std::cout << "\tleaked == " << unpooled.leaked << ", " << pooled.leaked << ", EXPECTED: 0, 0" << std::endl;
+    std::cout << "\tpooled.highWater == " << pooled.highWater << ", EXPECTED: <= " << (unpooled.highWater + POOL_BYTES) << std::endl;
+    std::cout << "\tpooled.largestHole == " << pooled.largestHole << ", EXPECTED: < " << unpooled.largestHole << std::endl;
+    std::cout << "\tpooled.holeBytes == " << pooled.holeBytes << ", EXPECTED: < " << unpooled.holeBytes << std::endl;
+    std::cout << "\tpooled.allocations == " << pooled.allocations << ", EXPECTED: < " << unpooled.allocations << std::endl;
+    std::cout << "[";
+  }
+
+  return result;
+}
+
+int test_n_request_context_swap_keeps_each_notecards_state()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  setUp(NOTE_RETRY_LOCK_HOLD);
+  otherTaskPending = false;
+  notecardFailNextA = false;
+  NoteI2CPacing learned = {};
+  learned.level = 3;
+  learned.floor = 2;
+
+  // The first Notecard, on I2C, with its own pacing, bus sharing and cache
+  NoteContextRestore(nullptr);
+  NoteSetFnI2C(NOTE_I2C_ADDR_DEFAULT, NOTE_I2C_MAX_DEFAULT, notecardReset, notecardTransmit, notecardReceive);
+  NoteSetI2CPacingAdaptive(true, &learned);
+  NoteSetI2CBusSharing(true);
+  NoteSetResponseCache(4, 1024);
+  JDelete(NoteRequestResponse(NoteNewRequest("card.warm")));
+  JDelete(NoteRequestResponse(NoteNewRequest("card.warm")));
+  const long hubA = seqOf(NoteNewRequest("hub.get"));
+  NoteContext cardA;
+  NoteContextSave(&cardA);
+
+   // Action
+  ///////////
+  // The second Notecard, on Serial, starts from a fresh state
+  NoteContextRestore(nullptr);
+  NoteSetFnSerial(notecardSerialReset, notecardSerialTransmit, notecardSerialAvailable, notecardSerialReceive);
+  NoteI2CPacing pacingB;
+  const bool adaptiveB = NoteGetI2CPacing(&pacingB);
+  const bool sharingB = NoteGetI2CBusSharing();
+  NoteSetResponseCache(4, 1024);
+  const size_t attemptsBeforeB = attempts.size();
+  const long hubB = seqOf(NoteNewRequest("hub.get"));
+  const size_t attemptsByB = (attempts.size() - attemptsBeforeB);
+  NoteContext cardB;
+  NoteContextSave(&cardB);
+
+  // Back to the first Notecard, which resumes where it left off
+  NoteContextRestore(&cardA);
+  const size_t attemptsBeforeA = attempts.size();
+  const long hubACached = seqOf(NoteNewRequest("hub.get"));
+  const long tempA = seqOf(NoteNewRequest("card.temp"));
+  const size_t attemptsByA = (attempts.size() - attemptsBeforeA);
+  NoteI2CPacing pacingA;
+  const bool adaptiveA = NoteGetI2CPacing(&pacingA);
+  const bool sharingA = NoteGetI2CBusSharing();
+  NoteResponseCacheStats statsA;
+  NoteGetResponseCacheStats(&statsA);
+
+   // Assert
+  ///////////
+  if (hubA >= 2 && hubB >= 0 && hubB < hubA
+   && attemptsByB >= 1
+   && !adaptiveB && !sharingB
+   && hubACached == hubA
+   && tempA == (hubA + 1)
+   && 1 == attemptsByA
+   && adaptiveA && sharingA
+   && learned.floor == pacingA.floor
+   && 1 == statsA.hits
+   && !noteLockDepth
+   && !noteLockUnbalanced)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'r' + 'e' + 'q' + 'u' + 'e' + 's' + 't');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\thub.get on A == " << hubA << ", then " << hubACached << ", card.temp on A == " << tempA << ", EXPECTED: N >= 2, N, N + 1" << std::endl;
+    std::cout << "\thub.get on B == " << hubB << " in " << attemptsByB << " attempts, EXPECTED: below N, sent to the Notecard" << std::endl;
+    std::cout << "\tattempts by A after the swap == " << attemptsByA << ", cache hits == " << statsA.hits << ", EXPECTED: 1, 1" << std::endl;
+    std::cout << "\tadaptive pacing == " << adaptiveA << " (floor " << static_cast<int>(pacingA.floor) << ") on A, " << adaptiveB << " on B, EXPECTED: 1 (floor " << static_cast<int>(learned.floor) << "), 0" << std::endl;
+    std::cout << "\tbus sharing == " << sharingA << " on A, " << sharingB << " on B, EXPECTED: 1, 0" << std::endl;
+    printAttempts();
+    std::cout << "[";
+  }
+
+  NoteContextFree(&cardB);
+  NoteSetResponseCache(0, 0);
+  NoteSetI2CPacingAdaptive(false, nullptr);
+  NoteSetI2CBusSharing(false);
+  return result;
+}
+
+#ifdef NOTE_C_METRICS
+int test_n_request_metrics_time_every_phase_and_count_every_event()
+{
+  int result = 0;
+
+   // Arrange
+  ////////////
+  setUp(NOTE_RETRY_LOCK_HOLD);
+  otherTaskPending = false;
+  JDelete(NoteRequestResponse(NoteNewRequest("card.warm")));
+  NoteResetMetrics();
+  notecardBytesIn = 0;
+  notecardBytesOut = 0;
+
+   // Action
+  ///////////
+  // The first attempt of card.a fails with an I/O error, and that of card.c
+  // with a CRC error, so each is sent twice
+  J *rsp = NoteRequestResponse(NoteNewRequest("card.a"));
+  notecardCorruptNextCrc = true;
+  JDelete(NoteRequestResponse(NoteNewRequest("card.c")));
+
+  NoteTransactionAsync txn;
+  J *asyncReq = NoteNewRequest("card.d");
+  NoteTransactionAsyncBegin(&txn, asyncReq);
+  while (!NoteTransactionAsyncPoll(&txn)) {
+    delayMs(1);
+  }
+  J *asyncRsp = NoteTransactionAsyncEnd(&txn);
+
+  NoteMetrics metrics;
+  NoteGetMetrics(&metrics);
+  const size_t bytesIn = notecardBytesIn;
+  const size_t bytesOut = notecardBytesOut;
+
+  NoteReset();
+  NoteMetrics afterReset;
+  NoteGetMetrics(&afterReset);
+  NoteResetMetrics();
+  NoteMetrics cleared;
+  NoteGetMetrics(&cleared);
+
+   // Assert
+  ///////////
+  // Every attempt is transmitted, awaited, received and has its CRC checked,
+  // but only the responses with a valid CRC are parsed
+  const uint32_t EXPECTED_COUNTS[NOTE_METRICS_PHASES] = {3, 3, 5, 5, 5, 5, 4};
+  for (size_t phase = 0 ; phase < NOTE_METRICS_PHASES ; ++phase) {
+    const NoteMetricsHistogram &histogram = metrics.phases[phase];
+    uint32_t bucketed = 0;
+    for (size_t bucket = 0 ; bucket < NOTE_METRICS_BUCKETS ; ++bucket) {
+      bucketed += histogram.buckets[bucket];
+    }
+    if (EXPECTED_COUNTS[phase] != histogram.count || bucketed != histogram.count || histogram.maxMs > histogram.totalMs) {
+      result = static_cast<int>('n' + '_' + 'r' + 'e' + 'q' + 'u' + 'e' + 's' + 't');
+      std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+      std::cout << "\tphases[" << phase << "]: count == " << histogram.count << " (" << bucketed << " bucketed), max == " << histogram.maxMs << ", total == " << histogram.totalMs << ", EXPECTED: count == " << EXPECTED_COUNTS[phase] << std::endl;
+      std::cout << "[";
+    }
+  }
+  if (!result
+   && responseHasSeqNo(rsp, attempts[1].seqNo)
+   && asyncRsp && !NoteResponseError(asyncRsp)
+   && 3 == metrics.transactions
+   && 2 == metrics.retries
+   && 1 == metrics.crcErrors
+   && 0 == metrics.resets
+   && 0 == metrics.heartbeats
+   && bytesOut == metrics.bytesOut
+   && bytesIn == metrics.bytesIn
+   && 1 == afterReset.resets
+   && 0 == cleared.transactions && 0 == cleared.bytesIn && 0 == cleared.phases[NOTE_METRICS_PHASE_RECEIVE].count)
+  {
+    result = 0;
+  }
+  else if (!result)
+  {
+    result = static_cast<int>('n' + '_' + 'r' + 'e' + 'q' + 'u' + 'e' + 's' + 't');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    std::cout << "\ttransactions == " << metrics.transactions << ", retries == " << metrics.retries << ", crcErrors == " << metrics.crcErrors
+              << ", resets == " << metrics.resets << " then " << afterReset.resets << ", heartbeats == " << metrics.heartbeats << ", EXPECTED: 3, 2, 1, 0 then 1, 0" << std::endl;
+    std::cout << "\tbytesOut == " << metrics.bytesOut << ", bytesIn == " << metrics.bytesIn << ", EXPECTED: " << bytesOut << ", " << bytesIn << std::endl;
+    printAttempts();
+    std::cout << "[";
+  }
+
+  JDelete(rsp);
+  JDelete(asyncReq);
+  JDelete(asyncRsp);
+  return result;
+}
+#endif
+
+#ifdef NOTE_C_THREAD_CONTEXT
+int test_n_request_thread_contexts_drive_notecards_in_parallel()
+{
+  int result;
+
+   // Arrange
+  ////////////
+  setUp(NOTE_RETRY_LOCK_HOLD);
+  NoteSetFn(malloc, free, realDelayMs, realGetMs);
+  rendezvousArrivals = 0;
+  std::vector<ThreadCard> cards(THREAD_CARDS, ThreadCard{"", "", false, false});
+
+   // Action
+  ///////////
+  const uint32_t startMs = realGetMs();
+  std::vector<std::thread> threads;
+  for (size_t i = 0 ; i < cards.size() ; ++i) {
+    threads.push_back(std::thread(threadCardRun, &cards[i], static_cast<uint16_t>(NOTE_I2C_ADDR_DEFAULT + i)));
+  }
+  for (size_t i = 0 ; i < threads.size() ; ++i) {
+    threads[i].join();
+  }
+  const uint32_t elapsedMs = (realGetMs() - startMs);
+
+   // Assert
+  ///////////
+  bool allMet = true;
+  for (size_t i = 0 ; i < cards.size() ; ++i) {
+    allMet = (allMet && cards[i].rendezvous && cards[i].transacted);
+  }
+  if (allMet
+   && elapsedMs < RENDEZVOUS_TIMEOUT_MS
+   && !noteLockDepth
+   && !noteLockUnbalanced)
+  {
+    result = 0;
+  }
+  else
+  {
+    result = static_cast<int>('n' + '_' + 'r' + 'e' + 'q' + 'u' + 'e' + 's' + 't');
+    std::cout << "\33[31mFAILED\33[0m] " << __FILE__ << ":" << __LINE__ << std::endl;
+    for (size_t i = 0 ; i < cards.size() ; ++i) {
+      std::cout << "\tNotecard " << i << ": met the others == " << cards[i].rendezvous << ", transacted == " << cards[i].transacted << ", EXPECTED: 1, 1" << std::endl;
+    }
+    std::cout << "\telapsed == " << elapsedMs << " ms, EXPECTED: < " << RENDEZVOUS_TIMEOUT_MS << " ms" << std::endl;
+    std::cout << "[";
+  }
+
+  NoteSetFn(malloc, free, delayMs, getMs);
+  return result;
+}
+#endif
+
+int main(void)
+{
+  TestFunction tests[] = {
+      {test_n_request_retry_lock_hold_blocks_other_tasks_for_every_retry, "test_n_request_retry_lock_hold_blocks_other_tasks_for_every_retry"},
+      {test_n_request_retry_lock_yield_lets_other_tasks_transact_after_an_undelivered_attempt, "test_n_request_retry_lock_yield_lets_other_tasks_transact_after_an_undelivered_attempt"},
+      {test_n_request_retry_lock_yield_keeps_the_callers_buffer_from_other_tasks, "test_n_request_retry_lock_yield_keeps_the_callers_buffer_from_other_tasks"},
+      {test_n_request_retry_lock_yield_holds_the_lock_after_an_attempt_that_reached_the_notecard, "test_n_request_retry_lock_yield_holds_the_lock_after_an_attempt_that_reached_the_notecard"},
+      {test_n_request_retry_lock_yield_releases_the_lock_during_a_non_blocking_backoff, "test_n_request_retry_lock_yield_releases_the_lock_during_a_non_blocking_backoff"},
+      {test_n_request_serializes_the_request_and_its_crc_into_a_single_buffer, "test_n_request_serializes_the_request_and_its_crc_into_a_single_buffer"},
+      {test_n_request_streamed_response_matches_the_buffered_response_without_holding_its_text, "test_n_request_streamed_response_matches_the_buffered_response_without_holding_its_text"},
+      {test_n_request_streamed_response_with_a_crc_error_is_retried, "test_n_request_streamed_response_with_a_crc_error_is_retried"},
+      {test_n_request_streamed_error_response_is_retried_without_a_crc_error, "test_n_request_streamed_error_response_is_retried_without_a_crc_error"},
+      {test_n_request_helpers_read_their_fields_without_parsing_the_response, "test_n_request_helpers_read_their_fields_without_parsing_the_response"},
+      {test_n_request_helper_response_with_a_crc_error_is_retried, "test_n_request_helper_response_with_a_crc_error_is_retried"},
+      {test_n_request_response_is_read_only_up_to_its_length, "test_n_request_response_is_read_only_up_to_its_length"},
+      {test_n_request_template_sends_what_the_j_path_sends, "test_n_request_template_sends_what_the_j_path_sends"},
+      {test_n_request_template_allocates_less_than_building_each_request, "test_n_request_template_allocates_less_than_building_each_request"},
+      {test_n_request_retry_policy_backs_off_exponentially_within_its_jitter, "test_n_request_retry_policy_backs_off_exponentially_within_its_jitter"},
+      {test_n_request_retry_deadline_spans_both_retry_layers, "test_n_request_retry_deadline_spans_both_retry_layers"},
+      {test_n_request_retry_policies_recover_from_injected_faults, "test_n_request_retry_policies_recover_from_injected_faults"},
+      {test_n_request_batch_until_error_stops_at_a_failed_request, "test_n_request_batch_until_error_stops_at_a_failed_request"},
+      {test_n_request_cache_answers_repeated_queries_until_their_ttl_expires, "test_n_request_cache_answers_repeated_queries_until_their_ttl_expires"},
+      {test_n_request_cache_does_not_store_a_response_made_stale_by_another_task, "test_n_request_cache_does_not_store_a_response_made_stale_by_another_task"},
+      {test_n_request_cache_is_invalidated_by_writes_and_bounded, "test_n_request_cache_is_invalidated_by_writes_and_bounded"},
+      {test_n_request_cache_is_invalidated_by_every_request_path_and_keyed_by_content, "test_n_request_cache_is_invalidated_by_every_request_path_and_keyed_by_content"},
+      {test_n_request_response_wait_hook_sleeps_until_the_response_instead_of_polling, "test_n_request_response_wait_hook_sleeps_until_the_response_instead_of_polling"},
+      {test_n_request_serial_flow_control_never_overruns_the_notecard, "test_n_request_serial_flow_control_never_overruns_the_notecard"},
+      {test_n_request_serial_fast_resync_ends_the_drain_early_only_on_a_clean_line, "test_n_request_serial_fast_resync_ends_the_drain_early_only_on_a_clean_line"},
+      {test_n_request_caller_buffers_transact_without_the_heap, "test_n_request_caller_buffers_transact_without_the_heap"},
+      {test_n_request_receive_buffer_pool_saves_allocations_and_stays_in_place, "test_n_request_receive_buffer_pool_saves_allocations_and_stays_in_place"},
+      {test_n_request_context_swap_keeps_each_notecards_state, "test_n_request_context_swap_keeps_each_notecards_state"},
+#ifdef NOTE_C_METRICS
+      {test_n_request_metrics_time_every_phase_and_count_every_event, "test_n_request_metrics_time_every_phase_and_count_every_event"},
+#endif
+#ifdef NOTE_C_THREAD_CONTEXT
+      {test_n_request_thread_contexts_drive_notecards_in_parallel, "test_n_request_thread_contexts_drive_notecards_in_parallel"},
+#endif
+  };
+
+  return TestFunction::runTests(tests, (sizeof(tests) / sizeof(TestFunction)));
+}
@@ -19,6 +19,7 @@ if [ 0 -eq $all_tests_result ]; then
   echo && echo -e "${YELLOW}Compiling and running Notecard Test Suite...${DEFAULT}"
   g++ -fprofile-arcs -ftest-coverage -Wall -Wextra -Werror -Wpedantic -Wno-deprecated-declarations -std=c++11 -O0 -g \
     src/Notecard.cpp \
+    src/NoteRing.cpp \
     test/Notecard.test.cpp \
     test/mock/mock-arduino.cpp \
     test/mock/mock-note-c-note.c \
@@ -45,6 +46,38 @@ if [ 0 -eq $all_tests_result ]; then
   fi
 fi
 
+if [ 0 -eq $all_tests_result ]; then
+  echo && echo -e "${YELLOW}Compiling and running Notecard Test Suite (NOTE_C_METRICS)...${DEFAULT}"
+  g++ -fprofile-arcs -ftest-coverage -Wall -Wextra -Werror -Wpedantic -Wno-deprecated-declarations -std=c++11 -O0 -g \
+    src/Notecard.cpp \
+    src/NoteRing.cpp \
+    test/Notecard.test.cpp \
+    test/mock/mock-arduino.cpp \
+    test/mock/mock-note-c-note.c \
+    test/mock/NoteI2c_Mock.cpp \
+    test/mock/NoteLog_Mock.cpp \
+    test/mock/NoteSerial_Mock.cpp \
+    test/mock/NoteTime_Mock.cpp \
+    test/mock/NoteTxn_Mock.cpp \
+    -Isrc \
+    -Itest \
+    -DNOTE_MOCK \
+    -DNOTE_C_METRICS \
+    -o failed_test_run
+  if [ 0 -eq $? ]; then
+    valgrind --leak-check=full --error-exitcode=66 ./failed_test_run
+    tests_result=$?
+    if [ 0 -eq ${tests_result} ]; then
+      echo -e "${GREEN}Notecard tests (NOTE_C_METRICS) passed!${DEFAULT}"
+    else
+      echo -e "${RED}Notecard tests (NOTE_C_METRICS) failed!${DEFAULT}"
+    fi
+    all_tests_result=$((all_tests_result+tests_result))
+  else
+    all_tests_result=999
+  fi
+fi
+
 if [ 0 -eq $all_tests_result ]; then
   echo && echo -e "${YELLOW}Compiling and running NoteI2c_Arduino Test Suite (no flags)...${DEFAULT}"
   g++ -fprofile-arcs -ftest-coverage -Wall -Wextra -Werror -Wpedantic -Wno-deprecated-declarations -std=c++11 -O0 -g \
@@ -120,6 +153,28 @@ if [ 0 -eq $all_tests_result ]; then
   fi
 fi
 
+if [ 0 -eq $all_tests_result ]; then
+  echo && echo -e "${YELLOW}Compiling and running NoteRing Test Suite...${DEFAULT}"
+  g++ -fprofile-arcs -ftest-coverage -Wall -Wextra -Werror -Wpedantic -Wno-deprecated-declarations -std=c++11 -O0 -g -pthread \
+    src/NoteRing.cpp \
+    test/NoteRing.test.cpp \
+    -Isrc \
+    -Itest \
+    -o failed_test_run
+  if [ 0 -eq $? ]; then
+    valgrind --leak-check=full --error-exitcode=66 ./failed_test_run
+    tests_result=$?
+    if [ 0 -eq ${tests_result} ]; then
+      echo -e "${GREEN}NoteRing tests passed!${DEFAULT}"
+    else
+      echo -e "${RED}NoteRing tests failed!${DEFAULT}"
+    fi
+    all_tests_result=$((all_tests_result+tests_result))
+  else
+    all_tests_result=999
+  fi
+fi
+
 if [ 0 -eq $all_tests_result ]; then
   echo && echo -e "${YELLOW}Compiling and running NoteSerial_Arduino Test Suite...${DEFAULT}"
   g++ -fprofile-arcs -ftest-coverage -Wall -Wextra -Werror -Wpedantic -Wno-deprecated-declarations -std=c++11 -O0 -g \
@@ -170,6 +225,291 @@ if [ 0 -eq $all_tests_result ]; then
   fi
 fi
 
+if [ 0 -eq $all_tests_result ]; then
+  echo && echo -e "${YELLOW}Compiling and running note-c Request Queue Test Suite...${DEFAULT}"
+  g++ -fprofile-arcs -ftest-coverage -Wall -Wextra -Werror -Wpedantic -Wno-deprecated-declarations -std=c++11 -O0 -g -pthread \
+    src/note-c/n_queue.c \
+    test/n_queue.test.cpp \
+    test/mock/mock-note-c-note.c \
+    -Isrc \
+    -Isrc/note-c \
+    -Itest \
+    -DNOTE_MOCK \
+    -o failed_test_run
+  if [ 0 -eq $? ]; then
+    valgrind --leak-check=full --error-exitcode=66 ./failed_test_run
+    tests_result=$?
+    if [ 0 -eq ${tests_result} ]; then
+      echo -e "${GREEN}note-c Request Queue tests passed!${DEFAULT}"
+    else
+      echo -e "${RED}note-c Request Queue tests failed!${DEFAULT}"
+    fi
+    all_tests_result=$((all_tests_result+tests_result))
+  else
+    all_tests_result=999
+  fi
+fi
+
+if [ 0 -eq $all_tests_result ]; then
+  echo && echo -e "${YELLOW}Compiling and running note-c CRC Test Suite...${DEFAULT}"
+  gcc -Wall -Wextra -Werror -Wpedantic -O0 -g -c \
+    src/note-c/*.c \
+    -Isrc/note-c
+  if [ 0 -eq $? ]; then
+    g++ -fprofile-arcs -ftest-coverage -Wall -Wextra -Werror -Wpedantic -Wno-deprecated-declarations -std=c++11 -O0 -g \
+      n_*.o \
+      test/n_crc.test.cpp \
+      -Isrc/note-c \
+      -Itest \
+      -o failed_test_run
+  fi
+  if [ 0 -eq $? ]; then
+    valgrind --leak-check=full --error-exitcode=66 ./failed_test_run
+    tests_result=$?
+    if [ 0 -eq ${tests_result} ]; then
+      echo -e "${GREEN}note-c CRC tests passed!${DEFAULT}"
+    else
+      echo -e "${RED}note-c CRC tests failed!${DEFAULT}"
+    fi
+    all_tests_result=$((all_tests_result+tests_result))
+  else
+    all_tests_result=999
+  fi
+  rm -f n_*.o
+fi
+
+if [ 0 -eq $all_tests_result ]; then
+  echo && echo -e "${YELLOW}Compiling and running note-c CRC Test Suite (NOTE_C_CRC32_SLICE_BY_4)...${DEFAULT}"
+  gcc -Wall -Wextra -Werror -Wpedantic -O0 -g -c \
+    src/note-c/*.c \
+    -Isrc/note-c \
+    -DNOTE_C_CRC32_SLICE_BY_4
+  if [ 0 -eq $? ]; then
+    g++ -fprofile-arcs -ftest-coverage -Wall -Wextra -Werror -Wpedantic -Wno-deprecated-declarations -std=c++11 -O0 -g \
+      n_*.o \
+      test/n_crc.test.cpp \
+      -Isrc/note-c \
+      -Itest \
+      -DNOTE_C_CRC32_SLICE_BY_4 \
+      -o failed_test_run
+  fi
+  if [ 0 -eq $? ]; then
+    valgrind --leak-check=full --error-exitcode=66 ./failed_test_run
+    tests_result=$?
+    if [ 0 -eq ${tests_result} ]; then
+      echo -e "${GREEN}note-c CRC tests (NOTE_C_CRC32_SLICE_BY_4) passed!${DEFAULT}"
+    else
+      echo -e "${RED}note-c CRC tests (NOTE_C_CRC32_SLICE_BY_4) failed!${DEFAULT}"
+    fi
+    all_tests_result=$((all_tests_result+tests_result))
+  else
+    all_tests_result=999
+  fi
+  rm -f n_*.o
+fi
+
+if [ 0 -eq $all_tests_result ]; then
+  echo && echo -e "${YELLOW}Compiling and running note-c CRC Test Suite (NOTE_C_CRC32_SLICE_BY_8)...${DEFAULT}"
+  gcc -Wall -Wextra -Werror -Wpedantic -O0 -g -c \
+    src/note-c/*.c \
+    -Isrc/note-c \
+    -DNOTE_C_CRC32_SLICE_BY_8
+  if [ 0 -eq $? ]; then
+    g++ -fprofile-arcs -ftest-coverage -Wall -Wextra -Werror -Wpedantic -Wno-deprecated-declarations -std=c++11 -O0 -g \
+      n_*.o \
+      test/n_crc.test.cpp \
+      -Isrc/note-c \
+      -Itest \
+      -DNOTE_C_CRC32_SLICE_BY_8 \
+      -o failed_test_run
+  fi
+  if [ 0 -eq $? ]; then
+    valgrind --leak-check=full --error-exitcode=66 ./failed_test_run
+    tests_result=$?
+    if [ 0 -eq ${tests_result} ]; then
+      echo -e "${GREEN}note-c CRC tests (NOTE_C_CRC32_SLICE_BY_8) passed!${DEFAULT}"
+    else
+      echo -e "${RED}note-c CRC tests (NOTE_C_CRC32_SLICE_BY_8) failed!${DEFAULT}"
+    fi
+    all_tests_result=$((all_tests_result+tests_result))
+  else
+    all_tests_result=999
+  fi
+  rm -f n_*.o
+fi
+
+if [ 0 -eq $all_tests_result ]; then
+  echo && echo -e "${YELLOW}Compiling and running note-c JSON Stream Test Suite...${DEFAULT}"
+  gcc -Wall -Wextra -Werror -Wpedantic -O0 -g -c \
+    src/note-c/*.c \
+    -Isrc/note-c
+  if [ 0 -eq $? ]; then
+    g++ -fprofile-arcs -ftest-coverage -Wall -Wextra -Werror -Wpedantic -Wno-deprecated-declarations -std=c++11 -O0 -g \
+      n_*.o \
+      test/n_jstream.test.cpp \
+      -Isrc/note-c \
+      -Itest \
+      -o failed_test_run
+  fi
+  if [ 0 -eq $? ]; then
+    valgrind --leak-check=full --error-exitcode=66 ./failed_test_run
+    tests_result=$?
+    if [ 0 -eq ${tests_result} ]; then
+      echo -e "${GREEN}note-c JSON Stream tests passed!${DEFAULT}"
+    else
+      echo -e "${RED}note-c JSON Stream tests failed!${DEFAULT}"
+    fi
+    all_tests_result=$((all_tests_result+tests_result))
+  else
+    all_tests_result=999
+  fi
+  rm -f n_*.o
+fi
+
+if [ 0 -eq $all_tests_result ]; then
+  echo && echo -e "${YELLOW}Compiling and running note-c JSON Helpers Test Suite...${DEFAULT}"
+  gcc -Wall -Wextra -Werror -Wpedantic -O0 -g -c \
+    src/note-c/*.c \
+    -Isrc/note-c
+  if [ 0 -eq $? ]; then
+    g++ -fprofile-arcs -ftest-coverage -Wall -Wextra -Werror -Wpedantic -Wno-deprecated-declarations -std=c++11 -O0 -g \
+      n_*.o \
+      test/n_cjson_helpers.test.cpp \
+      -Isrc/note-c \
+      -Itest \
+      -o failed_test_run
+  fi
+  if [ 0 -eq $? ]; then
+    valgrind --leak-check=full --error-exitcode=66 ./failed_test_run
+    tests_result=$?
+    if [ 0 -eq ${tests_result} ]; then
+      echo -e "${GREEN}note-c JSON Helpers tests passed!${DEFAULT}"
+    else
+      echo -e "${RED}note-c JSON Helpers tests failed!${DEFAULT}"
+    fi
+    all_tests_result=$((all_tests_result+tests_result))
+  else
+    all_tests_result=999
+  fi
+  rm -f n_*.o
+fi
+
+if [ 0 -eq $all_tests_result ]; then
+  echo && echo -e "${YELLOW}Compiling and running note-c I2C Test Suite...${DEFAULT}"
+  gcc -Wall -Wextra -Werror -Wpedantic -O0 -g -c \
+    src/note-c/*.c \
+    -Isrc/note-c
+  if [ 0 -eq $? ]; then
+    g++ -fprofile-arcs -ftest-coverage -Wall -Wextra -Werror -Wpedantic -Wno-deprecated-declarations -std=c++11 -O0 -g \
+      n_*.o \
+      test/n_i2c.test.cpp \
+      -Isrc/note-c \
+      -Itest \
+      -o failed_test_run
+  fi
+  if [ 0 -eq $? ]; then
+    valgrind --leak-check=full --error-exitcode=66 ./failed_test_run
+    tests_result=$?
+    if [ 0 -eq ${tests_result} ]; then
+      echo -e "${GREEN}note-c I2C tests passed!${DEFAULT}"
+    else
+      echo -e "${RED}note-c I2C tests failed!${DEFAULT}"
+    fi
+    all_tests_result=$((all_tests_result+tests_result))
+  else
+    all_tests_result=999
+  fi
+  rm -f n_*.o
+fi
+
+if [ 0 -eq $all_tests_result ]; then
+  echo && echo -e "${YELLOW}Compiling and running note-c Request Test Suite...${DEFAULT}"
+  gcc -Wall -Wextra -Werror -Wpedantic -O0 -g -c \
+    src/note-c/*.c \
+    -Isrc/note-c
+  if [ 0 -eq $? ]; then
+    g++ -fprofile-arcs -ftest-coverage -Wall -Wextra -Werror -Wpedantic -Wno-deprecated-declarations -std=c++11 -O0 -g \
+      n_*.o \
+      test/n_request.test.cpp \
+      -Isrc/note-c \
+      -Itest \
+      -o failed_test_run
+  fi
+  if [ 0 -eq $? ]; then
+    valgrind --leak-check=full --error-exitcode=66 ./failed_test_run
+    tests_result=$?
+    if [ 0 -eq ${tests_result} ]; then
+      echo -e "${GREEN}note-c Request tests passed!${DEFAULT}"
+    else
+      echo -e "${RED}note-c Request tests failed!${DEFAULT}"
+    fi
+    all_tests_result=$((all_tests_result+tests_result))
+  else
+    all_tests_result=999
+  fi
+  rm -f n_*.o
+fi
+
+if [ 0 -eq $all_tests_result ]; then
+  echo && echo -e "${YELLOW}Compiling and running note-c Request Test Suite (NOTE_C_METRICS)...${DEFAULT}"
+  gcc -Wall -Wextra -Werror -Wpedantic -O0 -g -c \
+    src/note-c/*.c \
+    -Isrc/note-c \
+    -DNOTE_C_METRICS
+  if [ 0 -eq $? ]; then
+    g++ -fprofile-arcs -ftest-coverage -Wall -Wextra -Werror -Wpedantic -Wno-deprecated-declarations -std=c++11 -O0 -g \
+      n_*.o \
+      test/n_request.test.cpp \
+      -Isrc/note-c \
+      -Itest \
+      -DNOTE_C_METRICS \
+      -o failed_test_run
+  fi
+  if [ 0 -eq $? ]; then
+    valgrind --leak-check=full --error-exitcode=66 ./failed_test_run
+    tests_result=$?
+    if [ 0 -eq ${tests_result} ]; then
+      echo -e "${GREEN}note-c Request tests (NOTE_C_METRICS) passed!${DEFAULT}"
+    else
+      echo -e "${RED}note-c Request tests (NOTE_C_METRICS) failed!${DEFAULT}"
+    fi
+    all_tests_result=$((all_tests_result+tests_result))
+  else
+    all_tests_result=999
+  fi
+  rm -f n_*.o
+fi
+
+if [ 0 -eq $all_tests_result ]; then
+  echo && echo -e "${YELLOW}Compiling and running note-c Request Test Suite (NOTE_C_THREAD_CONTEXT)...${DEFAULT}"
+  gcc -Wall -Wextra -Werror -Wpedantic -O0 -g -c \
+    src/note-c/*.c \
+    -Isrc/note-c \
+    -DNOTE_C_THREAD_CONTEXT
+  if [ 0 -eq $? ]; then
+    g++ -fprofile-arcs -ftest-coverage -Wall -Wextra -Werror -Wpedantic -Wno-deprecated-declarations -std=c++11 -O0 -g -pthread \
+      n_*.o \
+      test/n_request.test.cpp \
+      -Isrc/note-c \
+      -Itest \
+      -DNOTE_C_THREAD_CONTEXT \
+      -o failed_test_run
+  fi
+  if [ 0 -eq $? ]; then
+    valgrind --leak-check=full --error-exitcode=66 ./failed_test_run
+    tests_result=$?
+    if [ 0 -eq ${tests_result} ]; then
+      echo -e "${GREEN}note-c Request tests (NOTE_C_THREAD_CONTEXT) passed!${DEFAULT}"
+    else
+      echo -e "${RED}note-c Request tests (NOTE_C_THREAD_CONTEXT) failed!${DEFAULT}"
+    fi
+    all_tests_result=$((all_tests_result+tests_result))
+  else
+    all_tests_result=999
+  fi
+  rm -f n_*.o
+fi
+
 # Print summary statement
 if [ 0 -eq ${all_tests_result} ]; then
   echo && echo -e "${GREEN}All tests have passed!${DEFAULT}" && echo